@@ -249,6 +249,23 @@ void ambi_bin_setUseDefaultHRIRsflag(void* const hAmbi, int newState);
  */
 void ambi_bin_setSofaFilePath(void* const hAmbi, const char* path);
 
+/**
+ * Sets the directory of an on-disk decoder cache (set to NULL to disable)
+ *
+ * When enabled, the binaural decoding matrices are stored in this directory,
+ * keyed by a hash of the (pre-processed) HRTFs, their directions, the
+ * frequency vector, the decoding order and the decoding method/options. Any
+ * instance (including this one) which later requires the same decoding matrix
+ * will then load it from the cache, rather than computing it again.
+ *
+ * @note The directory must already exist. The cache is used from the next
+ *       (re)initialisation onwards.
+ *
+ * @param[in] hAmbi ambi_bin handle
+ * @param[in] path  Path of the cache directory
+ */
+void ambi_bin_setDecoderCacheDir(void* const hAmbi, const char* path);
+
 /**
  * Sets the decoding order (see #SH_ORDERS enum)
  *
@@ -290,6 +307,18 @@ void ambi_bin_setEnableTruncationEQ(void* const hAmbi, int newState);
 /** Sets HRIR pre-processing strategy (see #AMBI_BIN_PREPROC enum) */
 void ambi_bin_setHRIRsPreProc(void* const hAmbi, AMBI_BIN_PREPROC newType);
 
+/**
+ * Sets the flag to apply the decoder in the time-domain (1), rather than in the
+ * time-frequency domain (0)
+ *
+ * When enabled, the frequency-dependent decoding matrices are converted into a
+ * matrix of FIR filters, which are then applied to the input signals using
+ * partitioned convolution. This bypasses the filterbank, and therefore has a
+ * much lower processing delay (see ambi_bin_getProcessingDelayEx()). It is also
+ * typically cheaper, since there are only 2 output channels.
+ */
+void ambi_bin_setEnableFIRdecoding(void* const hAmbi, int newState);
+
 /** Sets the flag to enable/disable (1 or 0) sound-field rotation */
 void ambi_bin_setEnableRotation(void* const hAmbi, int newState);
 
@@ -377,6 +406,11 @@ AMBI_BIN_DECODING_METHODS ambi_bin_getDecodingMethod(void* const hAmbi);
  */
 char* ambi_bin_getSofaFilePath(void* const hAmbi);
 
+/**
+ * Returns the directory of the on-disk decoder cache (NULL if disabled)
+ */
+char* ambi_bin_getDecoderCacheDir(void* const hAmbi);
+
 /**
  * Returns the Ambisonic channel ordering convention currently being used to
  * decode with, which should match the convention employed by the input signals
@@ -424,6 +458,12 @@ int ambi_bin_getEnableTruncationEQ(void* const hAmbi);
  */
 AMBI_BIN_PREPROC ambi_bin_getHRIRsPreProc(void* const hAmbi);
 
+/**
+ * Returns the flag value which dictates whether the decoder is applied in the
+ * time-domain via FIR filters ('1'), or in the time-frequency domain ('0')
+ */
+int ambi_bin_getEnableFIRdecoding(void* const hAmbi);
+
 /**
  * Returns the flag value which dictates whether to enable/disable sound-field
  * rotation ('0' disabled, '1' enabled).
@@ -478,9 +518,19 @@ int ambi_bin_getDAWsamplerate(void* const hAmbi);
 /**
  * Returns the processing delay in samples (may be used for delay compensation
  * features)
+ *
+ * @note This is the delay of the default (filterbank) decoding. Use
+ *       ambi_bin_getProcessingDelayEx() to also account for FIR decoding
  */
 int ambi_bin_getProcessingDelay(void);
 
+/**
+ * Returns the processing delay in samples of the current configuration; i.e.
+ * the lower delay when FIR decoding is enabled (see
+ * ambi_bin_setEnableFIRdecoding())
+ */
+int ambi_bin_getProcessingDelayEx(void* const hAmbi);
+
     
 #ifdef __cplusplus
 } /* extern "C" { */
@@ -245,6 +245,27 @@ void ambi_dec_setNumLoudspeakers(void* const hAmbi, int new_nLoudspeakers);
  */
 void ambi_dec_setBinauraliseLSflag(void* const hAmbi, int newState);
 
+/**
+ * Sets the flag to apply the decoder in the time-domain (1), rather than in the
+ * time-frequency domain (0)
+ *
+ * When enabled, the frequency-dependent decoding matrices (with the HRTFs baked
+ * in, if the loudspeaker signals are binauralised) are converted into a matrix
+ * of FIR filters, which are then applied to the input signals using
+ * partitioned convolution. This bypasses the filterbank, and therefore has a
+ * much lower processing delay (see ambi_dec_getProcessingDelayEx()). It is also
+ * typically cheaper for binaural output, although the FIRs then only
+ * approximate the binaural response of the time-frequency domain decoder.
+ *
+ * @note Changing any of the frequency-dependent decoding parameters (e.g. the
+ *       decoding order per band or the transition frequency) requires the
+ *       FIRs to be redesigned, which is done during the next initCodec() call.
+ *
+ * @param[in] hAmbi    ambi_dec handle
+ * @param[in] newState '0' time-frequency domain, '1' time-domain (FIRs)
+ */
+void ambi_dec_setEnableFIRdecoding(void* const hAmbi, int newState);
+
 /**
  * Sets flag to dictate whether the default HRIRs in the Spatial_Audio_Framework
  * should be used (1), or a custom HRIR set loaded via a SOFA file (0).
@@ -271,6 +292,24 @@ void ambi_dec_setUseDefaultHRIRsflag(void* const hAmbi, int newState);
  */
 void ambi_dec_setSofaFilePath(void* const hAmbi, const char* path);
 
+/**
+ * Sets the directory of an on-disk decoder cache (set to NULL to disable)
+ *
+ * When enabled, the loudspeaker decoding matrices are stored in this
+ * directory, keyed by a hash of the loudspeaker directions, decoding order and
+ * decoding method. Any instance (including this one) which later requires the
+ * same decoding matrix will then load it from the cache, rather than
+ * computing it again. This is useful when many instances with the same
+ * configuration are started at once.
+ *
+ * @note The directory must already exist. The cache is used from the next
+ *       (re)initialisation onwards.
+ *
+ * @param[in] hAmbi ambi_dec handle
+ * @param[in] path  Path of the cache directory
+ */
+void ambi_dec_setDecoderCacheDir(void* const hAmbi, const char* path);
+
 /** Enable (1) or disable (0) the pre-processing applied to the HRTFs. */
 void ambi_dec_setEnableHRIRsPreProc(void* const hAmbi, int newState);
 
@@ -433,6 +472,12 @@ int  ambi_dec_getNSHrequired(void* const hAmbi);
  */
 int ambi_dec_getBinauraliseLSflag(void* const hAmbi);
 
+/**
+ * Returns the value of a flag used to dictate whether the decoder is applied
+ * in the time-domain via FIR filters (1), or in the time-frequency domain (0)
+ */
+int ambi_dec_getEnableFIRdecoding(void* const hAmbi);
+
 /**
  * Returns the value of a flag used to dictate whether the default HRIRs in the
  * Spatial_Audio_Framework should be used (1), or a custom HRIR set loaded via a
@@ -452,6 +497,11 @@ int ambi_dec_getUseDefaultHRIRsflag(void* const hAmbi);
  */
 char* ambi_dec_getSofaFilePath(void* const hAmbi);
 
+/**
+ * Returns the directory of the on-disk decoder cache (NULL if disabled)
+ */
+char* ambi_dec_getDecoderCacheDir(void* const hAmbi);
+
 /**
  * Returns the flag indicating whether the pre-processing applied to the HRTFs
  * is enabled (1) or disabled (0)
@@ -516,9 +566,19 @@ int ambi_dec_getDAWsamplerate(void* const hAmbi);
 /**
  * Returns the processing delay in samples; may be used for delay compensation
  * features
+ *
+ * @note This is the delay of the default (filterbank) decoding. Use
+ *       ambi_dec_getProcessingDelayEx() to also account for FIR decoding
  */
 int ambi_dec_getProcessingDelay(void);
 
+/**
+ * Returns the processing delay in samples of the current configuration; i.e.
+ * the lower delay when FIR decoding is enabled (see
+ * ambi_dec_setEnableFIRdecoding())
+ */
+int ambi_dec_getProcessingDelayEx(void* const hAmbi);
+
 
 #ifdef __cplusplus
 } /* extern "C" */
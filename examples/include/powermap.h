@@ -74,6 +74,20 @@ typedef enum {
     
 } POWERMAP_MODES;
 
+/**
+ * Available options for scanning the grid directions
+ */
+typedef enum {
+    POWERMAP_SCAN_FULL = 1,        /**< The activity-map is computed for all of
+                                    *   the grid directions */
+    POWERMAP_SCAN_COARSE_TO_FINE   /**< The activity-map is computed for a
+                                    *   coarse subset of the grid directions,
+                                    *   and then for all directions in the
+                                    *   vicinity of its "nSources" highest
+                                    *   peaks. The remaining directions are
+                                    *   interpolated. */
+} POWERMAP_SCAN_MODES;
+
 
 /* ========================================================================== */
 /*                               Main Functions                               */
@@ -151,6 +165,9 @@ void powermap_refreshSettings(void* const hPm);
 /** Sets the powermap/activity-map approach, (see #POWERMAP_MODES enum) */
 void powermap_setPowermapMode(void* const hPm, int newMode);
 
+/** Sets how the grid directions are scanned (see #POWERMAP_SCAN_MODES enum) */
+void powermap_setScanMode(void* const hPm, int newMode);
+
 /** Sets the maximum input/analysis order (see #SH_ORDERS enum) */
 void powermap_setMasterOrder(void* const hPm,  int newValue);
 
@@ -253,6 +270,11 @@ int powermap_getMasterOrder(void* const hPm);
  */
 int powermap_getPowermapMode(void* const hPm);
 
+/**
+ * Returns how the grid directions are scanned (see #POWERMAP_SCAN_MODES enum)
+ */
+int powermap_getScanMode(void* const hPm);
+
 /** Returns the current sampling rate, in Hz */
 int powermap_getSamplingRate(void* const hPm);
 
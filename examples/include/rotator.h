@@ -49,6 +49,25 @@
 extern "C" {
 #endif /* __cplusplus */
 
+/* ========================================================================== */
+/*                             Presets + Constants                            */
+/* ========================================================================== */
+
+/**
+ * Available methods for interpolating between the previous and new rotation,
+ * whenever the orientation changes
+ */
+typedef enum {
+    ROTATOR_INTERP_CROSSFADE = 1, /**< Linear cross-fade between the signals
+                                   *   rotated by the previous and the new SH
+                                   *   rotation matrices */
+    ROTATOR_INTERP_SLERP          /**< Spherical linear interpolation (slerp)
+                                   *   between the previous and new quaternions,
+                                   *   with the SH rotation matrix recomputed
+                                   *   for every sub-frame */
+}ROTATOR_INTERP_MODES;
+
+
 /* ========================================================================== */
 /*                               Main Functions                               */
 /* ========================================================================== */
@@ -170,6 +189,12 @@ void rotator_setOrder(void* const hRot, int newOrder);
  */
 void rotator_setRPYflag(void* const hRot, int newState);
 
+/**
+ * Sets the method used to interpolate between the previous and new rotations
+ * (see #ROTATOR_INTERP_MODES enum)
+ */
+void rotator_setInterpMode(void* const hRot, int newMode);
+
 
 /* ========================================================================== */
 /*                                Get Functions                               */
@@ -226,6 +251,12 @@ int rotator_getFlipQuaternion(void* const hRot);
  */
 int rotator_getRPYflag(void* const hRot);
 
+/**
+ * Returns the method used to interpolate between the previous and new
+ * rotations (see #ROTATOR_INTERP_MODES enum)
+ */
+int rotator_getInterpMode(void* const hRot);
+
 /**
  * Returns the Ambisonic channel ordering convention currently being used to
  * decode with, which should match the convention employed by the input signals
@@ -77,6 +77,7 @@ void ambi_bin_create
     pData->method = DECODING_METHOD_MAGLS;
     pData->order = pData->new_order = 1;
     pData->nSH =  (pData->order+1)*(pData->order+1);
+    pData->enableFIRdecoding = pData->new_enableFIRdecoding = 0;
     
     /* afSTFT and audio buffers */
     pData->fs = 0;
@@ -85,6 +86,8 @@ void ambi_bin_create
     pData->binFrameTD = (float**)malloc2d(NUM_EARS, AMBI_BIN_FRAME_SIZE, sizeof(float));
     pData->SHframeTF = (float_complex***)malloc3d(HYBRID_BANDS, MAX_NUM_SH_SIGNALS, TIME_SLOTS, sizeof(float_complex));
     pData->binframeTF = (float_complex***)malloc3d(HYBRID_BANDS, NUM_EARS, TIME_SLOTS, sizeof(float_complex));
+    pData->SHFrameTD_rot = (float**)malloc2d(MAX_NUM_SH_SIGNALS, AMBI_BIN_FRAME_SIZE, sizeof(float));
+    pData->hMatrixConv = NULL;
 
     /* codec data */
     pData->progressBar0_1 = 0.0f;
@@ -93,6 +96,7 @@ void ambi_bin_create
     pData->pars = (ambi_bin_codecPars*)malloc1d(sizeof(ambi_bin_codecPars));
     ambi_bin_codecPars* pars = pData->pars;
     pars->sofa_filepath = NULL;
+    pars->decoderCache_dir = NULL;
     pars->hrirs = NULL;
     pars->hrir_dirs_deg = NULL;
     pars->itds_s = NULL;
@@ -127,9 +131,12 @@ void ambi_bin_destroy
         free(pData->binFrameTD);
         free(pData->SHframeTF);
         free(pData->binframeTF);
+        free(pData->SHFrameTD_rot);
+        saf_matrixConv_destroy(&(pData->hMatrixConv));
 
         pars = pData->pars;
         free(pars->sofa_filepath);
+        free(pars->decoderCache_dir);
         free(pars->weights);
         free(pars->hrtf_fb);
         free(pars->itds_s);
@@ -172,6 +179,8 @@ void ambi_bin_initCodec
     ambi_bin_data *pData = (ambi_bin_data*)(hAmbi);
     ambi_bin_codecPars* pars = pData->pars;
     int i, j, nSH, order, band;
+    float* firs, *firs_tmp;
+    unsigned long long cacheKey;
 #ifdef SAF_ENABLE_SOFA_READER_MODULE
     SAF_SOFA_ERROR_CODES error;
     saf_sofa_container sofa;
@@ -245,31 +254,50 @@ void ambi_bin_initCodec
             memcpy(pars->hrir_dirs_deg, (float*)__default_hrir_dirs_deg, pars->N_hrir_dirs*2*sizeof(float));
         }
         
-        /* estimate the ITDs for each HRIR */
-        pData->progressBar0_1 = 0.3f;
+        /* Load the pre-processed HRTFs from the decoder cache, if enabled and the same HRIRs have been processed before */
+        pars->hrtfs_cacheKey = saf_cache_initKey();
+        saf_cache_hashInt(&(pars->hrtfs_cacheKey), SAF_VERSION);
+        saf_cache_hashInt(&(pars->hrtfs_cacheKey), (int)pData->preProc);
+        saf_cache_hashInt(&(pars->hrtfs_cacheKey), pars->N_hrir_dirs);
+        saf_cache_hashInt(&(pars->hrtfs_cacheKey), pars->hrir_len);
+        saf_cache_hashInt(&(pars->hrtfs_cacheKey), pars->hrir_fs);
+        saf_cache_hashData(&(pars->hrtfs_cacheKey), pData->freqVector, HYBRID_BANDS*sizeof(float));
+        saf_cache_hashData(&(pars->hrtfs_cacheKey), pars->hrirs, pars->N_hrir_dirs*NUM_EARS*(pars->hrir_len)*sizeof(float));
+        saf_cache_hashData(&(pars->hrtfs_cacheKey), pars->hrir_dirs_deg, pars->N_hrir_dirs*2*sizeof(float));
         pars->itds_s = realloc1d(pars->itds_s, pars->N_hrir_dirs*sizeof(float));
-        estimateITDs(pars->hrirs, pars->N_hrir_dirs, pars->hrir_len, pars->hrir_fs, pars->itds_s);
- 
-        /* convert hrirs to filterbank coefficients */
-        pData->progressBar0_1 = 0.4f;
         pars->hrtf_fb = realloc1d(pars->hrtf_fb, HYBRID_BANDS * NUM_EARS * (pars->N_hrir_dirs)*sizeof(float_complex));
-        HRIRs2HRTFs_afSTFT(pars->hrirs, pars->N_hrir_dirs, pars->hrir_len, HOP_SIZE, 0, 1, pars->hrtf_fb);
-        /* get integration weights */
-        pData->progressBar0_1 = 0.6f;
-        if(pars->N_hrir_dirs<=1000){
+        if(pars->N_hrir_dirs<=1000)
             pars->weights = realloc1d(pars->weights, pars->N_hrir_dirs*sizeof(float));
-            getVoronoiWeights(pars->hrir_dirs_deg, pars->N_hrir_dirs, 0, pars->weights);
-        }
         else{
             free(pars->weights);
             pars->weights = NULL;
         }
-        /* HRIR pre-processing */
-        pData->progressBar0_1 = 0.75f;
-        diffuseFieldEqualiseHRTFs(pars->N_hrir_dirs, pars->itds_s, pData->freqVector, HYBRID_BANDS, pars->weights,
-                                  pData->preProc == HRIR_PREPROC_EQ    || pData->preProc == HRIR_PREPROC_ALL ? 1 : 0, /* Apply Diffuse-field EQ? */
-                                  pData->preProc == HRIR_PREPROC_PHASE || pData->preProc == HRIR_PREPROC_ALL ? 1 : 0, /* Apply phase simplification EQ? */
-                                  pars->hrtf_fb);
+        if(!(saf_cache_load(pars->decoderCache_dir, "ambi_bin_itds", pars->hrtfs_cacheKey, pars->N_hrir_dirs*sizeof(float), pars->itds_s) &&
+             saf_cache_load(pars->decoderCache_dir, "ambi_bin_hrtfs", pars->hrtfs_cacheKey, HYBRID_BANDS*NUM_EARS*(pars->N_hrir_dirs)*sizeof(float_complex), pars->hrtf_fb) &&
+             (pars->weights==NULL || saf_cache_load(pars->decoderCache_dir, "ambi_bin_weights", pars->hrtfs_cacheKey, pars->N_hrir_dirs*sizeof(float), pars->weights))))
+        {
+            /* estimate the ITDs for each HRIR */
+            pData->progressBar0_1 = 0.3f;
+            estimateITDs(pars->hrirs, pars->N_hrir_dirs, pars->hrir_len, pars->hrir_fs, pars->itds_s);
+
+            /* convert hrirs to filterbank coefficients */
+            pData->progressBar0_1 = 0.4f;
+            HRIRs2HRTFs_afSTFT(pars->hrirs, pars->N_hrir_dirs, pars->hrir_len, HOP_SIZE, 0, 1, pars->hrtf_fb);
+            /* get integration weights */
+            pData->progressBar0_1 = 0.6f;
+            if(pars->weights!=NULL)
+                getVoronoiWeights(pars->hrir_dirs_deg, pars->N_hrir_dirs, 0, pars->weights);
+            /* HRIR pre-processing */
+            pData->progressBar0_1 = 0.75f;
+            diffuseFieldEqualiseHRTFs(pars->N_hrir_dirs, pars->itds_s, pData->freqVector, HYBRID_BANDS, pars->weights,
+                                      pData->preProc == HRIR_PREPROC_EQ    || pData->preProc == HRIR_PREPROC_ALL ? 1 : 0, /* Apply Diffuse-field EQ? */
+                                      pData->preProc == HRIR_PREPROC_PHASE || pData->preProc == HRIR_PREPROC_ALL ? 1 : 0, /* Apply phase simplification EQ? */
+                                      pars->hrtf_fb);
+            saf_cache_store(pars->decoderCache_dir, "ambi_bin_itds", pars->hrtfs_cacheKey, pars->itds_s, pars->N_hrir_dirs*sizeof(float));
+            saf_cache_store(pars->decoderCache_dir, "ambi_bin_hrtfs", pars->hrtfs_cacheKey, pars->hrtf_fb, HYBRID_BANDS*NUM_EARS*(pars->N_hrir_dirs)*sizeof(float_complex));
+            if(pars->weights!=NULL)
+                saf_cache_store(pars->decoderCache_dir, "ambi_bin_weights", pars->hrtfs_cacheKey, pars->weights, pars->N_hrir_dirs*sizeof(float));
+        }
         pData->reinit_hrtfsFLAG = 0;
     }
     
@@ -278,33 +306,43 @@ void ambi_bin_initCodec
     pData->progressBar0_1 = 0.95f;
     float_complex* decMtx;
     decMtx = calloc1d(HYBRID_BANDS*NUM_EARS*nSH, sizeof(float_complex));
-    switch(pData->method){
-        default:
-        case DECODING_METHOD_LS:
-            getBinauralAmbiDecoderMtx(pars->hrtf_fb, pars->hrir_dirs_deg, pars->N_hrir_dirs, HYBRID_BANDS,
-                                      BINAURAL_DECODER_LS, order, pData->freqVector, pars->itds_s, pars->weights,
-                                      pData->enableDiffuseMatching, pData->enableMaxRE, decMtx);
-            break;
-        case DECODING_METHOD_LSDIFFEQ:
-            getBinauralAmbiDecoderMtx(pars->hrtf_fb, pars->hrir_dirs_deg, pars->N_hrir_dirs, HYBRID_BANDS,
-                                      BINAURAL_DECODER_LSDIFFEQ, order, pData->freqVector, pars->itds_s, pars->weights,
-                                      pData->enableDiffuseMatching, pData->enableMaxRE, decMtx);
-            break;
-        case DECODING_METHOD_SPR:
-            getBinauralAmbiDecoderMtx(pars->hrtf_fb, pars->hrir_dirs_deg, pars->N_hrir_dirs, HYBRID_BANDS,
-                                      BINAURAL_DECODER_SPR, order, pData->freqVector, pars->itds_s, pars->weights,
-                                      pData->enableDiffuseMatching, pData->enableMaxRE, decMtx);
-            break;
-        case DECODING_METHOD_TA:
-            getBinauralAmbiDecoderMtx(pars->hrtf_fb, pars->hrir_dirs_deg, pars->N_hrir_dirs, HYBRID_BANDS,
-                                      BINAURAL_DECODER_TA, order, pData->freqVector, pars->itds_s, pars->weights,
-                                      pData->enableDiffuseMatching, pData->enableMaxRE, decMtx);
-            break;
-        case DECODING_METHOD_MAGLS:
-            getBinauralAmbiDecoderMtx(pars->hrtf_fb, pars->hrir_dirs_deg, pars->N_hrir_dirs, HYBRID_BANDS,
-                                      BINAURAL_DECODER_MAGLS, order, pData->freqVector, pars->itds_s, pars->weights,
-                                      pData->enableDiffuseMatching, pData->enableMaxRE, decMtx);
-            break;
+
+    /* Load the decoding matrix from the decoder cache, if enabled and the same decoder has been computed before */
+    cacheKey = pars->hrtfs_cacheKey;
+    saf_cache_hashInt(&cacheKey, (int)pData->method);
+    saf_cache_hashInt(&cacheKey, order);
+    saf_cache_hashInt(&cacheKey, pData->enableDiffuseMatching);
+    saf_cache_hashInt(&cacheKey, pData->enableMaxRE);
+    if(!saf_cache_load(pars->decoderCache_dir, "ambi_bin", cacheKey, HYBRID_BANDS*NUM_EARS*nSH*sizeof(float_complex), decMtx)){
+        switch(pData->method){
+            default:
+            case DECODING_METHOD_LS:
+                getBinauralAmbiDecoderMtx(pars->hrtf_fb, pars->hrir_dirs_deg, pars->N_hrir_dirs, HYBRID_BANDS,
+                                          BINAURAL_DECODER_LS, order, pData->freqVector, pars->itds_s, pars->weights,
+                                          pData->enableDiffuseMatching, pData->enableMaxRE, decMtx);
+                break;
+            case DECODING_METHOD_LSDIFFEQ:
+                getBinauralAmbiDecoderMtx(pars->hrtf_fb, pars->hrir_dirs_deg, pars->N_hrir_dirs, HYBRID_BANDS,
+                                          BINAURAL_DECODER_LSDIFFEQ, order, pData->freqVector, pars->itds_s, pars->weights,
+                                          pData->enableDiffuseMatching, pData->enableMaxRE, decMtx);
+                break;
+            case DECODING_METHOD_SPR:
+                getBinauralAmbiDecoderMtx(pars->hrtf_fb, pars->hrir_dirs_deg, pars->N_hrir_dirs, HYBRID_BANDS,
+                                          BINAURAL_DECODER_SPR, order, pData->freqVector, pars->itds_s, pars->weights,
+                                          pData->enableDiffuseMatching, pData->enableMaxRE, decMtx);
+                break;
+            case DECODING_METHOD_TA:
+                getBinauralAmbiDecoderMtx(pars->hrtf_fb, pars->hrir_dirs_deg, pars->N_hrir_dirs, HYBRID_BANDS,
+                                          BINAURAL_DECODER_TA, order, pData->freqVector, pars->itds_s, pars->weights,
+                                          pData->enableDiffuseMatching, pData->enableMaxRE, decMtx);
+                break;
+            case DECODING_METHOD_MAGLS:
+                getBinauralAmbiDecoderMtx(pars->hrtf_fb, pars->hrir_dirs_deg, pars->N_hrir_dirs, HYBRID_BANDS,
+                                          BINAURAL_DECODER_MAGLS, order, pData->freqVector, pars->itds_s, pars->weights,
+                                          pData->enableDiffuseMatching, pData->enableMaxRE, decMtx);
+                break;
+        }
+        saf_cache_store(pars->decoderCache_dir, "ambi_bin", cacheKey, decMtx, HYBRID_BANDS*NUM_EARS*nSH*sizeof(float_complex));
     }
     
     /* Apply Truncation EQ */
@@ -369,6 +407,22 @@ void ambi_bin_initCodec
         for(i=0; i<NUM_EARS; i++)
             for(j=0; j<nSH; j++)
                 pars->M_dec[band][i][j] = decMtx[band*NUM_EARS*nSH + i*nSH + j];
+    pData->recalc_M_rotFLAG = 1; /* since the rotated decoder is now stale */
+
+    /* Convert the decoder into FIR filters, and (re)create the matrix convolver */
+    saf_matrixConv_destroy(&(pData->hMatrixConv));
+    pData->enableFIRdecoding = pData->new_enableFIRdecoding;
+    if(pData->enableFIRdecoding){
+        firs_tmp = malloc1d(nSH*NUM_EARS*FIR_DEC_LENGTH*sizeof(float));
+        firs = malloc1d(NUM_EARS*nSH*FIR_DEC_LENGTH*sizeof(float));
+        afSTFT_filterbankCoeffsToFIR(decMtx, nSH, NUM_EARS, HOP_SIZE, 1, FIR_DEC_LENGTH, FIR_DEC_DELAY, firs_tmp);
+        for(i=0; i<NUM_EARS; i++)
+            for(j=0; j<nSH; j++)
+                memcpy(&firs[(i*nSH+j)*FIR_DEC_LENGTH], &firs_tmp[(j*NUM_EARS+i)*FIR_DEC_LENGTH], FIR_DEC_LENGTH*sizeof(float));
+        saf_matrixConv_create(&(pData->hMatrixConv), AMBI_BIN_FRAME_SIZE, firs, FIR_DEC_LENGTH, nSH, NUM_EARS, 1);
+        free(firs_tmp);
+        free(firs);
+    }
     free(decMtx);
     
     pData->order = order;
@@ -391,80 +445,96 @@ void ambi_bin_process
 {
     ambi_bin_data *pData = (ambi_bin_data*)(hAmbi);
     ambi_bin_codecPars* pars = pData->pars;
-    int ch, i, j, band;
+    int ch, band;
     const float_complex calpha = cmplxf(1.0f,0.0f), cbeta = cmplxf(0.0f, 0.0f);
     float Rxyz[3][3];
-    float M_rot_tmp[MAX_NUM_SH_SIGNALS*MAX_NUM_SH_SIGNALS];
     
     /* local copies of user parameters */
-    int order, nSH, enableRot;
+    int order, nSH, enableRot, enableFIR;
     NORM_TYPES norm;
     CH_ORDER chOrdering;
+    HOA_CH_ORDER inChOrder = HOA_CH_ORDER_ACN;
+    HOA_NORM inNorm = HOA_NORM_N3D;
+    int chPerm[MAX_NUM_SH_SIGNALS];
+    float chGains[MAX_NUM_SH_SIGNALS];
     norm = pData->norm;
     chOrdering = pData->chOrdering;
     order = pData->order;
     nSH = (order+1)*(order+1);
     enableRot = pData->enableRotation;
+    enableFIR = pData->enableFIRdecoding;
+
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
 
     /* Process frame */
     if (nSamples == AMBI_BIN_FRAME_SIZE && (pData->codecStatus == CODEC_STATUS_INITIALISED) ) {
         pData->procStatus = PROC_STATUS_ONGOING;
 
-        /* Load time-domain data */
-        for(i=0; i < SAF_MIN(nSH, nInputs); i++)
-            utility_svvcopy(inputs[i], AMBI_BIN_FRAME_SIZE, pData->SHFrameTD[i]);
-        for(; i<nSH; i++)
-            memset(pData->SHFrameTD[i], 0, AMBI_BIN_FRAME_SIZE * sizeof(float)); /* fill remaining channels with zeros */
-
-        /* account for channel order convention */
+        /* Load time-domain data, converting from the input conventions to ACN/N3D in the same pass (any remaining
+         * channels are filled with zeros) */
         switch(chOrdering){
-            case CH_ACN:  /* already in ACN, do nothing */ break; /* Otherwise, convert to ACN... */
-            case CH_FUMA: convertHOAChannelConvention(FLATTEN2D(pData->SHFrameTD), order, AMBI_BIN_FRAME_SIZE, HOA_CH_ORDER_FUMA, HOA_CH_ORDER_ACN); break;
+            case CH_ACN:  inChOrder = HOA_CH_ORDER_ACN;  break;
+            case CH_FUMA: inChOrder = HOA_CH_ORDER_FUMA; break;
         }
-
-        /* account for input normalisation scheme */
         switch(norm){
-            case NORM_N3D:  /* already in N3D, do nothing */ break; /* Otherwise, convert to N3D... */
-            case NORM_SN3D: convertHOANormConvention(FLATTEN2D(pData->SHFrameTD), order, AMBI_BIN_FRAME_SIZE, HOA_NORM_SN3D, HOA_NORM_N3D); break;
-            case NORM_FUMA: convertHOANormConvention(FLATTEN2D(pData->SHFrameTD), order, AMBI_BIN_FRAME_SIZE, HOA_NORM_FUMA, HOA_NORM_N3D); break;
+            case NORM_N3D:  inNorm = HOA_NORM_N3D;  break;
+            case NORM_SN3D: inNorm = HOA_NORM_SN3D; break;
+            case NORM_FUMA: inNorm = HOA_NORM_FUMA; break;
         }
-
-        /* Apply time-frequency transform (TFT) */
-        afSTFT_forward_knownDimensions(pData->hSTFT, pData->SHFrameTD, AMBI_BIN_FRAME_SIZE, MAX_NUM_SH_SIGNALS, TIME_SLOTS, pData->SHframeTF);
-
-        /* Main processing: */
-        if(order > 0 && enableRot) {
-            /* Apply rotation */
-            if(pData->recalc_M_rotFLAG){
-                /* Compute the new SH rotation matrix */
-                memset(pData->M_rot, 0, MAX_NUM_SH_SIGNALS*MAX_NUM_SH_SIGNALS*sizeof(float_complex));
-                yawPitchRoll2Rzyx(pData->yaw, pData->pitch, pData->roll, pData->useRollPitchYawFlag, Rxyz);
-                getSHrotMtxReal(Rxyz, (float*)M_rot_tmp, order);
-                for (i = 0; i < nSH; i++)
-                    for (j = 0; j < nSH; j++)
-                        pData->M_rot[i][j] = cmplxf(M_rot_tmp[i*nSH + j], 0.0f);
-
-                /* Bake the rotation into the decoding matrix */
-                for(band = 0; band < HYBRID_BANDS; band++) {
-                    cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, NUM_EARS, nSH, nSH, &calpha,
-                                pars->M_dec[band], MAX_NUM_SH_SIGNALS,
-                                pData->M_rot, MAX_NUM_SH_SIGNALS, &cbeta,
-                                pars->M_dec_rot[band], MAX_NUM_SH_SIGNALS);
+        getHOAConventionTransform(order, inChOrder, inNorm, HOA_CH_ORDER_ACN, HOA_NORM_N3D, chPerm, chGains);
+        applyHOAConventionTransform(inputs, nInputs, chPerm, chGains, nSH, AMBI_BIN_FRAME_SIZE, pData->SHFrameTD);
+
+        /* Apply the decoder in the time-domain, using the FIR filters (lower latency) */
+        if(enableFIR){
+            if(order > 0 && enableRot) {
+                /* Apply rotation (the rotation matrix is frequency-independent, so it is applied directly to the SH signals) */
+                if(pData->recalc_M_rotFLAG){
+                    yawPitchRoll2Rzyx(pData->yaw, pData->pitch, pData->roll, pData->useRollPitchYawFlag, Rxyz);
+                    getSHrotMtxReal(Rxyz, pData->M_rot, order);
+                    pData->recalc_M_rotFLAG = 0;
                 }
-                pData->recalc_M_rotFLAG = 0;
+                cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nSH, AMBI_BIN_FRAME_SIZE, nSH, 1.0f,
+                            pData->M_rot, nSH,
+                            FLATTEN2D(pData->SHFrameTD), AMBI_BIN_FRAME_SIZE, 0.0f,
+                            FLATTEN2D(pData->SHFrameTD_rot), AMBI_BIN_FRAME_SIZE);
+                saf_matrixConv_apply(pData->hMatrixConv, FLATTEN2D(pData->SHFrameTD_rot), FLATTEN2D(pData->binFrameTD));
             }
+            else
+                saf_matrixConv_apply(pData->hMatrixConv, FLATTEN2D(pData->SHFrameTD), FLATTEN2D(pData->binFrameTD));
         }
+        /* Or apply the decoder in the time-frequency domain */
+        else{
+            /* Apply time-frequency transform (TFT) */
+            afSTFT_forward_knownDimensions(pData->hSTFT, pData->SHFrameTD, AMBI_BIN_FRAME_SIZE, MAX_NUM_SH_SIGNALS, TIME_SLOTS, pData->SHframeTF);
+
+            /* Main processing: */
+            if(order > 0 && enableRot) {
+                /* Apply rotation */
+                if(pData->recalc_M_rotFLAG){
+                    /* Compute the new SH rotation matrix */
+                    yawPitchRoll2Rzyx(pData->yaw, pData->pitch, pData->roll, pData->useRollPitchYawFlag, Rxyz);
+                    getSHrotMtxReal(Rxyz, pData->M_rot, order);
+
+                    /* Bake the rotation into the decoding matrix (one block per order) */
+                    for(band = 0; band < HYBRID_BANDS; band++)
+                        applySHrotMtxRealToDecoder(order, pData->M_rot, nSH, (float_complex*)pars->M_dec[band], MAX_NUM_SH_SIGNALS,
+                                                   NUM_EARS, MAX_NUM_SH_SIGNALS, (float_complex*)pars->M_dec_rot[band]);
+                    pData->recalc_M_rotFLAG = 0;
+                }
+            }
 
-        /* Apply the decoder to go from SH input to binaural output */
-        for(band = 0; band < HYBRID_BANDS; band++) {
-            cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, NUM_EARS, TIME_SLOTS, nSH, &calpha,
-                        enableRot ? pars->M_dec_rot[band] : pars->M_dec[band], MAX_NUM_SH_SIGNALS,
-                        FLATTEN2D(pData->SHframeTF[band]), TIME_SLOTS, &cbeta,
-                        FLATTEN2D(pData->binframeTF[band]), TIME_SLOTS);
-        }
+            /* Apply the decoder to go from SH input to binaural output */
+            for(band = 0; band < HYBRID_BANDS; band++) {
+                cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, NUM_EARS, TIME_SLOTS, nSH, &calpha,
+                            enableRot ? pars->M_dec_rot[band] : pars->M_dec[band], MAX_NUM_SH_SIGNALS,
+                            FLATTEN2D(pData->SHframeTF[band]), TIME_SLOTS, &cbeta,
+                            FLATTEN2D(pData->binframeTF[band]), TIME_SLOTS);
+            }
 
-        /* inverse-TFT */
-        afSTFT_backward_knownDimensions(pData->hSTFT, pData->binframeTF, AMBI_BIN_FRAME_SIZE, NUM_EARS, TIME_SLOTS, pData->binFrameTD);
+            /* inverse-TFT */
+            afSTFT_backward_knownDimensions(pData->hSTFT, pData->binframeTF, AMBI_BIN_FRAME_SIZE, NUM_EARS, TIME_SLOTS, pData->binFrameTD);
+        }
 
         /* Copy to output */
         for (ch = 0; ch < SAF_MIN(NUM_EARS, nOutputs); ch++)
@@ -477,6 +547,7 @@ void ambi_bin_process
             memset(outputs[ch],0, AMBI_BIN_FRAME_SIZE*sizeof(float));
 
     pData->procStatus = PROC_STATUS_NOT_ONGOING;
+    md_rt_exitRegion();
 }
 
 
@@ -511,6 +582,21 @@ void ambi_bin_setSofaFilePath(void* const hAmbi, const char* path)
 
 }
 
+void ambi_bin_setDecoderCacheDir(void* const hAmbi, const char* path)
+{
+    ambi_bin_data *pData = (ambi_bin_data*)(hAmbi);
+    ambi_bin_codecPars* pars = pData->pars;
+
+    if(path==NULL || path[0]=='\0'){
+        free(pars->decoderCache_dir);
+        pars->decoderCache_dir = NULL;
+    }
+    else{
+        pars->decoderCache_dir = realloc1d(pars->decoderCache_dir, strlen(path) + 1);
+        strcpy(pars->decoderCache_dir, path);
+    }
+}
+
 void ambi_bin_setInputOrderPreset(void* const hAmbi, SH_ORDERS newOrder)
 {
     ambi_bin_data *pData = (ambi_bin_data*)(hAmbi);
@@ -582,6 +668,15 @@ void ambi_bin_setHRIRsPreProc(void* const hAmbi, AMBI_BIN_PREPROC newType)
     }
 }
 
+void ambi_bin_setEnableFIRdecoding(void* const hAmbi, int newState)
+{
+    ambi_bin_data *pData = (ambi_bin_data*)(hAmbi);
+    if(pData->new_enableFIRdecoding != newState){
+        pData->new_enableFIRdecoding = newState;
+        ambi_bin_setCodecStatus(hAmbi, CODEC_STATUS_NOT_INITIALISED);
+    }
+}
+
 void ambi_bin_setEnableRotation(void* const hAmbi, int newState)
 {
     ambi_bin_data *pData = (ambi_bin_data*)(hAmbi);
@@ -702,6 +797,13 @@ char* ambi_bin_getSofaFilePath(void* const hAmbi)
         return "no_file";
 }
 
+char* ambi_bin_getDecoderCacheDir(void* const hAmbi)
+{
+    ambi_bin_data *pData = (ambi_bin_data*)(hAmbi);
+    ambi_bin_codecPars* pars = pData->pars;
+    return pars->decoderCache_dir;
+}
+
 int ambi_bin_getChOrder(void* const hAmbi)
 {
     ambi_bin_data *pData = (ambi_bin_data*)(hAmbi);
@@ -732,6 +834,12 @@ int ambi_bin_getEnableTruncationEQ(void* const hAmbi)
     return pData->enableTruncationEQ;
 }
 
+int ambi_bin_getEnableFIRdecoding(void* const hAmbi)
+{
+    ambi_bin_data *pData = (ambi_bin_data*)(hAmbi);
+    return pData->new_enableFIRdecoding;
+}
+
 int ambi_bin_getNumEars()
 { 
     return NUM_EARS;
@@ -822,3 +930,11 @@ int ambi_bin_getProcessingDelay()
 {
     return 12*HOP_SIZE;
 }
+
+int ambi_bin_getProcessingDelayEx(void* const hAmbi)
+{
+    ambi_bin_data *pData = (ambi_bin_data*)(hAmbi);
+    if(pData->enableFIRdecoding)
+        return FIR_DEC_DELAY;
+    return ambi_bin_getProcessingDelay();
+}
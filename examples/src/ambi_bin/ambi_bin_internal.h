@@ -71,6 +71,8 @@ extern "C" {
 #define HYBRID_BANDS ( HOP_SIZE + 5 )                 /**< Number of frequency bands */
 #define TIME_SLOTS ( AMBI_BIN_FRAME_SIZE / HOP_SIZE ) /**< Number of STFT timeslots */
 #define POST_GAIN ( -9.0f )                           /**< Post-gain scaling, in dB */
+#define FIR_DEC_LENGTH ( 2*HOP_SIZE )                 /**< Length of the FIR decoding filters, in samples */
+#define FIR_DEC_DELAY ( HOP_SIZE/2 )                  /**< Modelling delay of the FIR decoding filters, in samples */
 
 /* Checks: */
 #if (AMBI_BIN_FRAME_SIZE % HOP_SIZE != 0)
@@ -88,6 +90,8 @@ typedef struct _ambi_bin_codecPars
     /* Decoder */
     float_complex M_dec[HYBRID_BANDS][NUM_EARS][MAX_NUM_SH_SIGNALS];     /**< Decoding matrix per band*/
     float_complex M_dec_rot[HYBRID_BANDS][NUM_EARS][MAX_NUM_SH_SIGNALS]; /**< Decording matrix per band, with sound-field rotation baked-in */
+    char* decoderCache_dir; /**< directory of the on-disk decoder cache (NULL: disabled), see saf_utility_cache.h */
+    unsigned long long hrtfs_cacheKey; /**< decoder cache key of the current HRIRs and their pre-processing */
     
     /* sofa file info */
     char* sofa_filepath;    /**< absolute/relevative file path for a sofa file */
@@ -118,7 +122,9 @@ typedef struct _ambi_bin
     float** binFrameTD;             /**< Output binaural signals in the time-domain; #NUM_EARS x #AMBI_BIN_FRAME_SIZE */
     float_complex*** SHframeTF;     /**< Input spherical harmonic (SH) signals in the time-frequency domain; #HYBRID_BANDS x #MAX_NUM_SH_SIGNALS x #TIME_SLOTS */
     float_complex*** binframeTF;    /**< Output binaural signals in the time-frequency domain; #HYBRID_BANDS x #NUM_EARS x #TIME_SLOTS */
+    float** SHFrameTD_rot;          /**< Rotated SH signals in the time-domain (FIR decoding only); #MAX_NUM_SH_SIGNALS x #AMBI_BIN_FRAME_SIZE */
     void* hSTFT;                    /**< afSTFT handle */
+    void* hMatrixConv;              /**< matrixConv handle, for applying the FIR decoding filters */
     int afSTFTdelay;                /**< for host delay compensation */
     float freqVector[HYBRID_BANDS]; /**< frequency vector for time-frequency transform, in Hz */
      
@@ -130,8 +136,9 @@ typedef struct _ambi_bin
     
     /* internal variables */
     PROC_STATUS procStatus;         /**< see #PROC_STATUS */
-    float_complex M_rot[MAX_NUM_SH_SIGNALS][MAX_NUM_SH_SIGNALS]; /**< Current SH rotation matrix */
+    float M_rot[MAX_NUM_SH_SIGNALS*MAX_NUM_SH_SIGNALS]; /**< Current SH rotation matrix; FLAT: nSH x nSH */
     int new_order;                  /**< new decoding order (current value will be replaced by this after next re-init) */
+    int new_enableFIRdecoding;      /**< new FIR decoding flag (current value will be replaced by this after next re-init) */
     int nSH;                        /**< number of spherical harmonic signals */
     
     /* flags */ 
@@ -140,6 +147,7 @@ typedef struct _ambi_bin
     
     /* user parameters */
     int order;                      /**< current decoding order */
+    int enableFIRdecoding;          /**< 0: decode in the time-frequency domain, 1: decode in the time-domain with FIR filters */
     int enableMaxRE;                /**< 0: disabled, 1: enabled */
     int enableDiffuseMatching;      /**< 0: disabled, 1: enabled */
     int enableTruncationEQ;         /**< 0: disabled, 1: enabled */
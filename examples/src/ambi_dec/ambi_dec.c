@@ -96,6 +96,7 @@ void ambi_dec_create
         }
     }
     pars->sofa_filepath = NULL;
+    pars->decoderCache_dir = NULL;
     pars->hrirs = NULL;
     pars->hrir_dirs_deg = NULL;
     pars->hrtf_vbap_gtableIdx = NULL;
@@ -107,6 +108,8 @@ void ambi_dec_create
     
     /* internal parameters */ 
     pData->binauraliseLS = pData->new_binauraliseLS = 0;
+    pData->enableFIRdecoding = pData->new_enableFIRdecoding = 0;
+    pData->hMatrixConv = NULL;
     
     /* flags */
     pData->procStatus = PROC_STATUS_NOT_ONGOING;
@@ -139,6 +142,7 @@ void ambi_dec_destroy
         free(pData->SHframeTF);
         free(pData->outputframeTF);
         free(pData->binframeTF);
+        saf_matrixConv_destroy(&(pData->hMatrixConv));
 
         /* free codec data */
         pars = pData->pars;
@@ -148,6 +152,7 @@ void ambi_dec_destroy
         free(pars->hrtf_fb_mag);
         free(pars->itds_s);
 	free(pars->sofa_filepath);
+        free(pars->decoderCache_dir);
         free(pars->hrirs);
         free(pars->hrir_dirs_deg);
         free(pars->weights);
@@ -185,9 +190,15 @@ void ambi_dec_initCodec
 {
     ambi_dec_data *pData = (ambi_dec_data*)(hAmbi);
     ambi_dec_codecPars* pars = pData->pars;
-    int i, ch, d, j, n, ng, nGrid_dirs, masterOrder, nSH_order, max_nSH, nLoudspeakers;
+    int i, ch, d, j, n, ng, nGrid_dirs, masterOrder, nSH_order, max_nSH, nLoudspeakers, band, orderBand, nSH_band, decIdx, nOutputs;
+    float scale;
+    float* M, *firs, *firs_tmp;
+    float_complex* decFB, *firFB;
     float* grid_dirs_deg, *Y, *M_dec_tmp, *g, *a, *e, *a_n, *hrtf_vbap_gtable;;
     float a_avg[MAX_SH_ORDER], e_avg[MAX_SH_ORDER], azi_incl[2], sum_elev;
+    int hrtfsCached, hrtf_dims[2];
+    unsigned long long cacheKey;
+    void* hPool;
 #ifdef SAF_ENABLE_SOFA_READER_MODULE
     SAF_SOFA_ERROR_CODES error;
     saf_sofa_container sofa;
@@ -255,21 +266,36 @@ void ambi_dec_initCodec
     e = malloc1d(nGrid_dirs*sizeof(float));
     
     /* calculate loudspeaker decoding matrices */
+    M_dec_tmp = malloc1d(nLoudspeakers * max_nSH * sizeof(float));
     for( d=0; d<NUM_DECODERS; d++){
-        M_dec_tmp = malloc1d(nLoudspeakers * max_nSH * sizeof(float));
-        switch(pData->dec_method[d]){
-            case DECODING_METHOD_SAD:
-                getLoudspeakerDecoderMtx((float*)pData->loudpkrs_dirs_deg, nLoudspeakers, LOUDSPEAKER_DECODER_SAD, masterOrder, 0, M_dec_tmp);
-                break;
-            case DECODING_METHOD_MMD:
-                getLoudspeakerDecoderMtx((float*)pData->loudpkrs_dirs_deg, nLoudspeakers, LOUDSPEAKER_DECODER_MMD, masterOrder, 0, M_dec_tmp);
-                break;
-            case DECODING_METHOD_EPAD:
-                getLoudspeakerDecoderMtx((float*)pData->loudpkrs_dirs_deg, nLoudspeakers, LOUDSPEAKER_DECODER_EPAD, masterOrder, 0, M_dec_tmp);
-                break;
-            case DECODING_METHOD_ALLRAD:
-                getLoudspeakerDecoderMtx((float*)pData->loudpkrs_dirs_deg, nLoudspeakers, LOUDSPEAKER_DECODER_ALLRAD, masterOrder, 0, M_dec_tmp);
-                break;
+        /* If both decoders employ the same method, then the first decoding matrix is reused (AllRAD triangulates the
+         * loudspeakers with a small random jitter, so a second computation could differ, and thus introduce a step in
+         * the response at the transition frequency) */
+        if(d==0 || pData->dec_method[d]!=pData->dec_method[0]){
+            /* Load the decoding matrix from the decoder cache, if enabled and the same decoder has been computed before */
+            cacheKey = saf_cache_initKey();
+            saf_cache_hashInt(&cacheKey, SAF_VERSION);
+            saf_cache_hashInt(&cacheKey, (int)pData->dec_method[d]);
+            saf_cache_hashInt(&cacheKey, masterOrder);
+            saf_cache_hashInt(&cacheKey, nLoudspeakers);
+            saf_cache_hashData(&cacheKey, pData->loudpkrs_dirs_deg, nLoudspeakers*2*sizeof(float));
+            if(!saf_cache_load(pars->decoderCache_dir, "ambi_dec", cacheKey, nLoudspeakers*max_nSH*sizeof(float), M_dec_tmp)){
+                switch(pData->dec_method[d]){
+                    case DECODING_METHOD_SAD:
+                        getLoudspeakerDecoderMtx((float*)pData->loudpkrs_dirs_deg, nLoudspeakers, LOUDSPEAKER_DECODER_SAD, masterOrder, 0, M_dec_tmp);
+                        break;
+                    case DECODING_METHOD_MMD:
+                        getLoudspeakerDecoderMtx((float*)pData->loudpkrs_dirs_deg, nLoudspeakers, LOUDSPEAKER_DECODER_MMD, masterOrder, 0, M_dec_tmp);
+                        break;
+                    case DECODING_METHOD_EPAD:
+                        getLoudspeakerDecoderMtx((float*)pData->loudpkrs_dirs_deg, nLoudspeakers, LOUDSPEAKER_DECODER_EPAD, masterOrder, 0, M_dec_tmp);
+                        break;
+                    case DECODING_METHOD_ALLRAD:
+                        getLoudspeakerDecoderMtx((float*)pData->loudpkrs_dirs_deg, nLoudspeakers, LOUDSPEAKER_DECODER_ALLRAD, masterOrder, 0, M_dec_tmp);
+                        break;
+                }
+                saf_cache_store(pars->decoderCache_dir, "ambi_dec", cacheKey, M_dec_tmp, nLoudspeakers*max_nSH*sizeof(float));
+            }
         }
         
         /* diffuse-field EQ for orders 1..masterOrder */
@@ -340,8 +366,8 @@ void ambi_dec_initCodec
                 pars->M_dec_cmplx_maxrE[d][n-1] = realloc1d(pars->M_dec_cmplx_maxrE[d][n-1], pData->nLoudpkrs * nSH_order * sizeof(float_complex));
             }
         }
-        free(M_dec_tmp);
     }
+    free(M_dec_tmp);
     
     /* update order */
     pData->masterOrder = pData->new_masterOrder;
@@ -391,58 +417,161 @@ void ambi_dec_initCodec
             memcpy(pars->hrir_dirs_deg, (float*)__default_hrir_dirs_deg, pars->N_hrir_dirs*2*sizeof(float));
         }
         
-        /* estimate the ITDs for each HRIR */
-        pars->itds_s = realloc1d(pars->itds_s, pars->N_hrir_dirs*sizeof(float));
-        estimateITDs(pars->hrirs, pars->N_hrir_dirs, pars->hrir_len, pars->hrir_fs, pars->itds_s);
-        
-        /* generate VBAP gain table for the hrir_dirs */
-        hrtf_vbap_gtable = NULL;
+        /* Load the pre-processed HRTFs from the decoder cache, if enabled and the same HRIRs have been processed before */
+        cacheKey = saf_cache_initKey();
+        saf_cache_hashInt(&cacheKey, SAF_VERSION);
+        saf_cache_hashInt(&cacheKey, pData->enableHRIRsPreProc);
+        saf_cache_hashInt(&cacheKey, pars->N_hrir_dirs);
+        saf_cache_hashInt(&cacheKey, pars->hrir_len);
+        saf_cache_hashInt(&cacheKey, pars->hrir_fs);
+        saf_cache_hashData(&cacheKey, pData->freqVector, HYBRID_BANDS*sizeof(float));
+        saf_cache_hashData(&cacheKey, pars->hrirs, pars->N_hrir_dirs*NUM_EARS*(pars->hrir_len)*sizeof(float));
+        saf_cache_hashData(&cacheKey, pars->hrir_dirs_deg, pars->N_hrir_dirs*2*sizeof(float));
         pars->hrtf_vbapTableRes[0] = 2; /* azimuth resolution in degrees */
         pars->hrtf_vbapTableRes[1] = 5; /* elevation resolution in degrees */
-        generateVBAPgainTable3D(pars->hrir_dirs_deg, pars->N_hrir_dirs, pars->hrtf_vbapTableRes[0], pars->hrtf_vbapTableRes[1], 1, 0, 0.0f,
-                                &hrtf_vbap_gtable, &(pars->N_hrtf_vbap_gtable), &(pars->hrtf_nTriangles));
-        if(hrtf_vbap_gtable==NULL){
-            /* if generating vbap gain tabled failed, re-calculate with default HRIR set (which is known to triangulate correctly) */
-            pData->useDefaultHRIRsFLAG = 1;
-            ambi_dec_initCodec(hAmbi);
+        hrtfsCached = 0;
+        if(saf_cache_load(pars->decoderCache_dir, "ambi_dec_hrtf_dims", cacheKey, 2*sizeof(int), hrtf_dims)){
+            pars->N_hrtf_vbap_gtable = hrtf_dims[0];
+            pars->hrtf_nTriangles = hrtf_dims[1];
+            pars->itds_s = realloc1d(pars->itds_s, pars->N_hrir_dirs*sizeof(float));
+            pars->hrtf_vbap_gtableComp = realloc1d(pars->hrtf_vbap_gtableComp, pars->N_hrtf_vbap_gtable * 3 * sizeof(float));
+            pars->hrtf_vbap_gtableIdx  = realloc1d(pars->hrtf_vbap_gtableIdx,  pars->N_hrtf_vbap_gtable * 3 * sizeof(int));
+            pars->hrtf_fb = realloc1d(pars->hrtf_fb, HYBRID_BANDS * NUM_EARS * (pars->N_hrir_dirs)*sizeof(float_complex));
+            if(pData->enableHRIRsPreProc)
+                pars->weights = realloc1d(pars->weights, pars->N_hrir_dirs*sizeof(float));
+            hrtfsCached = saf_cache_load(pars->decoderCache_dir, "ambi_dec_itds", cacheKey, pars->N_hrir_dirs*sizeof(float), pars->itds_s) &&
+                          saf_cache_load(pars->decoderCache_dir, "ambi_dec_gtableComp", cacheKey, pars->N_hrtf_vbap_gtable*3*sizeof(float), pars->hrtf_vbap_gtableComp) &&
+                          saf_cache_load(pars->decoderCache_dir, "ambi_dec_gtableIdx", cacheKey, pars->N_hrtf_vbap_gtable*3*sizeof(int), pars->hrtf_vbap_gtableIdx) &&
+                          saf_cache_load(pars->decoderCache_dir, "ambi_dec_hrtfs", cacheKey, HYBRID_BANDS*NUM_EARS*(pars->N_hrir_dirs)*sizeof(float_complex), pars->hrtf_fb) &&
+                          (!pData->enableHRIRsPreProc || saf_cache_load(pars->decoderCache_dir, "ambi_dec_weights", cacheKey, pars->N_hrir_dirs*sizeof(float), pars->weights));
         }
+        hrtf_vbap_gtable = NULL;
+        if(!hrtfsCached){
+            /* estimate the ITDs for each HRIR */
+            pars->itds_s = realloc1d(pars->itds_s, pars->N_hrir_dirs*sizeof(float));
+            estimateITDs(pars->hrirs, pars->N_hrir_dirs, pars->hrir_len, pars->hrir_fs, pars->itds_s);
         
-        /* compress VBAP table (i.e. remove the zero elements) */
-        pars->hrtf_vbap_gtableComp = realloc1d(pars->hrtf_vbap_gtableComp, pars->N_hrtf_vbap_gtable * 3 * sizeof(float));
-        pars->hrtf_vbap_gtableIdx  = realloc1d(pars->hrtf_vbap_gtableIdx,  pars->N_hrtf_vbap_gtable * 3 * sizeof(int));
-        compressVBAPgainTable3D(hrtf_vbap_gtable, pars->N_hrtf_vbap_gtable, pars->N_hrir_dirs, pars->hrtf_vbap_gtableComp, pars->hrtf_vbap_gtableIdx);
+            /* generate VBAP gain table for the hrir_dirs (with the grid directions split over all of the processors) */
+            saf_threadPool_create(&hPool, saf_threadPool_getNumProcessors());
+            generateVBAPgainTable3D_threaded(pars->hrir_dirs_deg, pars->N_hrir_dirs, pars->hrtf_vbapTableRes[0], pars->hrtf_vbapTableRes[1], 1, 0, 0.0f,
+                                             hPool, &hrtf_vbap_gtable, &(pars->N_hrtf_vbap_gtable), &(pars->hrtf_nTriangles));
+            saf_threadPool_destroy(&hPool);
+            if(hrtf_vbap_gtable==NULL){
+                /* if generating vbap gain tabled failed, re-calculate with default HRIR set (which is known to triangulate correctly) */
+                pData->useDefaultHRIRsFLAG = 1;
+                ambi_dec_initCodec(hAmbi);
+            }
         
-        /* convert hrirs to filterbank coefficients */
-        strcpy(pData->progressBarText,"Preparing HRIRs");
-        pData->progressBar0_1 = 0.85f;
-        pars->hrtf_fb = realloc1d(pars->hrtf_fb, HYBRID_BANDS * NUM_EARS * (pars->N_hrir_dirs)*sizeof(float_complex));
-        HRIRs2HRTFs_afSTFT(pars->hrirs, pars->N_hrir_dirs, pars->hrir_len, HOP_SIZE, 0, 1, pars->hrtf_fb);
-        /* HRIR pre-processing */
-        if(pData->enableHRIRsPreProc){
-            /* get integration weights */
-            strcpy(pData->progressBarText,"Applying HRIR Pre-Processing");
-            pData->progressBar0_1 = 0.95f;
-            if(pars->N_hrir_dirs<=3600){
-                pars->weights = realloc1d(pars->weights, pars->N_hrir_dirs*sizeof(float));
-                getVoronoiWeights(pars->hrir_dirs_deg, pars->N_hrir_dirs, 0, pars->weights);
+            /* compress VBAP table (i.e. remove the zero elements) */
+            pars->hrtf_vbap_gtableComp = realloc1d(pars->hrtf_vbap_gtableComp, pars->N_hrtf_vbap_gtable * 3 * sizeof(float));
+            pars->hrtf_vbap_gtableIdx  = realloc1d(pars->hrtf_vbap_gtableIdx,  pars->N_hrtf_vbap_gtable * 3 * sizeof(int));
+            compressVBAPgainTable3D(hrtf_vbap_gtable, pars->N_hrtf_vbap_gtable, pars->N_hrir_dirs, pars->hrtf_vbap_gtableComp, pars->hrtf_vbap_gtableIdx);
+        
+            /* convert hrirs to filterbank coefficients */
+            strcpy(pData->progressBarText,"Preparing HRIRs");
+            pData->progressBar0_1 = 0.85f;
+            pars->hrtf_fb = realloc1d(pars->hrtf_fb, HYBRID_BANDS * NUM_EARS * (pars->N_hrir_dirs)*sizeof(float_complex));
+            HRIRs2HRTFs_afSTFT(pars->hrirs, pars->N_hrir_dirs, pars->hrir_len, HOP_SIZE, 0, 1, pars->hrtf_fb);
+            /* HRIR pre-processing */
+            if(pData->enableHRIRsPreProc){
+                /* get integration weights */
+                strcpy(pData->progressBarText,"Applying HRIR Pre-Processing");
+                pData->progressBar0_1 = 0.95f;
+                if(pars->N_hrir_dirs<=3600){
+                    pars->weights = realloc1d(pars->weights, pars->N_hrir_dirs*sizeof(float));
+                    getVoronoiWeights(pars->hrir_dirs_deg, pars->N_hrir_dirs, 0, pars->weights);
+                }
+                else{
+                    pars->weights = realloc1d(pars->weights, pars->N_hrir_dirs*sizeof(float));
+                    for(int idx=0; idx < pars->N_hrir_dirs; idx++)
+                        pars->weights[idx] = 4.f*SAF_PI / (float)pars->N_hrir_dirs;
+                }
+                diffuseFieldEqualiseHRTFs(pars->N_hrir_dirs, pars->itds_s, pData->freqVector, HYBRID_BANDS, pars->weights, 1, 0, pars->hrtf_fb);
             }
-            else{
-                pars->weights = realloc1d(pars->weights, pars->N_hrir_dirs*sizeof(float));
-                for(int idx=0; idx < pars->N_hrir_dirs; idx++)
-                    pars->weights[idx] = 4.f*SAF_PI / (float)pars->N_hrir_dirs;
+
+            /* store in the decoder cache (only if the triangulation of the HRIR directions succeeded) */
+            if(hrtf_vbap_gtable!=NULL){
+                hrtf_dims[0] = pars->N_hrtf_vbap_gtable;
+                hrtf_dims[1] = pars->hrtf_nTriangles;
+                saf_cache_store(pars->decoderCache_dir, "ambi_dec_itds", cacheKey, pars->itds_s, pars->N_hrir_dirs*sizeof(float));
+                saf_cache_store(pars->decoderCache_dir, "ambi_dec_gtableComp", cacheKey, pars->hrtf_vbap_gtableComp, pars->N_hrtf_vbap_gtable*3*sizeof(float));
+                saf_cache_store(pars->decoderCache_dir, "ambi_dec_gtableIdx", cacheKey, pars->hrtf_vbap_gtableIdx, pars->N_hrtf_vbap_gtable*3*sizeof(int));
+                saf_cache_store(pars->decoderCache_dir, "ambi_dec_hrtfs", cacheKey, pars->hrtf_fb, HYBRID_BANDS*NUM_EARS*(pars->N_hrir_dirs)*sizeof(float_complex));
+                if(pData->enableHRIRsPreProc)
+                    saf_cache_store(pars->decoderCache_dir, "ambi_dec_weights", cacheKey, pars->weights, pars->N_hrir_dirs*sizeof(float));
+                saf_cache_store(pars->decoderCache_dir, "ambi_dec_hrtf_dims", cacheKey, hrtf_dims, 2*sizeof(int));
             }
-            diffuseFieldEqualiseHRTFs(pars->N_hrir_dirs, pars->itds_s, pData->freqVector, HYBRID_BANDS, pars->weights, 1, 0, pars->hrtf_fb);
         }
         
-        /* calculate magnitude responses */
+        /* calculate magnitude responses (stored direction-major, since they are only read 3 directions at a time by
+         * ambi_dec_interpHRTFs()) */
         pars->hrtf_fb_mag = realloc1d(pars->hrtf_fb_mag, HYBRID_BANDS*NUM_EARS*(pars->N_hrir_dirs)*sizeof(float));
-        for(i=0; i<HYBRID_BANDS*NUM_EARS* (pars->N_hrir_dirs); i++)
-            pars->hrtf_fb_mag[i] = cabsf(pars->hrtf_fb[i]);
+        for(band=0; band<HYBRID_BANDS; band++)
+            for(ch=0; ch<NUM_EARS; ch++)
+                for(i=0; i<pars->N_hrir_dirs; i++)
+                    pars->hrtf_fb_mag[(i*HYBRID_BANDS + band)*NUM_EARS + ch] = cabsf(pars->hrtf_fb[(band*NUM_EARS + ch)*(pars->N_hrir_dirs) + i]);
         
         /* clean-up */
         free(hrtf_vbap_gtable);
         pData->reinit_hrtfsFLAG = 0;
     }
+
+    /* Convert the decoders (and HRTFs) into FIR filters, and (re)create the matrix convolver */
+    saf_matrixConv_destroy(&(pData->hMatrixConv));
+    pData->enableFIRdecoding = pData->new_enableFIRdecoding;
+    if(pData->enableFIRdecoding){
+        strcpy(pData->progressBarText,"Designing FIR filters");
+        nLoudspeakers = pData->nLoudpkrs;
+        nOutputs = pData->binauraliseLS ? NUM_EARS : nLoudspeakers;
+
+        /* Frequency-dependent decoding matrix (the same decoder per band as in ambi_dec_process()) */
+        decFB = calloc1d(HYBRID_BANDS*nLoudspeakers*max_nSH, sizeof(float_complex));
+        for(band=0; band<HYBRID_BANDS; band++){
+            orderBand = SAF_MAX(SAF_MIN(pData->orderPerBand[band], masterOrder),1);
+            nSH_band = (orderBand+1)*(orderBand+1);
+            decIdx = pData->freqVector[band] < pData->transitionFreq ? 0 : 1;
+            M = pData->rE_WEIGHT[decIdx] ? pars->M_dec_maxrE[decIdx][orderBand-1] : pars->M_dec[decIdx][orderBand-1];
+            scale = pars->M_norm[decIdx][orderBand-1][pData->diffEQmode[decIdx]==AMPLITUDE_PRESERVING ? 0 : 1];
+            for(i=0; i<nLoudspeakers; i++)
+                for(j=0; j<nSH_band; j++)
+                    decFB[band*nLoudspeakers*max_nSH + i*max_nSH + j] = cmplxf(scale*M[i*nSH_band+j], 0.0f);
+        }
+
+        /* Bake the (interpolated) HRTFs into the decoder, if binauralising */
+        if(pData->binauraliseLS){
+            firFB = calloc1d(HYBRID_BANDS*NUM_EARS*max_nSH, sizeof(float_complex));
+            for(ch=0; ch<nLoudspeakers; ch++){
+                if(pData->recalc_hrtf_interpFLAG[ch]){
+                    ambi_dec_interpHRTFs(hAmbi, pData->loudpkrs_dirs_deg[ch][0], pData->loudpkrs_dirs_deg[ch][1], pars->hrtf_interp[ch]);
+                    pData->recalc_hrtf_interpFLAG[ch] = 0;
+                }
+                for(band=0; band<HYBRID_BANDS; band++)
+                    for(i=0; i<NUM_EARS; i++)
+                        for(j=0; j<max_nSH; j++)
+                            firFB[band*NUM_EARS*max_nSH + i*max_nSH + j] = ccaddf(firFB[band*NUM_EARS*max_nSH + i*max_nSH + j],
+                                                                                  crmulf(ccmulf(pars->hrtf_interp[ch][band][i], decFB[band*nLoudspeakers*max_nSH + ch*max_nSH + j]),
+                                                                                         1.0f/sqrtf((float)nLoudspeakers)));
+            }
+        }
+        else
+            firFB = decFB;
+
+        /* Design the FIRs, and rearrange them into: nOutputs x nSH x FIR_DEC_LENGTH */
+        firs_tmp = malloc1d(max_nSH*nOutputs*FIR_DEC_LENGTH*sizeof(float));
+        firs = malloc1d(nOutputs*max_nSH*FIR_DEC_LENGTH*sizeof(float));
+        afSTFT_filterbankCoeffsToFIR(firFB, max_nSH, nOutputs, HOP_SIZE, 1, FIR_DEC_LENGTH, FIR_DEC_DELAY, firs_tmp);
+        for(i=0; i<nOutputs; i++)
+            for(j=0; j<max_nSH; j++)
+                memcpy(&firs[(i*max_nSH+j)*FIR_DEC_LENGTH], &firs_tmp[(j*nOutputs+i)*FIR_DEC_LENGTH], FIR_DEC_LENGTH*sizeof(float));
+        saf_matrixConv_create(&(pData->hMatrixConv), AMBI_DEC_FRAME_SIZE, firs, FIR_DEC_LENGTH, max_nSH, nOutputs, 1);
+
+        /* clean-up */
+        if(firFB!=decFB)
+            free(firFB);
+        free(decFB);
+        free(firs_tmp);
+        free(firs);
+    }
     
     /* done! */
     strcpy(pData->progressBarText,"Done!");
@@ -466,16 +595,20 @@ void ambi_dec_process
 {
     ambi_dec_data *pData = (ambi_dec_data*)(hAmbi);
     ambi_dec_codecPars* pars = pData->pars;
-    int ch, ear, i, band, orderBand, nSH_band, decIdx, nSH;
+    int ch, ear, band, orderBand, nSH_band, decIdx, nSH;
     const float_complex calpha = cmplxf(1.0f, 0.0f), cbeta = cmplxf(0.0f, 0.0f);
 
     /* local copies of user parameters */
-    int nLoudspeakers, binauraliseLS, masterOrder;
+    int nLoudspeakers, binauraliseLS, masterOrder, enableFIR;
     int orderPerBand[HYBRID_BANDS], rE_WEIGHT[NUM_DECODERS];
     float transitionFreq;
     AMBI_DEC_DIFFUSE_FIELD_EQ_APPROACH diffEQmode[NUM_DECODERS];
     NORM_TYPES norm;
     CH_ORDER chOrdering;
+    HOA_CH_ORDER inChOrder = HOA_CH_ORDER_ACN;
+    HOA_NORM inNorm = HOA_NORM_N3D;
+    int chPerm[MAX_NUM_SH_SIGNALS];
+    float chGains[MAX_NUM_SH_SIGNALS];
     masterOrder = pData->masterOrder;
     nSH = ORDER2NSH(masterOrder);
     nLoudspeakers = pData->nLoudpkrs;
@@ -483,89 +616,94 @@ void ambi_dec_process
     transitionFreq = pData->transitionFreq;
     memcpy(diffEQmode, pData->diffEQmode, NUM_DECODERS*sizeof(int));
     binauraliseLS = pData->binauraliseLS;
+    enableFIR = pData->enableFIRdecoding;
     norm = pData->norm;
     chOrdering = pData->chOrdering;
     memcpy(rE_WEIGHT, pData->rE_WEIGHT, NUM_DECODERS*sizeof(int));
     
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
+
     /* Process frame */
     if (nSamples == AMBI_DEC_FRAME_SIZE && (pData->codecStatus == CODEC_STATUS_INITIALISED) ) {
         pData->procStatus = PROC_STATUS_ONGOING;
 
-        /* Load time-domain data */
-        for(i=0; i < SAF_MIN(nSH, nInputs); i++)
-            utility_svvcopy(inputs[i], AMBI_DEC_FRAME_SIZE, pData->SHFrameTD[i]);
-        for(; i<nSH; i++)
-            memset(pData->SHFrameTD[i], 0, AMBI_DEC_FRAME_SIZE * sizeof(float)); /* fill remaining channels with zeros */
-
-        /* account for channel order convention */
+        /* Load time-domain data, converting from the input conventions to ACN/N3D in the same pass (any remaining
+         * channels are filled with zeros) */
         switch(chOrdering){
-            case CH_ACN: /* already ACN, do nothing */ break; /* Otherwise, convert to ACN... */
-            case CH_FUMA: convertHOAChannelConvention(FLATTEN2D(pData->SHFrameTD), masterOrder, AMBI_DEC_FRAME_SIZE, HOA_CH_ORDER_FUMA, HOA_CH_ORDER_ACN); break;
+            case CH_ACN:  inChOrder = HOA_CH_ORDER_ACN;  break;
+            case CH_FUMA: inChOrder = HOA_CH_ORDER_FUMA; break;
         }
-
-        /* account for input normalisation scheme */
         switch(norm){
-            case NORM_N3D:  /* already in N3D, do nothing */ break; /* Otherwise, convert to N3D... */
-            case NORM_SN3D: convertHOANormConvention(FLATTEN2D(pData->SHFrameTD), masterOrder, AMBI_DEC_FRAME_SIZE, HOA_NORM_SN3D, HOA_NORM_N3D); break;
-            case NORM_FUMA: convertHOANormConvention(FLATTEN2D(pData->SHFrameTD), masterOrder, AMBI_DEC_FRAME_SIZE, HOA_NORM_FUMA, HOA_NORM_N3D); break;
+            case NORM_N3D:  inNorm = HOA_NORM_N3D;  break;
+            case NORM_SN3D: inNorm = HOA_NORM_SN3D; break;
+            case NORM_FUMA: inNorm = HOA_NORM_FUMA; break;
         }
+        getHOAConventionTransform(masterOrder, inChOrder, inNorm, HOA_CH_ORDER_ACN, HOA_NORM_N3D, chPerm, chGains);
+        applyHOAConventionTransform(inputs, nInputs, chPerm, chGains, nSH, AMBI_DEC_FRAME_SIZE, pData->SHFrameTD);
+
+        /* Apply the decoder (and HRTFs) in the time-domain, using the FIR filters (lower latency) */
+        if(enableFIR)
+            saf_matrixConv_apply(pData->hMatrixConv, FLATTEN2D(pData->SHFrameTD), FLATTEN2D(pData->outputFrameTD));
+        /* Or apply them in the time-frequency domain */
+        else{
+            /* Apply time-frequency transform (TFT) */
+            afSTFT_forward_knownDimensions(pData->hSTFT, pData->SHFrameTD, AMBI_DEC_FRAME_SIZE, MAX_NUM_SH_SIGNALS, TIME_SLOTS, pData->SHframeTF);
+
+            /* Decode to loudspeaker set-up */
+            memset(FLATTEN3D(pData->outputframeTF), 0, HYBRID_BANDS*MAX_NUM_LOUDSPEAKERS*TIME_SLOTS*sizeof(float_complex));
+            for(band=0; band<HYBRID_BANDS; band++){
+                orderBand = SAF_MAX(SAF_MIN(orderPerBand[band], masterOrder),1);
+                nSH_band = (orderBand+1)*(orderBand+1);
+
+                /* There is a different decoder for low (0) and high (1) frequencies, and for max_rE weights enabled/disabled */
+                decIdx = pData->freqVector[band] < transitionFreq ? 0 : 1;
+                if(rE_WEIGHT[decIdx]){
+                    cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nLoudspeakers, TIME_SLOTS, nSH_band, &calpha,
+                                pars->M_dec_cmplx_maxrE[decIdx][orderBand-1], nSH_band,
+                                FLATTEN2D(pData->SHframeTF[band]), TIME_SLOTS, &cbeta,
+                                FLATTEN2D(pData->outputframeTF[band]), TIME_SLOTS);
+                }
+                else{
+                    cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nLoudspeakers, TIME_SLOTS, nSH_band, &calpha,
+                                pars->M_dec_cmplx[decIdx][orderBand-1], nSH_band,
+                                FLATTEN2D(pData->SHframeTF[band]), TIME_SLOTS, &cbeta,
+                                FLATTEN2D(pData->outputframeTF[band]), TIME_SLOTS);
+                }
 
-        /* Apply time-frequency transform (TFT) */
-        afSTFT_forward_knownDimensions(pData->hSTFT, pData->SHFrameTD, AMBI_DEC_FRAME_SIZE, MAX_NUM_SH_SIGNALS, TIME_SLOTS, pData->SHframeTF);
-
-        /* Decode to loudspeaker set-up */
-        memset(FLATTEN3D(pData->outputframeTF), 0, HYBRID_BANDS*MAX_NUM_LOUDSPEAKERS*TIME_SLOTS*sizeof(float_complex));
-        for(band=0; band<HYBRID_BANDS; band++){
-            orderBand = SAF_MAX(SAF_MIN(orderPerBand[band], masterOrder),1);
-            nSH_band = (orderBand+1)*(orderBand+1);
-
-            /* There is a different decoder for low (0) and high (1) frequencies, and for max_rE weights enabled/disabled */
-            decIdx = pData->freqVector[band] < transitionFreq ? 0 : 1;
-            if(rE_WEIGHT[decIdx]){
-                cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nLoudspeakers, TIME_SLOTS, nSH_band, &calpha,
-                            pars->M_dec_cmplx_maxrE[decIdx][orderBand-1], nSH_band,
-                            FLATTEN2D(pData->SHframeTF[band]), TIME_SLOTS, &cbeta,
-                            FLATTEN2D(pData->outputframeTF[band]), TIME_SLOTS);
+                /* Apply scaling to preserve either the amplitude or energy when the decododing orders are different over frequency */
+                cblas_sscal(/*re+im*/2*nLoudspeakers*TIME_SLOTS, pars->M_norm[decIdx][orderBand-1][diffEQmode[decIdx]==AMPLITUDE_PRESERVING ? 0 : 1],
+                            (float*)FLATTEN2D(pData->outputframeTF[band]), 1);
             }
-            else{
-                cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nLoudspeakers, TIME_SLOTS, nSH_band, &calpha,
-                            pars->M_dec_cmplx[decIdx][orderBand-1], nSH_band,
-                            FLATTEN2D(pData->SHframeTF[band]), TIME_SLOTS, &cbeta,
-                            FLATTEN2D(pData->outputframeTF[band]), TIME_SLOTS);
-            }
-
-            /* Apply scaling to preserve either the amplitude or energy when the decododing orders are different over frequency */
-            cblas_sscal(/*re+im*/2*nLoudspeakers*TIME_SLOTS, pars->M_norm[decIdx][orderBand-1][diffEQmode[decIdx]==AMPLITUDE_PRESERVING ? 0 : 1],
-                        (float*)FLATTEN2D(pData->outputframeTF[band]), 1);
-        }
 
-        /* Binauralise the loudspeaker signals */
-        if(binauraliseLS){
-            /* Initialise the binaural buffer with zeros */
-            memset(FLATTEN3D(pData->binframeTF), 0, HYBRID_BANDS*NUM_EARS*TIME_SLOTS * sizeof(float_complex));
+            /* Binauralise the loudspeaker signals */
+            if(binauraliseLS){
+                /* Initialise the binaural buffer with zeros */
+                memset(FLATTEN3D(pData->binframeTF), 0, HYBRID_BANDS*NUM_EARS*TIME_SLOTS * sizeof(float_complex));
+
+                /* Convolve each loudspeaker signals with the respective HRTFs */
+                for (ch = 0; ch < nLoudspeakers; ch++) {
+                    if(pData->recalc_hrtf_interpFLAG[ch]){
+                        /* Re-compute the interpolated HRTF (only if loudspeaker direction changed) */
+                        ambi_dec_interpHRTFs(hAmbi, pData->loudpkrs_dirs_deg[ch][0], pData->loudpkrs_dirs_deg[ch][1], pars->hrtf_interp[ch]);
+                        pData->recalc_hrtf_interpFLAG[ch] = 0;
+                    }
 
-            /* Convolve each loudspeaker signals with the respective HRTFs */
-            for (ch = 0; ch < nLoudspeakers; ch++) {
-                if(pData->recalc_hrtf_interpFLAG[ch]){
-                    /* Re-compute the interpolated HRTF (only if loudspeaker direction changed) */
-                    ambi_dec_interpHRTFs(hAmbi, pData->loudpkrs_dirs_deg[ch][0], pData->loudpkrs_dirs_deg[ch][1], pars->hrtf_interp[ch]);
-                    pData->recalc_hrtf_interpFLAG[ch] = 0;
+                    /* Convolve this loudspeaker channel with the interpolated HRTF, and add it to the binaural buffer */
+                    for (band = 0; band < HYBRID_BANDS; band++)
+                        for (ear = 0; ear < NUM_EARS; ear++)
+                            cblas_caxpy(TIME_SLOTS, &pars->hrtf_interp[ch][band][ear], pData->outputframeTF[band][ch], 1, pData->binframeTF[band][ear], 1);
                 }
 
-                /* Convolve this loudspeaker channel with the interpolated HRTF, and add it to the binaural buffer */
-                for (band = 0; band < HYBRID_BANDS; band++)
-                    for (ear = 0; ear < NUM_EARS; ear++)
-                        cblas_caxpy(TIME_SLOTS, &pars->hrtf_interp[ch][band][ear], pData->outputframeTF[band][ch], 1, pData->binframeTF[band][ear], 1);
+                /* Scale by sqrt(number of loudspeakers) */
+                cblas_sscal(/*re+im*/2*HYBRID_BANDS*NUM_EARS*TIME_SLOTS, 1.0f/sqrtf((float)nLoudspeakers), (float*)FLATTEN3D(pData->binframeTF), 1);
             }
 
-            /* Scale by sqrt(number of loudspeakers) */
-            cblas_sscal(/*re+im*/2*HYBRID_BANDS*NUM_EARS*TIME_SLOTS, 1.0f/sqrtf((float)nLoudspeakers), (float*)FLATTEN3D(pData->binframeTF), 1);
+            /* inverse-TFT */
+            afSTFT_backward_knownDimensions(pData->hSTFT,        binauraliseLS ? pData->binframeTF : pData->outputframeTF,
+                                            AMBI_DEC_FRAME_SIZE, binauraliseLS ? NUM_EARS : MAX_NUM_LOUDSPEAKERS, TIME_SLOTS, pData->outputFrameTD);
         }
 
-        /* inverse-TFT */
-        afSTFT_backward_knownDimensions(pData->hSTFT,        binauraliseLS ? pData->binframeTF : pData->outputframeTF,
-                                        AMBI_DEC_FRAME_SIZE, binauraliseLS ? NUM_EARS : MAX_NUM_LOUDSPEAKERS, TIME_SLOTS, pData->outputFrameTD);
-
         /* Copy to output buffer */
         for(ch = 0; ch < SAF_MIN(binauraliseLS==1 ? NUM_EARS : nLoudspeakers, nOutputs); ch++)
             utility_svvcopy(pData->outputFrameTD[ch], AMBI_DEC_FRAME_SIZE, outputs[ch]);
@@ -577,6 +715,7 @@ void ambi_dec_process
             memset(outputs[ch], 0, AMBI_DEC_FRAME_SIZE*sizeof(float));
 
     pData->procStatus = PROC_STATUS_NOT_ONGOING;
+    md_rt_exitRegion();
 }
 
 
@@ -608,6 +747,8 @@ void ambi_dec_setDecOrder(void  * const hAmbi, int newValue, int bandIdx)
 {
     ambi_dec_data *pData = (ambi_dec_data*)(hAmbi);
     pData->orderPerBand[bandIdx] = SAF_MIN(SAF_MAX(newValue,1), pData->new_masterOrder);
+    if(pData->enableFIRdecoding)
+        ambi_dec_setCodecStatus(hAmbi, CODEC_STATUS_NOT_INITIALISED); /* the FIR filters need to be redesigned */
 }
 
 void ambi_dec_setDecOrderAllBands(void  * const hAmbi, int newValue)
@@ -617,6 +758,8 @@ void ambi_dec_setDecOrderAllBands(void  * const hAmbi, int newValue)
     
     for(band=0; band<HYBRID_BANDS; band++)
         pData->orderPerBand[band] = SAF_MIN(SAF_MAX(newValue,1), pData->new_masterOrder);
+    if(pData->enableFIRdecoding)
+        ambi_dec_setCodecStatus(hAmbi, CODEC_STATUS_NOT_INITIALISED); /* the FIR filters need to be redesigned */
 }
 
 void ambi_dec_setLoudspeakerAzi_deg(void* const hAmbi, int index, float newAzi_deg)
@@ -667,6 +810,15 @@ void ambi_dec_setBinauraliseLSflag(void* const hAmbi, int newState)
         ambi_dec_setCodecStatus(hAmbi, CODEC_STATUS_NOT_INITIALISED);
 }
 
+void ambi_dec_setEnableFIRdecoding(void* const hAmbi, int newState)
+{
+    ambi_dec_data *pData = (ambi_dec_data*)(hAmbi);
+
+    pData->new_enableFIRdecoding = newState;
+    if(pData->new_enableFIRdecoding != pData->enableFIRdecoding)
+        ambi_dec_setCodecStatus(hAmbi, CODEC_STATUS_NOT_INITIALISED);
+}
+
 void ambi_dec_setUseDefaultHRIRsflag(void* const hAmbi, int newState)
 {
     ambi_dec_data *pData = (ambi_dec_data*)(hAmbi);
@@ -688,6 +840,21 @@ void ambi_dec_setSofaFilePath(void* const hAmbi, const char* path)
     ambi_dec_refreshSettings(hAmbi);  // re-init and re-calc
 }
 
+void ambi_dec_setDecoderCacheDir(void* const hAmbi, const char* path)
+{
+    ambi_dec_data *pData = (ambi_dec_data*)(hAmbi);
+    ambi_dec_codecPars* pars = pData->pars;
+
+    if(path==NULL || path[0]=='\0'){
+        free(pars->decoderCache_dir);
+        pars->decoderCache_dir = NULL;
+    }
+    else{
+        pars->decoderCache_dir = realloc1d(pars->decoderCache_dir, strlen(path) + 1);
+        strcpy(pars->decoderCache_dir, path);
+    }
+}
+
 void ambi_dec_setEnableHRIRsPreProc(void* const hAmbi, int newState)
 {
     ambi_dec_data *pData = (ambi_dec_data*)(hAmbi);
@@ -772,6 +939,8 @@ void ambi_dec_setSourcePreset(void* const hAmbi, int newPresetID)
             }
             break;
     }
+    if(pData->enableFIRdecoding)
+        ambi_dec_setCodecStatus(hAmbi, CODEC_STATUS_NOT_INITIALISED); /* the FIR filters need to be redesigned */
 }
 
 void ambi_dec_setChOrder(void* const hAmbi, int newOrder)
@@ -799,18 +968,24 @@ void ambi_dec_setDecEnableMaxrE(void* const hAmbi, int index, int newID)
 {
     ambi_dec_data *pData = (ambi_dec_data*)(hAmbi);
     pData->rE_WEIGHT[index] = newID;
+    if(pData->enableFIRdecoding)
+        ambi_dec_setCodecStatus(hAmbi, CODEC_STATUS_NOT_INITIALISED); /* the FIR filters need to be redesigned */
 }
 
 void ambi_dec_setDecNormType(void* const hAmbi, int index, int newID)
 {
     ambi_dec_data *pData = (ambi_dec_data*)(hAmbi);
     pData->diffEQmode[index] = newID;
+    if(pData->enableFIRdecoding)
+        ambi_dec_setCodecStatus(hAmbi, CODEC_STATUS_NOT_INITIALISED); /* the FIR filters need to be redesigned */
 }
 
 void ambi_dec_setTransitionFreq(void* const hAmbi, float newValue)
 {
     ambi_dec_data *pData = (ambi_dec_data*)(hAmbi);
     pData->transitionFreq = SAF_CLAMP(newValue, AMBI_DEC_TRANSITION_MIN_VALUE, AMBI_DEC_TRANSITION_MAX_VALUE);
+    if(pData->enableFIRdecoding)
+        ambi_dec_setCodecStatus(hAmbi, CODEC_STATUS_NOT_INITIALISED); /* the FIR filters need to be redesigned */
 }
 
 
@@ -911,6 +1086,12 @@ int ambi_dec_getBinauraliseLSflag(void* const hAmbi)
     return pData->new_binauraliseLS;
 }
 
+int ambi_dec_getEnableFIRdecoding(void* const hAmbi)
+{
+    ambi_dec_data *pData = (ambi_dec_data*)(hAmbi);
+    return pData->new_enableFIRdecoding;
+}
+
 int ambi_dec_getUseDefaultHRIRsflag(void* const hAmbi)
 {
     ambi_dec_data *pData = (ambi_dec_data*)(hAmbi);
@@ -927,6 +1108,13 @@ char* ambi_dec_getSofaFilePath(void* const hAmbi)
         return "no_file";
 }
 
+char* ambi_dec_getDecoderCacheDir(void* const hAmbi)
+{
+    ambi_dec_data *pData = (ambi_dec_data*)(hAmbi);
+    ambi_dec_codecPars* pars = pData->pars;
+    return pars->decoderCache_dir;
+}
+
 int ambi_dec_getEnableHRIRsPreProc(void* const hAmbi)
 {
     ambi_dec_data *pData = (ambi_dec_data*)(hAmbi);
@@ -987,5 +1175,13 @@ int ambi_dec_getProcessingDelay()
     return 12*HOP_SIZE;
 }
 
+int ambi_dec_getProcessingDelayEx(void* const hAmbi)
+{
+    ambi_dec_data *pData = (ambi_dec_data*)(hAmbi);
+    if(pData->enableFIRdecoding)
+        return FIR_DEC_DELAY;
+    return ambi_dec_getProcessingDelay();
+}
+
 
 
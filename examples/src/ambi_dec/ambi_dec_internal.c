@@ -71,6 +71,7 @@ void ambi_dec_interpHRTFs
     float_complex ipd;
     float aziRes, elevRes, weights[1][3], itds3[3],  itdInterp[1];
     float magnitudes3[HYBRID_BANDS][3][NUM_EARS], magInterp[HYBRID_BANDS][NUM_EARS];
+    float* mags3;
 
     /* find closest pre-computed VBAP direction */
     aziRes = (float)pars->hrtf_vbapTableRes[0];
@@ -85,9 +86,10 @@ void ambi_dec_interpHRTFs
     /* retrieve the 3 itds and hrtf magnitudes */
     for (i = 0; i < 3; i++) {
         itds3[i] = pars->itds_s[pars->hrtf_vbap_gtableIdx[idx3d*3+i]];
+        mags3 = &pars->hrtf_fb_mag[pars->hrtf_vbap_gtableIdx[idx3d*3+i]*HYBRID_BANDS*NUM_EARS]; /* (direction-major) */
         for (band = 0; band < HYBRID_BANDS; band++) {
-            magnitudes3[band][i][0] = pars->hrtf_fb_mag[band*NUM_EARS*(pars->N_hrir_dirs) + 0*(pars->N_hrir_dirs) + pars->hrtf_vbap_gtableIdx[idx3d*3+i]];
-            magnitudes3[band][i][1] = pars->hrtf_fb_mag[band*NUM_EARS*(pars->N_hrir_dirs) + 1*(pars->N_hrir_dirs) + pars->hrtf_vbap_gtableIdx[idx3d*3+i]];
+            magnitudes3[band][i][0] = mags3[band*NUM_EARS + 0];
+            magnitudes3[band][i][1] = mags3[band*NUM_EARS + 1];
         }
     }
     
@@ -71,6 +71,8 @@ extern "C" {
 #define MAX_NUM_LOUDSPEAKERS ( MAX_NUM_OUTPUTS )       /**< Maximum permitted output channels */
 #define MIN_NUM_LOUDSPEAKERS ( 4 )                     /**< To avoid triangulation errors when using AllRAD */
 #define NUM_DECODERS ( 2 )                             /**< One for low-frequencies and another for high-frequencies */
+#define FIR_DEC_LENGTH ( 2*HOP_SIZE )                  /**< Length of the FIR decoding filters, in samples */
+#define FIR_DEC_DELAY ( HOP_SIZE/2 )                   /**< Modelling delay of the FIR decoding filters, in samples */
 
 /* Checks: */
 #if (AMBI_DEC_FRAME_SIZE % HOP_SIZE != 0)
@@ -93,6 +95,7 @@ typedef struct _ambi_dec_codecPars
     float* M_dec_maxrE[NUM_DECODERS][MAX_SH_ORDER]; /**< ambisonic decoding matrices with maxrE weighting ([0] for low-freq, [1] for high-freq); FLAT: nLoudspeakers x nSH */
     float_complex* M_dec_cmplx_maxrE[NUM_DECODERS][MAX_SH_ORDER]; /**< complex ambisonic decoding matrices with maxrE weighting ([0] for low-freq, [1] for high-freq); FLAT: nLoudspeakers x nSH */
     float M_norm[NUM_DECODERS][MAX_SH_ORDER][2]; /**< norm coefficients to preserve omni energy/amplitude between different orders and decoders */
+    char* decoderCache_dir;                     /**< directory of the on-disk decoder cache (NULL: disabled), see saf_utility_cache.h */
     
     /* sofa file info */
     char* sofa_filepath;                        /**< absolute/relevative file path for a sofa file */
@@ -112,7 +115,7 @@ typedef struct _ambi_dec_codecPars
     /* hrir filterbank coefficients */
     float* itds_s;                              /**< interaural-time differences for each HRIR (in seconds); N_hrirs x 1 */
     float_complex* hrtf_fb;                     /**< HRTF filterbank coefficients; nBands x nCH x N_hrirs */
-    float* hrtf_fb_mag;                         /**< magnitudes of the HRTF filterbank coefficients; nBands x nCH x N_hrirs */
+    float* hrtf_fb_mag;                         /**< magnitudes of the HRTF filterbank coefficients (direction-major); N_hrirs x nBands x nCH */
     float_complex hrtf_interp[MAX_NUM_LOUDSPEAKERS][HYBRID_BANDS][NUM_EARS]; /**< interpolated HRTFs */
     
     /* integration weights */
@@ -133,6 +136,7 @@ typedef struct _ambi_dec
     float_complex*** outputframeTF;      /**< Output loudspeaker signals in the time-frequency domain; #HYBRID_BANDS x #MAX_NUM_LOUDSPEAKERS x #TIME_SLOTS */
     float_complex*** binframeTF;         /**< Output binaural signals in the time-frequency domain; #HYBRID_BANDS x #NUM_EARS x #TIME_SLOTS */
     void* hSTFT;                         /**< afSTFT handle */
+    void* hMatrixConv;                   /**< matrixConv handle, for applying the FIR decoding filters */
     int afSTFTdelay;                     /**< for host delay compensation */ 
     int fs;                              /**< host sampling rate */
     float freqVector[HYBRID_BANDS];      /**< frequency vector for time-frequency transform, in Hz */
@@ -148,6 +152,7 @@ typedef struct _ambi_dec
     int new_nLoudpkrs;                   /**< if new_nLoudpkrs != nLoudpkrs, afSTFT is reinitialised  (current value will be replaced by this after next re-init) */
     int new_binauraliseLS;               /**< if new_binauraliseLS != binauraliseLS, ambi_dec is reinitialised (current value will be replaced by this after next re-init) */
     int new_masterOrder;                 /**< if new_masterOrder != masterOrder, ambi_dec is reinitialised (current value will be replaced by this after next re-init) */
+    int new_enableFIRdecoding;           /**< if new_enableFIRdecoding != enableFIRdecoding, ambi_dec is reinitialised (current value will be replaced by this after next re-init) */
     
     /* flags */
     PROC_STATUS procStatus;              /**< see #PROC_STATUS */
@@ -166,6 +171,7 @@ typedef struct _ambi_dec
     int useDefaultHRIRsFLAG;             /**< 1: use default HRIRs in database, 0: use those from SOFA file */
     int enableHRIRsPreProc;              /**< flag to apply pre-processing to the currently loaded HRTFs */
     int binauraliseLS;                   /**< 1: convolve loudspeaker signals with HRTFs, 0: output loudspeaker signals */
+    int enableFIRdecoding;               /**< 0: decode in the time-frequency domain, 1: decode in the time-domain with FIR filters */
     CH_ORDER chOrdering;                 /**< Ambisonic channel order convention (see #CH_ORDER) */
     NORM_TYPES norm;                     /**< Ambisonic normalisation convention (see #NORM_TYPES) */
     
@@ -153,6 +153,9 @@ void ambi_drc_process
         pData->reInitTFT = 0;
     }
 
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
+
     /* local copies of user parameters */
     alpha_a = expf(-1.0f / ( (pData->attack_ms  / ((float)AMBI_DRC_FRAME_SIZE / (float)TIME_SLOTS)) * pData->fs * 0.001f));
     alpha_r = expf(-1.0f / ( (pData->release_ms / ((float)AMBI_DRC_FRAME_SIZE / (float)TIME_SLOTS)) * pData->fs * 0.001f));
@@ -231,6 +234,7 @@ void ambi_drc_process
         for (ch=0; ch < nCh; ch++)
             memset(outputs[ch], 0, AMBI_DRC_FRAME_SIZE*sizeof(float));
     }
+    md_rt_exitRegion();
 }
 
 /* SETS */
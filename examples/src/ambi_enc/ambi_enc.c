@@ -97,10 +97,15 @@ void ambi_enc_process
     int i, j, ch, nSources, nSH, mixWithPreviousFLAG;
     float src_dirs[MAX_NUM_INPUTS][2], scale;
     float Y_src[MAX_NUM_SH_SIGNALS];
+    float* frameTD[MAX_NUM_SH_SIGNALS];
+    int chPerm[MAX_NUM_SH_SIGNALS];
+    float chGains[MAX_NUM_SH_SIGNALS];
 
     /* local copies of user parameters */
     CH_ORDER chOrdering;
     NORM_TYPES norm;
+    HOA_CH_ORDER outChOrder = HOA_CH_ORDER_ACN;
+    HOA_NORM outNorm = HOA_NORM_N3D;
     int order;
     chOrdering = pData->chOrdering;
     norm = pData->norm;
@@ -109,6 +114,9 @@ void ambi_enc_process
     order = SAF_MIN(pData->order, MAX_SH_ORDER);
     nSH = ORDER2NSH(order);
 
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
+
     /* Process frame */
     if (nSamples == AMBI_ENC_FRAME_SIZE) {
         /* Load time-domain data */
@@ -164,35 +172,34 @@ void ambi_enc_process
         /* for next frame */
         utility_svvcopy((const float*)pData->inputFrameTD, MAX_NUM_INPUTS*AMBI_ENC_FRAME_SIZE, (float*)pData->prev_inputFrameTD);
 
-        /* scale by 1/sqrt(nSources) */
-        if(pData->enablePostScaling){
-            scale = 1.0f/sqrtf((float)nSources);
-            cblas_sscal(nSH*AMBI_ENC_FRAME_SIZE, scale, (float*)pData->outputFrameTD, 1);
-        }
-
-        /* account for output channel order */
+        /* Copy to output, whilst converting from ACN/N3D to the output conventions and scaling by 1/sqrt(nSources)
+         * (if enabled), all in the same pass */
         switch(chOrdering){
-            case CH_ACN:  /* already ACN, do nothing */  break;
-            case CH_FUMA: convertHOAChannelConvention((float*)pData->outputFrameTD, order, AMBI_ENC_FRAME_SIZE, HOA_CH_ORDER_ACN, HOA_CH_ORDER_FUMA); break;
+            case CH_ACN:  outChOrder = HOA_CH_ORDER_ACN;  break;
+            case CH_FUMA: outChOrder = HOA_CH_ORDER_FUMA; break;
         }
-
-        /* account for normalisation scheme */
         switch(norm){
-            case NORM_N3D:  /* already N3D, do nothing */ break;  
-            case NORM_SN3D: convertHOANormConvention((float*)pData->outputFrameTD, order, AMBI_ENC_FRAME_SIZE, HOA_NORM_N3D, HOA_NORM_SN3D); break;
-            case NORM_FUMA: convertHOANormConvention((float*)pData->outputFrameTD, order, AMBI_ENC_FRAME_SIZE, HOA_NORM_N3D, HOA_NORM_FUMA); break;
+            case NORM_N3D:  outNorm = HOA_NORM_N3D;  break;
+            case NORM_SN3D: outNorm = HOA_NORM_SN3D; break;
+            case NORM_FUMA: outNorm = HOA_NORM_FUMA; break;
         }
-
-        /* Copy to output */
-        for(i = 0; i < SAF_MIN(nSH,nOutputs); i++)
-            utility_svvcopy(pData->outputFrameTD[i], AMBI_ENC_FRAME_SIZE, outputs[i]);
-        for(; i < nOutputs; i++)
+        getHOAConventionTransform(order, HOA_CH_ORDER_ACN, HOA_NORM_N3D, outChOrder, outNorm, chPerm, chGains);
+        if(pData->enablePostScaling){
+            scale = 1.0f/sqrtf((float)nSources);
+            for(i = 0; i < nSH; i++)
+                chGains[i] *= scale;
+        }
+        for(i = 0; i < nSH; i++)
+            frameTD[i] = pData->outputFrameTD[i];
+        applyHOAConventionTransform((const float* const*)frameTD, nSH, chPerm, chGains, SAF_MIN(nSH,nOutputs), AMBI_ENC_FRAME_SIZE, outputs);
+        for(i = SAF_MIN(nSH,nOutputs); i < nOutputs; i++)
             memset(outputs[i], 0, AMBI_ENC_FRAME_SIZE * sizeof(float));
     }
     else{
         for (ch=0; ch < nOutputs; ch++)
             memset(outputs[ch],0, AMBI_ENC_FRAME_SIZE*sizeof(float));
     }
+    md_rt_exitRegion();
 }
 
 /* Set Functions */
@@ -112,17 +112,21 @@ void ambi_roomsim_process
 )
 {
     ambi_roomsim_data *pData = (ambi_roomsim_data*)(hAmbi);
-    int i, j, rec, ch, nSources, nReceivers, nSH, order;
+    int i, rec, ch, nSources, nReceivers, nSH, order, nCh;
     float maxTime_s;
     CH_ORDER chOrdering;
     NORM_TYPES norm;
+    HOA_CH_ORDER outChOrder = HOA_CH_ORDER_ACN;
+    HOA_NORM outNorm = HOA_NORM_N3D;
+    int chPerm[MAX_NUM_SH_SIGNALS];
+    float chGains[MAX_NUM_SH_SIGNALS];
 
     /* (ims_shoebox is actually much more flexible than this. So consider this as a minimal example, which will also make things easier when designing a GUI) */
 
     /* Reinitialise room if needed */
     if(pData->reinit_room){
         ims_shoebox_destroy(&(pData->hIms));
-        ims_shoebox_create(&(pData->hIms), pData->room_dims, (float*)pData->abs_wall, 250.0f, 1, 343.0f, pData->fs);
+        ims_shoebox_create(&(pData->hIms), pData->room_dims, (float*)pData->abs_wall, 250.0f, 1, 343.0f, pData->fs, NULL);
         for(i=0; i<pData->new_nSources; i++) /* re-add source objects... */
             pData->sourceIDs[i] = ims_shoebox_addSource(pData->hIms, (float*)pData->src_pos[i], &(pData->src_sigs[i]));
         for(i=0; i<pData->new_nReceivers; i++) /* re-add receiver objects... */
@@ -155,6 +159,9 @@ void ambi_roomsim_process
         pData->nReceivers = pData->new_nReceivers;
     }
 
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
+
     /* local copies of user parameters */
     chOrdering = pData->chOrdering;
     norm = pData->norm;
@@ -187,23 +194,24 @@ void ambi_roomsim_process
             ims_shoebox_applyEchogramTD(pData->hIms, pData->receiverIDs[i], nSamples, 0);
 
         /* Handle output */
+        switch(chOrdering){
+            case CH_ACN:  outChOrder = HOA_CH_ORDER_ACN;  break;
+            case CH_FUMA: outChOrder = HOA_CH_ORDER_FUMA; break;
+        }
+        switch(norm){
+            case NORM_N3D:  outNorm = HOA_NORM_N3D;  break;
+            case NORM_SN3D: outNorm = HOA_NORM_SN3D; break;
+            case NORM_FUMA: outNorm = HOA_NORM_FUMA; break;
+        }
+        getHOAConventionTransform(order, HOA_CH_ORDER_ACN, HOA_NORM_N3D, outChOrder, outNorm, chPerm, chGains);
         for(rec=0, i=0; rec<nReceivers; rec++){
-            /* account for output channel order */
-            switch(chOrdering){
-                case CH_ACN: break;
-                case CH_FUMA: convertHOAChannelConvention(FLATTEN2D(pData->rec_sh_outsigs[rec]), order, AMBI_ROOMSIM_FRAME_SIZE, HOA_CH_ORDER_ACN, HOA_CH_ORDER_FUMA); break;
-            }
-
-            /* account for normalisation scheme */
-            switch(norm){
-                case NORM_N3D: break;
-                case NORM_SN3D: convertHOANormConvention(FLATTEN2D(pData->rec_sh_outsigs[rec]), order, AMBI_ROOMSIM_FRAME_SIZE, HOA_NORM_N3D, HOA_NORM_SN3D); break;
-                case NORM_FUMA: convertHOANormConvention(FLATTEN2D(pData->rec_sh_outsigs[rec]), order, AMBI_ROOMSIM_FRAME_SIZE, HOA_NORM_N3D, HOA_NORM_FUMA); break;
-            }
-
-            /* Append this receiver's output channels to the master output buffer */
-            for(j=0; (j<SAF_MIN(nSH, MAX_NUM_SH_SIGNALS) && i<SAF_MIN(nOutputs, MAX_NUM_CHANNELS)); j++, i++)
-                memcpy(outputs[i], pData->rec_sh_outsigs[rec][j], AMBI_ROOMSIM_FRAME_SIZE * sizeof(float));
+            /* Append this receiver's output channels to the master output buffer, whilst converting from ACN/N3D to
+             * the output conventions in the same pass */
+            nCh = SAF_MIN(SAF_MIN(nSH, MAX_NUM_SH_SIGNALS), SAF_MIN(nOutputs, MAX_NUM_CHANNELS)-i);
+            if(nCh<=0)
+                break;
+            applyHOAConventionTransform((const float* const*)pData->rec_sh_outsigs[rec], nSH, chPerm, chGains, nCh, AMBI_ROOMSIM_FRAME_SIZE, &outputs[i]);
+            i += nCh;
         }
         for(; i < nOutputs; i++)
             memset(outputs[i], 0, AMBI_ROOMSIM_FRAME_SIZE * sizeof(float));
@@ -212,6 +220,7 @@ void ambi_roomsim_process
         for (ch=0; ch < nOutputs; ch++)
             memset(outputs[ch],0, nSamples*sizeof(float));
     }
+    md_rt_exitRegion();
 }
 
 /* Set Functions */
@@ -182,7 +182,10 @@ void array2sh_process
     const float_complex calpha = cmplxf(1.0f,0.0f), cbeta = cmplxf(0.0f, 0.0f);
     CH_ORDER chOrdering;
     NORM_TYPES norm;
-    float gain_lin;
+    HOA_CH_ORDER outChOrder = HOA_CH_ORDER_ACN;
+    HOA_NORM outNorm = HOA_NORM_N3D;
+    int chPerm[MAX_NUM_SH_SIGNALS];
+    float gain_lin, chGains[MAX_NUM_SH_SIGNALS];
     
     /* reinit TFT if needed */
     array2sh_initTFT(hA2sh);
@@ -194,6 +197,9 @@ void array2sh_process
         pData->reinitSHTmatrixFLAG = 0;
     }
 
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
+
     /* local copy of user parameters */
     chOrdering = pData->chOrdering;
     norm = pData->norm;
@@ -226,26 +232,22 @@ void array2sh_process
         /* inverse-TFT */
         afSTFT_backward_knownDimensions(pData->hSTFT, pData->SHframeTF, ARRAY2SH_FRAME_SIZE, MAX_NUM_SH_SIGNALS, TIME_SLOTS, pData->SHframeTD);
 
-        /* account for output channel order */
+        /* Copy to output, whilst converting from ACN/N3D to the output conventions and applying the post-gain, all
+         * in the same pass */
         switch(chOrdering){
-            case CH_ACN:  /* already ACN, do nothing */ break;
-            case CH_FUMA: convertHOAChannelConvention(FLATTEN2D(pData->SHframeTD), order, ARRAY2SH_FRAME_SIZE, HOA_CH_ORDER_ACN, HOA_CH_ORDER_FUMA); break;
+            case CH_ACN:  outChOrder = HOA_CH_ORDER_ACN;  break;
+            case CH_FUMA: outChOrder = HOA_CH_ORDER_FUMA; break;
         }
-
-        /* account for normalisation scheme */
         switch(norm){
-            case NORM_N3D:  /* already N3D, do nothing */ break;  
-            case NORM_SN3D: convertHOANormConvention(FLATTEN2D(pData->SHframeTD), order, ARRAY2SH_FRAME_SIZE, HOA_NORM_N3D, HOA_NORM_SN3D); break;
-            case NORM_FUMA: convertHOANormConvention(FLATTEN2D(pData->SHframeTD), order, ARRAY2SH_FRAME_SIZE, HOA_NORM_N3D, HOA_NORM_FUMA); break;
+            case NORM_N3D:  outNorm = HOA_NORM_N3D;  break;
+            case NORM_SN3D: outNorm = HOA_NORM_SN3D; break;
+            case NORM_FUMA: outNorm = HOA_NORM_FUMA; break;
         }
-
-        /* Apply post-gain */
-        utility_svsmul(FLATTEN2D(pData->SHframeTD), &gain_lin, nSH*ARRAY2SH_FRAME_SIZE, NULL);
-
-        /* Copy to output */
-        for(i = 0; i < SAF_MIN(nSH,nOutputs); i++)
-            utility_svvcopy(pData->SHframeTD[i], ARRAY2SH_FRAME_SIZE, outputs[i]);
-        for(; i < nOutputs; i++)
+        getHOAConventionTransform(order, HOA_CH_ORDER_ACN, HOA_NORM_N3D, outChOrder, outNorm, chPerm, chGains);
+        for(i = 0; i < nSH; i++)
+            chGains[i] *= gain_lin;
+        applyHOAConventionTransform((const float* const*)pData->SHframeTD, nSH, chPerm, chGains, SAF_MIN(nSH,nOutputs), ARRAY2SH_FRAME_SIZE, outputs);
+        for(i = SAF_MIN(nSH,nOutputs); i < nOutputs; i++)
             memset(outputs[i], 0, ARRAY2SH_FRAME_SIZE * sizeof(float));
     }
     else{
@@ -254,6 +256,7 @@ void array2sh_process
     }
 
     pData->procStatus = PROC_STATUS_NOT_ONGOING;
+    md_rt_exitRegion();
 }
 
 /* Set Functions */
@@ -104,37 +104,44 @@ void beamformer_process
     beamformer_data *pData = (beamformer_data*)(hBeam);
     int ch, i, bi, nSH, mixWithPreviousFLAG;
     float c_n[MAX_SH_ORDER+1];
+    float* frameTD[MAX_NUM_SH_SIGNALS];
+    int chPerm[MAX_NUM_SH_SIGNALS];
+    float chGains[MAX_NUM_SH_SIGNALS];
 
     /* local copies of user parameters */
     int nBeams, beamOrder;
     NORM_TYPES norm;
     CH_ORDER chOrdering;
+    HOA_CH_ORDER inChOrder = HOA_CH_ORDER_ACN;
+    HOA_NORM inNorm = HOA_NORM_N3D;
     beamOrder = pData->beamOrder;
     nSH = ORDER2NSH(beamOrder);
     nBeams = pData->nBeams;
     norm = pData->norm;
     chOrdering = pData->chOrdering;
      
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
+
     /* Apply beamformer */
     if(nSamples == BEAMFORMER_FRAME_SIZE) {
-        /* Load time-domain data */
-        for(i=0; i < SAF_MIN(nSH, nInputs); i++)
-            utility_svvcopy(inputs[i], BEAMFORMER_FRAME_SIZE, pData->SHFrameTD[i]);
-        for(; i<MAX_NUM_SH_SIGNALS; i++)
-            memset(pData->SHFrameTD[i], 0, BEAMFORMER_FRAME_SIZE * sizeof(float)); /* fill remaining channels with zeros */
-
-        /* account for input channel order convention */
+        /* Load time-domain data, converting from the input conventions to ACN/N3D in the same pass (any remaining
+         * channels are filled with zeros) */
         switch(chOrdering){
-          case CH_ACN:  /* already ACN, do nothing*/ break; /* Otherwise, convert to ACN... */
-          case CH_FUMA: convertHOAChannelConvention((float*)pData->SHFrameTD, beamOrder, BEAMFORMER_FRAME_SIZE, HOA_CH_ORDER_FUMA, HOA_CH_ORDER_ACN); break;
+          case CH_ACN:  inChOrder = HOA_CH_ORDER_ACN;  break;
+          case CH_FUMA: inChOrder = HOA_CH_ORDER_FUMA; break;
         }
-
-        /* account for input normalisation scheme */
         switch(norm){
-          case NORM_N3D:  /* already in N3D, do nothing */ break; /* Otherwise, convert to N3D... */
-          case NORM_SN3D: convertHOANormConvention((float*)pData->SHFrameTD, beamOrder, BEAMFORMER_FRAME_SIZE, HOA_NORM_SN3D, HOA_NORM_N3D); break;
-          case NORM_FUMA: convertHOANormConvention((float*)pData->SHFrameTD, beamOrder, BEAMFORMER_FRAME_SIZE, HOA_NORM_FUMA, HOA_NORM_N3D); break;
+          case NORM_N3D:  inNorm = HOA_NORM_N3D;  break;
+          case NORM_SN3D: inNorm = HOA_NORM_SN3D; break;
+          case NORM_FUMA: inNorm = HOA_NORM_FUMA; break;
         }
+        for(i=0; i<nSH; i++)
+            frameTD[i] = pData->SHFrameTD[i];
+        getHOAConventionTransform(beamOrder, inChOrder, inNorm, HOA_CH_ORDER_ACN, HOA_NORM_N3D, chPerm, chGains);
+        applyHOAConventionTransform(inputs, nInputs, chPerm, chGains, nSH, BEAMFORMER_FRAME_SIZE, frameTD);
+        for(i=nSH; i<MAX_NUM_SH_SIGNALS; i++)
+            memset(pData->SHFrameTD[i], 0, BEAMFORMER_FRAME_SIZE * sizeof(float));
 
         /* Calculate beamforming coeffients */
         mixWithPreviousFLAG = 0;
@@ -190,6 +197,7 @@ void beamformer_process
     else
         for (ch=0; ch < nOutputs; ch++)
             memset(outputs[ch], 0, BEAMFORMER_FRAME_SIZE*sizeof(float));
+    md_rt_exitRegion();
 }
 
 
@@ -207,6 +207,9 @@ void binauraliser_process
     nSources = pData->nSources;
     enableRotation = pData->enableRotation;
     
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
+
     /* apply binaural panner */
     if ((nSamples == BINAURALISER_FRAME_SIZE) && (pData->hrtf_fb!=NULL) && (pData->codecStatus==CODEC_STATUS_INITIALISED) ){
         pData->procStatus = PROC_STATUS_ONGOING;
@@ -282,6 +285,7 @@ void binauraliser_process
     }
 
     pData->procStatus = PROC_STATUS_NOT_ONGOING;
+    md_rt_exitRegion();
 }
 
 /* Set Functions */
@@ -57,6 +57,8 @@ void binauraliser_interpHRTFs
     int aziIndex, elevIndex, N_azi, idx3d;
     float_complex ipd;
     float_complex weights_cmplx[3], hrtf_fb3[NUM_EARS][3];
+    float_complex* hrtfs3[3];
+    float* mags3[3];
     float aziRes, elevRes, weights[3], itds3[3],  itdInterp;
     float magnitudes3[HYBRID_BANDS][3][NUM_EARS], magInterp[HYBRID_BANDS][NUM_EARS];
     const float_complex calpha = cmplxf(1.0f, 0.0f), cbeta = cmplxf(0.0f, 0.0f);
@@ -68,8 +70,12 @@ void binauraliser_interpHRTFs
     aziIndex = (int)(matlab_fmodf(azimuth_deg + 180.0f, 360.0f) / aziRes + 0.5f);
     elevIndex = (int)((elevation_deg + 90.0f) / elevRes + 0.5f);
     idx3d = elevIndex * N_azi + aziIndex;
-    for (i = 0; i < 3; i++)
+    for (i = 0; i < 3; i++){
         weights[i] = pData->hrtf_vbap_gtableComp[idx3d*3 + i];
+        /* (direction-major, so each of the 3 HRTFs is one contiguous block) */
+        hrtfs3[i] = &pData->hrtf_fb[pData->hrtf_vbap_gtableIdx[idx3d*3+i]*HYBRID_BANDS*NUM_EARS];
+        mags3[i] = &pData->hrtf_fb_mag[pData->hrtf_vbap_gtableIdx[idx3d*3+i]*HYBRID_BANDS*NUM_EARS];
+    }
 
     switch(mode){
         case INTERP_TRI:
@@ -77,8 +83,8 @@ void binauraliser_interpHRTFs
                 weights_cmplx[i] = cmplxf(weights[i], 0.0f);
             for (band = 0; band < HYBRID_BANDS; band++) {
                 for (i = 0; i < 3; i++){
-                    hrtf_fb3[0][i] = pData->hrtf_fb[band*NUM_EARS*(pData->N_hrir_dirs) + 0*(pData->N_hrir_dirs) + pData->hrtf_vbap_gtableIdx[idx3d*3+i]];
-                    hrtf_fb3[1][i] = pData->hrtf_fb[band*NUM_EARS*(pData->N_hrir_dirs) + 1*(pData->N_hrir_dirs) + pData->hrtf_vbap_gtableIdx[idx3d*3+i]];
+                    hrtf_fb3[0][i] = hrtfs3[i][band*NUM_EARS + 0];
+                    hrtf_fb3[1][i] = hrtfs3[i][band*NUM_EARS + 1];
                 } 
                 cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, NUM_EARS, 1, 3, &calpha,
                             (float_complex*)hrtf_fb3, 3,
@@ -92,8 +98,8 @@ void binauraliser_interpHRTFs
             for (i = 0; i < 3; i++) {
                 itds3[i] = pData->itds_s[pData->hrtf_vbap_gtableIdx[idx3d*3+i]];
                 for (band = 0; band < HYBRID_BANDS; band++) {
-                    magnitudes3[band][i][0] = pData->hrtf_fb_mag[band*NUM_EARS*(pData->N_hrir_dirs) + 0*(pData->N_hrir_dirs) + pData->hrtf_vbap_gtableIdx[idx3d*3+i]];
-                    magnitudes3[band][i][1] = pData->hrtf_fb_mag[band*NUM_EARS*(pData->N_hrir_dirs) + 1*(pData->N_hrir_dirs) + pData->hrtf_vbap_gtableIdx[idx3d*3+i]];
+                    magnitudes3[band][i][0] = mags3[i][band*NUM_EARS + 0];
+                    magnitudes3[band][i][1] = mags3[i][band*NUM_EARS + 1];
                 }
             }
 
@@ -127,6 +133,8 @@ void binauraliser_initHRTFsAndGainTables(void* const hBin)
     binauraliser_data *pData = (binauraliser_data*)(hBin);
     int i, new_len;
     float* hrtf_vbap_gtable, *hrirs_resampled;//, *hrir_dirs_rad;
+    float_complex* hrtf_fb_dm;
+    void* hPool;
 #ifdef SAF_ENABLE_SOFA_READER_MODULE
     SAF_SOFA_ERROR_CODES error;
     saf_sofa_container sofa;
@@ -207,8 +215,10 @@ void binauraliser_initHRTFsAndGainTables(void* const hBin)
     hrtf_vbap_gtable = NULL;
     pData->hrtf_vbapTableRes[0] = 2;
     pData->hrtf_vbapTableRes[1] = 5;
-    generateVBAPgainTable3D(pData->hrir_dirs_deg, pData->N_hrir_dirs, pData->hrtf_vbapTableRes[0], pData->hrtf_vbapTableRes[1], 1, 0, 0.0f,
-                            &hrtf_vbap_gtable, &(pData->N_hrtf_vbap_gtable), &(pData->nTriangles));
+    saf_threadPool_create(&hPool, saf_threadPool_getNumProcessors()); /* (the grid directions are split over all of the processors) */
+    generateVBAPgainTable3D_threaded(pData->hrir_dirs_deg, pData->N_hrir_dirs, pData->hrtf_vbapTableRes[0], pData->hrtf_vbapTableRes[1], 1, 0, 0.0f,
+                                     hPool, &hrtf_vbap_gtable, &(pData->N_hrtf_vbap_gtable), &(pData->nTriangles));
+    saf_threadPool_destroy(&hPool);
     if(hrtf_vbap_gtable==NULL){
         /* if generating vbap gain tabled failed, re-calculate with default HRIR set */
         pData->useDefaultHRIRsFLAG = 1;
@@ -247,6 +257,12 @@ void binauraliser_initHRTFsAndGainTables(void* const hBin)
         diffuseFieldEqualiseHRTFs(pData->N_hrir_dirs, pData->itds_s, pData->freqVector, HYBRID_BANDS, pData->weights, 1, 0, pData->hrtf_fb);
     }
 
+    /* store the HRTFs direction-major, since they are only read 3 directions at a time by binauraliser_interpHRTFs() */
+    hrtf_fb_dm = malloc1d(HYBRID_BANDS * NUM_EARS * (pData->N_hrir_dirs)*sizeof(float_complex));
+    reorderHRTFs2dirMajor(pData->hrtf_fb, pData->N_hrir_dirs, HYBRID_BANDS, hrtf_fb_dm);
+    free(pData->hrtf_fb);
+    pData->hrtf_fb = hrtf_fb_dm;
+
     /* calculate magnitude responses */
     pData->hrtf_fb_mag = realloc1d(pData->hrtf_fb_mag, HYBRID_BANDS*NUM_EARS*(pData->N_hrir_dirs)*sizeof(float)); 
     for(i=0; i<HYBRID_BANDS*NUM_EARS* (pData->N_hrir_dirs); i++)
@@ -244,6 +244,9 @@ void binauraliserNF_process /* FREQ DOMAIN version */
     ffThresh        = pData->farfield_thresh_m;
     fs              = (float)pData->fs;
 
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
+
     /* apply binaural panner */
     if ((nSamples == BINAURALISER_FRAME_SIZE) && (pData->hrtf_fb!=NULL) && (pData->codecStatus==CODEC_STATUS_INITIALISED) ) {
         pData->procStatus = PROC_STATUS_ONGOING;
@@ -367,6 +370,7 @@ void binauraliserNF_process /* FREQ DOMAIN version */
     }
 
     pData->procStatus = PROC_STATUS_NOT_ONGOING;
+    md_rt_exitRegion();
 }
 
 
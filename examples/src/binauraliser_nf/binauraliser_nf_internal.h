@@ -91,8 +91,8 @@ typedef struct _binauraliserNF {
 
     /* hrir filterbank coefficients */
     float* itds_s;                   /**< interaural-time differences for each HRIR (in seconds); nBands x 1 */
-    float_complex* hrtf_fb;          /**< hrtf filterbank coefficients; nBands x nCH x N_hrirs */
-    float* hrtf_fb_mag;              /**< magnitudes of the hrtf filterbank coefficients; nBands x nCH x N_hrirs */
+    float_complex* hrtf_fb;          /**< hrtf filterbank coefficients (direction-major); N_hrirs x nBands x nCH */
+    float* hrtf_fb_mag;              /**< magnitudes of the hrtf filterbank coefficients (direction-major); N_hrirs x nBands x nCH */
     float_complex hrtf_interp[MAX_NUM_INPUTS][HYBRID_BANDS][NUM_EARS]; /**< Interpolated HRTFs */
 
     /* flags/status */
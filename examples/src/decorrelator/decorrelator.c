@@ -178,6 +178,9 @@ void decorrelator_process
     enableTransientDucker = pData->enableTransientDucker;
     compensateLevel = pData->compensateLevel;
 
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
+
     /* Process frame */
     if (nSamples == DECORRELATOR_FRAME_SIZE && (pData->codecStatus == CODEC_STATUS_INITIALISED) ) {
         pData->procStatus = PROC_STATUS_ONGOING;
@@ -234,6 +237,7 @@ void decorrelator_process
             memset(outputs[ch],0, DECORRELATOR_FRAME_SIZE*sizeof(float));
 
     pData->procStatus = PROC_STATUS_NOT_ONGOING;
+    md_rt_exitRegion();
 }
 
 
@@ -205,6 +205,12 @@ void dirass_analysis
     dirass_codecPars* pars = pData->pars;
     int s, i, j, k, ch, sec_nSH, secOrder, nSH, up_nSH;
     float intensity[3];
+    float* fifoTD[MAX_NUM_INPUT_SH_SIGNALS];
+    float* frameTD[MAX_NUM_INPUT_SH_SIGNALS];
+    HOA_CH_ORDER inChOrder = HOA_CH_ORDER_ACN;
+    HOA_NORM inNorm = HOA_NORM_N3D;
+    int chPerm[MAX_NUM_INPUT_SH_SIGNALS];
+    float chGains[MAX_NUM_INPUT_SH_SIGNALS];
     
     /* local copy of user parameters */
     int inputOrder, DirAssMode, upscaleOrder;
@@ -224,6 +230,9 @@ void dirass_analysis
     sec_nSH = (secOrder+1)*(secOrder+1);
     up_nSH = (upscaleOrder+1)*(upscaleOrder+1);
 
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
+
     /* Loop over all samples */
     for(s=0; s<nSamples; s++){
         /* Load input signals into inFIFO buffer */
@@ -240,22 +249,22 @@ void dirass_analysis
             pData->FIFO_idx = 0;
             pData->procStatus = PROC_STATUS_ONGOING;
 
-            /* Load time-domain data */
-            for(ch=0; ch<nSH; ch++)
-                memcpy(pData->SHframeTD[ch],pData->inFIFO[ch], DIRASS_FRAME_SIZE*sizeof(float));
-
-            /* account for input channel order */
+            /* Load time-domain data, converting from the input conventions to ACN/N3D in the same pass */
             switch(chOrdering){
-                case CH_ACN:  /* already ACN */ break; /* Otherwise, convert to ACN... */
-                case CH_FUMA: convertHOAChannelConvention((float*)pData->SHframeTD, inputOrder, DIRASS_FRAME_SIZE, HOA_CH_ORDER_FUMA, HOA_CH_ORDER_ACN); break;
+                case CH_ACN:  inChOrder = HOA_CH_ORDER_ACN;  break;
+                case CH_FUMA: inChOrder = HOA_CH_ORDER_FUMA; break;
             }
-
-            /* account for input normalisation scheme */
             switch(norm){
-                case NORM_N3D:  /* already in N3D, do nothing */ break; /* Otherwise, convert to N3D... */
-                case NORM_SN3D: convertHOANormConvention((float*)pData->SHframeTD, inputOrder, DIRASS_FRAME_SIZE, HOA_NORM_SN3D, HOA_NORM_N3D); break;
-                case NORM_FUMA: convertHOANormConvention((float*)pData->SHframeTD, inputOrder, DIRASS_FRAME_SIZE, HOA_NORM_FUMA, HOA_NORM_N3D); break;
+                case NORM_N3D:  inNorm = HOA_NORM_N3D;  break;
+                case NORM_SN3D: inNorm = HOA_NORM_SN3D; break;
+                case NORM_FUMA: inNorm = HOA_NORM_FUMA; break;
+            }
+            for(ch=0; ch<nSH; ch++){
+                fifoTD[ch] = pData->inFIFO[ch];
+                frameTD[ch] = pData->SHframeTD[ch];
             }
+            getHOAConventionTransform(inputOrder, inChOrder, inNorm, HOA_CH_ORDER_ACN, HOA_NORM_N3D, chPerm, chGains);
+            applyHOAConventionTransform((const float* const*)fifoTD, nSH, chPerm, chGains, nSH, DIRASS_FRAME_SIZE, frameTD);
 
             /* update the dirass powermap */
             if(pData->recalcPmap==1){
@@ -411,6 +420,7 @@ void dirass_analysis
     }
     
     pData->procStatus = PROC_STATUS_NOT_ONGOING;
+    md_rt_exitRegion();
 }
 
 /* SETS */
@@ -109,6 +109,9 @@ void matrixconv_process
  
     matrixconv_checkReInit(hMCnv);
 
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
+
     /* prep */
     numInputChannels = pData->nInputChannels;
     numOutputChannels = pData->nOutputChannels;
@@ -154,6 +157,7 @@ void matrixconv_process
             memset(pData->outFIFO, 0, MAX_NUM_CHANNELS*MAX_FRAME_SIZE*sizeof(float));
         }
     }
+    md_rt_exitRegion();
 }
 
 
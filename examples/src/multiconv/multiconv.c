@@ -107,6 +107,9 @@ void multiconv_process
  
     multiconv_checkReInit(hMCnv);
 
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
+
     /* prep */
     numChannels = pData->nChannels;
 
@@ -150,6 +153,7 @@ void multiconv_process
             memset(pData->outFIFO, 0, MAX_NUM_CHANNELS*MAX_FRAME_SIZE*sizeof(float));
         }
     }
+    md_rt_exitRegion();
 }
 
 
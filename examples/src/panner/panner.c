@@ -82,6 +82,9 @@ void panner_create
     for(ch=0; ch<MAX_NUM_INPUTS; ch++)
         pData->recalc_gainsFLAG[ch] = 1;
     pData->vbap_gtable = NULL;
+    pData->hVbap = NULL;
+    for(ch=0; ch<MAX_NUM_INPUTS; ch++)
+        pData->vbap_srcTriangle[ch] = -1;
     pData->recalc_M_rotFLAG = 1;
     pData->reInitGainTables = 1;
 }
@@ -108,6 +111,7 @@ void panner_destroy
         free(pData->inputframeTF);
         free(pData->outputframeTF);
         free(pData->vbap_gtable);
+        vbapRenderer_destroy(&(pData->hVbap));
         free(pData->progressBarText);
         
         free(pData);
@@ -181,8 +185,8 @@ void panner_process
 )
 {
     panner_data *pData = (panner_data*)(hPan);
-    int t, ch, ls, i, band, nSources, nLoudspeakers, N_azi, aziIndex, elevIndex, idx3d, idx2D;
-    float aziRes, elevRes, pv_f, gains3D_sum_pvf, gains2D_sum_pvf, Rxyz[3][3], hypotxy;
+    int t, ch, ls, i, band, nSources, nLoudspeakers, idx2D;
+    float aziRes, pv_f, gains3D_sum_pvf, gains2D_sum_pvf, Rxyz[3][3], hypotxy;
     float src_dirs[MAX_NUM_INPUTS][2], pValue[HYBRID_BANDS], gains3D[MAX_NUM_OUTPUTS], gains2D[MAX_NUM_OUTPUTS];
     const float_complex calpha = cmplxf(1.0f, 0.0f), cbeta = cmplxf(0.0f, 0.0f);
     float_complex outputTemp[MAX_NUM_OUTPUTS][TIME_SLOTS];
@@ -193,8 +197,11 @@ void panner_process
     nSources = pData->nSources;
     nLoudspeakers = pData->nLoudpkrs;
 
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
+
     /* apply panner */
-    if ((nSamples == PANNER_FRAME_SIZE) && (pData->vbap_gtable != NULL) && (pData->codecStatus == CODEC_STATUS_INITIALISED) ) {
+    if ((nSamples == PANNER_FRAME_SIZE) && (pData->vbap_gtable != NULL || pData->hVbap != NULL) && (pData->codecStatus == CODEC_STATUS_INITIALISED) ) {
         pData->procStatus = PROC_STATUS_ONGOING;
 
         /* Load time-domain data */
@@ -231,19 +238,12 @@ void panner_process
 
         /* Apply VBAP Panning */
         if(pData->output_nDims == 3){/* 3-D case */
-            aziRes = (float)pData->vbapTableRes[0];
-            elevRes = (float)pData->vbapTableRes[1];
-            N_azi = (int)(360.0f / aziRes + 0.5f) + 1;
             for (ch = 0; ch < nSources; ch++) {
                 /* recalculate frequency dependent panning gains */
                 if(pData->recalc_gainsFLAG[ch]){
-                    //aziIndex = (int)(matlab_fmodf(pData->src_dirs_deg[ch][0] + 180.0f, 360.0f) / aziRes + 0.5f);
-                    //elevIndex = (int)((pData->src_dirs_deg[ch][1] + 90.0f) / elevRes + 0.5f);
-                    aziIndex = (int)(matlab_fmodf(pData->src_dirs_rot_deg[ch][0] + 180.0f, 360.0f) / aziRes + 0.5f);
-                    elevIndex = (int)((pData->src_dirs_rot_deg[ch][1] + 90.0f) / elevRes + 0.5f);
-                    idx3d = elevIndex * N_azi + aziIndex;
-                    for (ls = 0; ls < nLoudspeakers; ls++)
-                        gains3D[ls] =  pData->vbap_gtable[idx3d*nLoudspeakers+ls];
+                    /* (exact gains, found by walking from the triangle which enclosed this source last time) */
+                    vbapRenderer_getGainsTracked(pData->hVbap, pData->src_dirs_rot_deg[ch][0], pData->src_dirs_rot_deg[ch][1],
+                                                 &(pData->vbap_srcTriangle[ch]), gains3D);
                     for (band = 0; band < HYBRID_BANDS; band++){
                         /* apply pValue per frequency */
                         pv_f = pData->pValue[band];
@@ -327,6 +327,7 @@ void panner_process
 
 
     pData->procStatus = PROC_STATUS_NOT_ONGOING;
+    md_rt_exitRegion();
 }
 
 
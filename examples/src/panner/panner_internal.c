@@ -58,6 +58,7 @@ void panner_setCodecStatus(void* const hPan, CODEC_STATUS newStatus)
 void panner_initGainTables(void* const hPan)
 {
     panner_data *pData = (panner_data*)(hPan);
+    int ch;
 #ifndef FORCE_3D_LAYOUT
     int i;
     float sum_elev;
@@ -72,22 +73,27 @@ void panner_initGainTables(void* const hPan)
         pData->output_nDims = 3;
 #endif
     
-    /* generate VBAP gain table */
+    /* generate VBAP gain table (2D), or the VBAP renderer, which computes the gains on demand (3D) */
     free(pData->vbap_gtable);
+    pData->vbap_gtable = NULL;
+    vbapRenderer_destroy(&(pData->hVbap));
+    for(ch=0; ch<MAX_NUM_INPUTS; ch++)
+        pData->vbap_srcTriangle[ch] = -1;
     pData->vbapTableRes[0] = 1;
     pData->vbapTableRes[1] = 1;
 #ifdef FORCE_3D_LAYOUT
     pData->output_nDims = 3;
-    generateVBAPgainTable3D((float*)pData->loudpkrs_dirs_deg, pData->nLoudpkrs, pData->vbapTableRes[0], pData->vbapTableRes[1], 1, 1, pData->spread_deg,
-                            &(pData->vbap_gtable), &(pData->N_vbap_gtable), &(pData->nTriangles));
+    vbapRenderer_create(&(pData->hVbap), (float*)pData->loudpkrs_dirs_deg, pData->nLoudpkrs, 1, 1, pData->spread_deg, 0);
+    pData->nTriangles = vbapRenderer_getNumTriangles(pData->hVbap);
 #else
     if(pData->output_nDims==2)
         generateVBAPgainTable2D((float*)pData->loudpkrs_dirs_deg, pData->nLoudpkrs, pData->vbapTableRes[0],
                                 &(pData->vbap_gtable), &(pData->N_vbap_gtable), &(pData->nTriangles));
     else{
-        generateVBAPgainTable3D((float*)pData->loudpkrs_dirs_deg, pData->nLoudpkrs, pData->vbapTableRes[0], pData->vbapTableRes[1], 1, 1, pData->spread_deg,
-                                &(pData->vbap_gtable), &(pData->N_vbap_gtable), &(pData->nTriangles));
-        if(pData->vbap_gtable==NULL){
+        vbapRenderer_create(&(pData->hVbap), (float*)pData->loudpkrs_dirs_deg, pData->nLoudpkrs, 1, 1, pData->spread_deg, 0);
+        pData->nTriangles = vbapRenderer_getNumTriangles(pData->hVbap);
+        if(pData->nTriangles==0){
+            vbapRenderer_destroy(&(pData->hVbap));
             /* if generating vbap gain tabled failed, re-calculate with 2D VBAP */
             pData->output_nDims = 2;
             panner_initGainTables(hPan);
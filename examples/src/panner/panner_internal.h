@@ -96,8 +96,10 @@ typedef struct _panner
     
     /* Internal */
     int vbapTableRes[2];            /**< [0] azimuth, and [1] elevation grid resolution, in degrees */
-    float* vbap_gtable;             /**< Current VBAP gains; FLAT: N_hrtf_vbap_gtable x nLoudpkrs */
+    float* vbap_gtable;             /**< Current VBAP gains (2D case); FLAT: N_hrtf_vbap_gtable x nLoudpkrs */
     int N_vbap_gtable;              /**< Number of directions in the VBAP gain table */
+    void* hVbap;                    /**< VBAP renderer (3D case), which computes exact gains on demand */
+    int vbap_srcTriangle[MAX_NUM_INPUTS]; /**< Loudspeaker triangle which enclosed each source at its last gain update (-1: unknown) */
     float_complex G_src[HYBRID_BANDS][MAX_NUM_INPUTS][MAX_NUM_OUTPUTS];  /**< Current VBAP gains per source */
     
     /* flags */
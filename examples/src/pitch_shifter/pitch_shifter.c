@@ -168,6 +168,9 @@ void pitch_shifter_process
     int s, ch, nChannels;
     nChannels = pData->nChannels;
 
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
+
     /* Loop over all samples */
     for(s=0; s<nSamples; s++){
         /* Load input signals into inFIFO buffer */
@@ -209,6 +212,7 @@ void pitch_shifter_process
     }
 
     pData->procStatus = PROC_STATUS_NOT_ONGOING;
+    md_rt_exitRegion();
 }
 
 /* sets */
@@ -51,6 +51,7 @@ void powermap_create
     pData->pmapAvgCoeff = 0.666f;
     pData->nSources = 1;
     pData->pmap_mode = PM_MODE_MUSIC;
+    pData->scanMode = POWERMAP_SCAN_FULL;
     pData->HFOVoption = HFOV_360;
     pData->aspectRatioOption = ASPECT_RATIO_2_1;
     pData->chOrdering = CH_ACN;
@@ -59,6 +60,10 @@ void powermap_create
     afSTFT_create(&(pData->hSTFT), MAX_NUM_SH_SIGNALS, 0, HOP_SIZE, 0, 1, AFSTFT_BANDS_CH_TIME);
     pData->SHframeTD = (float**)malloc2d(MAX_NUM_SH_SIGNALS, POWERMAP_FRAME_SIZE, sizeof(float));
     pData->SHframeTF = (float_complex***)malloc3d(HYBRID_BANDS, MAX_NUM_SH_SIGNALS, TIME_SLOTS, sizeof(float_complex));
+    utility_ccovtrk_create(&(pData->hCovTrk), MAX_NUM_SH_SIGNALS, HYBRID_BANDS);
+    pData->hMap = NULL;
+    pData->hGridSearch = NULL;
+    pData->Y_sub = NULL;
 
     /* codec data */
     pData->pars = (powermap_codecPars*)malloc1d(sizeof(powermap_codecPars));
@@ -113,6 +118,10 @@ void powermap_destroy
         afSTFT_destroy(&(pData->hSTFT));
         free(pData->SHframeTD);
         free(pData->SHframeTF);
+        utility_ccovtrk_destroy(&(pData->hCovTrk));
+        generateMap_destroy(&(pData->hMap));
+        saf_gridSearch_destroy(&(pData->hGridSearch));
+        free(pData->Y_sub);
         
         free(pData->pmap);
         free(pData->prev_pmap);
@@ -146,7 +155,7 @@ void powermap_init
     afSTFT_getCentreFreqs(pData->hSTFT, sampleRate, HYBRID_BANDS, pData->freqVector);
     
     /* intialise parameters */
-    memset(pData->Cx, 0 , MAX_NUM_SH_SIGNALS*MAX_NUM_SH_SIGNALS*HYBRID_BANDS*sizeof(float_complex));
+    utility_ccovtrk_reset(pData->hCovTrk);
     if(pData->prev_pmap!=NULL)
         memset(pData->prev_pmap, 0, pars->grid_nDirs*sizeof(float));
     pData->pmapReady = 0;
@@ -195,9 +204,13 @@ void powermap_analysis
     powermap_codecPars* pars = pData->pars;
     int s, i, j, ch, band, nSH_order, order_band, nSH_maxOrder, maxOrder;
     float C_grp_trace, pmapEQ_band;
-    const float_complex calpha = cmplxf(1.0f, 0.0f), cbeta = cmplxf(0.0f, 0.0f);
-    float_complex new_Cx[MAX_NUM_SH_SIGNALS*MAX_NUM_SH_SIGNALS];
+    float_complex Cx_band[MAX_NUM_SH_SIGNALS*MAX_NUM_SH_SIGNALS];
     float_complex C_grp[MAX_NUM_SH_SIGNALS*MAX_NUM_SH_SIGNALS];
+    float* fifoTD[MAX_NUM_SH_SIGNALS];
+    HOA_CH_ORDER inChOrder = HOA_CH_ORDER_ACN;
+    HOA_NORM inNorm = HOA_NORM_N3D;
+    int chPerm[MAX_NUM_SH_SIGNALS];
+    float chGains[MAX_NUM_SH_SIGNALS];
     
     /* local parameters */
     int analysisOrderPerBand[HYBRID_BANDS];
@@ -207,6 +220,8 @@ void powermap_analysis
     NORM_TYPES norm;
     CH_ORDER chOrdering;
     POWERMAP_MODES pmap_mode;
+    POWERMAP_SCAN_MODES scanMode;
+    powermap_mapArgs mapArgs;
     memcpy(analysisOrderPerBand, pData->analysisOrderPerBand, HYBRID_BANDS*sizeof(int));
     memcpy(pmapEQ, pData->pmapEQ, HYBRID_BANDS*sizeof(float));
     norm = pData->norm;
@@ -215,9 +230,13 @@ void powermap_analysis
     covAvgCoeff = SAF_MIN(pData->covAvgCoeff, MAX_COV_AVG_COEFF);
     pmapAvgCoeff = pData->pmapAvgCoeff;
     pmap_mode = pData->pmap_mode;
+    scanMode = pData->scanMode;
     masterOrder = pData->masterOrder;
     nSH = (masterOrder+1)*(masterOrder+1);
 
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
+
     /* Loop over all samples */
     for(s=0; s<nSamples; s++){
         /* Load input signals into inFIFO buffer */
@@ -234,37 +253,27 @@ void powermap_analysis
             pData->FIFO_idx = 0;
             pData->procStatus = PROC_STATUS_ONGOING;
 
-            /* Load time-domain data */
-            for(ch=0; ch<nSH; ch++)
-                memcpy(pData->SHframeTD[ch], pData->inFIFO[ch], POWERMAP_FRAME_SIZE*sizeof(float));
-
-            /* account for input channel order */
+            /* Load time-domain data, converting from the input conventions to ACN/N3D in the same pass */
             switch(chOrdering){
-                case CH_ACN:  /* already ACN */ break; /* Otherwise, convert to ACN... */
-                case CH_FUMA: convertHOAChannelConvention(FLATTEN2D(pData->SHframeTD), masterOrder, POWERMAP_FRAME_SIZE, HOA_CH_ORDER_FUMA, HOA_CH_ORDER_ACN); break;
+                case CH_ACN:  inChOrder = HOA_CH_ORDER_ACN;  break;
+                case CH_FUMA: inChOrder = HOA_CH_ORDER_FUMA; break;
             }
-
-            /* account for input normalisation scheme */
             switch(norm){
-                case NORM_N3D:  /* already in N3D, do nothing */ break; /* Otherwise, convert to N3D... */
-                case NORM_SN3D: convertHOANormConvention(FLATTEN2D(pData->SHframeTD), masterOrder, POWERMAP_FRAME_SIZE, HOA_NORM_SN3D, HOA_NORM_N3D); break;
-                case NORM_FUMA: convertHOANormConvention(FLATTEN2D(pData->SHframeTD), masterOrder, POWERMAP_FRAME_SIZE, HOA_NORM_FUMA, HOA_NORM_N3D); break;
+                case NORM_N3D:  inNorm = HOA_NORM_N3D;  break;
+                case NORM_SN3D: inNorm = HOA_NORM_SN3D; break;
+                case NORM_FUMA: inNorm = HOA_NORM_FUMA; break;
             }
+            for(ch=0; ch<nSH; ch++)
+                fifoTD[ch] = pData->inFIFO[ch];
+            getHOAConventionTransform(masterOrder, inChOrder, inNorm, HOA_CH_ORDER_ACN, HOA_NORM_N3D, chPerm, chGains);
+            applyHOAConventionTransform((const float* const*)fifoTD, nSH, chPerm, chGains, nSH, POWERMAP_FRAME_SIZE, pData->SHframeTD);
 
             /* apply the time-frequency transform */
             afSTFT_forward_knownDimensions(pData->hSTFT, pData->SHframeTD, POWERMAP_FRAME_SIZE, MAX_NUM_SH_SIGNALS, TIME_SLOTS, pData->SHframeTF);
 
-            /* Update covarience matrix per band */
-            for(band=0; band<HYBRID_BANDS; band++){
-                cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, nSH, nSH, TIME_SLOTS, &calpha,
-                            FLATTEN2D(pData->SHframeTF[band]), TIME_SLOTS,
-                            FLATTEN2D(pData->SHframeTF[band]), TIME_SLOTS, &cbeta,
-                            new_Cx, nSH);
-
-                /* average over time */
-                cblas_sscal(nSH*nSH*2, covAvgCoeff, (float*)pData->Cx[band], 1);
-                cblas_saxpy(nSH*nSH*2, 1.0f-covAvgCoeff, (float*)new_Cx, 1, (float*)pData->Cx[band], 1);
-            }
+            /* Update covarience matrix per band (and average over time) */
+            for(band=0; band<HYBRID_BANDS; band++)
+                utility_ccovtrk_update(pData->hCovTrk, band, FLATTEN2D(pData->SHframeTF[band]), nSH, TIME_SLOTS, covAvgCoeff, NULL);
 
             /* update the powermap */
             if(pData->recalcPmap==1){
@@ -283,61 +292,30 @@ void powermap_analysis
                     order_band = SAF_MAX(SAF_MIN(pData->analysisOrderPerBand[band], masterOrder),1);
                     nSH_order = (order_band+1)*(order_band+1);
                     pmapEQ_band = SAF_MIN(SAF_MAX(pmapEQ[band], 0.0f), 2.0f);
+                    utility_ccovtrk_get(pData->hCovTrk, band, nSH, Cx_band);
                     for(i=0; i<nSH_order; i++)
                         for(j=0; j<nSH_order; j++)
-                            C_grp[i*nSH_maxOrder+j] = ccaddf(C_grp[i*nSH_maxOrder+j], crmulf(pData->Cx[band][i*nSH+j], 1e3f*pmapEQ_band));
+                            C_grp[i*nSH_maxOrder+j] = ccaddf(C_grp[i*nSH_maxOrder+j], crmulf(Cx_band[i*nSH+j], 1e3f*pmapEQ_band));
                 }
 
                 /* generate powermap */
                 C_grp_trace = 0.0f;
                 for(i=0; i<nSH_maxOrder; i++)
                     C_grp_trace+=crealf(C_grp[i*nSH_maxOrder+ i]);
-                switch(pmap_mode){
+                mapArgs.pData = pData;
+                mapArgs.pmap_mode = pmap_mode;
+                mapArgs.order = maxOrder;
+                mapArgs.Cx = (float_complex*)C_grp;
+                mapArgs.Cx_trace = C_grp_trace;
+                mapArgs.CxDecomposed = 0;
+                mapArgs.nSources = nSources;
+                switch(scanMode){
                     default:
-                    case PM_MODE_PWD:
-                        generatePWDmap(maxOrder, (float_complex*)C_grp, pars->Y_grid_cmplx[maxOrder-1], pars->grid_nDirs, pData->pmap);
+                    case POWERMAP_SCAN_FULL:
+                        powermap_computeMap(&mapArgs, pars->Y_grid_cmplx[maxOrder-1], pars->grid_nDirs, pData->pmap);
                         break;
-
-                    case PM_MODE_MVDR:
-                        if(C_grp_trace>1e-8f)
-                            generateMVDRmap(maxOrder, (float_complex*)C_grp, pars->Y_grid_cmplx[maxOrder-1], pars->grid_nDirs, 8.0f, pData->pmap, NULL);
-                        else
-                            memset(pData->pmap, 0, pars->grid_nDirs*sizeof(float));
-                        break;
-
-                    case PM_MODE_CROPAC_LCMV:
-                        if(C_grp_trace>1e-8f)
-                            generateCroPaCLCMVmap(maxOrder, (float_complex*)C_grp, pars->Y_grid_cmplx[maxOrder-1], pars->grid_nDirs, 8.0f, 0.0f, pData->pmap);
-                        else
-                            memset(pData->pmap, 0, pars->grid_nDirs*sizeof(float));
-                        break;
-
-                    case PM_MODE_MUSIC:
-                        if(C_grp_trace>1e-8f)
-                            generateMUSICmap(maxOrder, (float_complex*)C_grp, pars->Y_grid_cmplx[maxOrder-1], nSources, pars->grid_nDirs, 0, pData->pmap);
-                        else
-                            memset(pData->pmap, 0, pars->grid_nDirs*sizeof(float));
-                        break;
-
-                    case PM_MODE_MUSIC_LOG:
-                        if(C_grp_trace>1e-8f)
-                            generateMUSICmap(maxOrder, (float_complex*)C_grp, pars->Y_grid_cmplx[maxOrder-1], nSources, pars->grid_nDirs, 1, pData->pmap);
-                        else
-                            memset(pData->pmap, 0, pars->grid_nDirs*sizeof(float));
-                        break;
-
-                    case PM_MODE_MINNORM:
-                        if(C_grp_trace>1e-8f)
-                            generateMinNormMap(maxOrder, (float_complex*)C_grp, pars->Y_grid_cmplx[maxOrder-1], nSources, pars->grid_nDirs, 0, pData->pmap);
-                        else
-                            memset(pData->pmap, 0, pars->grid_nDirs*sizeof(float));
-                        break;
-
-                    case PM_MODE_MINNORM_LOG:
-                        if(C_grp_trace>1e-8f)
-                            generateMinNormMap(maxOrder, (float_complex*)C_grp, pars->Y_grid_cmplx[maxOrder-1], nSources, pars->grid_nDirs, 1, pData->pmap);
-                        else
-                            memset(pData->pmap, 0, pars->grid_nDirs*sizeof(float));
+                    case POWERMAP_SCAN_COARSE_TO_FINE:
+                        saf_gridSearch_apply(pData->hGridSearch, powermap_computeMapSubset, (void*)&mapArgs, nSources, pData->pmap, NULL);
                         break;
                 }
 
@@ -377,6 +355,7 @@ void powermap_analysis
     }
 
     pData->procStatus = PROC_STATUS_NOT_ONGOING;
+    md_rt_exitRegion();
 }
 
 /* SETS */
@@ -395,6 +374,12 @@ void powermap_setPowermapMode(void* const hPm, int newMode)
         memset(pData->prev_pmap, 0, pars->grid_nDirs*sizeof(float));
 }
 
+void powermap_setScanMode(void* const hPm, int newMode)
+{
+    powermap_data *pData = (powermap_data*)(hPm);
+    pData->scanMode = (POWERMAP_SCAN_MODES)newMode;
+}
+
 void powermap_setMasterOrder(void* const hPm,  int newValue)
 {
     powermap_data *pData = (powermap_data*)(hPm);
@@ -605,6 +590,12 @@ int powermap_getPowermapMode(void* const hPm)
     return (int)pData->pmap_mode;
 }
 
+int powermap_getScanMode(void* const hPm)
+{
+    powermap_data *pData = (powermap_data*)(hPm);
+    return (int)pData->scanMode;
+}
+
 int powermap_getSamplingRate(void* const hPm)
 {
     powermap_data *pData = (powermap_data*)(hPm);
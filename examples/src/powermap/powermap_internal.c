@@ -73,6 +73,14 @@ void powermap_initAna(void* const hPm)
                 pars->Y_grid_cmplx[n-1][i*(pars->grid_nDirs)+j] = cmplxf(pars->Y_grid[n-1][i*(pars->grid_nDirs)+j], 0.0f);
     }
 
+    /* activity-map generator workspace */
+    generateMap_destroy(&(pData->hMap));
+    generateMap_create(&(pData->hMap), order, pars->grid_nDirs);
+    saf_gridSearch_destroy(&(pData->hGridSearch));
+    saf_gridSearch_create(&(pData->hGridSearch), pars->grid_dirs_deg, pars->grid_nDirs, pars->grid_nDirs/COARSE_GRID_FACTOR);
+    free(pData->Y_sub);
+    pData->Y_sub = malloc1d(((order+1)*(order+1))*(pars->grid_nDirs)*sizeof(float_complex));
+
     /* generate interpolation table for current display settings */
     switch(pData->HFOVoption){
         default:
@@ -135,6 +143,94 @@ void powermap_initTFT
     else if(nSH!=new_nSH){
         afSTFT_channelChange(pData->hSTFT, new_nSH, 0);
         afSTFT_clearBuffers(pData->hSTFT);
-        memset(pData->Cx, 0 , MAX_NUM_SH_SIGNALS*MAX_NUM_SH_SIGNALS*HYBRID_BANDS*sizeof(float_complex));
+        utility_ccovtrk_reset(pData->hCovTrk);
     }
 }
+
+void powermap_computeMap
+(
+    powermap_mapArgs* args,
+    float_complex* Y_grid,
+    int nDirs,
+    float* pmap
+)
+{
+    powermap_data *pData = args->pData;
+    float_complex* Cx;
+
+    /* Cx only needs to be decomposed by the first call for the current frame */
+    Cx = args->CxDecomposed ? NULL : args->Cx;
+    args->CxDecomposed = 1;
+
+    switch(args->pmap_mode){
+        default:
+        case PM_MODE_PWD:
+            generatePWDmap_compute(pData->hMap, args->order, Cx, Y_grid, nDirs, pmap);
+            break;
+
+        case PM_MODE_MVDR:
+            if(args->Cx_trace>1e-8f)
+                generateMVDRmap_compute(pData->hMap, args->order, Cx, Y_grid, nDirs, 8.0f, pmap, NULL);
+            else
+                memset(pmap, 0, nDirs*sizeof(float));
+            break;
+
+        case PM_MODE_CROPAC_LCMV:
+            if(args->Cx_trace>1e-8f)
+                generateCroPaCLCMVmap_compute(pData->hMap, args->order, Cx, Y_grid, nDirs, 8.0f, 0.0f, pmap);
+            else
+                memset(pmap, 0, nDirs*sizeof(float));
+            break;
+
+        case PM_MODE_MUSIC:
+            if(args->Cx_trace>1e-8f)
+                generateMUSICmap_compute(pData->hMap, args->order, Cx, Y_grid, args->nSources, nDirs, 0, pmap);
+            else
+                memset(pmap, 0, nDirs*sizeof(float));
+            break;
+
+        case PM_MODE_MUSIC_LOG:
+            if(args->Cx_trace>1e-8f)
+                generateMUSICmap_compute(pData->hMap, args->order, Cx, Y_grid, args->nSources, nDirs, 1, pmap);
+            else
+                memset(pmap, 0, nDirs*sizeof(float));
+            break;
+
+        case PM_MODE_MINNORM:
+            if(args->Cx_trace>1e-8f)
+                generateMinNormMap_compute(pData->hMap, args->order, Cx, Y_grid, args->nSources, nDirs, 0, pmap);
+            else
+                memset(pmap, 0, nDirs*sizeof(float));
+            break;
+
+        case PM_MODE_MINNORM_LOG:
+            if(args->Cx_trace>1e-8f)
+                generateMinNormMap_compute(pData->hMap, args->order, Cx, Y_grid, args->nSources, nDirs, 1, pmap);
+            else
+                memset(pmap, 0, nDirs*sizeof(float));
+            break;
+    }
+}
+
+void powermap_computeMapSubset
+(
+    void* userData,
+    const int* inds,
+    int nInds,
+    float* vals
+)
+{
+    powermap_mapArgs* args = (powermap_mapArgs*)userData;
+    powermap_data *pData = args->pData;
+    powermap_codecPars* pars = pData->pars;
+    int i, j, nSH;
+    float_complex* Y_grid;
+
+    /* Gather the SH basis for the requested directions */
+    nSH = (args->order+1)*(args->order+1);
+    Y_grid = pars->Y_grid_cmplx[args->order-1];
+    for(i=0; i<nSH; i++)
+        for(j=0; j<nInds; j++)
+            pData->Y_sub[i*nInds+j] = Y_grid[i*(pars->grid_nDirs)+inds[j]];
+    powermap_computeMap(args, pData->Y_sub, nInds, vals);
+}
@@ -56,6 +56,7 @@ extern "C" {
 #define TIME_SLOTS ( POWERMAP_FRAME_SIZE / HOP_SIZE ) /**< Number of STFT timeslots */
 #define NUM_DISP_SLOTS ( 2 )                          /**< Number of display slots */
 #define MAX_COV_AVG_COEFF ( 0.45f )                   /**< Maximum supported covariance averaging coefficient  */
+#define COARSE_GRID_FACTOR ( 8 )                      /**< Ratio of scanning directions to coarse directions (#POWERMAP_SCAN_COARSE_TO_FINE) */
 
 /* Checks: */
 #if (POWERMAP_FRAME_SIZE % HOP_SIZE != 0)
@@ -98,7 +99,10 @@ typedef struct _powermap
     float fs;                       /**< Host sample rate, in Hz*/
     
     /* internal */
-    float_complex Cx[HYBRID_BANDS][MAX_NUM_SH_SIGNALS*MAX_NUM_SH_SIGNALS];     /**< covariance matrices per band */
+    void* hCovTrk;                  /**< covariance matrices per band (upper triangles only) */
+    void* hMap;                     /**< activity-map generator handle */
+    void* hGridSearch;              /**< coarse-to-fine grid search handle */
+    float_complex* Y_sub;           /**< SH basis for a subset of the scanning directions; FLAT: MAX_NUM_SH_SIGNALS x grid_nDirs */
     int new_masterOrder;            /**< New maximum/master SH analysis order (current value will be replaced by this after next re-init) */
     int dispWidth;                  /**< Number of pixels on the horizontal in the 2D interpolated powermap image */
     
@@ -129,11 +133,25 @@ typedef struct _powermap
     float pmapAvgCoeff;             /**< Powermap averaging coefficient, [0..1] */
     int nSources;                   /**< Current number of sources (used for MUSIC) */
     POWERMAP_MODES pmap_mode;       /**< see #POWERMAP_MODES*/
+    POWERMAP_SCAN_MODES scanMode;   /**< see #POWERMAP_SCAN_MODES */
     CH_ORDER chOrdering;            /**< Ambisonic channel order convention (see #CH_ORDER) */
     NORM_TYPES norm;                /**< Ambisonic normalisation convention (see #NORM_TYPES) */
     
 } powermap_data;
 
+/** Arguments passed to powermap_computeMapSubset() */
+typedef struct _powermap_mapArgs
+{
+    powermap_data* pData;           /**< powermap data */
+    POWERMAP_MODES pmap_mode;       /**< see #POWERMAP_MODES */
+    int order;                      /**< Analysis order */
+    float_complex* Cx;              /**< Covariance matrix; FLAT: (order+1)^2 x (order+1)^2 */
+    float Cx_trace;                 /**< Trace of Cx */
+    int CxDecomposed;               /**< 1: Cx has been decomposed by a previous powermap_computeMap() call (for this frame), 0: not yet */
+    int nSources;                   /**< Number of sources */
+
+} powermap_mapArgs;
+
 
 /* ========================================================================== */
 /*                             Internal Functions                             */
@@ -152,6 +170,37 @@ void powermap_initAna(void* const hPm);
  */
 void powermap_initTFT(void* const hPm);
 
+/**
+ * Computes the current activity-map for the given scanning directions
+ *
+ * @note Only the first call for each frame decomposes the covariance matrix;
+ *       subsequent calls (e.g. the refinement stage of the coarse-to-fine
+ *       search) reuse it, and only compute the per-direction part
+ *
+ * @param[in]  args   Map arguments
+ * @param[in]  Y_grid SH basis for the scanning directions; FLAT: nSH x nDirs
+ * @param[in]  nDirs  Number of scanning directions
+ * @param[out] pmap   Activity-map; nDirs x 1
+ */
+void powermap_computeMap(powermap_mapArgs* args,
+                         float_complex* Y_grid,
+                         int nDirs,
+                         float* pmap);
+
+/**
+ * Computes the current activity-map for a subset of the scanning grid
+ * directions (#saf_gridSearch_evalFcn callback)
+ *
+ * @param[in]  userData Map arguments (see #powermap_mapArgs)
+ * @param[in]  inds     Indices of the scanning grid directions; nInds x 1
+ * @param[in]  nInds    Number of directions
+ * @param[out] vals     Activity-map; nInds x 1
+ */
+void powermap_computeMapSubset(void* userData,
+                               const int* inds,
+                               int nInds,
+                               float* vals);
+
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -59,6 +59,7 @@ void rotator_create
     pData->chOrdering = CH_ACN;
     pData->norm = NORM_SN3D;
     pData->useRollPitchYawFlag = 0;
+    pData->interpMode = ROTATOR_INTERP_CROSSFADE;
     rotator_setOrder(*phRot, SH_ORDER_FIRST);
 }
 
@@ -94,6 +95,10 @@ void rotator_init
     memset(pData->M_rot, 0, MAX_NUM_SH_SIGNALS*MAX_NUM_SH_SIGNALS*sizeof(float));
     memset(pData->prev_M_rot, 0, MAX_NUM_SH_SIGNALS*MAX_NUM_SH_SIGNALS*sizeof(float));
     memset(pData->prev_inputFrameTD, 0, MAX_NUM_SH_SIGNALS*ROTATOR_FRAME_SIZE*sizeof(float));
+    pData->Q_rot.w = pData->prev_Q_rot.w = 1.0f;
+    pData->Q_rot.x = pData->prev_Q_rot.x = 0.0f;
+    pData->Q_rot.y = pData->prev_Q_rot.y = 0.0f;
+    pData->Q_rot.z = pData->prev_Q_rot.z = 0.0f;
     pData->M_rot_status = M_ROT_RECOMPUTE_QUATERNION;
 }
 
@@ -108,29 +113,38 @@ void rotator_process
 )
 {
     rotator_data *pData = (rotator_data*)(hRot);
-    int i, j, order, nSH, mixWithPreviousFLAG;
+    int i, j, sf, order, nSH, mixWithPreviousFLAG;
     float Rxyz[3][3];
+    quaternion_data Q_sf;
     float M_rot_tmp[MAX_NUM_SH_SIGNALS*MAX_NUM_SH_SIGNALS];
+    float* frameTD[MAX_NUM_SH_SIGNALS];
     CH_ORDER chOrdering;
+    HOA_CH_ORDER hoaChOrder = HOA_CH_ORDER_ACN;
+    int chPerm[MAX_NUM_SH_SIGNALS];
+    float chGains[MAX_NUM_SH_SIGNALS];
 
     /* locals */
     chOrdering = pData->chOrdering;
     order = (int)pData->inputOrder;
     nSH = ORDER2NSH(order);
 
-    if (nSamples == ROTATOR_FRAME_SIZE) {
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
 
-        /* Load time-domain data */
-        for(i=0; i < SAF_MIN(nSH, nInputs); i++)
-            utility_svvcopy(inputs[i], ROTATOR_FRAME_SIZE, pData->inputFrameTD[i]);
-        for(; i<MAX_NUM_SH_SIGNALS; i++)
-            memset(pData->inputFrameTD[i], 0, ROTATOR_FRAME_SIZE * sizeof(float)); /* fill remaining channels with zeros */
+    if (nSamples == ROTATOR_FRAME_SIZE) {
 
-        /* account for channel order */
+        /* Load time-domain data, converting from the input channel order to ACN in the same pass (any remaining
+         * channels are filled with zeros) */
         switch(chOrdering){
-            case CH_ACN:  /* already ACN */ break; /* Otherwise, convert to ACN... */
-            case CH_FUMA: convertHOAChannelConvention((float*)pData->inputFrameTD, order, ROTATOR_FRAME_SIZE, HOA_CH_ORDER_FUMA, HOA_CH_ORDER_ACN); break;
+            case CH_ACN:  hoaChOrder = HOA_CH_ORDER_ACN;  break;
+            case CH_FUMA: hoaChOrder = HOA_CH_ORDER_FUMA; break;
         }
+        for(i=0; i<MAX_NUM_SH_SIGNALS; i++)
+            frameTD[i] = pData->inputFrameTD[i];
+        getHOAConventionTransform(order, hoaChOrder, HOA_NORM_N3D, HOA_CH_ORDER_ACN, HOA_NORM_N3D, chPerm, chGains);
+        applyHOAConventionTransform(inputs, nInputs, chPerm, chGains, nSH, ROTATOR_FRAME_SIZE, frameTD);
+        for(i=nSH; i<MAX_NUM_SH_SIGNALS; i++)
+            memset(pData->inputFrameTD[i], 0, ROTATOR_FRAME_SIZE * sizeof(float));
 
         if (order>0){
             /* calculate rotation matrix */
@@ -147,6 +161,7 @@ void rotator_process
                     quaternion2euler(&(pData->Q), 0, pData->useRollPitchYawFlag ? EULER_ROTATION_ROLL_PITCH_YAW : EULER_ROTATION_YAW_PITCH_ROLL,
                                      &(pData->yaw), &(pData->pitch), &(pData->roll));
                 }
+                rotationMatrix2quaternion(Rxyz, &(pData->Q_rot));
                 getSHrotMtxReal(Rxyz, (float*)M_rot_tmp, order);
                 for(i=0; i<nSH; i++)
                     for(j=0; j<nSH; j++)
@@ -156,17 +171,33 @@ void rotator_process
             }
 
             /* apply rotation */
-            cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nSH, ROTATOR_FRAME_SIZE, nSH, 1.0f,
-                        (float*)(pData->M_rot), MAX_NUM_SH_SIGNALS,
-                        (float*)pData->prev_inputFrameTD, ROTATOR_FRAME_SIZE, 0.0f,
-                        (float*)pData->outputFrameTD, ROTATOR_FRAME_SIZE);
+            if(mixWithPreviousFLAG && pData->interpMode == ROTATOR_INTERP_SLERP){
+                /* Slerp from the previous to the new orientation; recomputing the (block-diagonal) rotation matrix every sub-frame */
+                for(sf=0; sf<ROTATOR_FRAME_SIZE/ROTATOR_SLERP_SUBFRAME_SIZE; sf++){
+                    if((sf+1)*ROTATOR_SLERP_SUBFRAME_SIZE == ROTATOR_FRAME_SIZE) /* last sub-frame reaches the new orientation */
+                        applySHrotMtxReal(order, (float*)(pData->M_rot), MAX_NUM_SH_SIGNALS,
+                                          &(pData->prev_inputFrameTD[0][sf*ROTATOR_SLERP_SUBFRAME_SIZE]), ROTATOR_FRAME_SIZE, ROTATOR_SLERP_SUBFRAME_SIZE,
+                                          ROTATOR_FRAME_SIZE, &(pData->outputFrameTD[0][sf*ROTATOR_SLERP_SUBFRAME_SIZE]));
+                    else{
+                        quaternionSlerp(&(pData->prev_Q_rot), &(pData->Q_rot), (float)((sf+1)*ROTATOR_SLERP_SUBFRAME_SIZE)/(float)ROTATOR_FRAME_SIZE, &Q_sf);
+                        quaternion2rotationMatrix(&Q_sf, Rxyz);
+                        getSHrotMtxReal(Rxyz, (float*)M_rot_tmp, order);
+                        applySHrotMtxReal(order, (float*)M_rot_tmp, nSH,
+                                          &(pData->prev_inputFrameTD[0][sf*ROTATOR_SLERP_SUBFRAME_SIZE]), ROTATOR_FRAME_SIZE, ROTATOR_SLERP_SUBFRAME_SIZE,
+                                          ROTATOR_FRAME_SIZE, &(pData->outputFrameTD[0][sf*ROTATOR_SLERP_SUBFRAME_SIZE]));
+                    }
+                }
+            }
+            else
+                applySHrotMtxReal(order, (float*)(pData->M_rot), MAX_NUM_SH_SIGNALS,
+                                  (float*)pData->prev_inputFrameTD, ROTATOR_FRAME_SIZE, ROTATOR_FRAME_SIZE,
+                                  ROTATOR_FRAME_SIZE, (float*)pData->outputFrameTD);
 
             /* Fade between (linearly inerpolate) the new rotation matrix and the previous rotation matrix (only if the new rotation matrix is different) */
-            if(mixWithPreviousFLAG){
-                cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nSH, ROTATOR_FRAME_SIZE, nSH, 1.0f,
-                            (float*)pData->prev_M_rot, MAX_NUM_SH_SIGNALS,
-                            (float*)pData->prev_inputFrameTD, ROTATOR_FRAME_SIZE, 0.0f,
-                            (float*)pData->tempFrame, ROTATOR_FRAME_SIZE);
+            if(mixWithPreviousFLAG && pData->interpMode == ROTATOR_INTERP_CROSSFADE){
+                applySHrotMtxReal(order, (float*)pData->prev_M_rot, MAX_NUM_SH_SIGNALS,
+                                  (float*)pData->prev_inputFrameTD, ROTATOR_FRAME_SIZE, ROTATOR_FRAME_SIZE,
+                                  ROTATOR_FRAME_SIZE, (float*)pData->tempFrame);
 
                 /* Apply the linear interpolation */
                 for (i=0; i < nSH; i++){
@@ -175,33 +206,31 @@ void rotator_process
                 }
                 cblas_scopy(nSH*ROTATOR_FRAME_SIZE, (float*)pData->outputFrameTD_fadeIn, 1, (float*)pData->outputFrameTD, 1);
                 cblas_saxpy(nSH*ROTATOR_FRAME_SIZE, 1.0f, (float*)pData->tempFrame_fadeOut, 1, (float*)pData->outputFrameTD, 1);
-
-                /* for next frame */
-                utility_svvcopy((const float*)pData->M_rot, MAX_NUM_SH_SIGNALS*MAX_NUM_SH_SIGNALS, (float*)pData->prev_M_rot);
             }
 
             /* for next frame */
+            if(mixWithPreviousFLAG){
+                utility_svvcopy((const float*)pData->M_rot, MAX_NUM_SH_SIGNALS*MAX_NUM_SH_SIGNALS, (float*)pData->prev_M_rot);
+                pData->prev_Q_rot = pData->Q_rot;
+            }
             utility_svvcopy((const float*)pData->inputFrameTD, MAX_NUM_SH_SIGNALS*ROTATOR_FRAME_SIZE, (float*)pData->prev_inputFrameTD);
         }
         else /* Pass-through the omni (cannot be rotated...) */
             utility_svvcopy((const float*)pData->inputFrameTD[0], ROTATOR_FRAME_SIZE, (float*)pData->outputFrameTD[0]);
   
-        /* account for channel order */
-        switch(chOrdering){
-            case CH_ACN:  /* do nothing */ break;
-            case CH_FUMA: convertHOAChannelConvention((float*)pData->outputFrameTD, order, ROTATOR_FRAME_SIZE, HOA_CH_ORDER_ACN, HOA_CH_ORDER_FUMA); break;
-        }
-
-        /* Copy to output */
-        for (i = 0; i < SAF_MIN(nSH, nOutputs); i++)
-            utility_svvcopy(pData->outputFrameTD[i], ROTATOR_FRAME_SIZE, outputs[i]);
-        for (; i < nOutputs; i++)
+        /* Copy to output, whilst converting from ACN to the output channel order in the same pass */
+        for(i=0; i<MAX_NUM_SH_SIGNALS; i++)
+            frameTD[i] = pData->outputFrameTD[i];
+        getHOAConventionTransform(order, HOA_CH_ORDER_ACN, HOA_NORM_N3D, hoaChOrder, HOA_NORM_N3D, chPerm, chGains);
+        applyHOAConventionTransform((const float* const*)frameTD, nSH, chPerm, chGains, SAF_MIN(nSH, nOutputs), ROTATOR_FRAME_SIZE, outputs);
+        for (i = SAF_MIN(nSH, nOutputs); i < nOutputs; i++)
             memset(outputs[i], 0, ROTATOR_FRAME_SIZE*sizeof(float));
     }
     else{
         for (i = 0; i < nOutputs; i++)
             memset(outputs[i], 0, ROTATOR_FRAME_SIZE*sizeof(float));
     }
+    md_rt_exitRegion();
 }
 
 
@@ -300,6 +329,12 @@ void rotator_setRPYflag(void* const hRot, int newState)
     pData->useRollPitchYawFlag = newState;
 }
 
+void rotator_setInterpMode(void* const hRot, int newMode)
+{
+    rotator_data *pData = (rotator_data*)(hRot);
+    pData->interpMode = (ROTATOR_INTERP_MODES)newMode;
+}
+
 void rotator_setChOrder(void* const hRot, int newOrder)
 {
     rotator_data *pData = (rotator_data*)(hRot);
@@ -406,6 +441,12 @@ int rotator_getRPYflag(void* const hRot)
     return pData->useRollPitchYawFlag;
 }
 
+int rotator_getInterpMode(void* const hRot)
+{
+    rotator_data *pData = (rotator_data*)(hRot);
+    return (int)pData->interpMode;
+}
+
 int rotator_getChOrder(void* const hRot)
 {
     rotator_data *pData = (rotator_data*)(hRot);
@@ -53,6 +53,10 @@ extern "C" {
 #  define ROTATOR_FRAME_SIZE ( 64 )         /**< Framesize, in time-domain samples */
 # endif
 #endif
+#define ROTATOR_SLERP_SUBFRAME_SIZE ( 16 )  /**< Number of samples between rotation matrix updates, when using #ROTATOR_INTERP_SLERP */
+#if (ROTATOR_FRAME_SIZE % ROTATOR_SLERP_SUBFRAME_SIZE != 0)
+# error "ROTATOR_FRAME_SIZE must be a multiple of ROTATOR_SLERP_SUBFRAME_SIZE"
+#endif
 
 /* ========================================================================== */
 /*                                 Structures                                 */
@@ -81,6 +85,8 @@ typedef struct _rotator
     float interpolator_fadeOut[ROTATOR_FRAME_SIZE];      /**< Linear Interpolator (fade-out) */
     float M_rot[MAX_NUM_SH_SIGNALS][MAX_NUM_SH_SIGNALS];      /**< Current SH rotation matrix [1] */
     float prev_M_rot[MAX_NUM_SH_SIGNALS][MAX_NUM_SH_SIGNALS]; /**< Previous SH rotation matrix [1] */
+    quaternion_data Q_rot;          /**< Quaternion of the 3x3 rotation matrix used to compute M_rot */
+    quaternion_data prev_Q_rot;     /**< Quaternion of the 3x3 rotation matrix used to compute prev_M_rot */
     M_ROT_STATUS M_rot_status;      /**< see #M_ROT_STATUS */
     int fs;                         /**< Host sampling rate, in Hz */
 
@@ -94,6 +100,7 @@ typedef struct _rotator
     int bFlipPitch;                 /**< flag to flip the sign of the pitch rotation angle */
     int bFlipRoll;                  /**< flag to flip the sign of the roll rotation angle */
     int useRollPitchYawFlag;        /**< rotation order flag, 1: r-p-y, 0: y-p-r */
+    ROTATOR_INTERP_MODES interpMode; /**< see #ROTATOR_INTERP_MODES */
     CH_ORDER chOrdering;            /**< Ambisonic channel order convention (see #CH_ORDER) */
     NORM_TYPES norm;                /**< Ambisonic normalisation convention (see #NORM_TYPES) */
     SH_ORDERS inputOrder;           /**< current input/output SH order */ 
@@ -205,6 +205,11 @@ void sldoa_analysis
     float avgCoeff, max_en[HYBRID_BANDS], min_en[HYBRID_BANDS];
     float new_doa[MAX_NUM_SECTORS][TIME_SLOTS][2], new_doa_xyz[3], doa_xyz[3], avg_xyz[3];
     float new_energy[MAX_NUM_SECTORS][TIME_SLOTS];
+    float* fifoTD[MAX_NUM_SH_SIGNALS];
+    HOA_CH_ORDER inChOrder = HOA_CH_ORDER_ACN;
+    HOA_NORM inNorm = HOA_NORM_N3D;
+    int chPerm[MAX_NUM_SH_SIGNALS];
+    float chGains[MAX_NUM_SH_SIGNALS];
     
     /* local parameters */
     int nSH, masterOrder;
@@ -223,6 +228,9 @@ void sldoa_analysis
     masterOrder = pData->masterOrder;
     nSH = ORDER2NSH(masterOrder);
 
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
+
     /* Loop over all samples */
     for(s=0; s<nSamples; s++){
         /* Load input signals into inFIFO buffer */
@@ -240,22 +248,20 @@ void sldoa_analysis
             pData->procStatus = PROC_STATUS_ONGOING;
             current_disp_idx = pData->current_disp_idx;
 
-            /* Load time-domain data */
-            for(ch=0; ch<nSH; ch++)
-                memcpy(pData->SHframeTD[ch],pData->inFIFO[ch], SLDOA_FRAME_SIZE*sizeof(float));
-
-            /* account for input channel order */
+            /* Load time-domain data, converting from the input conventions to ACN/N3D in the same pass */
             switch(chOrdering){
-                case CH_ACN:  /* already ACN */ break; /* Otherwise, convert to ACN... */
-                case CH_FUMA: convertHOAChannelConvention(FLATTEN2D(pData->SHframeTD), masterOrder, SLDOA_FRAME_SIZE, HOA_CH_ORDER_FUMA, HOA_CH_ORDER_ACN); break;
+                case CH_ACN:  inChOrder = HOA_CH_ORDER_ACN;  break;
+                case CH_FUMA: inChOrder = HOA_CH_ORDER_FUMA; break;
             }
-
-            /* account for input normalisation scheme */
             switch(norm){
-                case NORM_N3D:  /* already in N3D, do nothing */ break; /* Otherwise, convert to N3D... */
-                case NORM_SN3D: convertHOANormConvention(FLATTEN2D(pData->SHframeTD), masterOrder, SLDOA_FRAME_SIZE, HOA_NORM_SN3D, HOA_NORM_N3D); break;
-                case NORM_FUMA: convertHOANormConvention(FLATTEN2D(pData->SHframeTD), masterOrder, SLDOA_FRAME_SIZE, HOA_NORM_FUMA, HOA_NORM_N3D); break;
+                case NORM_N3D:  inNorm = HOA_NORM_N3D;  break;
+                case NORM_SN3D: inNorm = HOA_NORM_SN3D; break;
+                case NORM_FUMA: inNorm = HOA_NORM_FUMA; break;
             }
+            for(ch=0; ch<nSH; ch++)
+                fifoTD[ch] = pData->inFIFO[ch];
+            getHOAConventionTransform(masterOrder, inChOrder, inNorm, HOA_CH_ORDER_ACN, HOA_NORM_N3D, chPerm, chGains);
+            applyHOAConventionTransform((const float* const*)fifoTD, nSH, chPerm, chGains, nSH, SLDOA_FRAME_SIZE, pData->SHframeTD);
         
             /* apply the time-frequency transform */
             afSTFT_forward_knownDimensions(pData->hSTFT, pData->SHframeTD, SLDOA_FRAME_SIZE, MAX_NUM_SH_SIGNALS, TIME_SLOTS, pData->SHframeTF);
@@ -340,6 +346,7 @@ void sldoa_analysis
     }
 
     pData->procStatus = PROC_STATUS_NOT_ONGOING;
+    md_rt_exitRegion();
 }
 
 /* SETS */
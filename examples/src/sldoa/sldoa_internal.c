@@ -150,7 +150,6 @@ void sldoa_estimateDoA
 {
     int n, ch, i, j, nSectors, analysisOrder, nSH;
     float_complex secSig[4][TIME_SLOTS];
-    float_complex* sec_c;
     float secEnergy[TIME_SLOTS], secIntensity[3][TIME_SLOTS], secAzi[TIME_SLOTS], secElev[TIME_SLOTS];
     const float_complex calpha = cmplxf(1.0f, 0.0f); const float_complex cbeta = cmplxf(0.0f, 0.0f);
     
@@ -160,7 +159,6 @@ void sldoa_estimateDoA
     analysisOrder = SAF_MAX(SAF_MIN(MAX_SH_ORDER, anaOrder),1);
     nSectors = ORDER2NUMSECTORS(analysisOrder);
     nSH = (analysisOrder+1)*(analysisOrder+1);
-    sec_c = malloc1d(4*nSH*sizeof(float_complex));
     
     /* calculate energy and DoA for each sector */
     for( n=0; n<nSectors; n++){
@@ -168,11 +166,9 @@ void sldoa_estimateDoA
             for (i=0; i<4; i++)
                 memcpy(secSig[i], SHframeTF[i], TIME_SLOTS * sizeof(float_complex));
         else{ /* spatially localised active-intensity based DoA estimation */
-            for (i=0; i<4; i++)
-                for (j=0; j<nSH; j++)
-                    sec_c[i*nSH+j] = secCoeffs[i*(nSectors*nSH)+n*nSH+j];
+            /* (the coefficients of this sector are indexed in-place: 4 x nSH, with a row stride of nSectors*nSH) */
             cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, 4, TIME_SLOTS, nSH, &calpha,
-                        sec_c, nSH,
+                        &secCoeffs[n*nSH], nSectors*nSH,
                         FLATTEN2D(SHframeTF), TIME_SLOTS, &cbeta,
                         secSig, TIME_SLOTS);
         }
@@ -204,7 +200,5 @@ void sldoa_estimateDoA
             energy[n][j] = secEnergy[j]*1e6f;
         }
     }
-    
-    free(sec_c);
 }
 
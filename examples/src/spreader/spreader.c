@@ -73,7 +73,7 @@ void spreader_create
     for(src=0; src<SPREADER_MAX_NUM_SOURCES; src++){
         pData->hDecor[src] = NULL;
         pData->Cy[src] = NULL;
-        pData->Cproto[src] = NULL;
+        pData->hCprotoTrk[src] = NULL;
         pData->prev_M[src] = NULL;
         pData->prev_Mr[src] = NULL;
         pData->dirActive[src] = NULL;
@@ -145,7 +145,7 @@ void spreader_destroy
         for(src=0; src<SPREADER_MAX_NUM_SOURCES; src++){
             latticeDecorrelator_destroy(&(pData->hDecor[src]));
             free(pData->Cy[src]);
-            free(pData->Cproto[src]);
+            utility_ccovtrk_destroy(&(pData->hCprotoTrk[src]));
             free(pData->prev_M[src]);
             free(pData->prev_Mr[src]);
             free(pData->dirActive[src]);
@@ -311,8 +311,8 @@ void spreader_initCodec
     for(src=0; src<SPREADER_MAX_NUM_SOURCES; src++){
         pData->Cy[src] = (float_complex**)realloc2d((void**)pData->Cy[src], HYBRID_BANDS, (pData->Q)*(pData->Q), sizeof(float_complex));
         memset(FLATTEN2D(pData->Cy[src]), 0, HYBRID_BANDS * (pData->Q)*(pData->Q) * sizeof(float_complex));
-        pData->Cproto[src] = (float_complex**)realloc2d((void**)pData->Cproto[src], HYBRID_BANDS, (pData->Q)*(pData->Q), sizeof(float_complex));
-        memset(FLATTEN2D(pData->Cproto[src]), 0, HYBRID_BANDS * (pData->Q)*(pData->Q) * sizeof(float_complex));
+        utility_ccovtrk_destroy(&(pData->hCprotoTrk[src]));
+        utility_ccovtrk_create(&(pData->hCprotoTrk[src]), pData->Q, HYBRID_BANDS);
         pData->prev_M[src] = (float_complex**)realloc2d((void**)pData->prev_M[src], HYBRID_BANDS, (pData->Q)*(pData->Q), sizeof(float_complex));
         memset(FLATTEN2D(pData->prev_M[src]), 0, HYBRID_BANDS * (pData->Q)*(pData->Q) * sizeof(float_complex));
         pData->prev_Mr[src] = (float**)realloc2d((void**)pData->prev_Mr[src], HYBRID_BANDS, (pData->Q)*(pData->Q), sizeof(float));
@@ -369,6 +369,9 @@ void spreader_process
     memcpy((float*)src_dirs_deg, pData->src_dirs_deg, nSources*2*sizeof(float));
     memcpy((float*)src_spread, pData->src_spread, nSources*sizeof(float));
 
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
+
     /* apply binaural panner */
     if ((nSamples == SPREADER_FRAME_SIZE) && (pData->codecStatus==CODEC_STATUS_INITIALISED) ){
         pData->procStatus = PROC_STATUS_ONGOING;
@@ -470,14 +473,8 @@ void spreader_process
                 latticeDecorrelator_apply(pData->hDecor[src], pData->protoframeTF, TIME_SLOTS, pData->decorframeTF);
 
                 /* Compute prototype covariance matrix and average over time */
-                for(band=0; band<HYBRID_BANDS; band++){
-                    cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, Q, Q, TIME_SLOTS, &calpha,
-                                FLATTEN2D(pData->protoframeTF[band]), TIME_SLOTS,
-                                FLATTEN2D(pData->protoframeTF[band]), TIME_SLOTS, &cbeta,
-                                Cproto, Q);
-                    cblas_sscal(/*re+im*/2*Q*Q, pData->covAvgCoeff, (float*)pData->Cproto[src][band], 1);
-                    cblas_saxpy(/*re+im*/2*Q*Q, 1.0f-pData->covAvgCoeff, (float*)Cproto, 1, (float*)pData->Cproto[src][band], 1);
-                }
+                for(band=0; band<HYBRID_BANDS; band++)
+                    utility_ccovtrk_update(pData->hCprotoTrk[src], band, FLATTEN2D(pData->protoframeTF[band]), Q, TIME_SLOTS, pData->covAvgCoeff, NULL);
 
                 /* Define target covariance matrices */
                 for(band=0; band<HYBRID_BANDS; band++){
@@ -547,9 +544,10 @@ void spreader_process
                         /* For normalising the level of Cy */
                         Ey = Eproto = 0.0f;
                         for(band=0; band<HYBRID_BANDS; band++){
+                            utility_ccovtrk_get(pData->hCprotoTrk[src], band, Q, Cproto);
                             for(i=0; i<Q; i++){
                                 Ey += crealf(pData->Cy[src][band][i*Q+i]);
-                                Eproto += crealf(pData->Cproto[src][band][i*Q+i])+0.000001f;
+                                Eproto += crealf(Cproto[i*Q+i])+0.000001f;
                             }
                         }
                         Gcomp = sqrtf(Eproto/(Ey+2.23e-9f));
@@ -574,7 +572,7 @@ void spreader_process
                             if(pData->freqVector[band]<MAX_SPREAD_FREQ){
 #if 1
                                 /* Diagonalise and diagonally load the Cproto matrices */
-                                cblas_ccopy(Q*Q, pData->Cproto[src][band], 1, Cproto, 1);
+                                utility_ccovtrk_get(pData->hCprotoTrk[src], band, Q, Cproto);
                                 for(i=0; i<Q; i++){
                                     for(j=0; j<Q; j++){
                                         if(i==j)
@@ -668,6 +666,7 @@ void spreader_process
     }
 
     pData->procStatus = PROC_STATUS_NOT_ONGOING;
+    md_rt_exitRegion();
 }
 
 /* Set Functions */
@@ -96,7 +96,7 @@ typedef struct _spreader
     float* weights;                    /**< Integration weights; nGrid x 1 */
     void* hDecor[SPREADER_MAX_NUM_SOURCES]; /**< handles for decorrelators */
     float* angles;                     /**< angles; nGrid x 1 */
-    float_complex** Cproto[SPREADER_MAX_NUM_SOURCES]; /**< Current prototype covariance matrices; HYBRID_BANDS x FLAT:(Q x Q) */
+    void* hCprotoTrk[SPREADER_MAX_NUM_SOURCES];       /**< Current prototype covariance matrices, per band (upper triangles only) */
     float_complex** Cy[SPREADER_MAX_NUM_SOURCES];     /**< Target covariance matrices; HYBRID_BANDS x FLAT:(Q x Q) */
     float_complex** prev_M[SPREADER_MAX_NUM_SOURCES]; /**< previous mixing matrices; HYBRID_BANDS x FLAT:(Q x Q) */
     float** prev_Mr[SPREADER_MAX_NUM_SOURCES];        /**< previous residual mixing matrices; HYBRID_BANDS x FLAT:(Q x Q) */
@@ -131,6 +131,9 @@ void tvconv_process
     int numInputChannels, numOutputChannels;
  
     tvconv_checkReInit(hTVCnv);
+    /* Real-time region (no heap allocations from here on) */
+    md_rt_enterRegion();
+
     pData->procStatus = PROC_STATUS_ONGOING;
    
     numInputChannels = pData->nInputChannels;
@@ -182,6 +185,7 @@ void tvconv_process
         }
     }
     pData->procStatus = PROC_STATUS_NOT_ONGOING;
+    md_rt_exitRegion();
 }
 
 
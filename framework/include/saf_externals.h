@@ -57,6 +57,8 @@
  *    - AVX/AVX2 intrinsics are enabled with compiler flag: -mavx2
  *    - AVX-512  intrinsics are enabled with compiler flag: -mavx512f
  *   (Note that intrinsics require a CPU that supports them)
+ *   Alternatively, all of these may be compiled in and selected at run-time,
+ *   with: SAF_ENABLE_SIMD_RUNTIME_DISPATCH
  *
  * @author Leo McCormack
  * @date 06.08.2020
@@ -210,8 +212,6 @@ extern "C" {
  *   - slightly faster DFT/FFT (for saf_utility_fft) compared with the
  *     implementation found in Intel MKL, which are both faster than the DFT/FFT
  *     implementations found in Apple Accelerate vDSP and FFTW.
- *   - this overrides the included resources/speex_resampler with the IPP
- *     resampler, which is marginally faster and more accurate.
  *   - this also overrides certain vector-vector, and vector-scalar operations,
  *     such as element-wise multiplication, addition, scaling etc.
  *
@@ -272,6 +272,27 @@ extern "C" {
 # endif
 #endif
 
+#if defined(SAF_ENABLE_SIMD_RUNTIME_DISPATCH)
+/*
+ * Alternatively, the SSE3, AVX2 and AVX-512 variants of the SIMD accelerated
+ * fall-back options may all be compiled into SAF, with the most capable variant
+ * supported by the host CPU then being selected at run-time. This may be
+ * enabled with: SAF_ENABLE_SIMD_RUNTIME_DISPATCH
+ *
+ * Unlike SAF_ENABLE_SIMD, no architecture-specific compiler flags (e.g.
+ * -march=native) are required, and so the resulting binaries may be deployed
+ * on any x86_64 machine. Note that this option takes precedence over
+ * SAF_ENABLE_SIMD, if both happen to be defined.
+ */
+# if !(defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+#  error SAF_ENABLE_SIMD_RUNTIME_DISPATCH requires an x86/x86_64 CPU
+# endif
+# include <immintrin.h> /* for SSE, SSE2, SSE3, AVX, AVX2, and AVX-512 */
+# if defined(_MSC_VER)
+#  include <intrin.h>    /* for __cpuid() */
+# endif
+#endif
+
 #if defined(SAF_ENABLE_SOFA_READER_MODULE)
 /*
  * The built-in saf_sofa_open() SOFA file reader has two implementations:
@@ -334,7 +355,10 @@ extern "C" {
 #endif
 
 /* Status of SIMD intrinsics */
-#if defined(SAF_ENABLE_SIMD)
+#if defined(SAF_ENABLE_SIMD_RUNTIME_DISPATCH)
+# define SAF_SIMD_STATUS_STRING "Enabled (run-time dispatch)"
+# define SAF_ENABLED_SIMD_INTRINSICS_STRING "SSE, SSE2, SSE3, AVX, AVX2, AVX512F (selected at run-time)"
+#elif defined(SAF_ENABLE_SIMD)
 # define SAF_SIMD_STATUS_STRING "Enabled"
 /* Which SIMD intrinsics are currently enabled? */
 # if defined(__AVX512F__)
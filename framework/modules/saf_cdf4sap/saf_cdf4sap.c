@@ -50,7 +50,8 @@ typedef struct _cdf4sap_data {
     int nXcols, nYcols;
     
     /* intermediate vectors & matrices */
-    void* hSVD;
+    CDF4SAP_DECOMPOSITION_METHODS decompMethod;
+    void* hSVD, *hEIG;
     float* lambda, *U_Cy, *S_Cy, *Ky, *U_Cx, *S_Cx, *s_Cx, *Kx, *Kx_reg_inverse, *U, *V, *P;
     float* G_hat, *Cx_QH;
     float* GhatH_Ky, *QH_GhatH_Ky, *KxH_QH_GhatH_Ky, *lambda_UH;
@@ -69,10 +70,11 @@ typedef struct _cdf4sap_cmplx_data {
     int nXcols, nYcols;
     
     /* intermediate vectors & matrices */
-    void* hSVD;
+    CDF4SAP_DECOMPOSITION_METHODS decompMethod;
+    void* hSVD, *hEIG;
     float_complex* Cr_cmplx;
     float_complex* lambda, *U_Cy, *S_Cy, *S_Cx, *Ky, *U_Cx, *Kx, *Kx_reg_inverse, *U, *V, *P;
-    float* s_Cx, *G_hat_diag;
+    float* s_Cy, *s_Cx, *G_hat_diag;
     float_complex* G_hat, *Cx_QH;
     float_complex* GhatH_Ky, *QH_GhatH_Ky, *KxH_QH_GhatH_Ky, *lambda_UH;
     float_complex *P_Kxreginverse;
@@ -95,8 +97,10 @@ void cdf4sap_create
     h->nYcols = nYcols;
     h->lambda = malloc1d(nYcols * nXcols * sizeof(float));
 
-    /* For the SVD */
+    /* For the SVD and (optionally) the eigenvalue decompositions */
+    h->decompMethod = CDF4SAP_DECOMPOSITION_SVD;
     utility_ssvd_create(&h->hSVD, SAF_MAX(nXcols, nYcols), SAF_MAX(nXcols, nYcols));
+    utility_sseig_create(&h->hEIG, SAF_MAX(nXcols, nYcols));
     
     /* For the decomposition of Cy */
     h->U_Cy = malloc1d(nYcols*nYcols*sizeof(float));
@@ -151,12 +155,15 @@ void cdf4sap_cmplx_create
     h->lambda = malloc1d(nYcols * nXcols * sizeof(float_complex));
     h->Cr_cmplx = malloc1d(nYcols * nYcols * sizeof(float_complex));
 
-    /* For the SVD */
+    /* For the SVD and (optionally) the eigenvalue decompositions */
+    h->decompMethod = CDF4SAP_DECOMPOSITION_SVD;
     utility_csvd_create(&h->hSVD, SAF_MAX(nXcols, nYcols), SAF_MAX(nXcols, nYcols));
+    utility_cseig_create(&h->hEIG, SAF_MAX(nXcols, nYcols));
 
     /* For the decomposition of Cy */
     h->U_Cy = malloc1d(nYcols*nYcols*sizeof(float_complex));
     h->S_Cy = malloc1d(nYcols*nYcols*sizeof(float_complex));
+    h->s_Cy = malloc1d(nYcols*sizeof(float));
     h->Ky = malloc1d(nYcols*nYcols*sizeof(float_complex));
     
     /* For the decomposition of Cx */
@@ -202,6 +209,7 @@ void cdf4sap_destroy
     
     if(h!=NULL){
         utility_ssvd_destroy(&h->hSVD);
+        utility_sseig_destroy(&h->hEIG);
         free(h->lambda);
         free(h->U_Cy);
         free(h->S_Cy);
@@ -238,10 +246,12 @@ void cdf4sap_cmplx_destroy
     
     if(h!=NULL){
         utility_csvd_destroy(&h->hSVD);
+        utility_cseig_destroy(&h->hEIG);
         free(h->lambda);
         free(h->Cr_cmplx);
         free(h->U_Cy);
         free(h->S_Cy);
+        free(h->s_Cy);
         free(h->Ky);
         free(h->U_Cx);
         free(h->S_Cx);
@@ -267,6 +277,26 @@ void cdf4sap_cmplx_destroy
     }
 }
 
+void cdf4sap_setDecompositionMethod
+(
+    void * const hCdf,
+    CDF4SAP_DECOMPOSITION_METHODS method
+)
+{
+    cdf4sap_data *h = (cdf4sap_data*)(hCdf);
+    h->decompMethod = method;
+}
+
+void cdf4sap_cmplx_setDecompositionMethod
+(
+    void * const hCdf,
+    CDF4SAP_DECOMPOSITION_METHODS method
+)
+{
+    cdf4sap_cmplx_data *h = (cdf4sap_cmplx_data*)(hCdf);
+    h->decompMethod = method;
+}
+
 void formulate_M_and_Cr
 (
     void * const hCdf,
@@ -289,8 +319,11 @@ void formulate_M_and_Cr
     for(i = 0; i<SAF_MIN(nXcols,nYcols); i++)
         h->lambda[i*nXcols + i] = 1.0f;
 
-    /* Decomposition of Cy */
-    utility_ssvd(h->hSVD, Cy, nYcols, nYcols, h->U_Cy, h->S_Cy, NULL, NULL);
+    /* Decomposition of Cy (which is symmetric positive semi-definite, so its eigen and singular values are the same) */
+    if(h->decompMethod==CDF4SAP_DECOMPOSITION_EIG)
+        utility_sseig(h->hEIG, Cy, nYcols, 1, h->U_Cy, h->S_Cy, NULL);
+    else
+        utility_ssvd(h->hSVD, Cy, nYcols, nYcols, h->U_Cy, h->S_Cy, NULL, NULL);
     for(i=0; i< nYcols; i++)
         h->S_Cy[i*nYcols+i] = sqrtf(SAF_MAX(h->S_Cy[i*nYcols+i], 2.23e-20f));
     cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nYcols, nYcols, nYcols, 1.0f,
@@ -299,7 +332,10 @@ void formulate_M_and_Cr
                 h->Ky, nYcols);
 
     /* Decomposition of Cx */
-    utility_ssvd(h->hSVD, Cx, nXcols, nXcols, h->U_Cx, h->S_Cx, NULL, h->s_Cx);
+    if(h->decompMethod==CDF4SAP_DECOMPOSITION_EIG)
+        utility_sseig(h->hEIG, Cx, nXcols, 1, h->U_Cx, h->S_Cx, h->s_Cx);
+    else
+        utility_ssvd(h->hSVD, Cx, nXcols, nXcols, h->U_Cx, h->S_Cx, NULL, h->s_Cx);
     for(i=0; i< nXcols; i++){
         h->S_Cx[i*nXcols+i] = sqrtf(SAF_MAX(h->S_Cx[i*nXcols+i], 2.23e-20f));
         h->s_Cx[i] = sqrtf(SAF_MAX(h->s_Cx[i], 2.23e-20f));
@@ -401,63 +437,67 @@ void formulate_M_and_Cr
     }
 }
 
-void formulate_M_and_Cr_cmplx
+/**
+ * Formulates the (square-rooted) decompositions Ky and Kx, the regularised
+ * Kx^-1, and the matrix Kx^H Q^H G_hat^H Ky, from the decompositions of Cx and
+ * Cy (singular/eigen values in decending order)
+ */
+static void cdf4sap_cmplx_prepare
 (
-    void * const hCdf,
+    cdf4sap_cmplx_data* h,
     float_complex* Cx,
     float_complex* Cy,
     float_complex* Q,
-    int useEnergyFLAG,
     float reg,
-    float_complex* M,
-    float_complex* Cr
+    float_complex* U_Cy,
+    float* s_Cy,
+    float_complex* U_Cx,
+    float* s_Cx,
+    float_complex* Ky,
+    float_complex* Kx_reg_inverse,
+    float_complex* KxH_QH_GhatH_Ky
 )
 {
-    cdf4sap_cmplx_data *h = (cdf4sap_cmplx_data*)(hCdf);
     int i, j, nXcols, nYcols;
     const float_complex calpha = cmplxf(1.0f, 0.0f); const float_complex cbeta = cmplxf(0.0f, 0.0f);
 
     nXcols = h->nXcols;
     nYcols = h->nYcols;
-    
-    memset(h->lambda, 0, nYcols * nXcols * sizeof(float_complex));
-    for(i = 0; i<SAF_MIN(nXcols,nYcols); i++)
-        h->lambda[i*nXcols + i] = cmplxf(1.0f, 0.0f);
-    
+
     /* Decomposition of Cy */
-    utility_csvd(h->hSVD, Cy, nYcols, nYcols, h->U_Cy, h->S_Cy, NULL, NULL);
+    memset(h->S_Cy, 0, nYcols*nYcols*sizeof(float_complex));
     for(i=0; i< nYcols; i++)
-        h->S_Cy[i*nYcols+i] = cmplxf(sqrtf(SAF_MAX(crealf(h->S_Cy[i*nYcols+i]), 2.23e-20f)), 0.0f);
+        h->S_Cy[i*nYcols+i] = cmplxf(sqrtf(SAF_MAX(s_Cy[i], 2.23e-20f)), 0.0f);
     cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nYcols, nYcols, nYcols, &calpha,
-                h->U_Cy, nYcols,
+                U_Cy, nYcols,
                 h->S_Cy, nYcols, &cbeta,
-                h->Ky, nYcols);
+                Ky, nYcols);
     
     /* Decomposition of Cx */
-    utility_csvd(h->hSVD, Cx, nXcols, nXcols, h->U_Cx, h->S_Cx, NULL, h->s_Cx);
+    memset(h->S_Cx, 0, nXcols*nXcols*sizeof(float_complex));
     for(i=0; i< nXcols; i++){
-        h->s_Cx[i] = sqrtf(SAF_MAX(h->s_Cx[i], 2.23e-13f));
-        h->S_Cx[i*nXcols+i] = cmplxf(h->s_Cx[i], 0.0f);
+        s_Cx[i] = sqrtf(SAF_MAX(s_Cx[i], 2.23e-13f));
+        h->S_Cx[i*nXcols+i] = cmplxf(s_Cx[i], 0.0f);
     }
     cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nXcols, nXcols, nXcols, &calpha,
-                h->U_Cx, nXcols,
+                U_Cx, nXcols,
                 h->S_Cx, nXcols, &cbeta,
                 h->Kx, nXcols);
     
     /* Regularisation of S_Cx */
     int ind;
     float limit, maxVal;
-    //utility_simaxv(h->s_Cx, nXcols, &ind);
-    ind = 0; /* utility_csvd returns the singular values in decending order */
-    limit = h->s_Cx[ind] * reg + 2.23e-13f;
+    //utility_simaxv(s_Cx, nXcols, &ind);
+    ind = 0; /* the singular/eigen values are in decending order */
+    limit = s_Cx[ind] * reg + 2.23e-13f;
     for(i=0; i < nXcols; i++)
-        h->S_Cx[i*nXcols+i] = cmplxf(1.0f / SAF_MAX(h->s_Cx[i], limit), 0.0f);
+        h->S_Cx[i*nXcols+i] = cmplxf(1.0f / SAF_MAX(s_Cx[i], limit), 0.0f);
     
     /* Formulate regularised Kx^-1 */
     cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, nXcols, nXcols, nXcols, &calpha,
                 h->S_Cx, nXcols,
-                h->U_Cx, nXcols, &cbeta,
-                h->Kx_reg_inverse, nXcols);
+                U_Cx, nXcols, &cbeta,
+                Kx_reg_inverse, nXcols);
     
     /* Formulate normalisation matrix G_hat */
     cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, nXcols, nYcols, nXcols, &calpha,
@@ -489,7 +529,7 @@ void formulate_M_and_Cr_cmplx
     /* Formulate optimal P */
     cblas_cgemm(CblasRowMajor, CblasConjTrans, CblasNoTrans, nYcols, nYcols, nYcols, &calpha,
                 h->G_hat, nYcols,
-                h->Ky, nYcols, &cbeta,
+                Ky, nYcols, &cbeta,
                 h->GhatH_Ky, nYcols);
     cblas_cgemm(CblasRowMajor, CblasConjTrans, CblasNoTrans, nXcols, nYcols, nYcols, &calpha,
                 Q, nXcols,
@@ -498,24 +538,52 @@ void formulate_M_and_Cr_cmplx
     cblas_cgemm(CblasRowMajor, CblasConjTrans, CblasNoTrans, nXcols, nYcols, nXcols, &calpha,
                 h->Kx, nXcols,
                 h->QH_GhatH_Ky, nYcols, &cbeta,
-                h->KxH_QH_GhatH_Ky, nYcols);
-    utility_csvd(h->hSVD, h->KxH_QH_GhatH_Ky, nXcols, nYcols, h->U, NULL, h->V, NULL);
+                KxH_QH_GhatH_Ky, nYcols);
+}
+
+/**
+ * Formulates the mixing matrix M (and optionally Cr), given the outputs of
+ * cdf4sap_cmplx_prepare() and the SVD of Kx^H Q^H G_hat^H Ky
+ */
+static void cdf4sap_cmplx_finalise
+(
+    cdf4sap_cmplx_data* h,
+    float_complex* Cx,
+    float_complex* Cy,
+    int useEnergyFLAG,
+    float_complex* Ky,
+    float_complex* Kx_reg_inverse,
+    float_complex* U,
+    float_complex* V,
+    float_complex* M,
+    float_complex* Cr
+)
+{
+    int i, j, nXcols, nYcols;
+    const float_complex calpha = cmplxf(1.0f, 0.0f); const float_complex cbeta = cmplxf(0.0f, 0.0f);
+
+    nXcols = h->nXcols;
+    nYcols = h->nYcols;
+
+    memset(h->lambda, 0, nYcols * nXcols * sizeof(float_complex));
+    for(i = 0; i<SAF_MIN(nXcols,nYcols); i++)
+        h->lambda[i*nXcols + i] = cmplxf(1.0f, 0.0f);
     cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, nYcols, nXcols, nXcols, &calpha,
                 h->lambda, nXcols,
-                h->U, nXcols, &cbeta,
+                U, nXcols, &cbeta,
                 h->lambda_UH, nXcols);
     cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nYcols, nXcols, nYcols, &calpha,
-                h->V, nYcols,
+                V, nYcols,
                 h->lambda_UH, nXcols, &cbeta,
                 h->P, nXcols);
     
     /* Formulate M */
     cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nYcols, nXcols, nXcols, &calpha,
                 h->P, nXcols,
-                h->Kx_reg_inverse, nXcols, &cbeta,
+                Kx_reg_inverse, nXcols, &cbeta,
                 h->P_Kxreginverse, nXcols);
     cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nYcols, nXcols, nYcols, &calpha,
-                h->Ky, nYcols,
+                Ky, nYcols,
                 h->P_Kxreginverse, nXcols, &cbeta,
                 M, nXcols);
     
@@ -559,5 +627,221 @@ void formulate_M_and_Cr_cmplx
         memcpy(M, h->G_M, nYcols*nXcols*sizeof(float_complex));
         if(Cr != NULL)
             memset(Cr, 0, nYcols*nYcols*sizeof(float_complex));
-    } 
+    }
+}
+
+void formulate_M_and_Cr_cmplx
+(
+    void * const hCdf,
+    float_complex* Cx,
+    float_complex* Cy,
+    float_complex* Q,
+    int useEnergyFLAG,
+    float reg,
+    float_complex* M,
+    float_complex* Cr
+)
+{
+    cdf4sap_cmplx_data *h = (cdf4sap_cmplx_data*)(hCdf);
+
+    /* Decompositions of Cy and Cx */
+    if(h->decompMethod==CDF4SAP_DECOMPOSITION_EIG){
+        utility_cseig(h->hEIG, Cy, h->nYcols, 1, h->U_Cy, NULL, h->s_Cy);
+        utility_cseig(h->hEIG, Cx, h->nXcols, 1, h->U_Cx, NULL, h->s_Cx);
+    }
+    else{
+        utility_csvd(h->hSVD, Cy, h->nYcols, h->nYcols, h->U_Cy, NULL, NULL, h->s_Cy);
+        utility_csvd(h->hSVD, Cx, h->nXcols, h->nXcols, h->U_Cx, NULL, NULL, h->s_Cx);
+    }
+
+    /* Formulate Ky, Kx, regularised Kx^-1, and Kx^H Q^H G_hat^H Ky */
+    cdf4sap_cmplx_prepare(h, Cx, Cy, Q, reg, h->U_Cy, h->s_Cy, h->U_Cx, h->s_Cx, h->Ky, h->Kx_reg_inverse, h->KxH_QH_GhatH_Ky);
+
+    /* Formulate optimal P, and the mixing matrix */
+    utility_csvd(h->hSVD, h->KxH_QH_GhatH_Ky, h->nXcols, h->nYcols, h->U, NULL, h->V, NULL);
+    cdf4sap_cmplx_finalise(h, Cx, Cy, useEnergyFLAG, h->Ky, h->Kx_reg_inverse, h->U, h->V, M, Cr);
+}
+
+/**
+ * Main data structure for the batched (multi-band) Covariance Domain Framework
+ * for Spatial Audio Processing (CDF4SAP), for complex-valued matrices.
+ */
+typedef struct _cdf4sap_cmplx_batch_data {
+    /* Dimensions of Cx and Cy, and the maximum number of bands */
+    int nXcols, nYcols, maxNbands;
+
+    /* Batched decompositions */
+    void* hEigBatch;                 /**< For decomposing Cx and Cy (when they are known to be Hermitian PSD) */
+    void* hSVDBatch;                 /**< For decomposing Cx and Cy, and Kx^H Q^H G_hat^H Ky */
+    void* hPool;                     /**< Thread pool (NULL if single-threaded) */
+    int nThreads;                    /**< Number of threads in hPool */
+    void** hCdf;                     /**< Per-thread single-band handles (scratch memory); nThreads x 1 */
+
+    /* Per-band intermediate matrices */
+    float_complex* U_Cy;             /**< FLAT: maxNbands x nYcols x nYcols */
+    float* s_Cy;                     /**< FLAT: maxNbands x nYcols */
+    float_complex* U_Cx;             /**< FLAT: maxNbands x nXcols x nXcols */
+    float* s_Cx;                     /**< FLAT: maxNbands x nXcols */
+    float_complex* Ky;               /**< FLAT: maxNbands x nYcols x nYcols */
+    float_complex* Kx_reg_inverse;   /**< FLAT: maxNbands x nXcols x nXcols */
+    float_complex* KxH_QH_GhatH_Ky;  /**< FLAT: maxNbands x nXcols x nYcols */
+    float_complex* U;                /**< FLAT: maxNbands x nXcols x nXcols */
+    float_complex* V;                /**< FLAT: maxNbands x nYcols x nYcols */
+
+    /* Arguments of the current formulate_M_and_Cr_cmplx_batch() call */
+    float_complex* Cx, *Cy, *Q, *M, *Cr;
+    int useEnergyFLAG;
+    float reg;
+
+}cdf4sap_cmplx_batch_data;
+
+/** Runs cdf4sap_cmplx_prepare() for one band */
+static void cdf4sap_cmplx_batch_prepareBand
+(
+    void* userData,
+    int band,
+    int threadIdx
+)
+{
+    cdf4sap_cmplx_batch_data *h = (cdf4sap_cmplx_batch_data*)(userData);
+    int nX, nY;
+
+    nX = h->nXcols;
+    nY = h->nYcols;
+    cdf4sap_cmplx_prepare((cdf4sap_cmplx_data*)h->hCdf[threadIdx], h->Cx + band*nX*nX, h->Cy + band*nY*nY, h->Q + band*nY*nX, h->reg,
+                          h->U_Cy + band*nY*nY, h->s_Cy + band*nY, h->U_Cx + band*nX*nX, h->s_Cx + band*nX,
+                          h->Ky + band*nY*nY, h->Kx_reg_inverse + band*nX*nX, h->KxH_QH_GhatH_Ky + band*nX*nY);
+}
+
+/** Runs cdf4sap_cmplx_finalise() for one band */
+static void cdf4sap_cmplx_batch_finaliseBand
+(
+    void* userData,
+    int band,
+    int threadIdx
+)
+{
+    cdf4sap_cmplx_batch_data *h = (cdf4sap_cmplx_batch_data*)(userData);
+    int nX, nY;
+
+    nX = h->nXcols;
+    nY = h->nYcols;
+    cdf4sap_cmplx_finalise((cdf4sap_cmplx_data*)h->hCdf[threadIdx], h->Cx + band*nX*nX, h->Cy + band*nY*nY, h->useEnergyFLAG,
+                           h->Ky + band*nY*nY, h->Kx_reg_inverse + band*nX*nX, h->U + band*nX*nX, h->V + band*nY*nY,
+                           h->M + band*nY*nX, h->Cr==NULL ? NULL : h->Cr + band*nY*nY);
+}
+
+void cdf4sap_cmplx_batch_create
+(
+    void ** const phCdf,
+    int nXcols,
+    int nYcols,
+    int maxNbands,
+    void* const hPool
+)
+{
+    *phCdf = malloc1d(sizeof(cdf4sap_cmplx_batch_data));
+    cdf4sap_cmplx_batch_data *h = (cdf4sap_cmplx_batch_data*)(*phCdf);
+    int t, maxDim;
+
+    h->nXcols = nXcols;
+    h->nYcols = nYcols;
+    h->maxNbands = maxNbands;
+    h->hPool = hPool;
+    h->nThreads = saf_threadPool_getNumThreads(hPool);
+    maxDim = SAF_MAX(nXcols, nYcols);
+
+    /* Batched decompositions (split over the same threads) */
+    utility_cseig_batch_create(&(h->hEigBatch), maxDim, hPool);
+    utility_csvd_batch_create(&(h->hSVDBatch), maxDim, maxDim, hPool);
+
+    /* Scratch memory for the per-band steps, one set per thread */
+    h->hCdf = (void**)malloc1d(h->nThreads*sizeof(void*));
+    for(t=0; t<h->nThreads; t++)
+        cdf4sap_cmplx_create(&(h->hCdf[t]), nXcols, nYcols);
+
+    /* Per-band intermediate matrices */
+    h->U_Cy = malloc1d(maxNbands*nYcols*nYcols*sizeof(float_complex));
+    h->s_Cy = malloc1d(maxNbands*nYcols*sizeof(float));
+    h->U_Cx = malloc1d(maxNbands*nXcols*nXcols*sizeof(float_complex));
+    h->s_Cx = malloc1d(maxNbands*nXcols*sizeof(float));
+    h->Ky = malloc1d(maxNbands*nYcols*nYcols*sizeof(float_complex));
+    h->Kx_reg_inverse = malloc1d(maxNbands*nXcols*nXcols*sizeof(float_complex));
+    h->KxH_QH_GhatH_Ky = malloc1d(maxNbands*nXcols*nYcols*sizeof(float_complex));
+    h->U = malloc1d(maxNbands*nXcols*nXcols*sizeof(float_complex));
+    h->V = malloc1d(maxNbands*nYcols*nYcols*sizeof(float_complex));
+}
+
+void cdf4sap_cmplx_batch_destroy
+(
+    void ** const phCdf
+)
+{
+    cdf4sap_cmplx_batch_data *h = (cdf4sap_cmplx_batch_data*)(*phCdf);
+    int t;
+
+    if(h!=NULL){
+        utility_cseig_batch_destroy(&(h->hEigBatch));
+        utility_csvd_batch_destroy(&(h->hSVDBatch));
+        for(t=0; t<h->nThreads; t++)
+            cdf4sap_cmplx_destroy(&(h->hCdf[t]));
+        free(h->hCdf);
+        free(h->U_Cy);
+        free(h->s_Cy);
+        free(h->U_Cx);
+        free(h->s_Cx);
+        free(h->Ky);
+        free(h->Kx_reg_inverse);
+        free(h->KxH_QH_GhatH_Ky);
+        free(h->U);
+        free(h->V);
+        free(h);
+        h = NULL;
+        *phCdf = NULL;
+    }
+}
+
+void formulate_M_and_Cr_cmplx_batch
+(
+    void * const hCdf,
+    float_complex* Cx,
+    float_complex* Cy,
+    float_complex* Q,
+    int nBands,
+    int useEnergyFLAG,
+    float reg,
+    int hermitianFLAG,
+    float_complex* M,
+    float_complex* Cr
+)
+{
+    cdf4sap_cmplx_batch_data *h = (cdf4sap_cmplx_batch_data*)(hCdf);
+
+    saf_assert(nBands<=h->maxNbands, "nBands exceeds the maximum specified upon creation");
+    if(nBands<1)
+        return;
+    h->Cx = Cx;
+    h->Cy = Cy;
+    h->Q = Q;
+    h->M = M;
+    h->Cr = Cr;
+    h->useEnergyFLAG = useEnergyFLAG;
+    h->reg = reg;
+
+    /* Decompositions of Cy and Cx, for all bands at once */
+    if(hermitianFLAG){
+        utility_cseig_batch(h->hEigBatch, Cy, h->nYcols, nBands, 1, h->U_Cy, NULL, h->s_Cy);
+        utility_cseig_batch(h->hEigBatch, Cx, h->nXcols, nBands, 1, h->U_Cx, NULL, h->s_Cx);
+    }
+    else{
+        utility_csvd_batch(h->hSVDBatch, Cy, h->nYcols, h->nYcols, nBands, h->U_Cy, NULL, NULL, h->s_Cy);
+        utility_csvd_batch(h->hSVDBatch, Cx, h->nXcols, h->nXcols, nBands, h->U_Cx, NULL, NULL, h->s_Cx);
+    }
+
+    /* Formulate Ky, Kx, regularised Kx^-1, and Kx^H Q^H G_hat^H Ky per band */
+    saf_threadPool_run(h->hPool, nBands, cdf4sap_cmplx_batch_prepareBand, (void*)h);
+
+    /* Formulate optimal P, and the mixing matrices */
+    utility_csvd_batch(h->hSVDBatch, h->KxH_QH_GhatH_Ky, h->nXcols, h->nYcols, nBands, h->U, NULL, h->V, NULL);
+    saf_threadPool_run(h->hPool, nBands, cdf4sap_cmplx_batch_finaliseBand, (void*)h);
 }
@@ -47,6 +47,32 @@
 extern "C" {
 #endif /* __cplusplus */
 
+/* ========================================================================== */
+/*                                   Enums                                    */
+/* ========================================================================== */
+
+/**
+ * Available methods for decomposing the input and target covariance matrices,
+ * 'Cx' and 'Cy'
+ *
+ * Since these matrices are Hermitian positive semi-definite, their eigenvalue
+ * and singular value decompositions coincide (up to the arbitrary phase of the
+ * vectors, which does not affect the solution). The eigenvalue decomposition
+ * is, however, cheaper to compute. Note that, if 'Cx' or 'Cy' are rank
+ * deficient, then the solution is only defined up to the numerical noise in
+ * their null-spaces. The two methods may then yield different mixing matrices,
+ * and the resulting output covariance matrices may differ by a few percent
+ * (relative to the largest element of 'Cy'). With energy compensation enabled,
+ * both methods still deliver the target channel energies. Note that the SVD
+ * is always used for the (non-square) 'KxH_QH_GhatH_Ky' matrix.
+ */
+typedef enum {
+    CDF4SAP_DECOMPOSITION_SVD = 1, /**< Singular value decomposition (default) */
+    CDF4SAP_DECOMPOSITION_EIG      /**< Symmetric/Hermitian eigenvalue
+                                    *   decomposition */
+} CDF4SAP_DECOMPOSITION_METHODS;
+
+
 /* ========================================================================== */
 /*                               Main Functions                               */
 /* ========================================================================== */
@@ -103,6 +129,35 @@ void cdf4sap_destroy(/* Input Arguments */
 void cdf4sap_cmplx_destroy(/* Input Arguments */
                            void ** const phCdf);
 
+/**
+ * Sets the method used for decomposing 'Cx' and 'Cy' (default:
+ * #CDF4SAP_DECOMPOSITION_SVD)
+ *
+ * @note Use this function for real-valued input/output matrices. For
+ *       complex-valued input/output matrices use
+ *       cdf4sap_cmplx_setDecompositionMethod().
+ *
+ * @param[in] hCdf   Covariance Domain Framework handle
+ * @param[in] method See #CDF4SAP_DECOMPOSITION_METHODS
+ */
+void cdf4sap_setDecompositionMethod(/* Input Arguments */
+                                    void * const hCdf,
+                                    CDF4SAP_DECOMPOSITION_METHODS method);
+
+/**
+ * Sets the method used for decomposing 'Cx' and 'Cy' (default:
+ * #CDF4SAP_DECOMPOSITION_SVD)
+ *
+ * @note Use this function for complex-valued input/output matrices. For
+ *       real-valued input/output matrices use cdf4sap_setDecompositionMethod().
+ *
+ * @param[in] hCdf   Covariance Domain Framework handle
+ * @param[in] method See #CDF4SAP_DECOMPOSITION_METHODS
+ */
+void cdf4sap_cmplx_setDecompositionMethod(/* Input Arguments */
+                                          void * const hCdf,
+                                          CDF4SAP_DECOMPOSITION_METHODS method);
+
 /**
  * Computes the optimal mixing matrices
  *
@@ -217,6 +272,85 @@ void formulate_M_and_Cr_cmplx(/* Input Arguments */
                               float_complex* Cr);
 
 
+/* ========================================================================== */
+/*                         Batched (Multi-band) Functions                     */
+/* ========================================================================== */
+
+/**
+ * Creates an instance of the batched Covariance Domain Framework, which solves
+ * the problem for many (e.g. frequency bands) complex-valued Cx/Cy/Q at once
+ *
+ * @param[in] phCdf     The address (&) of the CDF4SAP batch handle
+ * @param[in] nXcols    Number of columns/rows in square input matrices 'Cx'
+ * @param[in] nYcols    Number of columns/rows in square input matrices 'Cy'
+ * @param[in] maxNbands Maximum number of bands that may be passed to
+ *                      formulate_M_and_Cr_cmplx_batch()
+ * @param[in] hPool     Thread pool handle (see saf_threadPool_create()), over
+ *                      which the bands should be split; or NULL for single-
+ *                      threaded. Note the pool must outlive this handle.
+ */
+void cdf4sap_cmplx_batch_create(/* Input Arguments */
+                                void ** const phCdf,
+                                int nXcols,
+                                int nYcols,
+                                int maxNbands,
+                                void* const hPool);
+
+/**
+ * Destroys an instance of the batched Covariance Domain Framework
+ *
+ * @param[in] phCdf The address (&) of the CDF4SAP batch handle
+ */
+void cdf4sap_cmplx_batch_destroy(/* Input Arguments */
+                                 void ** const phCdf);
+
+/**
+ * Computes the optimal mixing matrices for a batch of bands
+ *
+ * Equivalent to calling formulate_M_and_Cr_cmplx() for each band, except that
+ * the decompositions of Cx, Cy, and Kx^H Q^H G_hat^H Ky are conducted for all
+ * bands at once (see utility_csvd_batch() and utility_cseig_batch()), and the
+ * remaining per-band operations are split over the threads of the thread pool
+ * given to cdf4sap_cmplx_batch_create() (if any).
+ *
+ * @note The decompositions are unique only up to a (complex) scaling of the
+ *       singular/eigen vectors, which cancels out in the solution. The mixing
+ *       matrices therefore match those of formulate_M_and_Cr_cmplx() to within
+ *       numerical precision.
+ *
+ * @test test__formulate_M_and_Cr_cmplx_batch()
+ *
+ * @param[in]  hCdf          Covariance Domain Framework batch handle
+ * @param[in]  Cx            Covariance matrices of input 'x';
+ *                           FLAT: nBands x nXcols x nXcols
+ * @param[in]  Cy            Target covariance matrices;
+ *                           FLAT: nBands x nYcols x nYcols
+ * @param[in]  Q             Prototype matrices; FLAT: nBands x nYcols x nXcols
+ * @param[in]  nBands        Number of bands (<=maxNbands)
+ * @param[in]  useEnergyFLAG See formulate_M_and_Cr_cmplx()
+ * @param[in]  reg           Regularisation term (suggested: 0.2f)
+ * @param[in]  hermitianFLAG '1' Cx and Cy are known to be Hermitian positive
+ *                           semi-definite, in which case they are decomposed
+ *                           via an eigen decomposition (which is cheaper)
+ *                           rather than an SVD. '0' use the SVD.
+ * @param[out] M             Mixing matrices; FLAT: nBands x nYcols x nXcols
+ * @param[out] Cr            Mixing matrix residuals, set to NULL if not
+ *                           needed; FLAT: nBands x nYcols x nYcols
+ */
+void formulate_M_and_Cr_cmplx_batch(/* Input Arguments */
+                                    void * const hCdf,
+                                    float_complex* Cx,
+                                    float_complex* Cy,
+                                    float_complex* Q,
+                                    int nBands,
+                                    int useEnergyFLAG,
+                                    float reg,
+                                    int hermitianFLAG,
+                                    /* Output Arguments */
+                                    float_complex* M,
+                                    float_complex* Cr);
+
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif /* __cplusplus */
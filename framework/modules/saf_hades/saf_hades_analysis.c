@@ -44,6 +44,71 @@
 /*                             HADES Analysis                               */
 /* ========================================================================== */
 
+/** Applies the diffuse whitening process to the covariance matrix of one band */
+static void hades_analysis_whitenBand
+(
+    void* userData,
+    int band,
+    int threadIdx
+)
+{
+    hades_analysis_data *a = (hades_analysis_data*)(userData);
+    CxMic Cx, T_Cx;
+    const float_complex calpha = cmplxf(1.0f, 0.0f); const float_complex cbeta = cmplxf(0.0f, 0.0f); /* blas */
+    SAF_UNUSED(threadIdx);
+
+    utility_ccovtrk_get(a->hCovTrk, band, a->nMics, Cx.Cx);
+    cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, a->nMics, a->nMics, a->nMics, &calpha,
+                a->T[band], a->nMics,
+                Cx.Cx, a->nMics, &cbeta,
+                T_Cx.Cx, a->nMics);
+    cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, a->nMics, a->nMics, a->nMics, &calpha,
+                T_Cx.Cx, a->nMics,
+                a->T[band], a->nMics, &cbeta,
+                &(a->T_Cx_TH[band*(a->nMics)*(a->nMics)]), a->nMics);
+}
+
+/** Estimates the spatial parameters of one band, from its eigen decomposition */
+static void hades_analysis_estimateBand
+(
+    void* userData,
+    int band,
+    int threadIdx
+)
+{
+    hades_analysis_data *a = (hades_analysis_data*)(userData);
+    hades_param_container_data *pcon = a->pcon;
+    int i, j, k, est_idx;
+    float diffuseness;
+    float_complex* Vn;
+
+    /* Estimate diffuseness */
+    diffuseness = 0.0f;
+    switch(a->diffOpt){
+        case HADES_USE_COMEDIE: diffuseness = hades_comedie(&(a->lambda[band*(a->nMics)]), a->nMics); break;
+    }
+
+    /* Store diffuseness and source number estimates */
+    pcon->diffuseness[band] = diffuseness;
+    pcon->gains_dir[band] = pcon->gains_diff[band] = 1.0f; /* Default gains per band */
+
+    /* Apply DoA estimator */
+    est_idx = 0;
+    switch(a->doaOpt){
+        case HADES_USE_MUSIC:
+            /* perform sphMUSIC on the noise subspace */
+            Vn = &(a->Vn[threadIdx*(a->nMics)*(a->nMics)]);
+            for(i=0; i<a->nMics; i++)
+                for(j=0, k=1; j<a->nMics-1; j++, k++)
+                    Vn[i*(a->nMics-1)+j] = a->V[band*(a->nMics)*(a->nMics) + i*(a->nMics)+k];
+            hades_sdMUSIC_compute(a->hDoA[threadIdx], &(a->H_array_w[band*(a->nMics)*(a->nGrid)]), Vn, 1, NULL, &est_idx);
+            break;
+    }
+
+    /* Store */
+    pcon->doa_idx[band] = pcon->gains_idx[band] = est_idx;
+}
+
 void hades_analysis_create
 (
     hades_analysis_handle* const phAna,
@@ -58,12 +123,13 @@ void hades_analysis_create
     int nMics,
     int h_len,
     HADES_DIFFUSENESS_ESTIMATORS diffOption,
-    HADES_DOA_ESTIMATORS doaOption
+    HADES_DOA_ESTIMATORS doaOption,
+    int nThreads
 )
 {
     hades_analysis_data* a = (hades_analysis_data*)malloc1d(sizeof(hades_analysis_data));
     *phAna = (void*)a;
-    int band, i, idx_max;
+    int band, i, t, idx_max;
     float* w_tmp;
     float_complex *U, *E, *H_W;
     const float_complex calpha = cmplxf(1.0f, 0.0f); const float_complex cbeta = cmplxf(0.0f, 0.0f); /* blas */
@@ -87,6 +153,8 @@ void hades_analysis_create
     a->h_len = h_len;
     a->diffOpt = diffOption;
     a->doaOpt = doaOption;
+    a->nThreads = SAF_MAX(nThreads, 1);
+    a->enableCoarseToFine = 0;
     a->covAvgCoeff = 1.0f - 1.0f/(4096.0f/a->blocksize);
     a->covAvgCoeff = SAF_CLAMP(a->covAvgCoeff, 0.0f, 0.99999f);
 
@@ -110,12 +178,22 @@ void hades_analysis_create
             break;
     }
 
-    /* Initialise DoA estimator */
+    /* Worker threads, over which the bands are split */
+    if(a->nThreads>1)
+        saf_threadPool_create(&(a->hPool), a->nThreads);
+    else
+        a->hPool = NULL;
+
+    /* Initialise DoA estimator (one instance per thread, since they hold their own scratch memory) */
     utility_cseig_create(&(a->hEig), a->nMics);
+    utility_cseig_batch_create(&(a->hEigBatch), a->nMics, a->hPool);
     a->grid_dirs_xyz = malloc1d(a->nGrid*3*sizeof(float));
     unitSph2cart(a->grid_dirs_deg, a->nGrid, 1, a->grid_dirs_xyz);
-    switch(a->doaOpt){
-        case HADES_USE_MUSIC: hades_sdMUSIC_create(&(a->hDoA), a->nMics, a->grid_dirs_deg, a->nGrid); break;
+    a->hDoA = (void**)calloc1d(a->nThreads, sizeof(void*));
+    for(t=0; t<a->nThreads; t++){
+        switch(a->doaOpt){
+            case HADES_USE_MUSIC: hades_sdMUSIC_create(&(a->hDoA[t]), a->nMics, a->grid_dirs_deg, a->nGrid, 0); break;
+        }
     }
 
     /* Integration weights */
@@ -172,10 +250,11 @@ void hades_analysis_create
 
     /* Run-time variables */
     a->inputBlock = (float**)malloc2d(a->nMics, a->blocksize, sizeof(float));
-    a->Cx = malloc1d(a->nBands*sizeof(CxMic));
-    a->V  = malloc1d((a->nMics)*(a->nMics)*sizeof(float_complex));
-    a->Vn = malloc1d((a->nMics)*(a->nMics)*sizeof(float_complex));
-    a->lambda = malloc1d((a->nMics)*sizeof(float));
+    utility_ccovtrk_create(&(a->hCovTrk), a->nMics, a->nBands);
+    a->T_Cx_TH = malloc1d(a->nBands*(a->nMics)*(a->nMics)*sizeof(float_complex));
+    a->V  = malloc1d(a->nBands*(a->nMics)*(a->nMics)*sizeof(float_complex));
+    a->Vn = malloc1d(a->nThreads*(a->nMics)*(a->nMics)*sizeof(float_complex));
+    a->lambda = malloc1d(a->nBands*(a->nMics)*sizeof(float));
 
     /* Flush run-time buffers with zeros */
     hades_analysis_reset((*phAna));
@@ -187,6 +266,7 @@ void hades_analysis_destroy
 )
 {
     hades_analysis_data *a = (hades_analysis_data*)(*phAna);
+    int t;
 
     if (a != NULL) {
         free(a->h_array);
@@ -207,15 +287,21 @@ void hades_analysis_destroy
 
         /* Destroy DoA estimator */
         utility_cseig_destroy(&(a->hEig));
-        switch(a->doaOpt){
-            case HADES_USE_MUSIC:
-                hades_sdMUSIC_destroy(&(a->hDoA));
-                break;
+        utility_cseig_batch_destroy(&(a->hEigBatch));
+        for(t=0; t<a->nThreads; t++){
+            switch(a->doaOpt){
+                case HADES_USE_MUSIC:
+                    hades_sdMUSIC_destroy(&(a->hDoA[t]));
+                    break;
+            }
         }
+        free(a->hDoA);
+        saf_threadPool_destroy(&(a->hPool));
 
         /* Free run-time variables */
         free(a->inputBlock);
-        free(a->Cx);
+        utility_ccovtrk_destroy(&(a->hCovTrk));
+        free(a->T_Cx_TH);
         free(a->V);
         free(a->Vn);
         free(a->lambda);
@@ -232,13 +318,11 @@ void hades_analysis_reset
 )
 {
     hades_analysis_data *a;
-    int band;
     if(hAna==NULL)
         return;
     a = (hades_analysis_data*)(hAna);
 
-    for(band=0; band<a->nBands; band++)
-        memset(a->Cx[band].Cx, 0, HADES_MAX_NMICS*HADES_MAX_NMICS*sizeof(float_complex));
+    utility_ccovtrk_reset(a->hCovTrk);
 }
 
 void hades_analysis_apply
@@ -254,10 +338,7 @@ void hades_analysis_apply
     hades_analysis_data *a = (hades_analysis_data*)(hAna);
     hades_param_container_data *pcon = (hades_param_container_data*)(hPCon);
     hades_signal_container_data *scon = (hades_signal_container_data*)(hSCon);
-    int i, j, k, ch, band, est_idx;
-    float diffuseness;
-    CxMic Cx_new, T_Cx, T_Cx_TH;
-    const float_complex calpha = cmplxf(1.0f, 0.0f); const float_complex cbeta = cmplxf(0.0f, 0.0f); /* blas */
+    int ch, band;
 
     assert(blocksize==a->blocksize);
 
@@ -275,56 +356,20 @@ void hades_analysis_apply
 
     /* Update covarience matrix per band */
     for(band=0; band<a->nBands; band++){
-        cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, a->nMics, a->nMics, a->timeSlots, &calpha,
-                    FLATTEN2D(scon->inTF[band]), a->timeSlots,
-                    FLATTEN2D(scon->inTF[band]), a->timeSlots, &cbeta,
-                    Cx_new.Cx, a->nMics);
-
-        /* Make a copy for the signal container */
-        cblas_ccopy(a->nMics*a->nMics, (float_complex*)Cx_new.Cx, 1, (float_complex*)scon->Cx[band].Cx, 1);
-
-        /* Apply temporal averaging */
-        cblas_sscal(/*re+im*/2*(a->nMics) * (a->nMics), SAF_CLAMP(a->covAvgCoeff, 0.0f, 0.999f), (float*)a->Cx[band].Cx, 1);
-        cblas_saxpy(/*re+im*/2*(a->nMics) * (a->nMics), 1.0f-SAF_CLAMP(a->covAvgCoeff, 0.0f, 0.999f), (float*)Cx_new.Cx, 1, (float*)a->Cx[band].Cx, 1);
+        /* (also makes a non-averaged copy for the signal container) */
+        utility_ccovtrk_update(a->hCovTrk, band, FLATTEN2D(scon->inTF[band]), a->nMics, a->timeSlots,
+                               SAF_CLAMP(a->covAvgCoeff, 0.0f, 0.999f), scon->Cx[band].Cx);
     }
 
-    /* Spatial parameter estimation per band */
-    for (band = 0; band < a->nBands; band++) {
-        /* Apply diffuse whitening process */
-        cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, a->nMics, a->nMics, a->nMics, &calpha,
-                    a->T[band], a->nMics,
-                    a->Cx[band].Cx, a->nMics, &cbeta,
-                    T_Cx.Cx, a->nMics);
-        cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, a->nMics, a->nMics, a->nMics, &calpha,
-                    T_Cx.Cx, a->nMics,
-                    a->T[band], a->nMics, &cbeta,
-                    T_Cx_TH.Cx, a->nMics);
-        utility_cseig(a->hEig, T_Cx_TH.Cx, a->nMics, 1, a->V, NULL, a->lambda);
-
-        /* Estimate diffuseness */
-        diffuseness = 0.0f;
-        switch(a->diffOpt){
-            case HADES_USE_COMEDIE: diffuseness = hades_comedie(a->lambda, a->nMics); break;
-        }
+    /* Apply diffuse whitening process (bands split over the worker threads) */
+    saf_threadPool_run(a->hPool, a->nBands, hades_analysis_whitenBand, (void*)a);
 
-        /* Store diffuseness and source number estimates */
-        pcon->diffuseness[band] = diffuseness;
-        pcon->gains_dir[band] = pcon->gains_diff[band] = 1.0f; /* Default gains per band */
+    /* Eigenvalue decomposition of the whitened covariance matrices, for all bands at once */
+    utility_cseig_batch(a->hEigBatch, a->T_Cx_TH, a->nMics, a->nBands, 1, a->V, NULL, a->lambda);
 
-        /* Apply DoA estimator */
-        switch(a->doaOpt){
-            case HADES_USE_MUSIC:
-                /* perform sphMUSIC on the noise subspace */
-                for(i=0; i<a->nMics; i++)
-                    for(j=0, k=1; j<a->nMics-1; j++, k++)
-                        a->Vn[i*(a->nMics-1)+j] = a->V[i*(a->nMics)+k];
-                hades_sdMUSIC_compute(a->hDoA, &(a->H_array_w[band*(a->nMics)*(a->nGrid)]), a->Vn, 1, NULL, &est_idx);
-                break;
-        }
-
-        /* Store */
-        pcon->doa_idx[band] = pcon->gains_idx[band] = est_idx; 
-    }
+    /* Spatial parameter estimation per band (bands split over the worker threads) */
+    a->pcon = pcon;
+    saf_threadPool_run(a->hPool, a->nBands, hades_analysis_estimateBand, (void*)a);
 }
 
 const float* hades_analysis_getFrequencyVectorPtr
@@ -373,6 +418,34 @@ int hades_analysis_getProcDelay
     return hAna == NULL ? 0 : ((hades_analysis_data*)(hAna))->filterbankDelay;
 }
 
+void hades_analysis_setCoarseToFineDoA
+(
+    hades_analysis_handle const hAna,
+    int enable
+)
+{
+    hades_analysis_data *a;
+    int t;
+    if(hAna==NULL)
+        return;
+    a = (hades_analysis_data*)(hAna);
+    enable = enable ? 1 : 0;
+    if(a->enableCoarseToFine == enable)
+        return;
+    a->enableCoarseToFine = enable;
+
+    /* Re-create the DoA estimators (with or without the coarse grid) */
+    for(t=0; t<a->nThreads; t++){
+        switch(a->doaOpt){
+            case HADES_USE_MUSIC:
+                hades_sdMUSIC_destroy(&(a->hDoA[t]));
+                hades_sdMUSIC_create(&(a->hDoA[t]), a->nMics, a->grid_dirs_deg, a->nGrid,
+                                     enable ? a->nGrid/HADES_SDMUSIC_COARSE_GRID_FACTOR : 0);
+                break;
+        }
+    }
+}
+
 
 /* ========================================================================== */
 /*                      Parameter and Signal Containers                       */
@@ -422,6 +495,22 @@ void hades_param_container_destroy
     }
 }
 
+const float* hades_param_container_getDiffusenessPtr
+(
+    hades_param_container_handle const hPCon
+)
+{
+    return hPCon == NULL ? NULL : (const float*)((hades_param_container_data*)(hPCon))->diffuseness;
+}
+
+const int* hades_param_container_getDoAindicesPtr
+(
+    hades_param_container_handle const hPCon
+)
+{
+    return hPCon == NULL ? NULL : (const int*)((hades_param_container_data*)(hPCon))->doa_idx;
+}
+
 void hades_signal_container_create
 (
     hades_signal_container_handle* const phSCon,
@@ -462,4 +551,18 @@ void hades_signal_container_destroy
     }
 }
 
+const float_complex* hades_signal_container_getCovarianceMatrixPtr
+(
+    hades_signal_container_handle const hSCon,
+    int band
+)
+{
+    hades_signal_container_data *scon;
+    if(hSCon==NULL)
+        return NULL;
+    scon = (hades_signal_container_data*)(hSCon);
+    saf_assert(band>=0 && band<scon->nBands, "Invalid band index");
+    return (const float_complex*)scon->Cx[band].Cx;
+}
+
 #endif /* SAF_ENABLE_HADES_MODULE */
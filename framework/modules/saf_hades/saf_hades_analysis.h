@@ -38,6 +38,8 @@
 #ifndef __SAF_HADES_ANALYSIS_H_INCLUDED__
 #define __SAF_HADES_ANALYSIS_H_INCLUDED__
 
+#include "../saf_utilities/saf_utility_complex.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -104,6 +106,10 @@ typedef enum {
  * @param[in] diffOption    Diffusness parameter estimator to use (see
  *                          #HADES_DIFFUSENESS_ESTIMATORS)
  * @param[in] doaOption     DoA estimator to use (see #HADES_DOA_ESTIMATORS)
+ * @param[in] nThreads      Number of threads over which to split the per-band
+ *                          analysis (including the calling thread); 1 for
+ *                          single-threaded. The worker threads are spawned
+ *                          here, and persist until hades_analysis_destroy()
  */
 void hades_analysis_create(/* Input Arguments */
                            hades_analysis_handle* const phAna,
@@ -118,7 +124,8 @@ void hades_analysis_create(/* Input Arguments */
                            int nMics,
                            int h_len,
                            HADES_DIFFUSENESS_ESTIMATORS diffOption,
-                           HADES_DOA_ESTIMATORS doaOption);
+                           HADES_DOA_ESTIMATORS doaOption,
+                           int nThreads);
 
 /**
  * Destroys an instance of a hades analysis object
@@ -201,6 +208,28 @@ float* hades_analysis_getCovarianceAvagingCoeffPtr(hades_analysis_handle const h
  */
 int hades_analysis_getProcDelay(hades_analysis_handle const hAna);
 
+/**
+ * Enables/disables the coarse-to-fine search for the DoA estimates (disabled
+ * by default)
+ *
+ * When enabled, the MUSIC pseudo-spectrum is first evaluated for a coarse
+ * subset of the scanning grid (every 8th direction, approximately), and then
+ * only refined around its highest local maxima; one per source, as estimated
+ * for that band (see saf_gridSearch). This is considerably cheaper for dense
+ * scanning grids, but the DoA estimates may differ from those of the
+ * exhaustive search whenever the pseudo-spectrum has more peaks of similar
+ * height than there are sources.
+ *
+ * @warning This re-creates the DoA estimators, so it should not be called
+ *          while hades_analysis_apply() is running
+ *
+ * @param[in] hAna   hades analysis handle
+ * @param[in] enable 0: exhaustive search over all grid directions,
+ *                   1: coarse-to-fine search
+ */
+void hades_analysis_setCoarseToFineDoA(hades_analysis_handle const hAna,
+                                       int enable);
+
 
 /* ========================================================================== */
 /*                      Parameter and Signal Containers                       */
@@ -230,6 +259,20 @@ void hades_param_container_create(/* Input Arguments */
 void hades_param_container_destroy(/* Input Arguments */
                                    hades_param_container_handle* const phPCon);
 
+/**
+ * Returns a pointer to the diffuseness values estimated per band, by the last
+ * hades_analysis_apply() call (or NULL if hPCon is not initialised);
+ * nBands x 1
+ */
+const float* hades_param_container_getDiffusenessPtr(hades_param_container_handle const hPCon);
+
+/**
+ * Returns a pointer to the DoA (scanning grid) indices estimated per band, by
+ * the last hades_analysis_apply() call (or NULL if hPCon is not initialised);
+ * nBands x 1
+ */
+const int* hades_param_container_getDoAindicesPtr(hades_param_container_handle const hPCon);
+
 /**
  * Creates an instance of a container used for storing the TF-domain audio
  * returned by an analyser for one 'blocksize'
@@ -253,6 +296,17 @@ void hades_signal_container_create(hades_signal_container_handle* const phSCon,
 void hades_signal_container_destroy(/* Input Arguments */
                                     hades_signal_container_handle* const phSCon);
 
+/**
+ * Returns a pointer to the (non-time-averaged) covariance matrix of one band,
+ * as computed by the last hades_analysis_apply() call (or NULL if hSCon is
+ * not initialised); FLAT: nMics x nMics
+ *
+ * @param[in] hSCon hades signal container handle
+ * @param[in] band  Band index
+ */
+const float_complex* hades_signal_container_getCovarianceMatrixPtr(hades_signal_container_handle const hSCon,
+                                                                   int band);
+
 #endif /* SAF_ENABLE_HADES_MODULE */
 
 
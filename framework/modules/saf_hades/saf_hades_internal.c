@@ -52,8 +52,9 @@ void hades_getInterpolatedHRTFs
     hades_analysis_data *a = (hades_analysis_data*)(hAna);
     int band, i, j, ntable, ntri;
     int* idx;
-    float* itds_s, *interpTable, *w;
+    float* itds_s, *interpTable, *interpWeights, *w;
     float_complex*** hrtf_fb;    /* nBands x NUM_EARS x N_dirs */
+    float_complex* hrtf_fb_dm;   /* N_dirs x nBands x NUM_EARS */
 
     /* Pass HRIRs through the filterbank */
     hrtf_fb = (float_complex***)malloc3d(a->nBands, NUM_EARS, binConfig->nHRIR, sizeof(float_complex));
@@ -94,16 +95,23 @@ void hades_getInterpolatedHRTFs
             /* Diffuse-field EQ with phase-simplification */
             diffuseFieldEqualiseHRTFs(binConfig->nHRIR, itds_s, a->freqVector, a->nBands, w, 1, 1, FLATTEN3D(hrtf_fb));
 
-            /* Interpolation table */
+            /* Interpolation table (compressed to the 3 HRTFs used per target direction) */
             interpTable = NULL;
             generateVBAPgainTable3D_srcs(target_dirs_deg, nTargetDirs, binConfig->hrir_dirs_deg, binConfig->nHRIR, 0, 0, 0.0f, &interpTable, &ntable, &ntri);
-            VBAPgainTable2InterpTable(interpTable, nTargetDirs, binConfig->nHRIR);
+            idx = malloc1d(nTargetDirs*3*sizeof(int));
+            interpWeights = malloc1d(nTargetDirs*3*sizeof(float));
+            compressVBAPgainTable3D(interpTable, nTargetDirs, binConfig->nHRIR, interpWeights, idx);
 
-            /* Interpolate */
-            interpHRTFs(FLATTEN3D(hrtf_fb), itds_s, a->freqVector, interpTable, binConfig->nHRIR, a->nBands, nTargetDirs, hrtf_interp);
+            /* Interpolate (direction-major, such that each HRTF is read as one contiguous block) */
+            hrtf_fb_dm = malloc1d(binConfig->nHRIR*(a->nBands)*NUM_EARS*sizeof(float_complex));
+            reorderHRTFs2dirMajor(FLATTEN3D(hrtf_fb), binConfig->nHRIR, a->nBands, hrtf_fb_dm);
+            interpHRTFs_tri(hrtf_fb_dm, itds_s, a->freqVector, idx, interpWeights, a->nBands, nTargetDirs, hrtf_interp);
 
             /* Clean-up */
             free(interpTable);
+            free(interpWeights);
+            free(idx);
+            free(hrtf_fb_dm);
             break;
     }
 
@@ -124,14 +132,49 @@ typedef struct _hades_sdMUSIC_data {
     float* P_minus_peak;
     float* VM_mask;
 
+    /* coarse-to-fine peak search */
+    void* hGridSearch;        /**< Grid search handle; NULL if not used */
+    float_complex* A_sub;     /**< Gathered steering vectors; FLAT: nMics x nDirs */
+    float_complex* A_grid_cur;/**< Steering vectors of the current call */
+    float_complex* Vn_cur;    /**< Noise subspace of the current call */
+    int VnD2_cur;             /**< Noise subspace dimension of the current call */
+
 }hades_sdMUSIC_data;
 
+/** Evaluates the MUSIC pseudo-spectrum for a subset of the grid directions */
+static void hades_sdMUSIC_computeSubset
+(
+    void* userData,
+    const int* inds,
+    int nInds,
+    float* vals
+)
+{
+    hades_sdMUSIC_data *h = (hades_sdMUSIC_data*)(userData);
+    int i, j, VnD2;
+    const float_complex calpha = cmplxf(1.0f, 0.0f); const float_complex cbeta = cmplxf(0.0f, 0.0f);
+
+    VnD2 = h->VnD2_cur;
+    for(i=0; i<h->nMics; i++)
+        for(j=0; j<nInds; j++)
+            h->A_sub[i*nInds+j] = h->A_grid_cur[i*(h->nDirs)+inds[j]];
+    cblas_cgemm(CblasRowMajor, CblasConjTrans, CblasNoTrans, nInds, VnD2, h->nMics, &calpha,
+                h->A_sub, nInds,
+                h->Vn_cur, VnD2, &cbeta,
+                h->VnA, VnD2);
+    utility_cvabs(h->VnA, nInds*VnD2, h->abs_VnA);
+    for (i = 0; i < nInds; i++)
+        h->pSpecInv[i] = cblas_sdot(VnD2, &(h->abs_VnA[i*VnD2]), 1, &(h->abs_VnA[i*VnD2]), 1);
+    utility_svrecip(h->pSpecInv, nInds, vals);
+}
+
 void hades_sdMUSIC_create
 (
     void ** const phMUSIC,
     int nMics,
     float* grid_dirs_deg,
-    int nDirs
+    int nDirs,
+    int nCoarseDirs
 )
 {
     *phMUSIC = malloc1d(sizeof(hades_sdMUSIC_data));
@@ -151,6 +194,16 @@ void hades_sdMUSIC_create
     h->pSpecInv = malloc1d(h->nDirs*sizeof(float));
     h->P_minus_peak = malloc1d(h->nDirs*sizeof(float));
     h->VM_mask = malloc1d(h->nDirs*sizeof(float));
+
+    /* for the (optional) coarse-to-fine peak search */
+    if(nCoarseDirs>0 && nCoarseDirs<nDirs){
+        saf_gridSearch_create(&(h->hGridSearch), grid_dirs_deg, nDirs, nCoarseDirs);
+        h->A_sub = malloc1d(h->nMics * (h->nDirs) * sizeof(float_complex));
+    }
+    else{
+        h->hGridSearch = NULL;
+        h->A_sub = NULL;
+    }
 }
 
 void hades_sdMUSIC_destroy
@@ -168,6 +221,8 @@ void hades_sdMUSIC_destroy
         free(h->pSpecInv);
         free(h->P_minus_peak);
         free(h->VM_mask);
+        saf_gridSearch_destroy(&(h->hGridSearch));
+        free(h->A_sub);
         free(h);
         h = NULL;
         *phMUSIC = NULL;
@@ -192,6 +247,16 @@ void hades_sdMUSIC_compute
 
     VnD2 = h->nMics - nSrcs; /* noise subspace second dimension length */
 
+    /* Only the peaks are wanted, so search coarse-to-fine (if enabled) */
+    if(P_music==NULL && peak_inds!=NULL && h->hGridSearch!=NULL){
+        h->A_grid_cur = A_grid;
+        h->Vn_cur = Vn;
+        h->VnD2_cur = VnD2;
+        /* (if there are fewer local maxima than sources, the remaining peaks are the next-highest values not already picked) */
+        saf_gridSearch_apply(h->hGridSearch, hades_sdMUSIC_computeSubset, (void*)h, nSrcs, NULL, peak_inds);
+        return;
+    }
+
     /* derive the pseudo-spectrum value for each grid direction */
     cblas_cgemm(CblasRowMajor, CblasConjTrans, CblasNoTrans, h->nDirs, VnD2, h->nMics, &calpha,
                 A_grid, h->nDirs,
@@ -52,6 +52,14 @@ extern "C" {
 /** Maximum supported blocksize */
 #define HADES_MAX_BLOCKSIZE ( 4096 )
 
+/** Ratio between the number of scanning grid directions and the number of
+ *  coarse directions used by the sdMUSIC coarse-to-fine peak search */
+#define HADES_SDMUSIC_COARSE_GRID_FACTOR ( 8 )
+
+/** Maximum number of consecutive frames for which a cached mixing matrix may
+ *  be reused (when change detection is enabled), before it is refreshed */
+#define HADES_SYNTHESIS_MAX_HOLD_FRAMES ( 32 )
+
 /** Helper struct for averaging covariance matrices (block-wise) */
 typedef struct _CxMic{
     float_complex Cx[HADES_MAX_NMICS*HADES_MAX_NMICS];
@@ -77,6 +85,8 @@ typedef struct _hades_analysis_data
     int h_len;                            /**< Length of impulse responses, in samples */
     HADES_DIFFUSENESS_ESTIMATORS diffOpt; /**< see #HADES_DIFFUSENESS_ESTIMATORS */
     HADES_DOA_ESTIMATORS doaOpt;          /**< see #HADES_DOA_ESTIMATORS */
+    int nThreads;                         /**< Number of threads over which the bands are split */
+    int enableCoarseToFine;               /**< 1: sdMUSIC peaks are searched coarse-to-fine, 0: exhaustively */
 
     /* Optional user parameters (that can also be manipulated at run-time) */
     float covAvgCoeff;                    /**< Temporal averaging coefficient [0 1] */
@@ -93,20 +103,34 @@ typedef struct _hades_analysis_data
 
     /* DoA and diffuseness estimator data */
     void* hEig;                           /**< handle for the eigen solver */
+    void* hEigBatch;                      /**< handle for the batched eigen solver (all bands at once) */
     float_complex** T;                    /**< for covariance whitening; nBands x (nMics x nMics) */
-    void* hDoA;                           /**< DoA estimator handle */
+    void** hDoA;                          /**< DoA estimator handles; one per thread */
     float* grid_dirs_xyz;                 /**< Scanning grid coordinates (unit vectors and only used by grid-based estimators); FLAT: nGrid x 3 */
     float_complex* W;                     /**< Diffuse integration weighting matrix; FLAT: nGrid x nGrid */
 
     /* Run-time variables */
+    void* hPool;                          /**< Worker thread pool (NULL if single-threaded) */
+    struct _hades_param_container_data* pcon; /**< Parameter container of the current hades_analysis_apply() call */
     float** inputBlock;                   /**< Input frame; nMics x blocksize */
-    CxMic* Cx;                            /**< Current (time-averaged) covariance matrix per band; nBands x 1 */
-    float_complex* V;                     /**< Eigen vectors; FLAT: nMics x nMics */
-    float_complex* Vn;                    /**< Noise subspace; FLAT: nMics x (nMics-1) */
-    float* lambda;                        /**< Eigenvalues; nMics x 1 */
+    void* hCovTrk;                        /**< Time-averaged covariance matrix per band (upper triangles only) */
+    float_complex* T_Cx_TH;               /**< Whitened covariance matrices; FLAT: nBands x nMics x nMics */
+    float_complex* V;                     /**< Eigen vectors; FLAT: nBands x nMics x nMics */
+    float_complex* Vn;                    /**< Noise subspace per thread; FLAT: nThreads x nMics x (nMics-1) */
+    float* lambda;                        /**< Eigenvalues; FLAT: nBands x nMics */
 
 }hades_analysis_data;
 
+/** Spatial parameters used to compute a cached mixing matrix (one per band) */
+typedef struct _hades_synthesis_cache{
+    int valid;         /**< 1: cached mixing matrix may be reused, 0: must be recomputed */
+    int nHeld;         /**< Number of consecutive frames the cached mixing matrix has been reused */
+    int doa_idx;       /**< DoA index */
+    int gain_idx;      /**< Reproduction direction index */
+    float diffuseness; /**< Diffuseness */
+    float a, b, eq;    /**< Direct/diffuse stream gains and EQ */
+}hades_synthesis_cache;
+
 /** Main structure for hades synthesis */
 typedef struct _hades_synthesis_data
 {
@@ -121,6 +145,9 @@ typedef struct _hades_synthesis_data
     float* eq;                       /**< Gain factor per band; nBands x 1 */
     float* streamBalance;            /**< Stream balance per band (0:fully diffuse, 1:balanced, 2:fully direct); nBands x 1 */
     float synAvgCoeff;               /**< Mixing matrix averaging coefficent [0..1] */
+    int enableChangeDetect;          /**< Flag: 1: reuse the mixing matrices of bands whose parameters have not changed, 0: recompute all bands */
+    float doaThresh_cos;             /**< Cosine of the DoA change threshold */
+    float diffThresh;                /**< Diffuseness change threshold */
 
     /* Things relevant to the synthesiser, which are copied from the hades_analysis_create() to keep everything aligned */
     HADES_FILTERBANKS fbOpt;         /**< Filterbank option, see #HADES_FILTERBANKS */
@@ -148,16 +175,24 @@ typedef struct _hades_synthesis_data
     /* Run-time variables */
     void* hPinv;                     /**< Handle for computing the Moore-Penrose pseudo inverse */
     void* hLinSolve;                 /**< Handle for solving linear equations (Ax=b) */
-    void* hCDF;                      /**< Handle for solving the covariance matching problem */
+    void* hPool;                     /**< Worker thread pool of the analysis object (a reference is held; NULL if single-threaded) */
+    void* hCDF;                      /**< Handle for solving the covariance matching problems (all bands at once) */
     float_complex* As;               /**< Array steering vector for DoA; FLAT: nMics x 1 */
     float_complex* As_l;             /**< Array steering vector relative to left reference sensor; FLAT: nMics x 1 */
     float_complex* As_r;             /**< Array steering vector relative to right reference sensor; FLAT: nMics x 1 */
     float_complex* Q_diff;           /**< Mixing matrix for the diffuse stream; FLAT: #NUM_EARS x nMics */
     float_complex* Q_dir;            /**< Mixing matrix for the direct stream; FLAT: #NUM_EARS x nMics */
     float_complex* Q;                /**< Mixing matrix for the direct and diffuse streams combined (based on the diffuseness value); FLAT: #NUM_EARS x nMics */
-    float_complex* Cy;               /**< Target binaural spatial covariance matrix; FLAT: #NUM_EARS x #NUM_EARS */
-    float_complex* new_M;            /**< New mixing matrix (not yet temporally averaged); FLAT: #NUM_EARS x nMics */
+    float_complex* Cx_cm;            /**< Input covariance matrices of the bands requiring covariance matching; FLAT: nBands x nMics x nMics */
+    float_complex* Cy;               /**< Target binaural spatial covariance matrices of these bands; FLAT: nBands x #NUM_EARS x #NUM_EARS */
+    float_complex* Q_cm;             /**< Prototype mixing matrices of these bands; FLAT: nBands x #NUM_EARS x nMics */
+    float_complex* M_cm;             /**< Solutions for these bands; FLAT: nBands x #NUM_EARS x nMics */
+    int* cmBands;                    /**< Indices of these bands; nBands x 1 */
+    int* recomputed;                 /**< Flag per band: 1: mixing matrix was recomputed this frame, 0: cached matrix was reused; nBands x 1 */
+    float_complex* new_M;            /**< New mixing matrices (not yet temporally averaged); FLAT: nBands x #NUM_EARS x nMics */
     float_complex** M;               /**< Mixing matrix per band; nBands x FLAT: (#NUM_EARS x nMics) */
+    float_complex** M_cached;        /**< Last computed (non-averaged) mixing matrix per band; nBands x FLAT: (#NUM_EARS x nMics) */
+    hades_synthesis_cache* cache;    /**< Parameters used to compute M_cached; nBands x 1 */
 
     /* Run-time audio buffers */
     float_complex*** outTF;          /**< nBands x #NUM_EARS x timeSlots */
@@ -236,11 +271,15 @@ void hades_getInterpolatedHRTFs(/* Input Arguments */
  * @param[in] nMics         Number of microphones in the array
  * @param[in] grid_dirs_deg Scanning grid directions; FLAT: nDirs x 2
  * @param[in] nDirs         Number of scanning directions
+ * @param[in] nCoarseDirs   Number of coarse directions to use for the
+ *                          coarse-to-fine peak search (see saf_gridSearch),
+ *                          or 0 to always search exhaustively
  */
 void hades_sdMUSIC_create(void ** const phMUSIC,
                           int nMics,
                           float* grid_dirs_deg,
-                          int nDirs);
+                          int nDirs,
+                          int nCoarseDirs);
 
 /**
  * Destroys an instance of the spherical harmonic domain MUSIC implementation,
@@ -255,6 +294,11 @@ void hades_sdMUSIC_destroy(void ** const phMUSIC);
  * Computes a pseudo-spectrum based on the MUSIC algorithm optionally returning
  * the grid indices corresponding to the N highest peaks (N=nSrcs)
  *
+ * @note If P_music is NULL and the handle was created with nCoarseDirs>0,
+ *       then the peaks are found coarse-to-fine, and the pseudo-spectrum is
+ *       only evaluated for a fraction of the scanning directions. In this
+ *       case, the peaks are the nSrcs highest local maxima of the
+ *       pseudo-spectrum, rather than being found via iterative masking.
  * @warning The number of sources should not exceed: floor(nMics/2)!
  *
  * @param[in] hMUSIC    sdMUSIC handle
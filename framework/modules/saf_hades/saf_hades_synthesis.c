@@ -137,6 +137,9 @@ void hades_synthesis_create
         s->streamBalance[band] = 1.0f; /* 50/50 direct/ambient balance (i.e., no biasing) */
     }
     s->synAvgCoeff = 1.0f - 1.0f/(4096.0f/a->blocksize); /* How much averaging of current mixing matrices with the previous mixing matrices */
+    s->enableChangeDetect = 0; /* Recompute all mixing matrices every frame */
+    s->doaThresh_cos = cosf(5.0f*SAF_PI/180.0f);
+    s->diffThresh = 0.05f;
 
     /* Things relevant to the synthesiser, which are copied from the analyser to keep things aligned */
     s->fbOpt = a->fbOpt;
@@ -212,16 +215,25 @@ void hades_synthesis_create
     /* Run-time variables */
     utility_cpinv_create(&(s->hPinv), s->nMics, s->nMics);
     utility_cglslv_create(&(s->hLinSolve), s->nMics, s->nMics);
-    cdf4sap_cmplx_create(&(s->hCDF), s->nMics, NUM_EARS);
+    s->hPool = a->hPool; /* (shared with the analysis; a reference is held, so either may be destroyed first) */
+    saf_threadPool_retain(s->hPool);
+    cdf4sap_cmplx_batch_create(&(s->hCDF), s->nMics, NUM_EARS, s->nBands, s->hPool);
     s->As   = malloc1d(s->nMics*sizeof(float_complex));
     s->As_l = malloc1d(s->nMics*sizeof(float_complex));
     s->As_r = malloc1d(s->nMics*sizeof(float_complex));
     s->Q_diff = malloc1d(NUM_EARS*(s->nMics)*sizeof(float_complex));
     s->Q_dir  = malloc1d(NUM_EARS*(s->nMics)*sizeof(float_complex));
     s->Q      = malloc1d(NUM_EARS*(s->nMics)*sizeof(float_complex));
-    s->Cy = malloc1d(NUM_EARS*NUM_EARS*sizeof(float_complex));
-    s->new_M = malloc1d(NUM_EARS*(s->nMics)*sizeof(float_complex));
+    s->Cx_cm = malloc1d(s->nBands*(s->nMics)*(s->nMics)*sizeof(float_complex));
+    s->Cy = malloc1d(s->nBands*NUM_EARS*NUM_EARS*sizeof(float_complex));
+    s->Q_cm = malloc1d(s->nBands*NUM_EARS*(s->nMics)*sizeof(float_complex));
+    s->M_cm = malloc1d(s->nBands*NUM_EARS*(s->nMics)*sizeof(float_complex));
+    s->cmBands = malloc1d(s->nBands*sizeof(int));
+    s->recomputed = malloc1d(s->nBands*sizeof(int));
+    s->new_M = malloc1d(s->nBands*NUM_EARS*(s->nMics)*sizeof(float_complex));
     s->M  = (float_complex**)malloc2d(s->nBands, NUM_EARS*(s->nMics), sizeof(float_complex));
+    s->M_cached = (float_complex**)malloc2d(s->nBands, NUM_EARS*(s->nMics), sizeof(float_complex));
+    s->cache = malloc1d(s->nBands*sizeof(hades_synthesis_cache));
 
     /* Run-time audio buffers */
     s->outTF = (float_complex***)malloc3d(s->nBands, NUM_EARS, s->timeSlots, sizeof(float_complex));
@@ -266,16 +278,24 @@ void hades_synthesis_destroy
         /* Run-time variables */
         utility_cpinv_destroy(&(s->hPinv));
         utility_cglslv_destroy(&(s->hLinSolve));
-        cdf4sap_cmplx_destroy(&(s->hCDF));
+        cdf4sap_cmplx_batch_destroy(&(s->hCDF));
+        saf_threadPool_destroy(&(s->hPool));
         free(s->As);
         free(s->As_l);
         free(s->As_r);
         free(s->Q_diff);
         free(s->Q_dir);
         free(s->Q);
+        free(s->Cx_cm);
         free(s->Cy);
+        free(s->Q_cm);
+        free(s->M_cm);
+        free(s->cmBands);
+        free(s->recomputed);
         free(s->new_M);
         free(s->M);
+        free(s->M_cached);
+        free(s->cache);
 
         /* Run-time audio buffers */
         free(s->outTF);
@@ -303,6 +323,7 @@ void hades_synthesis_reset
         case HADES_USE_AFSTFT:    afSTFT_clearBuffers(s->hFB_dec); break;
     }
     memset(FLATTEN2D(s->M), 0, s->nBands*NUM_EARS*(s->nMics)*sizeof(float_complex));
+    memset(s->cache, 0, s->nBands*sizeof(hades_synthesis_cache)); /* (invalidates all cached mixing matrices) */
 }
 
 void hades_synthesis_apply
@@ -318,17 +339,22 @@ void hades_synthesis_apply
     hades_synthesis_data *s = (hades_synthesis_data*)(hSyn);
     hades_param_container_data *pcon = (hades_param_container_data*)(hPCon);
     hades_signal_container_data *scon = (hades_signal_container_data*)(hSCon);
-    int i, j, ch, nMics, band, doa_idx, gain_idx;
+    int i, j, ch, nMics, band, doa_idx, gain_idx, recompute, nCM;
     float a, b, diffuseness, synAvgCoeff, streamBalance, eq, gain_dir, gain_diff, trace_M, reg_M, sum_As, targetEnergy;
     float_complex g_l, g_r, h_dir[NUM_EARS], AsH_invCx_As;
     float_complex Cx[HADES_MAX_NMICS*HADES_MAX_NMICS], conj_As[HADES_MAX_NMICS], AsH_invCx[HADES_MAX_NMICS*HADES_MAX_NMICS];
+    float_complex* new_M, *Cy;
+    hades_synthesis_cache* cache;
     const float_complex calpha = cmplxf(1.0f, 0.0f); const float_complex cbeta = cmplxf(0.0f, 0.0f); /* blas */
 
     nMics = s->nMics;
     synAvgCoeff = SAF_CLAMP((s->synAvgCoeff), 0.0f, 0.99f);
 
-    /* Loop over bands and compute the mixing matrices */
+    /* Loop over bands and compute the mixing matrices (or gather the covariance matching problems to solve) */
+    nCM = 0;
     for (band = 0; band < s->nBands; band++) {
+        new_M = &(s->new_M[band*NUM_EARS*nMics]);
+
         /* Pull estimated (and possibly modified) spatial parameters for this band */
         diffuseness = pcon->diffuseness[band];
         saf_assert(diffuseness>-0.0001f && diffuseness < 1.00001f, "Erroneous parameter analysis");
@@ -351,6 +377,26 @@ void hades_synthesis_apply
         a *= gain_dir;
         b *= gain_diff;
 
+        /* Check whether the parameters of this band have moved since its mixing matrix was last computed */
+        cache = &(s->cache[band]);
+        recompute = 1;
+        if(s->enableChangeDetect && cache->valid && cache->nHeld<HADES_SYNTHESIS_MAX_HOLD_FRAMES){
+            recompute = 0;
+            if(cblas_sdot(3, s->grid_dirs_xyz[doa_idx], 1, s->grid_dirs_xyz[cache->doa_idx], 1) < s->doaThresh_cos ||
+               cblas_sdot(3, s->grid_dirs_xyz[gain_idx], 1, s->grid_dirs_xyz[cache->gain_idx], 1) < s->doaThresh_cos ||
+               fabsf(diffuseness - cache->diffuseness) > s->diffThresh ||
+               a != cache->a || b != cache->b || eq != cache->eq)
+                recompute = 1;
+        }
+
+        /* Reuse the cached mixing matrix (which already includes the equalisation; the temporal averaging is applied below, in either case) */
+        s->recomputed[band] = recompute;
+        if(!recompute){
+            cblas_ccopy(NUM_EARS*nMics, s->M_cached[band], 1, new_M, 1);
+            cache->nHeld++;
+            continue;
+        }
+
         /* Source array steering vector for the estimated DoAs */
         for(i=0; i<nMics; i++)
             s->As[i] = s->H_array[band*nMics*(s->nGrid) + i*(s->nGrid) + doa_idx];
@@ -452,27 +498,56 @@ void hades_synthesis_apply
         /* Final mixing matrix */
         if(s->enableCM && targetEnergy>0.0001f){
             /* "Direct" contributions to the target spatial covariance matrix */
+            Cy = &(s->Cy[nCM*NUM_EARS*NUM_EARS]);
             cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, NUM_EARS, NUM_EARS, 1, &calpha,
                         h_dir, 1,
                         h_dir, 1, &cbeta,
-                        s->Cy, NUM_EARS);
-            cblas_sscal(/*re+im*/2*NUM_EARS*NUM_EARS, eq*a*(1.0f-diffuseness)*targetEnergy, (float*)s->Cy, 1);
+                        Cy, NUM_EARS);
+            cblas_sscal(/*re+im*/2*NUM_EARS*NUM_EARS, eq*a*(1.0f-diffuseness)*targetEnergy, (float*)Cy, 1);
 
             /* "Diffuse" contributions to the target spatial covariance matrix */
-            cblas_saxpy(/*re+im*/2*NUM_EARS*NUM_EARS, eq*b*diffuseness*targetEnergy, (float*)&(s->DCM_bin_norm[band*NUM_EARS*NUM_EARS]), 1, (float*)s->Cy, 1);
+            cblas_saxpy(/*re+im*/2*NUM_EARS*NUM_EARS, eq*b*diffuseness*targetEnergy, (float*)&(s->DCM_bin_norm[band*NUM_EARS*NUM_EARS]), 1, (float*)Cy, 1);
 
-            /* Solve the covariance matching problem */
-            formulate_M_and_Cr_cmplx(s->hCDF, (float_complex*)scon->Cx[band].Cx, s->Cy, s->Q, 1, 0.1f, s->new_M, NULL);
+            /* The covariance matching problem is solved below, along with those of the other bands */
+            cblas_ccopy(nMics*nMics, (float_complex*)scon->Cx[band].Cx, 1, &(s->Cx_cm[nCM*nMics*nMics]), 1);
+            cblas_ccopy(NUM_EARS*nMics, s->Q, 1, &(s->Q_cm[nCM*NUM_EARS*nMics]), 1);
+            s->cmBands[nCM++] = band;
         }
         else
-            cblas_ccopy(NUM_EARS*nMics, s->Q, 1, s->new_M, 1);
+            cblas_ccopy(NUM_EARS*nMics, s->Q, 1, new_M, 1);
+
+        /* Parameters used to compute the mixing matrix (which is cached below) */
+        if(s->enableChangeDetect){
+            cache->valid = 1;
+            cache->nHeld = 0;
+            cache->doa_idx = doa_idx;
+            cache->gain_idx = gain_idx;
+            cache->diffuseness = diffuseness;
+            cache->a = a;
+            cache->b = b;
+            cache->eq = eq;
+        }
+    }
+
+    /* Solve the covariance matching problems, for all of the bands that require it at once */
+    formulate_M_and_Cr_cmplx_batch(s->hCDF, s->Cx_cm, s->Cy, s->Q_cm, nCM, 1, 0.1f, 0, s->M_cm, NULL);
+    for(i=0; i<nCM; i++)
+        cblas_ccopy(NUM_EARS*nMics, &(s->M_cm[i*NUM_EARS*nMics]), 1, &(s->new_M[(s->cmBands[i])*NUM_EARS*nMics]), 1);
 
-        /* Optional Equalisation */
-        cblas_sscal(/*re+im*/2*NUM_EARS*nMics, eq, (float*)s->new_M, 1);
+    for (band = 0; band < s->nBands; band++) {
+        new_M = &(s->new_M[band*NUM_EARS*nMics]);
+        if(s->recomputed[band]){
+            /* Optional Equalisation */
+            cblas_sscal(/*re+im*/2*NUM_EARS*nMics, s->eq[band], (float*)new_M, 1);
+
+            /* Cache the mixing matrix */
+            if(s->enableChangeDetect)
+                cblas_ccopy(NUM_EARS*nMics, new_M, 1, s->M_cached[band], 1);
+        }
 
         /* Temporal averaging of mixing matrices */
         cblas_sscal(/*re+im*/2*NUM_EARS*nMics, synAvgCoeff, (float*)s->M[band], 1);
-        cblas_saxpy(/*re+im*/2*NUM_EARS*nMics, 1.0f-synAvgCoeff, (float*)s->new_M, 1, (float*)s->M[band], 1);
+        cblas_saxpy(/*re+im*/2*NUM_EARS*nMics, 1.0f-synAvgCoeff, (float*)new_M, 1, (float*)s->M[band], 1);
     }
 
     /* Apply mixing matrices */
@@ -496,6 +571,25 @@ void hades_synthesis_apply
         memset(output[ch], 0, blocksize*sizeof(float));
 }
 
+void hades_synthesis_setChangeDetection
+(
+    hades_synthesis_handle const hSyn,
+    int enable,
+    float doaThresh_deg,
+    float diffThresh
+)
+{
+    hades_synthesis_data *s;
+    if(hSyn==NULL)
+        return;
+    s = (hades_synthesis_data*)(hSyn);
+    s->doaThresh_cos = cosf(SAF_CLAMP(doaThresh_deg, 0.0f, 180.0f)*SAF_PI/180.0f);
+    s->diffThresh = SAF_MAX(diffThresh, 0.0f);
+    if(s->enableChangeDetect != enable)
+        memset(s->cache, 0, s->nBands*sizeof(hades_synthesis_cache)); /* (invalidates all cached mixing matrices) */
+    s->enableChangeDetect = enable;
+}
+
 float* hades_synthesis_getEqPtr
 (
     hades_synthesis_handle const hSyn,
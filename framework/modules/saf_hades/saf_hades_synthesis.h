@@ -131,6 +131,11 @@ void hades_radial_editor_apply(/* Input Arguments */
  * @param[in] enableCM     0: disabled, 1: enable covariance matching
  * @param[in] binConfig    Binaural configuration
  * @param[in] interpOption see #HADES_HRTF_INTERP_OPTIONS
+ *
+ * @note The synthesis carries out its per-band work using the thread pool of
+ *       hAna (holding its own reference to it, so hAna may be destroyed
+ *       first). Therefore, hades_analysis_apply() and hades_synthesis_apply()
+ *       must not be called at the same time from different threads.
  */
 void hades_synthesis_create(/* Input Arguments */
                             hades_synthesis_handle* const phSyn,
@@ -181,6 +186,29 @@ void hades_synthesis_apply(/* Input Arguments */
                            /* Output Arguments */
                            float** output);
 
+/**
+ * Enables/disables the reuse of the mixing matrices of bands whose spatial
+ * parameters have not changed (disabled by default)
+ *
+ * When enabled, the mixing matrix for a band is only recomputed if its DoA or
+ * reproduction direction has moved by more than doaThresh_deg, its diffuseness
+ * has changed by more than diffThresh, or its gains/eq have changed, since the
+ * last time it was computed. The matrices are also refreshed every
+ * #HADES_SYNTHESIS_MAX_HOLD_FRAMES frames, since the beamformers and the
+ * covariance matching solution also depend on the input signal statistics.
+ * The temporal averaging of the mixing matrices is applied in either case.
+ *
+ * @param[in] hSyn          hades synthesis handle
+ * @param[in] enable        0: disabled (recompute every band, every frame),
+ *                          1: enabled
+ * @param[in] doaThresh_deg DoA change threshold, in degrees
+ * @param[in] diffThresh    Diffuseness change threshold [0..1]
+ */
+void hades_synthesis_setChangeDetection(hades_synthesis_handle const hSyn,
+                                        int enable,
+                                        float doaThresh_deg,
+                                        float diffThresh);
+
 /**
  * Returns a pointer to the eq vector, which can be changed at run-time
  *
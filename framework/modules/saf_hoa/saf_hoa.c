@@ -115,6 +115,104 @@ void convertHOANormConvention
     }
 }
 
+void getHOAConventionTransform
+(
+    int order,
+    HOA_CH_ORDER inChOrder,
+    HOA_NORM inNorm,
+    HOA_CH_ORDER outChOrder,
+    HOA_NORM outNorm,
+    int* perm,
+    float* gains
+)
+{
+    int n, ch, nSH;
+
+    nSH = ORDER2NSH(order);
+    for(ch=0; ch<nSH; ch++){
+        perm[ch] = ch;
+        gains[ch] = 1.0f;
+    }
+    if(order==0)
+        return; /* Nothing to do */
+
+    /* Channel ordering (same as convertHOAChannelConvention()) */
+    if(inChOrder != outChOrder){
+        if(inChOrder==HOA_CH_ORDER_FUMA && outChOrder==HOA_CH_ORDER_ACN){
+            perm[1] = 2; perm[2] = 3; perm[3] = 1; /* W X Y Z -> W Y Z X */
+        }
+        else if(inChOrder==HOA_CH_ORDER_ACN && outChOrder==HOA_CH_ORDER_FUMA){
+            perm[1] = 3; perm[2] = 1; perm[3] = 2; /* W Y Z X -> W X Y Z */
+        }
+        for(ch=4; ch<nSH; ch++)
+            perm[ch] = -1;
+    }
+
+    /* Normalisation (same as convertHOANormConvention()), applied after the reordering */
+    if(inNorm==HOA_NORM_N3D){
+        if(outNorm == HOA_NORM_SN3D){
+            for (n = 0; n<order+1; n++)
+                for (ch = ORDER2NSH(n-1); ch < ORDER2NSH(n); ch++)
+                    gains[ch] = 1.0f/sqrtf(2.0f*(float)n+1.0f);
+        }
+        else if(outNorm==HOA_NORM_FUMA){
+            gains[0] = 1.0f/sqrtf(2.0f);
+            for (ch = 1; ch<4 /* 1st order only */; ch++)
+                gains[ch] = 1.0f/sqrtf(3.0f);
+        }
+    }
+    else if(inNorm==HOA_NORM_SN3D){
+        if(outNorm == HOA_NORM_N3D){
+            for (n = 0; n<order+1; n++)
+                for (ch = ORDER2NSH(n-1); ch<ORDER2NSH(n); ch++)
+                    gains[ch] = sqrtf(2.0f*(float)n+1.0f);
+        }
+        else if(outNorm==HOA_NORM_FUMA)
+            gains[0] = 1.0f/sqrtf(2.0f);
+    }
+    else if(inNorm==HOA_NORM_FUMA){
+        if(outNorm == HOA_NORM_N3D){
+            gains[0] = sqrtf(2.0f);
+            for (ch = 1; ch<4 /* 1st order only */; ch++)
+                gains[ch] = sqrtf(3.0f);
+        }
+        else if(outNorm == HOA_NORM_SN3D)
+            gains[0] = sqrtf(2.0f);
+    }
+}
+
+void applyHOAConventionTransform
+(
+    const float* const* insig,
+    int nInputs,
+    const int* perm,
+    const float* gains,
+    int nChannels,
+    int signalLength,
+    float** outsig
+)
+{
+    int i, ch;
+    float g;
+    const float* in;
+    float* out;
+
+    for(ch=0; ch<nChannels; ch++){
+        if(perm[ch]<0 || perm[ch]>=nInputs || insig[perm[ch]]==NULL)
+            memset(outsig[ch], 0, signalLength * sizeof(float));
+        else if(gains[ch]==1.0f)
+            cblas_scopy(signalLength, insig[perm[ch]], 1, outsig[ch], 1);
+        else{
+            /* Reorder and scale in the same pass */
+            g = gains[ch];
+            in = insig[perm[ch]];
+            out = outsig[ch];
+            for(i=0; i<signalLength; i++)
+                out[i] = g * in[i];
+        }
+    }
+}
+
 void getRSH
 (
     int N,
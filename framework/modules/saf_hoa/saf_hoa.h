@@ -266,6 +266,68 @@ void convertHOANormConvention(/* Input Arguments */
                               HOA_NORM inConvention,
                               HOA_NORM outConvention);
 
+/**
+ * Returns a channel permutation and per-channel gains, which convert an
+ * Ambisonic signal from one channel ordering and normalisation convention to
+ * another
+ *
+ * The transform is: out[ch] = gains[ch] * in[perm[ch]], where perm[ch]==-1
+ * denotes an output channel which is set to zeros. This gives the same result
+ * as calling convertHOAChannelConvention() followed by
+ * convertHOANormConvention(), except that the conversion may be applied in a
+ * single pass over the signals (see applyHOAConventionTransform()), or folded
+ * into a decoding/encoding matrix. It does not allocate any memory, so it may
+ * be called from a real-time processing loop.
+ *
+ * @warning The same FuMa restrictions apply as for
+ *          convertHOAChannelConvention() and convertHOANormConvention()
+ * @test test__getHOAConventionTransform()
+ *
+ * @param[in]  order      Ambisonic order
+ * @param[in]  inChOrder  Channel order convention of input signals
+ * @param[in]  inNorm     Normalisation convention of the input signals
+ * @param[in]  outChOrder Channel order convention of output signals
+ * @param[in]  outNorm    Normalisation convention of the output signals
+ * @param[out] perm       Input channel index for each output channel (-1 for
+ *                        zeros); (order+1)^2 x 1
+ * @param[out] gains      Gain for each output channel; (order+1)^2 x 1
+ */
+void getHOAConventionTransform(/* Input Arguments */
+                               int order,
+                               HOA_CH_ORDER inChOrder,
+                               HOA_NORM inNorm,
+                               HOA_CH_ORDER outChOrder,
+                               HOA_NORM outNorm,
+                               /* Output Arguments */
+                               int* perm,
+                               float* gains);
+
+/**
+ * Applies a convention transform, computed with getHOAConventionTransform(),
+ * while copying an Ambisonic signal from one buffer to another
+ *
+ * @note Input channels beyond nInputs (or which are NULL) are taken to be
+ *       zeros. insig and outsig must not overlap.
+ *
+ * @param[in]  insig        Input signals; nInputs x signalLength
+ * @param[in]  nInputs      Number of input signals
+ * @param[in]  perm         Input channel index for each output channel;
+ *                          nChannels x 1
+ * @param[in]  gains        Gain for each output channel; nChannels x 1
+ * @param[in]  nChannels    Number of output channels to write
+ * @param[in]  signalLength Signal length in samples
+ * @param[out] outsig       Output signals; nChannels x signalLength
+ */
+void applyHOAConventionTransform(/* Input Arguments */
+                                 const float* const* insig,
+                                 int nInputs,
+                                 const int* perm,
+                                 const float* gains,
+                                 int nChannels,
+                                 int signalLength,
+                                 /* Output Arguments */
+                                 float** outsig);
+
 /**
  * Computes real-valued spherical harmonics [1] for each given direction on the
  * unit sphere
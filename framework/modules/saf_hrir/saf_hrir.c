@@ -319,6 +319,81 @@ void interpHRTFs
     }
 }
 
+void reorderHRTFs2dirMajor
+(
+    float_complex* hrtfs,   /* N_bands x 2 x N_hrtf_dirs */
+    int N_hrtf_dirs,
+    int N_bands,
+    float_complex* hrtfs_dm /* N_hrtf_dirs x N_bands x 2 */
+)
+{
+    int i, band, ear;
+
+    for(band=0; band<N_bands; band++)
+        for(ear=0; ear<NUM_EARS; ear++)
+            for(i=0; i<N_hrtf_dirs; i++)
+                hrtfs_dm[(i*N_bands + band)*NUM_EARS + ear] = hrtfs[(band*NUM_EARS + ear)*N_hrtf_dirs + i];
+}
+
+void interpHRTFs_tri
+(
+    float_complex* hrtfs_dm, /* N_hrtf_dirs x N_bands x 2 */
+    float* itds,
+    float* freqVector,
+    int* interp_idx,         /* N_interp_dirs x 3 */
+    float* interp_weights,   /* N_interp_dirs x 3 */
+    int N_bands,
+    int N_interp_dirs,
+    float_complex* hrtfs_interp /* pre-alloc, N_bands x 2 x N_interp_dirs */
+)
+{
+    int i, j, band, ear;
+    float itd_interp, ipd_interp;
+    float w[3], mags_interp[NUM_EARS];
+    float_complex* h3[3];
+    float_complex h_interp;
+
+    for(j=0; j<N_interp_dirs; j++){
+        /* the three HRTFs are each one contiguous block of N_bands x 2 */
+        for(i=0; i<3; i++){
+            w[i] = interp_weights[j*3+i];
+            h3[i] = &hrtfs_dm[interp_idx[j*3+i]*N_bands*NUM_EARS];
+        }
+
+        if(itds==NULL || freqVector==NULL){
+            /* interpolate HRTF spectra */
+            for(band=0; band<N_bands; band++){
+                for(ear=0; ear<NUM_EARS; ear++){
+                    h_interp = cmplxf(0.0f, 0.0f);
+                    for(i=0; i<3; i++)
+                        h_interp = ccaddf(h_interp, crmulf(h3[i][band*NUM_EARS+ear], w[i]));
+                    hrtfs_interp[band*NUM_EARS*N_interp_dirs + ear*N_interp_dirs + j] = h_interp;
+                }
+            }
+        }
+        else{
+            /* interpolate ITDs */
+            itd_interp = 0.0f;
+            for(i=0; i<3; i++)
+                itd_interp += w[i] * itds[interp_idx[j*3+i]];
+
+            for(band=0; band<N_bands; band++){
+                /* interpolate HRTF magnitudes */
+                for(ear=0; ear<NUM_EARS; ear++){
+                    mags_interp[ear] = 0.0f;
+                    for(i=0; i<3; i++)
+                        mags_interp[ear] += w[i] * cabsf(h3[i][band*NUM_EARS+ear]);
+                }
+
+                /* reintroduce the interaural phase difference (IPD) */
+                ipd_interp = (matlab_fmodf(2.0f*SAF_PI*freqVector[band]*itd_interp + SAF_PI, 2.0f*SAF_PI) - SAF_PI)/2.0f;
+                hrtfs_interp[band*NUM_EARS*N_interp_dirs + 0*N_interp_dirs + j] = ccmulf( cmplxf(mags_interp[0],0.0f), cexpf(cmplxf(0.0f, ipd_interp)) );
+                hrtfs_interp[band*NUM_EARS*N_interp_dirs + 1*N_interp_dirs + j] = ccmulf( cmplxf(mags_interp[1],0.0f), cexpf(cmplxf(0.0f,-ipd_interp)) );
+            }
+        }
+    }
+}
+
 void binauralDiffuseCoherence
 (
     float_complex* hrtfs, /* N_bands x 2 x N_hrtf_dirs */
@@ -374,93 +449,48 @@ void resampleHRIRs
     int* hrirs_out_len
 )
 {
-    int ch, hrirs_out_ld;
-    float resample_factor;
-#if defined(SAF_USE_INTEL_IPP) && 0 /* works fine on macOS, but not on MSVC. Not tried Linux. Use SPEEX for now... */
-    Ipp64f pTime;
-    const int history = 128;
-    float *inBuffer, *outBuffer;
-    int filterLength, pSize, numFilters, outL;
-    IppStatus error;
-#else
-    unsigned int in_length, out_length;
-    int ERROR_VAL, out_latency, nsample_proc;
+    int ch, nCH, hrirs_out_ld, latency, nZeros, nsample_proc;
     float *zeros;
-    SpeexResamplerState *pRS;
-#endif
+    float **inPtrs, **outPtrs;
+    void* hRes;
 
     /* New HRIR length */
-    resample_factor = (float)hrirs_out_fs / (float)hrirs_in_fs;
-    (*hrirs_out_len) = (int)ceilf((float)hrirs_in_len * resample_factor);
+    nCH = hrirs_N_dirs*NUM_EARS;
+    (*hrirs_out_len) = (int)ceil((double)hrirs_in_len * (double)hrirs_out_fs / (double)hrirs_in_fs);
     hrirs_out_ld = padToNextPow2 ? (int)pow(2.0, ceil(log((double)(*hrirs_out_len))/log(2.0))) : (*hrirs_out_len);
 
-#if defined(SAF_USE_INTEL_IPP) && 0 /* works fine on macOS, but not on MSVC. Not tried Linux. Use SPEEX for now... */
-    /* Initialise IPP resampler */
-    error = ippsResamplePolyphaseFixedGetSize_32f(hrirs_in_fs, hrirs_out_fs, 2*(history-1), &pSize, &filterLength, &numFilters, ippAlgHintFast);
-    saf_assert(!error, "IPP error");
-    IppsResamplingPolyphaseFixed_32f* spec;
-    spec = (IppsResamplingPolyphaseFixed_32f*)ippsMalloc_8u(pSize);
-    error = ippsResamplePolyphaseFixedInit_32f(hrirs_in_fs, hrirs_out_fs, 2*(history-1), 0.98f, 12.0f, spec, ippAlgHintFast);
-    saf_assert(!error, "IPP error");
-    inBuffer = ippsMalloc_32f(hrirs_in_len + history * 2 + 2);
-    outBuffer = ippsMalloc_32f(hrirs_out_ld + 2);
-    ippsZero_32f(inBuffer, hrirs_in_len + history * 2 + 2);
-
-    /* Apply IPP resampler */
-    (*hrirs_out) = calloc1d(hrirs_N_dirs*NUM_EARS*(hrirs_out_ld), sizeof(float));
-    for(ch=0; ch<hrirs_N_dirs*NUM_EARS; ch++){
-        pTime = history;
-        outL =  0;
-
-        /* Apply resampling */
-        ippsCopy_32f(hrirs_in + ch * hrirs_in_len, inBuffer + history, hrirs_in_len);
-        saf_assert(!ippsResamplePolyphaseFixed_32f(inBuffer, hrirs_in_len, outBuffer, 1.0f, &pTime, &outL, spec), "IPP error");
-        saf_assert(hrirs_out_ld==outL, "Not all samples were processed!");
-        ippsCopy_32f(outBuffer, (*hrirs_out) + ch * (hrirs_out_ld), hrirs_out_ld);
-    }
+    /* Initialise the resampler (all HRIRs are processed together) */
+    saf_resampler_create(&hRes, nCH, hrirs_in_fs, hrirs_out_fs, hrirs_in_len);
+    latency = saf_resampler_getLatency(hRes);
+    zeros = calloc1d(hrirs_in_len, sizeof(float));
+    inPtrs = (float**)malloc1d(nCH*sizeof(float*));
+    outPtrs = (float**)malloc1d(nCH*sizeof(float*));
 
-    (*hrirs_out_len) = hrirs_out_ld;
+    /* Pass the FIRs through the resampler */
+    (*hrirs_out) = calloc1d(nCH*(hrirs_out_ld), sizeof(float));
+    for(ch=0; ch<nCH; ch++){
+        inPtrs[ch] = hrirs_in + ch * hrirs_in_len;
+        outPtrs[ch] = (*hrirs_out) + ch * (hrirs_out_ld);
+    }
+    nsample_proc = saf_resampler_apply(hRes, inPtrs, hrirs_in_len, outPtrs);
 
-    /* Clean-up */
-    ippsFree(spec);
-    ippsFree(inBuffer);
-    ippsFree(outBuffer);
-
-#else
-    /* Initialise SPEEX resampler */
-    pRS = speex__resampler_init(1 /*one channel at a time*/, hrirs_in_fs, hrirs_out_fs, SPEEX_RESAMPLER_QUALITY_MAX, &ERROR_VAL);
-    out_latency = speex__resampler_get_output_latency(pRS);
-    zeros = calloc1d(out_latency, sizeof(float));
-
-    /* Apply SPEEX resampler */
-    (*hrirs_out) = calloc1d(hrirs_N_dirs*NUM_EARS*(hrirs_out_ld), sizeof(float));
-    for(ch=0; ch<hrirs_N_dirs*NUM_EARS; ch++){
-        speex__resampler_reset_mem(pRS);
-        speex__resampler_skip_zeros(pRS);
-        nsample_proc = 0;
-
-        /* Pass the FIR through the resampler */
-        in_length = hrirs_in_len;
-        out_length = hrirs_out_ld;
-        ERROR_VAL = speex__resampler_process_float((pRS), 0, hrirs_in + ch * hrirs_in_len, &in_length,
-                                                   (*hrirs_out) + ch * (hrirs_out_ld), &out_length);
-        nsample_proc += out_length; /* Current number of output samples processed */
-
-        /* Pass through zeros to get the tail of the filter too */
-        while(nsample_proc<(hrirs_out_ld)){
-            in_length = out_latency;
-            out_length = (hrirs_out_ld)-nsample_proc;
-            ERROR_VAL = speex__resampler_process_float((pRS), 0, zeros, &in_length,
-                                                       (*hrirs_out) + ch * (hrirs_out_ld) + nsample_proc, &out_length);
-            nsample_proc += out_length;
+    /* Pass through zeros to get the tail of the filters too */
+    while(latency>0){
+        nZeros = SAF_MIN(latency, hrirs_in_len);
+        for(ch=0; ch<nCH; ch++){
+            inPtrs[ch] = zeros;
+            outPtrs[ch] = (*hrirs_out) + ch * (hrirs_out_ld) + nsample_proc;
         }
-        saf_assert(nsample_proc==(hrirs_out_ld), "Not all samples were processed!");
+        nsample_proc += saf_resampler_apply(hRes, inPtrs, nZeros, outPtrs);
+        latency -= nZeros;
     }
+    saf_assert(nsample_proc==(*hrirs_out_len), "Not all samples were processed!");
 
     (*hrirs_out_len) = hrirs_out_ld;
 
     /* Clean-up */
-    speex__resampler_destroy(pRS);
+    saf_resampler_destroy(&hRes);
     free(zeros);
-#endif
+    free(inPtrs);
+    free(outPtrs);
 }
@@ -235,6 +235,70 @@ void interpHRTFs(/* Input Arguments */
                  /* Output Arguments */
                  float_complex* hrtf_interp);
 
+/**
+ * Reorders a set of HRTFs from band-major to direction-major layout
+ *
+ * Interpolators which only require a few HRTFs at a time (e.g. the three
+ * directions of a triangle) may then read one contiguous block per direction,
+ * rather than one N_hrtf_dirs-strided element for every band and ear.
+ *
+ * @param[in]  hrtfs       HRTFs as filterbank coeffs;
+ *                         FLAT: N_bands x #NUM_EARS x N_hrtf_dirs
+ * @param[in]  N_hrtf_dirs Number of HRTF directions
+ * @param[in]  N_bands     Number of frequency bands
+ * @param[out] hrtfs_dm    HRTFs in direction-major layout;
+ *                         FLAT: N_hrtf_dirs x N_bands x #NUM_EARS
+ */
+void reorderHRTFs2dirMajor(/* Input Arguments */
+                           float_complex* hrtfs,
+                           int N_hrtf_dirs,
+                           int N_bands,
+                           /* Output Arguments */
+                           float_complex* hrtfs_dm);
+
+/**
+ * Interpolates a set of direction-major HRTFs using (up to) three HRTFs per
+ * interpolated direction
+ *
+ * This gives the same result as interpHRTFs(), when each row of its
+ * 'interp_table' has at most three non-zero weights. However, only the three
+ * HRTFs involved are read for each interpolated direction. The indices and
+ * weights may be obtained from a VBAP gain table using
+ * compressVBAPgainTable3D().
+ *
+ * @warning This function is NOT suitable for binaural room impulse responses
+ *          (BRIRs)!
+ *
+ * @test test__interpHRTFs_tri()
+ *
+ * @param[in]  hrtfs_dm       HRTFs in direction-major layout (see
+ *                            reorderHRTFs2dirMajor());
+ *                            FLAT: N_hrtf_dirs x N_bands x #NUM_EARS
+ * @param[in]  itds           The inter-aural time difference (ITD) for each
+ *                            HRIR (set to NULL if you do not want phase
+ *                            simplication to be applied); N_hrtf_dirs x 1
+ * @param[in]  freqVector     Frequency vector (set to NULL if you do not want
+ *                            phase simplication to be applied); N_bands x 1
+ * @param[in]  interp_idx     Indices of the HRTFs to interpolate between;
+ *                            FLAT: N_interp_dirs x 3
+ * @param[in]  interp_weights Amplitude-normalised interpolation weights;
+ *                            FLAT: N_interp_dirs x 3
+ * @param[in]  N_bands        Number of frequency bands
+ * @param[in]  N_interp_dirs  Number of interpolated hrtf positions
+ * @param[out] hrtf_interp    interpolated HRTFs;
+ *                            FLAT: N_bands x #NUM_EARS x N_interp_dirs
+ */
+void interpHRTFs_tri(/* Input Arguments */
+                     float_complex* hrtfs_dm,
+                     float* itds,
+                     float* freqVector,
+                     int* interp_idx,
+                     float* interp_weights,
+                     int N_bands,
+                     int N_interp_dirs,
+                     /* Output Arguments */
+                     float_complex* hrtf_interp);
+
 /**
  * Computes the binaural diffuse coherence per frequency for a given HRTF set,
  * as described in [1]
@@ -263,8 +327,9 @@ void binauralDiffuseCoherence(/* Input Arguments */
 /**
  * Resamples a set of HRIRs from its original samplerate to a new samplerate
  *
- * @note The included speex_resampler.h is used by default. If SAF_USE_INTEL_IPP
- *       is defined, then the IPP resampler is employed instead.
+ * @note The in-tree polyphase resampler (see saf_resampler_create()) is
+ *       employed, which designs its filter only once and then processes all of
+ *       the HRIRs together.
  *
  * @param[in]  hrirs_in      Input HRIRs;
  *                           FLAT: hrirs_N_dirs x #NUM_EARS x hrirs_in_len
@@ -41,13 +41,16 @@ void ims_shoebox_create
     float lowestOctaveBand,
     int nOctBands,
     float c_ms,
-    float fs
+    float fs,
+    void* hArena
 )
 {
-    *phIms = malloc1d(sizeof(ims_scene_data));
+    *phIms = ims_shoebox_malloc1d(hArena, sizeof(ims_scene_data));
     ims_scene_data *sc = (ims_scene_data*)(*phIms);
     int i,j,band,wall;
 
+    sc->hArena = hArena;
+
     /* Shoebox dimensions */
     sc->room_dims[0] = roomDimensions[0];
     sc->room_dims[1] = roomDimensions[1];
@@ -57,11 +60,11 @@ void ims_shoebox_create
     /* Octave band centre frequencies */
     if(nOctBands>1){
         sc->nBands = nOctBands;
-        sc->band_centerfreqs = malloc1d(nOctBands*sizeof(float));
+        sc->band_centerfreqs = ims_shoebox_malloc1d(sc->hArena, nOctBands*sizeof(float));
         sc->band_centerfreqs[0] = lowestOctaveBand;
         for(band=1; band<nOctBands; band++)
             sc->band_centerfreqs[band] = sc->band_centerfreqs[band-1]*2.0f;
-        sc->band_cutofffreqs = malloc1d((sc->nBands-1)*sizeof(float));
+        sc->band_cutofffreqs = ims_shoebox_malloc1d(sc->hArena, (sc->nBands-1)*sizeof(float));
         getOctaveBandCutoffFreqs(sc->band_centerfreqs, sc->nBands, sc->band_cutofffreqs);
     }
     else { /* Broad-band operation */
@@ -74,7 +77,7 @@ void ims_shoebox_create
     sc->fs = fs;
 
     /* Absorption coeffients per wall and octave band */
-    sc->abs_wall = (float**)malloc2d(sc->nBands, IMS_NUM_WALLS_SHOEBOX, sizeof(float));
+    sc->abs_wall = (float**)ims_shoebox_malloc2d(sc->hArena, sc->nBands, IMS_NUM_WALLS_SHOEBOX, sizeof(float));
     for(band=0; band<sc->nBands; band++)
         for(wall=0; wall<IMS_NUM_WALLS_SHOEBOX; wall++)
             sc->abs_wall[band][wall] = abs_wall[band*IMS_NUM_WALLS_SHOEBOX+wall];
@@ -88,7 +91,7 @@ void ims_shoebox_create
     sc->nReceivers = 0;
 
     /* ims_core_workspace per source / receiver combination */
-    sc->hCoreWrkSpc = (voidPtr**)malloc2d(IMS_MAX_NUM_RECEIVERS, IMS_MAX_NUM_SOURCES, sizeof(voidPtr));
+    sc->hCoreWrkSpc = (voidPtr**)ims_shoebox_malloc2d(sc->hArena, IMS_MAX_NUM_RECEIVERS, IMS_MAX_NUM_SOURCES, sizeof(voidPtr));
     for(i=0; i<IMS_MAX_NUM_RECEIVERS; i++)
         for(j=0; j<IMS_MAX_NUM_SOURCES; j++)
             sc->hCoreWrkSpc[i][j] = NULL;
@@ -97,7 +100,7 @@ void ims_shoebox_create
     sc->H_filt = NULL;
 
     /* RIRs per source / receiver combination  */
-    sc->rirs = (ims_rir**)malloc2d(IMS_MAX_NUM_RECEIVERS, IMS_MAX_NUM_SOURCES, sizeof(ims_rir));
+    sc->rirs = (ims_rir**)ims_shoebox_malloc2d(sc->hArena, IMS_MAX_NUM_RECEIVERS, IMS_MAX_NUM_SOURCES, sizeof(ims_rir));
     for(i=0; i<IMS_MAX_NUM_RECEIVERS; i++){
         for(j=0; j<IMS_MAX_NUM_SOURCES; j++){
             sc->rirs[i][j].data = NULL;
@@ -111,24 +114,24 @@ void ims_shoebox_create
     sc->circ_buffer[1] = NULL;
 
     /* IIR Filterbank per source (only used/allocated when applyEchogramTD() function is called for the first time) */
-    sc->hFaFbank = malloc1d(IMS_MAX_NUM_SOURCES*sizeof(voidPtr));
-    sc->src_sigs_bands = malloc1d(IMS_MAX_NUM_SOURCES*sizeof(float**));
+    sc->hFaFbank = ims_shoebox_malloc1d(sc->hArena, IMS_MAX_NUM_SOURCES*sizeof(voidPtr));
+    sc->src_sigs_bands = ims_shoebox_malloc1d(sc->hArena, IMS_MAX_NUM_SOURCES*sizeof(float**));
     for(j=0; j<IMS_MAX_NUM_SOURCES; j++){
         sc->hFaFbank[j] = NULL;
         sc->src_sigs_bands[j] = NULL;
     }
 
     /* Temp buffers for cross-fading (only used/allocated when applyEchogramTD() function is called for the first time) */
-    sc->rec_sig_tmp[IMS_EG_CURRENT] = malloc1d(IMS_MAX_NUM_RECEIVERS*sizeof(float**));
-    sc->rec_sig_tmp[IMS_EG_PREV] = malloc1d(IMS_MAX_NUM_RECEIVERS*sizeof(float**));
+    sc->rec_sig_tmp[IMS_EG_CURRENT] = ims_shoebox_malloc1d(sc->hArena, IMS_MAX_NUM_RECEIVERS*sizeof(float**));
+    sc->rec_sig_tmp[IMS_EG_PREV] = ims_shoebox_malloc1d(sc->hArena, IMS_MAX_NUM_RECEIVERS*sizeof(float**));
     for(j=0; j<IMS_MAX_NUM_RECEIVERS; j++){
         sc->rec_sig_tmp[IMS_EG_CURRENT][j] = NULL;
         sc->rec_sig_tmp[IMS_EG_PREV][j] = NULL;
     }
     memset(sc->applyCrossFadeFLAG, 0, IMS_MAX_NUM_RECEIVERS*IMS_MAX_NUM_SOURCES*sizeof(int));
-    sc->interpolator_fIn = NULL;
-    sc->interpolator_fOut = NULL;
-    sc->tmp_frame = NULL;
+    sc->interpolator_fIn = ims_shoebox_malloc1d(sc->hArena, IMS_MAX_NSAMPLES_PER_FRAME*sizeof(float));
+    sc->interpolator_fOut = ims_shoebox_malloc1d(sc->hArena, IMS_MAX_NSAMPLES_PER_FRAME*sizeof(float));
+    sc->tmp_frame = ims_shoebox_malloc1d(sc->hArena, IMS_MAX_NSAMPLES_PER_FRAME*sizeof(float));
     sc->framesize = -1;
 
     /* Lagrange interpolator look-up table */
@@ -137,6 +140,42 @@ void ims_shoebox_create
     lagrangeWeights(IMS_LAGRANGE_ORDER, sc->lookup_fractions, IMS_LAGRANGE_LOOKUP_TABLE_SIZE, (float*)sc->lookup_H_frac);
 }
 
+size_t ims_shoebox_getRequiredArenaSize
+(
+    int nOctBands,
+    int maxNumSources,
+    int maxNumReceivers,
+    int maxNumReceiverChannels
+)
+{
+    size_t nBytes;
+    int nBands;
+
+    saf_assert(maxNumSources<=IMS_MAX_NUM_SOURCES && maxNumReceivers<=IMS_MAX_NUM_RECEIVERS, "Exceeded the maximum number of sources/receivers");
+    nBands = nOctBands>1 ? nOctBands : 1;
+
+    /* Allocated by ims_shoebox_create() */
+    nBytes = md_arena_size1d(sizeof(ims_scene_data));
+    if(nOctBands>1)
+        nBytes += md_arena_size1d(nOctBands*sizeof(float)) + md_arena_size1d((nOctBands-1)*sizeof(float));
+    nBytes += md_arena_size2d(nBands, IMS_NUM_WALLS_SHOEBOX, sizeof(float));
+    nBytes += md_arena_size2d(IMS_MAX_NUM_RECEIVERS, IMS_MAX_NUM_SOURCES, sizeof(voidPtr));
+    nBytes += md_arena_size2d(IMS_MAX_NUM_RECEIVERS, IMS_MAX_NUM_SOURCES, sizeof(ims_rir));
+    nBytes += md_arena_size1d(IMS_MAX_NUM_SOURCES*sizeof(voidPtr)) + md_arena_size1d(IMS_MAX_NUM_SOURCES*sizeof(float**));
+    nBytes += 2*md_arena_size1d(IMS_MAX_NUM_RECEIVERS*sizeof(float**));
+    nBytes += 3*md_arena_size1d(IMS_MAX_NSAMPLES_PER_FRAME*sizeof(float));
+
+    /* Allocated by ims_shoebox_renderRIRs() */
+    nBytes += md_arena_size2d(nBands, IMS_FIR_FILTERBANK_ORDER+1, sizeof(float));
+
+    /* Allocated by ims_shoebox_applyEchogramTD() */
+    nBytes += 2*md_arena_size3d(IMS_MAX_NUM_SOURCES, nBands, IMS_CIRC_BUFFER_LENGTH, sizeof(float));
+    nBytes += (size_t)maxNumSources*md_arena_size2d(nBands, IMS_MAX_NSAMPLES_PER_FRAME, sizeof(float));
+    nBytes += (size_t)maxNumReceivers*2*md_arena_size2d(maxNumReceiverChannels, IMS_MAX_NSAMPLES_PER_FRAME, sizeof(float));
+
+    return nBytes;
+}
+
 void ims_shoebox_destroy
 (
     void** phIms
@@ -146,36 +185,36 @@ void ims_shoebox_destroy
     int i,j;
 
     if(sc!=NULL){
-        free(sc->band_centerfreqs);
-        free(sc->band_cutofffreqs);
-        free(sc->abs_wall);
+        free_arena(sc->hArena, sc->band_centerfreqs);
+        free_arena(sc->hArena, sc->band_cutofffreqs);
+        free_arena(sc->hArena, sc->abs_wall);
         for(i=0; i<IMS_MAX_NUM_RECEIVERS; i++)
             for(j=0; j<IMS_MAX_NUM_SOURCES; j++)
                 ims_shoebox_coreWorkspaceDestroy(&(sc->hCoreWrkSpc[i][j]));
-        free(sc->hCoreWrkSpc);
-        free(sc->H_filt);
+        free_arena(sc->hArena, sc->hCoreWrkSpc);
+        free_arena(sc->hArena, sc->H_filt);
         for(i=0; i<IMS_MAX_NUM_RECEIVERS; i++)
             for(j=0; j<IMS_MAX_NUM_SOURCES; j++)
                 free(sc->rirs[i][j].data);
-        free(sc->rirs);
-        free(sc->circ_buffer[IMS_EG_CURRENT]);
-        free(sc->circ_buffer[IMS_EG_PREV]);
+        free_arena(sc->hArena, sc->rirs);
+        free_arena(sc->hArena, sc->circ_buffer[IMS_EG_CURRENT]);
+        free_arena(sc->hArena, sc->circ_buffer[IMS_EG_PREV]);
         for(j=0; j<IMS_MAX_NUM_SOURCES; j++){
             faf_IIRFilterbank_destroy(&(sc->hFaFbank[j]));
-            free(sc->src_sigs_bands[j]);
+            free_arena(sc->hArena, sc->src_sigs_bands[j]);
         }
-        free(sc->hFaFbank);
-        free(sc->src_sigs_bands);
+        free_arena(sc->hArena, sc->hFaFbank);
+        free_arena(sc->hArena, sc->src_sigs_bands);
         for(i=0; i<IMS_MAX_NUM_RECEIVERS; i++){
-            free(sc->rec_sig_tmp[IMS_EG_CURRENT][i]);
-            free(sc->rec_sig_tmp[IMS_EG_PREV][i]);
+            free_arena(sc->hArena, sc->rec_sig_tmp[IMS_EG_CURRENT][i]);
+            free_arena(sc->hArena, sc->rec_sig_tmp[IMS_EG_PREV][i]);
         }
-        free(sc->rec_sig_tmp[IMS_EG_CURRENT]);
-        free(sc->rec_sig_tmp[IMS_EG_PREV]);
-        free(sc->interpolator_fIn);
-        free(sc->interpolator_fOut);
-        free(sc->tmp_frame);
-        free(sc);
+        free_arena(sc->hArena, sc->rec_sig_tmp[IMS_EG_CURRENT]);
+        free_arena(sc->hArena, sc->rec_sig_tmp[IMS_EG_PREV]);
+        free_arena(sc->hArena, sc->interpolator_fIn);
+        free_arena(sc->hArena, sc->interpolator_fOut);
+        free_arena(sc->hArena, sc->tmp_frame);
+        free_arena(sc->hArena, sc);
         sc=NULL;
         *phIms = NULL;
     }
@@ -269,7 +308,7 @@ void ims_shoebox_renderRIRs
     /* Compute FIR Filterbank coefficients (if this is the first time this
      * function is being called) */
     if(sc->H_filt==NULL){
-        sc->H_filt = (float**)realloc2d((void**)sc->H_filt, sc->nBands, (IMS_FIR_FILTERBANK_ORDER+1), sizeof(float));
+        sc->H_filt = (float**)ims_shoebox_malloc2d(sc->hArena, sc->nBands, (IMS_FIR_FILTERBANK_ORDER+1), sizeof(float));
         FIRFilterbank(IMS_FIR_FILTERBANK_ORDER, sc->band_cutofffreqs, sc->nBands-1,
                       sc->fs, WINDOWING_FUNCTION_HAMMING, 1, FLATTEN2D(sc->H_filt));
     }
@@ -313,9 +352,9 @@ void ims_shoebox_applyEchogramTD
 
     /* Allocate circular buffers (if this is the first time this function is being called) */
     if(sc->circ_buffer[0] == NULL)
-        sc->circ_buffer[0] = (float***)calloc3d(IMS_MAX_NUM_SOURCES, sc->nBands, IMS_CIRC_BUFFER_LENGTH, sizeof(float));
+        sc->circ_buffer[0] = (float***)ims_shoebox_calloc3d(sc->hArena, IMS_MAX_NUM_SOURCES, sc->nBands, IMS_CIRC_BUFFER_LENGTH, sizeof(float));
     if(sc->circ_buffer[1] == NULL)
-        sc->circ_buffer[1] = (float***)calloc3d(IMS_MAX_NUM_SOURCES, sc->nBands, IMS_CIRC_BUFFER_LENGTH, sizeof(float));
+        sc->circ_buffer[1] = (float***)ims_shoebox_calloc3d(sc->hArena, IMS_MAX_NUM_SOURCES, sc->nBands, IMS_CIRC_BUFFER_LENGTH, sizeof(float));
 
     /* Also allocate signal buffers and filterbank handles (if this is the first time this function is being called) */
     for(src_idx = 0; src_idx < IMS_MAX_NUM_SOURCES; src_idx++){
@@ -325,7 +364,7 @@ void ims_shoebox_applyEchogramTD
                 faf_IIRFilterbank_create(&(sc->hFaFbank[src_idx]), IMS_IIR_FILTERBANK_ORDER, sc->band_cutofffreqs,
                                          sc->nBands-1, sc->fs, IMS_MAX_NSAMPLES_PER_FRAME);
             }
-            sc->src_sigs_bands[src_idx] = (float**)malloc2d(sc->nBands, IMS_MAX_NSAMPLES_PER_FRAME, sizeof(float)); 
+            sc->src_sigs_bands[src_idx] = (float**)ims_shoebox_malloc2d(sc->hArena, sc->nBands, IMS_MAX_NSAMPLES_PER_FRAME, sizeof(float));
         }
     }
 
@@ -341,14 +380,11 @@ void ims_shoebox_applyEchogramTD
 
     /* Allocate temporary buffer (if this is the first time this function is being called)  */
     if( (sc->recs[rec_idx].ID != IMS_UNASSIGNED) && (sc->rec_sig_tmp[IMS_EG_CURRENT][rec_idx] == NULL) ){
-        sc->rec_sig_tmp[IMS_EG_CURRENT][rec_idx] = (float**)malloc2d(sc->recs[rec_idx].nChannels, IMS_MAX_NSAMPLES_PER_FRAME, sizeof(float));
-        sc->rec_sig_tmp[IMS_EG_PREV][rec_idx] = (float**)malloc2d(sc->recs[rec_idx].nChannels, IMS_MAX_NSAMPLES_PER_FRAME, sizeof(float));
+        sc->rec_sig_tmp[IMS_EG_CURRENT][rec_idx] = (float**)ims_shoebox_malloc2d(sc->hArena, sc->recs[rec_idx].nChannels, IMS_MAX_NSAMPLES_PER_FRAME, sizeof(float));
+        sc->rec_sig_tmp[IMS_EG_PREV][rec_idx] = (float**)ims_shoebox_malloc2d(sc->hArena, sc->recs[rec_idx].nChannels, IMS_MAX_NSAMPLES_PER_FRAME, sizeof(float));
     }
-    if(sc->framesize!=nSamples){
+    if(sc->framesize!=nSamples){ /* (the buffers are already allocated for up to IMS_MAX_NSAMPLES_PER_FRAME) */
         sc->framesize = nSamples;
-        sc->interpolator_fIn = realloc1d(sc->interpolator_fIn, nSamples*sizeof(float));
-        sc->interpolator_fOut = realloc1d(sc->interpolator_fOut, nSamples*sizeof(float));
-        sc->tmp_frame = realloc1d(sc->tmp_frame, nSamples*sizeof(float));
         for(i=0; i<nSamples; i++){
             sc->interpolator_fIn[i] = (i+1)*1.0f/(float)nSamples;
             sc->interpolator_fOut[i] = 1.0f-sc->interpolator_fIn[i];
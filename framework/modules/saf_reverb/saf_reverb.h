@@ -30,6 +30,8 @@
 #ifndef __SAF_REVERB_H_INCLUDED__
 #define __SAF_REVERB_H_INCLUDED__
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -101,6 +103,13 @@ typedef struct _ims_rir{
  *                             "lowestOctaveBand")
  * @param[in] c_ms             Speed of sound, meters per second
  * @param[in] fs               SampleRate, Hz
+ * @param[in] hArena           Memory arena (see md_arena_create()), from which
+ *                             the buffers of the room simulator are allocated,
+ *                             including those allocated upon the first call to
+ *                             ims_shoebox_applyEchogramTD(); set to NULL to
+ *                             use the heap instead. If the arena is too small
+ *                             (see ims_shoebox_getRequiredArenaSize()), then
+ *                             the remaining buffers are taken from the heap
  */
 void ims_shoebox_create(void** phIms,
                         float roomDimensions[3],
@@ -108,7 +117,8 @@ void ims_shoebox_create(void** phIms,
                         float lowestOctaveBand,
                         int nOctBands,
                         float c_ms,
-                        float fs);
+                        float fs,
+                        void* hArena);
 
 /**
  * Destroys an instance of ims_shoebox room simulator
@@ -117,6 +127,27 @@ void ims_shoebox_create(void** phIms,
  */
 void ims_shoebox_destroy(void** phIms);
 
+/**
+ * Returns the arena capacity, in bytes, required for all of the allocations
+ * of an ims_shoebox object to be taken from its arena (see
+ * ims_shoebox_create())
+ *
+ * Note that the circular buffers of ims_shoebox_applyEchogramTD() are always
+ * allocated for #IMS_MAX_NUM_SOURCES, and therefore dominate this size when
+ * the time-domain rendering is used.
+ *
+ * @param[in] nOctBands              Number of octave bands (as passed to
+ *                                   ims_shoebox_create())
+ * @param[in] maxNumSources          Largest number of sources added at once
+ * @param[in] maxNumReceivers        Largest number of receivers added at once
+ * @param[in] maxNumReceiverChannels Largest number of channels of a receiver
+ * @returns Required arena capacity, in bytes
+ */
+size_t ims_shoebox_getRequiredArenaSize(int nOctBands,
+                                        int maxNumSources,
+                                        int maxNumReceivers,
+                                        int maxNumReceiverChannels);
+
 /**
  * Computes echograms for all active source/receiver combinations
  *
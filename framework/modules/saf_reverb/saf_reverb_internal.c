@@ -708,3 +708,47 @@ void ims_shoebox_renderRIR
 
     free(temp);
 }
+
+void* ims_shoebox_malloc1d
+(
+    void* hArena,
+    size_t dim1_data_size
+)
+{
+    void* ptr;
+    ptr = malloc1d_arena(hArena, dim1_data_size);
+    if(ptr==NULL && hArena!=NULL)
+        ptr = malloc1d(dim1_data_size);
+    return ptr;
+}
+
+void** ims_shoebox_malloc2d
+(
+    void* hArena,
+    size_t dim1,
+    size_t dim2,
+    size_t data_size
+)
+{
+    void** ptr;
+    ptr = malloc2d_arena(hArena, dim1, dim2, data_size);
+    if(ptr==NULL && hArena!=NULL)
+        ptr = malloc2d(dim1, dim2, data_size);
+    return ptr;
+}
+
+void*** ims_shoebox_calloc3d
+(
+    void* hArena,
+    size_t dim1,
+    size_t dim2,
+    size_t dim3,
+    size_t data_size
+)
+{
+    void*** ptr;
+    ptr = calloc3d_arena(hArena, dim1, dim2, dim3, data_size);
+    if(ptr==NULL && hArena!=NULL)
+        ptr = calloc3d(dim1, dim2, dim3, data_size);
+    return ptr;
+}
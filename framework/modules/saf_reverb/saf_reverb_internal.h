@@ -205,6 +205,7 @@ typedef struct _ims_scene_data
     float fs;                 /**< Sampling rate */
     int nBands;               /**< Number of frequency bands */
     float** abs_wall;         /**< Wall aborption coeffs per wall; nBands x 6 */
+    void* hArena;             /**< Memory arena for the buffers of this object (NULL: heap) */
 
     /* Source and receiver positions */
     ims_src_obj srcs[IMS_MAX_NUM_SOURCES];   /**< Source positions */
@@ -233,9 +234,9 @@ typedef struct _ims_scene_data
     /* Temporary receiver frame used for cross-fading (only used/allocated when
      * applyEchogramTD() function is called for the first time) */
     float*** rec_sig_tmp[IMS_EG_NUM_SLOTS]; /**< [IMS_EG_NUM_SLOTS] x (nReceivers x nChannels x nSamples) */
-    float* interpolator_fIn;  /**< framesize x 1 */
-    float* interpolator_fOut; /**< framesize x 1 */
-    float* tmp_frame;         /**< framesize x 1 */
+    float* interpolator_fIn;  /**< #IMS_MAX_NSAMPLES_PER_FRAME x 1 */
+    float* interpolator_fOut; /**< #IMS_MAX_NSAMPLES_PER_FRAME x 1 */
+    float* tmp_frame;         /**< #IMS_MAX_NSAMPLES_PER_FRAME x 1 */
     int applyCrossFadeFLAG[IMS_MAX_NUM_RECEIVERS][IMS_MAX_NUM_SOURCES];
     int framesize;            /**< Curent framesize in samples */
 
@@ -409,6 +410,30 @@ void ims_shoebox_renderRIR(void* hWork,
                            float** H_filt,
                            ims_rir* rir);
 
+/**
+ * Allocates from the arena (see malloc1d_arena()), but falls back to the heap
+ * if the arena does not have enough space remaining (in which case the memory
+ * is still deallocated via free_arena())
+ *
+ * @note ims_shoebox_getRequiredArenaSize() returns the arena size for which
+ *       this fall-back is never needed.
+ */
+void* ims_shoebox_malloc1d(void* hArena,
+                           size_t dim1_data_size);
+
+/** 2-D version of ims_shoebox_malloc1d(); same layout as malloc2d() */
+void** ims_shoebox_malloc2d(void* hArena,
+                            size_t dim1,
+                            size_t dim2,
+                            size_t data_size);
+
+/** 3-D calloc version of ims_shoebox_malloc1d(); same layout as calloc3d() */
+void*** ims_shoebox_calloc3d(void* hArena,
+                             size_t dim1,
+                             size_t dim2,
+                             size_t dim3,
+                             size_t data_size);
+
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -187,6 +187,426 @@ void unnorm_legendreP_recur
 /*                    SH and Beamforming related Functions                    */
 /* ========================================================================== */
 
+/**
+ * Computes the coefficients of the recursion for the orthonormalised
+ * associated Legendre functions, Q_n^m (i.e. including the 1/sqrt(4pi) and
+ * (n-m)!/(n+m)! terms, but not the Condon-Shortley phase), up to order N:
+ *     Q_m^m     = d_m * sin(incl) * Q_{m-1}^{m-1}
+ *     Q_{m+1}^m = e_m * cos(incl) * Q_m^m
+ *     Q_n^m     = a_nm * (cos(incl) * Q_{n-1}^m - b_nm * Q_{n-2}^m)
+ * This avoids the factorials and pow(-1,m) terms, which also allows the
+ * recursion to remain numerically stable for high orders.
+ * The coefficients are written in double (a, b, d, e) and/or single (a_f,
+ * b_f, d_f, e_f) precision; set either set to NULL if not wanted.
+ */
+static void shEval_getCoeffs
+(
+    int N,
+    double* a,
+    double* b,
+    double* d,
+    double* e,
+    float* a_f,
+    float* b_f,
+    float* d_f,
+    float* e_f
+)
+{
+    int n, m, idx;
+    double nn, mm, dm, em, anm, bnm;
+
+    for(m=0; m<=N; m++){
+        mm = (double)m;
+        dm = m==0 ? 1.0/sqrt(4.0*SAF_PId) : sqrt((2.0*mm+1.0)/(2.0*mm));
+        em = sqrt(2.0*mm+3.0);
+        if(d!=NULL){
+            d[m] = dm;
+            e[m] = em;
+        }
+        if(d_f!=NULL){
+            d_f[m] = (float)dm;
+            e_f[m] = (float)em;
+        }
+        for(n=m; n<=N; n++){
+            nn = (double)n;
+            idx = SAF_SH_EVAL_TRI_IDX(n,m);
+            if(n<m+2)
+                anm = bnm = 0.0;
+            else{
+                anm = sqrt((4.0*nn*nn-1.0)/(nn*nn-mm*mm));
+                bnm = sqrt(((nn-1.0)*(nn-1.0)-mm*mm)/(4.0*(nn-1.0)*(nn-1.0)-1.0));
+            }
+            if(a!=NULL){
+                a[idx] = anm;
+                b[idx] = bnm;
+            }
+            if(a_f!=NULL){
+                a_f[idx] = (float)anm;
+                b_f[idx] = (float)bnm;
+            }
+        }
+    }
+}
+
+/* The single precision coefficients for the lower orders are precomputed (i.e. the output of shEval_getCoeffs()),
+ * such that getSHreal_recur() does not have to compute them for every call */
+
+/** a_nm recursion coefficients up to order #SAF_SH_EVAL_TABLE_ORDER (single precision; see shEval_getCoeffs()) */
+static const float shEval_a_f[SAF_SH_EVAL_TRI_IDX(SAF_SH_EVAL_TABLE_ORDER+1,0)] = {
+    0.0f, 0.0f, 0.0f, 1.93649173f, 0.0f, 0.0f,
+    1.97202659f, 2.09165001f, 0.0f, 0.0f, 1.98431349f, 2.04939008f,
+    2.2912879f, 0.0f, 0.0f, 1.98997486f, 2.03100967f, 2.17124057f,
+    2.48746848f, 0.0f, 0.0f, 1.99304342f, 2.0213151f, 2.11394191f,
+    2.30136824f, 2.67394829f, 0.0f, 0.0f, 1.99489141f, 2.01556444f,
+    2.08166599f, 2.2079401f, 2.43086219f, 2.85043859f, 0.0f, 0.0f,
+    1.99608994f, 2.01186943f, 2.06155276f, 2.15322161f, 2.3048861f, 2.55704165f,
+    3.01780438f, 0.0f, 0.0f, 1.99691117f, 2.00935316f, 2.04812241f,
+    2.11804414f, 2.22917724f, 2.40163636f, 2.67913747f, 3.17706633f, 0.0f,
+    0.0f, 1.99749839f, 2.00756145f, 2.03868842f, 2.09394741f, 2.17944956f,
+    2.30651259f, 2.49687314f, 2.79705739f, 3.32916403f, 0.0f, 0.0f,
+    1.99793279f, 2.00624037f, 2.0317986f, 2.07665586f, 2.14476109f, 2.24304485f,
+    2.38376856f, 2.59004498f, 2.91095924f, 3.47491002f, 0.0f, 0.0f,
+    1.99826312f, 2.00523782f, 2.02660871f, 2.06379724f, 2.11947823f, 2.19816589f,
+    2.30739546f, 2.46020961f, 2.68095136f, 3.02108979f, 3.61499405f, 0.0f,
+    0.0f, 1.99852014f, 2.00445938f, 2.0225997f, 2.05395961f, 2.10042024f,
+    2.16506362f, 2.25281787f, 2.37170815f, 2.53546286f, 2.76955843f, 3.1277163f,
+    3.75f, 0.0f, 0.0f, 1.9987241f, 2.00384235f, 2.01943684f,
+    2.04625654f, 2.08566546f, 2.13984752f, 2.21218228f, 2.30792785f, 2.43553233f,
+    2.60934782f, 2.85591483f, 3.23109889f, 3.88042426f, 0.0f, 0.0f,
+    1.99888861f, 2.00334549f, 2.01689696f, 2.04010701f, 2.07399011f, 2.12014151f,
+    2.18096614f, 2.26007843f, 2.36301732f, 2.49861073f, 2.68179035f, 2.94010735f,
+    3.33148098f, 4.00669098f, 0.0f, 0.0f
+};
+
+/** b_nm recursion coefficients up to order #SAF_SH_EVAL_TABLE_ORDER */
+static const float shEval_b_f[SAF_SH_EVAL_TRI_IDX(SAF_SH_EVAL_TABLE_ORDER+1,0)] = {
+    0.0f, 0.0f, 0.0f, 0.577350259f, 0.0f, 0.0f,
+    0.516397774f, 0.44721359f, 0.0f, 0.0f, 0.507092535f, 0.478091449f,
+    0.377964467f, 0.0f, 0.0f, 0.503952622f, 0.487950027f, 0.436435789f,
+    0.333333343f, 0.0f, 0.0f, 0.502518892f, 0.492365956f, 0.460566193f,
+    0.40201512f, 0.301511347f, 0.0f, 0.0f, 0.501745224f, 0.494727433f,
+    0.473049909f, 0.434524089f, 0.373978794f, 0.277350098f, 0.0f, 0.0f,
+    0.501280427f, 0.49613893f, 0.480384469f, 0.452910811f, 0.411376685f, 0.350823194f,
+    0.258198887f, 0.0f, 0.0f, 0.500979424f, 0.497050136f, 0.485071242f,
+    0.464420378f, 0.433860928f, 0.391076952f, 0.331366748f, 0.242535621f, 0.0f,
+    0.0f, 0.50077337f, 0.497672588f, 0.488252074f, 0.472133696f, 0.44859603f,
+    0.41638276f, 0.373254448f, 0.314755797f, 0.22941573f, 0.0f, 0.0f,
+    0.500626147f, 0.498116761f, 0.490511477f, 0.477566928f, 0.458831459f, 0.433554977f,
+    0.400500953f, 0.357518613f, 0.3003757f, 0.218217894f, 0.0f, 0.0f,
+    0.500517309f, 0.498444796f, 0.492174804f, 0.481543422f, 0.466252416f, 0.445822567f,
+    0.419503808f, 0.386093676f, 0.343529373f, 0.287777245f, 0.208514407f, 0.0f,
+    0.0f, 0.500434577f, 0.498693943f, 0.493435174f, 0.484543711f, 0.471814245f,
+    0.454924732f, 0.433389068f, 0.406469434f, 0.373001933f, 0.331006378f, 0.276625633f,
+    0.200000003f, 0.0f, 0.0f, 0.500370204f, 0.498887658f, 0.494413227f,
+    0.486864507f, 0.476095229f, 0.461880207f, 0.443888545f, 0.421637028f, 0.394405305f,
+    0.361068368f, 0.319722116f, 0.266666681f, 0.192450091f, 0.0f, 0.0f,
+    0.500319183f, 0.499041229f, 0.495187581f, 0.48869729f, 0.479463309f, 0.467323005f,
+    0.452042341f, 0.433289111f, 0.410587847f, 0.383237541f, 0.350150496f, 0.30949223f,
+    0.257703781f, 0.185695335f, 0.0f, 0.0f
+};
+
+/** d_m recursion coefficients up to order #SAF_SH_EVAL_TABLE_ORDER */
+static const float shEval_d_f[SAF_SH_EVAL_TABLE_ORDER+1] = {
+    0.282094806f, 1.22474492f, 1.11803401f, 1.08012342f, 1.06066012f, 1.04880881f,
+    1.040833f, 1.03509831f, 1.03077638f, 1.02740228f, 1.02469504f, 1.02247477f,
+    1.0206207f, 1.01904929f, 1.01770043f, 1.01653004f
+};
+
+/** e_m recursion coefficients up to order #SAF_SH_EVAL_TABLE_ORDER */
+static const float shEval_e_f[SAF_SH_EVAL_TABLE_ORDER+1] = {
+    1.73205078f, 2.23606801f, 2.64575124f, 3.0f, 3.31662488f, 3.60555124f,
+    3.87298346f, 4.12310553f, 4.35889912f, 4.5825758f, 4.79583168f, 5.0f,
+    5.19615221f, 5.38516474f, 5.56776428f, 5.74456263f
+};
+
+
+/**
+ * Evaluates the real SH up to order N for a block of #SAF_SH_EVAL_LANES
+ * directions [azi, incl] (single precision). The recursion runs across all
+ * lanes at once, with fixed-length inner loops, such that it is vectorised.
+ * Y is written with the leading dimension ldY.
+ */
+static void shEval_block_f
+(
+    int N,
+    const float* a,
+    const float* b,
+    const float* d,
+    const float* e,
+    const float* dirs_rad,
+    float* Y,
+    int ldY
+)
+{
+    int n, m, l;
+    float x[SAF_SH_EVAL_LANES], s[SAF_SH_EVAL_LANES], c1[SAF_SH_EVAL_LANES], s1[SAF_SH_EVAL_LANES];
+    float cm[SAF_SH_EVAL_LANES], sm[SAF_SH_EVAL_LANES], tmp[SAF_SH_EVAL_LANES];
+    float Qmm[SAF_SH_EVAL_LANES], Q[SAF_SH_EVAL_LANES], Q1[SAF_SH_EVAL_LANES], Q2[SAF_SH_EVAL_LANES];
+    float anm, bnm;
+    const float sqrt2 = sqrtf(2.0f);
+
+    for(l=0; l<SAF_SH_EVAL_LANES; l++){
+        x[l] = cosf(dirs_rad[l*2+1]);
+        s[l] = fabsf(sinf(dirs_rad[l*2+1])); /* i.e. sqrt(1-x^2) */
+        c1[l] = cosf(dirs_rad[l*2]);
+        s1[l] = sinf(dirs_rad[l*2]);
+        cm[l] = 1.0f;
+        sm[l] = 0.0f;
+        Qmm[l] = d[0];
+    }
+    for(m=0; m<=N; m++){
+        if(m>0){
+            /* Q_m^m, and cos(m*azi), sin(m*azi) via the angle-sum identities */
+            for(l=0; l<SAF_SH_EVAL_LANES; l++){
+                Qmm[l] *= d[m]*s[l];
+                tmp[l] = cm[l]*c1[l] - sm[l]*s1[l];
+                sm[l] = sm[l]*c1[l] + cm[l]*s1[l];
+                cm[l] = tmp[l];
+            }
+        }
+        for(l=0; l<SAF_SH_EVAL_LANES; l++){
+            Q2[l] = 0.0f;
+            Q1[l] = Qmm[l];
+        }
+        for(n=m; n<=N; n++){
+            if(n==m)
+                memcpy(Q, Qmm, SAF_SH_EVAL_LANES*sizeof(float));
+            else if(n==m+1){
+                for(l=0; l<SAF_SH_EVAL_LANES; l++)
+                    Q[l] = e[m]*x[l]*Qmm[l];
+            }
+            else{
+                anm = a[SAF_SH_EVAL_TRI_IDX(n,m)];
+                bnm = b[SAF_SH_EVAL_TRI_IDX(n,m)];
+                for(l=0; l<SAF_SH_EVAL_LANES; l++)
+                    Q[l] = anm*(x[l]*Q1[l] - bnm*Q2[l]);
+            }
+            if(n>m){
+                memcpy(Q2, Q1, SAF_SH_EVAL_LANES*sizeof(float));
+                memcpy(Q1, Q, SAF_SH_EVAL_LANES*sizeof(float));
+            }
+
+            /* Output */
+            if(m==0){
+                for(l=0; l<SAF_SH_EVAL_LANES; l++)
+                    Y[(n*n+n)*ldY+l] = Q[l];
+            }
+            else{
+                for(l=0; l<SAF_SH_EVAL_LANES; l++){
+                    Y[(n*n+n-m)*ldY+l] = sqrt2*Q[l]*sm[l];
+                    Y[(n*n+n+m)*ldY+l] = sqrt2*Q[l]*cm[l];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Evaluates the real SH up to order N for a single direction [azi, incl]
+ * (single precision); i.e. the same recursion as shEval_block_f(), but
+ * without the overhead of the unused lanes. Y is written with the leading
+ * dimension ldY.
+ */
+static void shEval_dir_f
+(
+    int N,
+    const float* a,
+    const float* b,
+    const float* d,
+    const float* e,
+    const float* dir_rad,
+    float* Y,
+    int ldY
+)
+{
+    int n, m;
+    float x, s, c1, s1, cm, sm, tmp, Qmm, Q, Q1, Q2;
+    const float sqrt2 = sqrtf(2.0f);
+
+    x = cosf(dir_rad[1]);
+    s = fabsf(sinf(dir_rad[1])); /* i.e. sqrt(1-x^2) */
+    c1 = cosf(dir_rad[0]);
+    s1 = sinf(dir_rad[0]);
+    cm = 1.0f;
+    sm = 0.0f;
+    Qmm = d[0];
+    for(m=0; m<=N; m++){
+        if(m>0){
+            /* Q_m^m, and cos(m*azi), sin(m*azi) via the angle-sum identities */
+            Qmm *= d[m]*s;
+            tmp = cm*c1 - sm*s1;
+            sm = sm*c1 + cm*s1;
+            cm = tmp;
+        }
+        Q2 = 0.0f;
+        Q1 = Qmm;
+        for(n=m; n<=N; n++){
+            if(n==m)
+                Q = Qmm;
+            else if(n==m+1)
+                Q = e[m]*x*Qmm;
+            else
+                Q = a[SAF_SH_EVAL_TRI_IDX(n,m)]*(x*Q1 - b[SAF_SH_EVAL_TRI_IDX(n,m)]*Q2);
+            if(n>m){
+                Q2 = Q1;
+                Q1 = Q;
+            }
+
+            /* Output */
+            if(m==0)
+                Y[(n*n+n)*ldY] = Q;
+            else{
+                Y[(n*n+n-m)*ldY] = sqrt2*Q*sm;
+                Y[(n*n+n+m)*ldY] = sqrt2*Q*cm;
+            }
+        }
+    }
+}
+
+/**
+ * Evaluates the real SH up to order N for nDirs directions (single precision):
+ * in vectorised blocks of #SAF_SH_EVAL_LANES directions, with any remaining
+ * directions evaluated one at a time.
+ */
+static void shEval_f
+(
+    int N,
+    const float* a,
+    const float* b,
+    const float* d,
+    const float* e,
+    const float* dirs_rad,
+    int nDirs,
+    float* Y
+)
+{
+    int dir;
+
+    for(dir=0; dir+SAF_SH_EVAL_LANES<=nDirs; dir+=SAF_SH_EVAL_LANES)
+        shEval_block_f(N, a, b, d, e, &dirs_rad[dir*2], &Y[dir], nDirs);
+    for(; dir<nDirs; dir++)
+        shEval_dir_f(N, a, b, d, e, &dirs_rad[dir*2], &Y[dir], nDirs);
+}
+
+/**
+ * getSHreal_recur() for orders above #SAF_SH_EVAL_TABLE_ORDER, with the
+ * recursion coefficients computed on the stack (kept out of getSHreal_recur()
+ * itself, such that the lower orders do not need the stack space)
+ */
+static void shEval_f_stackCoeffs
+(
+    int N,
+    const float* dirs_rad,
+    int nDirs,
+    float* Y
+)
+{
+    float a[SAF_SH_EVAL_TRI_IDX(SAF_SH_EVAL_MAX_STACK_ORDER+1,0)], b[SAF_SH_EVAL_TRI_IDX(SAF_SH_EVAL_MAX_STACK_ORDER+1,0)];
+    float d[SAF_SH_EVAL_MAX_STACK_ORDER+1], e[SAF_SH_EVAL_MAX_STACK_ORDER+1];
+
+    saf_assert(N<=SAF_SH_EVAL_MAX_STACK_ORDER, "order exceeds the stack tables");
+    shEval_getCoeffs(N, NULL, NULL, NULL, NULL, a, b, d, e);
+    shEval_f(N, a, b, d, e, dirs_rad, nDirs, Y);
+}
+
+/**
+ * Double precision version of shEval_block_f(). The output is written to
+ * either Y_d or Y_f (whichever is not NULL).
+ */
+static void shEval_block_d
+(
+    int N,
+    const double* a,
+    const double* b,
+    const double* d,
+    const double* e,
+    const double* dirs_rad,
+    int nLanes,
+    double* Y_d,
+    float* Y_f,
+    int ldY
+)
+{
+    int n, m, l, idx;
+    double x[SAF_SH_EVAL_LANES], s[SAF_SH_EVAL_LANES], c1[SAF_SH_EVAL_LANES], s1[SAF_SH_EVAL_LANES];
+    double cm[SAF_SH_EVAL_LANES], sm[SAF_SH_EVAL_LANES], tmp[SAF_SH_EVAL_LANES];
+    double Qmm[SAF_SH_EVAL_LANES], Q[SAF_SH_EVAL_LANES], Q1[SAF_SH_EVAL_LANES], Q2[SAF_SH_EVAL_LANES];
+    double Yneg[SAF_SH_EVAL_LANES], Ypos[SAF_SH_EVAL_LANES];
+    double anm, bnm;
+    const double sqrt2 = sqrt(2.0);
+
+    /* Unused lanes repeat the last direction */
+    for(l=0; l<SAF_SH_EVAL_LANES; l++){
+        idx = SAF_MIN(l, nLanes-1);
+        x[l] = cos(dirs_rad[idx*2+1]);
+        s[l] = fabs(sin(dirs_rad[idx*2+1])); /* i.e. sqrt(1-x^2) */
+        c1[l] = cos(dirs_rad[idx*2]);
+        s1[l] = sin(dirs_rad[idx*2]);
+        cm[l] = 1.0;
+        sm[l] = 0.0;
+        Qmm[l] = d[0];
+    }
+    for(m=0; m<=N; m++){
+        if(m>0){
+            /* Q_m^m, and cos(m*azi), sin(m*azi) via the angle-sum identities */
+            for(l=0; l<SAF_SH_EVAL_LANES; l++){
+                Qmm[l] *= d[m]*s[l];
+                tmp[l] = cm[l]*c1[l] - sm[l]*s1[l];
+                sm[l] = sm[l]*c1[l] + cm[l]*s1[l];
+                cm[l] = tmp[l];
+            }
+        }
+        for(l=0; l<SAF_SH_EVAL_LANES; l++){
+            Q2[l] = 0.0;
+            Q1[l] = Qmm[l];
+        }
+        for(n=m; n<=N; n++){
+            if(n==m)
+                memcpy(Q, Qmm, SAF_SH_EVAL_LANES*sizeof(double));
+            else if(n==m+1){
+                for(l=0; l<SAF_SH_EVAL_LANES; l++)
+                    Q[l] = e[m]*x[l]*Qmm[l];
+            }
+            else{
+                anm = a[SAF_SH_EVAL_TRI_IDX(n,m)];
+                bnm = b[SAF_SH_EVAL_TRI_IDX(n,m)];
+                for(l=0; l<SAF_SH_EVAL_LANES; l++)
+                    Q[l] = anm*(x[l]*Q1[l] - bnm*Q2[l]);
+            }
+            if(n>m){
+                memcpy(Q2, Q1, SAF_SH_EVAL_LANES*sizeof(double));
+                memcpy(Q1, Q, SAF_SH_EVAL_LANES*sizeof(double));
+            }
+
+            /* Output */
+            if(m==0){
+                if(Y_d!=NULL)
+                    for(l=0; l<nLanes; l++)
+                        Y_d[(n*n+n)*ldY+l] = Q[l];
+                else
+                    for(l=0; l<nLanes; l++)
+                        Y_f[(n*n+n)*ldY+l] = (float)Q[l];
+            }
+            else{
+                for(l=0; l<SAF_SH_EVAL_LANES; l++){
+                    Yneg[l] = sqrt2*Q[l]*sm[l];
+                    Ypos[l] = sqrt2*Q[l]*cm[l];
+                }
+                if(Y_d!=NULL){
+                    memcpy(&Y_d[(n*n+n-m)*ldY], Yneg, nLanes*sizeof(double));
+                    memcpy(&Y_d[(n*n+n+m)*ldY], Ypos, nLanes*sizeof(double));
+                }
+                else{
+                    for(l=0; l<nLanes; l++){
+                        Y_f[(n*n+n-m)*ldY+l] = (float)Yneg[l];
+                        Y_f[(n*n+n+m)*ldY+l] = (float)Ypos[l];
+                    }
+                }
+            }
+        }
+    }
+}
+
 void getSHreal
 (
     int order,
@@ -195,61 +615,41 @@ void getSHreal
     float* Y  /* the SH weights: (order+1)^2 x nDirs */
 )
 {
-    int dir, j, n, m, idx_Y;
-    double* Lnm, *CosSin;
-    double *p_nm, *cos_incl;
-    double *norm_real;
+    int dir, i, nLanes;
+    double sa[SAF_SH_EVAL_TRI_IDX(SAF_SH_EVAL_MAX_STACK_ORDER+1,0)], sb[SAF_SH_EVAL_TRI_IDX(SAF_SH_EVAL_MAX_STACK_ORDER+1,0)];
+    double sd[SAF_SH_EVAL_MAX_STACK_ORDER+1], se[SAF_SH_EVAL_MAX_STACK_ORDER+1];
+    double dirs_rad_d[SAF_SH_EVAL_LANES*2];
+    double* a, *b, *d, *e;
 
     if(nDirs<1)
         return;
-    
-    Lnm = malloc1d((2*order+1)*nDirs*sizeof(double));
-    norm_real = malloc1d((2*order+1)*sizeof(double));
-    CosSin = malloc1d((2*order+1)*sizeof(double));
-    cos_incl = malloc1d(nDirs*sizeof(double));
-    p_nm = malloc1d((order+1)*nDirs * sizeof(double));
-    for (dir = 0; dir<nDirs; dir++)
-        cos_incl[dir] = cos((double)dirs_rad[dir*2+1]);
-    
-    idx_Y = 0;
-    for(n=0; n<=order; n++){
-        /* vector of unnormalised associated Legendre functions of current order */
-        unnorm_legendreP(n, cos_incl, nDirs, p_nm); /* includes Condon-Shortley phase term */
-        
-        for(dir=0; dir<nDirs; dir++){
-            /* cancel the Condon-Shortley phase from the definition of the Legendre functions to result in signless real SH */
-            if (n != 0)
-                for(m=-n, j=0; m<=n; m++, j++)
-                    Lnm[j*nDirs+dir] = pow(-1.0, (double)abs(m)) * p_nm[abs(m)*nDirs+dir];
-            else
-                Lnm[dir] = p_nm[dir];
-        }
-        
-        /* normalisation */
-        for(m=-n, j=0; m<=n; m++, j++)
-            norm_real[j] = sqrt( (2.0*(double)n+1.0) * (double)factorial(n-abs(m)) / (4.0*SAF_PId*(double)factorial(n+abs(m))) );
-        
-        /* norm_real * Lnm_real .* CosSin; */
-        for(dir=0; dir<nDirs; dir++){
-            for(m=-n, j=0; m<=n; m++, j++){
-                if(j<n)
-                    Y[(j+idx_Y)*nDirs+dir] = (float)(norm_real[j] * Lnm[j*nDirs+dir] * sqrt(2.0)*sin((double)(n-j)*(double)dirs_rad[dir*2]));
-                else if(j==n)
-                    Y[(j+idx_Y)*nDirs+dir] = (float)(norm_real[j] * Lnm[j*nDirs+dir]);
-                else /* (j>n) */
-                    Y[(j+idx_Y)*nDirs+dir] = (float)(norm_real[j] * Lnm[j*nDirs+dir] * sqrt(2.0)*cos((double)(abs(m))*(double)dirs_rad[dir*2]));
-            }
-        }
-        
-        /* increment */
-        idx_Y = idx_Y + (2*n+1);
+
+    /* recursion coefficients (only allocated for very high orders) */
+    if(order<=SAF_SH_EVAL_MAX_STACK_ORDER){
+        a = sa; b = sb; d = sd; e = se;
+    }
+    else{
+        a = malloc1d(SAF_SH_EVAL_TRI_IDX(order+1,0)*sizeof(double));
+        b = malloc1d(SAF_SH_EVAL_TRI_IDX(order+1,0)*sizeof(double));
+        d = malloc1d((order+1)*sizeof(double));
+        e = malloc1d((order+1)*sizeof(double));
+    }
+    shEval_getCoeffs(order, a, b, d, e, NULL, NULL, NULL, NULL);
+
+    /* evaluate in blocks of directions (in double precision) */
+    for(dir=0; dir<nDirs; dir+=SAF_SH_EVAL_LANES){
+        nLanes = SAF_MIN(SAF_SH_EVAL_LANES, nDirs-dir);
+        for(i=0; i<nLanes*2; i++)
+            dirs_rad_d[i] = (double)dirs_rad[dir*2+i];
+        shEval_block_d(order, a, b, d, e, dirs_rad_d, nLanes, NULL, &Y[dir], nDirs);
+    }
+
+    if(order>SAF_SH_EVAL_MAX_STACK_ORDER){
+        free(a);
+        free(b);
+        free(d);
+        free(e);
     }
-    
-    free(p_nm);
-    free(Lnm);
-    free(norm_real);
-    free(CosSin);
-    free(cos_incl);
 }
 
 void getSHreal_recur
@@ -260,73 +660,103 @@ void getSHreal_recur
     float* Y
 )
 {
-    int n, m, i, dir, index_n;
-    float Nn0, Nnm;
-    float sleg_n[8], sleg_n_1[8], sleg_n_2[8], scos_incl, sfactorials_n[15];
-    float* leg_n, *leg_n_1, *leg_n_2, *cos_incl, *factorials_n;
+    void* hSHE;
 
     if(nDirs<1)
         return;
 
-    if(N<=7 && nDirs == 1){
-        /* Single direction optimisation for up to 7th order */
-        leg_n = sleg_n;
-        leg_n_1 = sleg_n_1;
-        leg_n_2 = sleg_n_2;
-        cos_incl = &scos_incl;
-        factorials_n = sfactorials_n;
-    }
+    /* Precomputed recursion coefficients */
+    if(N<=SAF_SH_EVAL_TABLE_ORDER)
+        shEval_f(N, shEval_a_f, shEval_b_f, shEval_d_f, shEval_e_f, dirs_rad, nDirs, Y);
+    /* Recursion coefficients computed on the stack */
+    else if(N<=SAF_SH_EVAL_MAX_STACK_ORDER)
+        shEval_f_stackCoeffs(N, dirs_rad, nDirs, Y);
+    /* Very high orders; the recursion coefficients do not fit on the stack */
     else{
-        factorials_n = malloc1d((2*N+1)*sizeof(float));
-        leg_n = malloc1d((N+1)*nDirs * sizeof(float));
-        leg_n_1 = malloc1d((N+1)*nDirs * sizeof(float));
-        leg_n_2 = malloc1d((N+1)*nDirs * sizeof(float));
-        cos_incl = malloc1d(nDirs * sizeof(float));
+        shEvaluator_create(&hSHE, N);
+        shEvaluator_getSHreal(hSHE, N, dirs_rad, nDirs, Y);
+        shEvaluator_destroy(&hSHE);
     }
-    index_n = 0;
+}
 
-    /* precompute factorials */
-    for (i = 0; i < 2*N+1; i++)
-        factorials_n[i] = (float)factorial(i); 
+void shEvaluator_create
+(
+    void ** const phSHE,
+    int maxOrder
+)
+{
+    *phSHE = malloc1d(sizeof(shEvaluator_data));
+    shEvaluator_data *h = (shEvaluator_data*)(*phSHE);
+    int nTri;
+
+    h->maxOrder = maxOrder;
+    nTri = SAF_SH_EVAL_TRI_IDX(maxOrder+1,0);
+    h->a_d = malloc1d(nTri*sizeof(double));
+    h->b_d = malloc1d(nTri*sizeof(double));
+    h->d_d = malloc1d((maxOrder+1)*sizeof(double));
+    h->e_d = malloc1d((maxOrder+1)*sizeof(double));
+    h->a_f = malloc1d(nTri*sizeof(float));
+    h->b_f = malloc1d(nTri*sizeof(float));
+    h->d_f = malloc1d((maxOrder+1)*sizeof(float));
+    h->e_f = malloc1d((maxOrder+1)*sizeof(float));
+
+    /* The recursion coefficients do not depend on the maximum order, so these tables serve all orders up to it */
+    shEval_getCoeffs(maxOrder, h->a_d, h->b_d, h->d_d, h->e_d, h->a_f, h->b_f, h->d_f, h->e_f);
+}
 
-    /* cos(inclination) = sin(elevation) */
-    for (dir = 0; dir<nDirs; dir++)
-        cos_incl[dir] = cosf(dirs_rad[dir*2+1]);
-
-    /* compute SHs with the recursive Legendre function */
-    for (n = 0; n<N+1; n++) {
-        if (n==0) {
-            for (dir = 0; dir<nDirs; dir++)
-                Y[n*nDirs+dir] = 1.0f/SQRT4PI;
-            index_n = 1;
-        }
-        else {
-            unnorm_legendreP_recur(n, cos_incl, nDirs, leg_n_1, leg_n_2, leg_n); /* does NOT include Condon-Shortley phase term */
-
-            Nn0 = sqrtf(2.0f*(float)n+1.0f);
-            for (dir = 0; dir<nDirs; dir++){
-                for (m = 0; m<n+1; m++) {
-                    if (m==0)
-                        Y[(index_n+n)*nDirs+dir] = Nn0/SQRT4PI * leg_n[m*nDirs+dir];
-                    else {
-                        Nnm = Nn0* sqrtf( 2.0f * factorials_n[n-m]/factorials_n[n+m] );
-                        Y[(index_n+n-m)*nDirs+dir] = Nnm/SQRT4PI * leg_n[m*nDirs+dir] * sinf((float)m * (dirs_rad[dir*2]));
-                        Y[(index_n+n+m)*nDirs+dir] = Nnm/SQRT4PI * leg_n[m*nDirs+dir] * cosf((float)m * (dirs_rad[dir*2]));
-                    }
-                }
-            }
-            index_n += 2*n+1;
-        }
-        utility_svvcopy(leg_n_1, (N+1)*nDirs, leg_n_2);
-        utility_svvcopy(leg_n,   (N+1)*nDirs, leg_n_1);
+void shEvaluator_destroy
+(
+    void ** const phSHE
+)
+{
+    shEvaluator_data *h = (shEvaluator_data*)(*phSHE);
+
+    if (h != NULL) {
+        free(h->a_d);
+        free(h->b_d);
+        free(h->d_d);
+        free(h->e_d);
+        free(h->a_f);
+        free(h->b_f);
+        free(h->d_f);
+        free(h->e_f);
+        free(h);
+        h = NULL;
+        *phSHE = NULL;
     }
+}
+
+void shEvaluator_getSHreal
+(
+    void* const hSHE,
+    int order,
+    const float* dirs_rad,
+    int nDirs,
+    float* Y
+)
+{
+    shEvaluator_data *h = (shEvaluator_data*)(hSHE);
+
+    saf_assert(order<=h->maxOrder, "order exceeds the maximum specified upon creation");
+    shEval_f(order, h->a_f, h->b_f, h->d_f, h->e_f, dirs_rad, nDirs, Y);
+}
+
+void shEvaluator_getSHreal_d
+(
+    void* const hSHE,
+    int order,
+    const double* dirs_rad,
+    int nDirs,
+    double* Y
+)
+{
+    shEvaluator_data *h = (shEvaluator_data*)(hSHE);
+    int dir, nLanes;
 
-    if(N>7 || nDirs > 1){
-        free(factorials_n);
-        free(leg_n);
-        free(leg_n_1);
-        free(leg_n_2);
-        free(cos_incl);
+    saf_assert(order<=h->maxOrder, "order exceeds the maximum specified upon creation");
+    for(dir=0; dir<nDirs; dir+=SAF_SH_EVAL_LANES){
+        nLanes = SAF_MIN(SAF_SH_EVAL_LANES, nDirs-dir);
+        shEval_block_d(order, h->a_d, h->b_d, h->d_d, h->e_d, &dirs_rad[dir*2], nLanes, &Y[dir], NULL, nDirs);
     }
 }
 
@@ -562,6 +992,68 @@ void getSHrotMtxReal
     }
 }
 
+void applySHrotMtxReal
+(
+    int L,
+    const float* RotMtx,
+    int ldRot,
+    const float* inSig,
+    int ldIn,
+    int nSamples,
+    int ldOut,
+    float* outSig
+)
+{
+    int n, o, blk;
+
+    /* One (2n+1)x(2n+1) block per order, starting at row/column n^2 */
+    for(n=0; n<=L; n++){
+        o = n*n;
+        blk = 2*n+1;
+        cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, blk, nSamples, blk, 1.0f,
+                    RotMtx + o*ldRot + o, ldRot,
+                    inSig + o*ldIn, ldIn, 0.0f,
+                    outSig + o*ldOut, ldOut);
+    }
+}
+
+void applySHrotMtxRealToDecoder
+(
+    int L,
+    const float* RotMtx,
+    int ldRot,
+    const float_complex* decMtx,
+    int ldDec,
+    int nRows,
+    int ldDecRot,
+    float_complex* decMtx_rot
+)
+{
+    int n, o, blk, r, i, j;
+    float re, im, rij;
+    const float* R_n;
+    const float_complex* d;
+
+    /* Real-valued blocks, so the real and imaginary parts may be rotated separately */
+    for(n=0; n<=L; n++){
+        o = n*n;
+        blk = 2*n+1;
+        R_n = RotMtx + o*ldRot + o;
+        for(r=0; r<nRows; r++){
+            d = decMtx + r*ldDec + o;
+            for(j=0; j<blk; j++){
+                re = im = 0.0f;
+                for(i=0; i<blk; i++){
+                    rij = R_n[i*ldRot+j];
+                    re += crealf(d[i])*rij;
+                    im += cimagf(d[i])*rij;
+                }
+                decMtx_rot[r*ldDecRot + o + j] = cmplxf(re, im);
+            }
+        }
+    }
+}
+
 void computeVelCoeffsMtx
 (
     int sectorOrder,
@@ -737,15 +1229,10 @@ void beamWeightsHypercardioid2Spherical
 )
 {
     int n;
-    float* c_n;
-    float dirs_rad[2] = {0.0f, 0.0f};
-    
-    c_n = malloc1d((N+1)*(N+1)*sizeof(float));
-    getSHreal(N, dirs_rad, 1, c_n);
+
+    /* The m=0 spherical harmonics evaluated at the pole, i.e. sqrt((2n+1)/(4pi)), scaled by 4pi/(N+1)^2 */
     for(n=0; n<N+1; n++)
-        b_n[n] = c_n[(n+1)*(n+1)-n-1] * 4.0f * SAF_PI/(powf((float)N+1.0f, 2.0f));
-    
-    free(c_n);
+        b_n[n] = sqrtf((2.0f*(float)n+1.0f)/(4.0f*SAF_PI)) * 4.0f * SAF_PI/(powf((float)N+1.0f, 2.0f));
 }
 
 void beamWeightsMaxEV
@@ -756,23 +1243,24 @@ void beamWeightsMaxEV
 {
     int n;
     float norm;
-    double temp_i;
-    double* temp_o;
-    
-    temp_o = malloc1d( (N+1)*sizeof(double));
+    double x, P_n, P_nm1, P_np1;
+
+    /* Legendre polynomials (m=0) evaluated at x, via Bonnet's recursion */
+    x = cos(2.4068f/((double)N+1.51));
+    P_nm1 = 0.0;
+    P_n = 1.0;
     norm = 0.0f;
     for (n=0; n<=N; n++) {
-        temp_i = cos(2.4068f/((double)N+1.51));
-        unnorm_legendreP(n, &temp_i, 1, temp_o);
-        b_n[n] = sqrtf((2.0f*(float)n+1.0f)/(4.0f*SAF_PI))*(float)temp_o[0];
+        b_n[n] = sqrtf((2.0f*(float)n+1.0f)/(4.0f*SAF_PI))*(float)P_n;
         norm +=  sqrtf((2.0f*(float)n+1.0f)/(4.0f*SAF_PI))*b_n[n];
+        P_np1 = ((2.0*(double)n+1.0)*x*P_n - (double)n*P_nm1)/((double)n+1.0);
+        P_nm1 = P_n;
+        P_n = P_np1;
     }
     
     /* normalise to unity response on look-direction */
     for (n=0; n<=N; n++)
         b_n[n] /= norm;
-    
-    free(temp_o);
 }
 
 void beamWeightsVelocityPatternsReal
@@ -845,15 +1333,17 @@ void rotateAxisCoeffsReal
     float* c_nm
 )
 {
-    int nSH;
-    float_complex* c_nm_c;
+    int n, m, q;
+    float phi_theta[2];
 
-    nSH = ORDER2NSH(order);
-    c_nm_c = malloc1d(nSH*sizeof(float_complex));
-    rotateAxisCoeffsComplex(order, c_n, theta_0, phi_0, c_nm_c);
-    complex2realCoeffs(order, c_nm_c, 1, c_nm);
-    
-    free(c_nm_c);
+    /* The real spherical harmonics for the look-direction are first written directly to the output, and then
+     * weighted by the pattern coefficients (without allocating memory, for up to 7th order) */
+    phi_theta[0] = phi_0;
+    phi_theta[1] = theta_0;
+    getSHreal_recur(order, (float*)phi_theta, 1, c_nm);
+    for(n=0, q = 0; n<=order; n++)
+        for(m=-n; m<=n; m++, q++)
+            c_nm[q] *= sqrtf(4.0f*SAF_PI/(2.0f*(float)n+1.0f)) * c_n[n];
 }
 
 void rotateAxisCoeffsComplex
@@ -1541,50 +2031,235 @@ void sphESPRIT_estimateDirs
     }
 }
 
-void generatePWDmap
+void generateMap_create
 (
-    int order,
+    void ** const phMap,
+    int maxOrder,
+    int maxNgrid_dirs
+)
+{
+    *phMap = malloc1d(sizeof(generateMap_data));
+    generateMap_data *h = (generateMap_data*)(*phMap);
+
+    h->maxOrder = maxOrder;
+    h->maxNSH = ORDER2NSH(maxOrder);
+    h->maxNgrid_dirs = maxNgrid_dirs;
+
+    /* solvers */
+    utility_cinv_create(&(h->hCinv), h->maxNSH);
+    utility_cseig_create(&(h->hCseig), h->maxNSH);
+
+    /* run-time buffers */
+    h->Cx = malloc1d(h->maxNSH*h->maxNSH*sizeof(float_complex));
+    h->nSH_Cx = 0;
+    h->invCx_valid = h->V_valid = 0;
+    h->invCx_regPar = 0.0f;
+    h->Cx_d = malloc1d(h->maxNSH*h->maxNSH*sizeof(float_complex));
+    h->invCx = malloc1d(h->maxNSH*h->maxNSH*sizeof(float_complex));
+    h->Cx_W = malloc1d(h->maxNSH*maxNgrid_dirs*sizeof(float_complex));
+    h->W = malloc1d(h->maxNSH*maxNgrid_dirs*sizeof(float_complex));
+    h->B = malloc1d(h->maxNSH*2*maxNgrid_dirs*sizeof(float_complex));
+    h->invCx_B = malloc1d(h->maxNSH*2*maxNgrid_dirs*sizeof(float_complex));
+    h->V = malloc1d(h->maxNSH*h->maxNSH*sizeof(float_complex));
+    h->Un = malloc1d(h->maxNSH*sizeof(float_complex));
+    h->gridTmp = malloc1d(6*maxNgrid_dirs*sizeof(float_complex));
+    h->gridTmp_r = malloc1d(maxNgrid_dirs*sizeof(float));
+}
+
+void generateMap_destroy
+(
+    void ** const phMap
+)
+{
+    generateMap_data *h = (generateMap_data*)(*phMap);
+
+    if (h != NULL) {
+        utility_cinv_destroy(&(h->hCinv));
+        utility_cseig_destroy(&(h->hCseig));
+        free(h->Cx);
+        free(h->Cx_d);
+        free(h->invCx);
+        free(h->Cx_W);
+        free(h->W);
+        free(h->B);
+        free(h->invCx_B);
+        free(h->V);
+        free(h->Un);
+        free(h->gridTmp);
+        free(h->gridTmp_r);
+        free(h);
+        h = NULL;
+        *phMap = NULL;
+    }
+}
+
+/**
+ * Accumulates the column-wise sums of the (non-conjugated) element-wise
+ * products of two matrices, i.e. sum(A.*B, 1), where both matrices have nRows x
+ * nCols elements. The rows are traversed in the outer loop, such that the
+ * inner loop runs over contiguous memory for the whole grid */
+static void sumColumnsOfProducts
+(
+    const float_complex* A,
+    int lda,
+    const float_complex* B,
+    int ldb,
+    int nRows,
+    int nCols,
+    float_complex* sums
+)
+{
+    int i, j;
+    float* s;
+    const float* a, *b;
+
+    memset(sums, 0, nCols*sizeof(float_complex));
+    s = (float*)sums;
+    for(j=0; j<nRows; j++){
+        a = (const float*)&A[j*lda];
+        b = (const float*)&B[j*ldb];
+        for(i=0; i<nCols; i++){
+            s[2*i]   += a[2*i]*b[2*i]   - a[2*i+1]*b[2*i+1];
+            s[2*i+1] += a[2*i]*b[2*i+1] + a[2*i+1]*b[2*i];
+        }
+    }
+}
+
+/** Computes real(diag(W.'*Cx*W)) for all grid directions */
+static void generateMap_pwd
+(
+    generateMap_data* h,
+    int nSH,
     float_complex* Cx,
-    float_complex* Y_grid,
+    float_complex* W,
     int nGrid_dirs,
     float* pmap
 )
 {
-    int i, j, nSH;
-    float_complex* Cx_Y, *Y_Cx_Y, *Cx_Y_s, *Y_grid_s;
+    int i;
     const float_complex calpha = cmplxf(1.0f, 0.0f), cbeta = cmplxf(0.0f, 0.0f);
-    
-    nSH = ORDER2NSH(order);
-    Cx_Y = malloc1d(nSH * nGrid_dirs * sizeof(float_complex));
-    Y_Cx_Y = malloc1d(nGrid_dirs*sizeof(float_complex));
-    Cx_Y_s = malloc1d(nSH*sizeof(float_complex));
-    Y_grid_s = malloc1d(nSH*sizeof(float_complex));
-    
-    /* Calculate PWD powermap: real(diag(Y_grid.'*C_x*Y_grid)) */
+
     cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nSH, nGrid_dirs, nSH, &calpha,
                 Cx, nSH,
-                Y_grid, nGrid_dirs, &cbeta,
-                Cx_Y, nGrid_dirs);
-    for(i=0; i<nGrid_dirs; i++){
-        for(j=0; j<nSH; j++){
-            Cx_Y_s[j] = Cx_Y[j*nGrid_dirs+i];
-            Y_grid_s[j] = Y_grid[j*nGrid_dirs+i];
-        }
-        /* faster to perform the dot-product for each vector seperately */
-        utility_cvvdot(Y_grid_s, Cx_Y_s, nSH, NO_CONJ, &Y_Cx_Y[i]);
+                W, nGrid_dirs, &cbeta,
+                h->Cx_W, nGrid_dirs);
+    sumColumnsOfProducts(W, nGrid_dirs, h->Cx_W, nGrid_dirs, nSH, nGrid_dirs, h->gridTmp);
+    for(i=0; i<nGrid_dirs; i++)
+        pmap[i] = crealf(h->gridTmp[i]);
+}
+
+/**
+ * Stores a copy of Cx and invalidates the decompositions of the previous one;
+ * or, if Cx is NULL, checks that there is a previous one to reuse */
+static void generateMap_setCx
+(
+    generateMap_data* h,
+    int nSH,
+    float_complex* Cx
+)
+{
+    if(Cx!=NULL){
+        memcpy(h->Cx, Cx, nSH*nSH*sizeof(float_complex));
+        h->nSH_Cx = nSH;
+        h->invCx_valid = h->V_valid = 0;
     }
-    
+    else
+        saf_assert(h->nSH_Cx==nSH, "Cx may only be NULL if a previous call provided one of the same order");
+}
+
+/** Computes the inverse of the diagonally loaded Cx, h->invCx (unless it is already up to date) */
+static void generateMap_invCx
+(
+    generateMap_data* h,
+    int nSH,
+    float regPar
+)
+{
+    int i;
+    float Cx_trace;
+
+    if(h->invCx_valid && h->invCx_regPar==regPar)
+        return;
+    Cx_trace = 0.0f;
+    for(i=0; i<nSH; i++)
+        Cx_trace += crealf(h->Cx[i*nSH+i]);
+    Cx_trace /= (float)nSH;
+    memcpy(h->Cx_d, h->Cx, nSH*nSH*sizeof(float_complex));
+    for(i=0; i<nSH; i++)
+        h->Cx_d[i*nSH+i] = craddf(h->Cx_d[i*nSH+i], regPar*Cx_trace);
+    utility_cinv(h->hCinv, h->Cx_d, h->invCx, nSH);
+    h->invCx_valid = 1;
+    h->invCx_regPar = regPar;
+}
+
+/** Computes the eigenvectors of Cx, h->V, sorted in decending order of their eigenvalues (unless they are already up
+ * to date) */
+static void generateMap_eigCx
+(
+    generateMap_data* h,
+    int nSH
+)
+{
+    if(h->V_valid)
+        return;
+    utility_cseig(h->hCseig, h->Cx, nSH, 1, h->V, NULL, NULL);
+    h->V_valid = 1;
+}
+
+/**
+ * Computes the MVDR weights for all grid directions, (Cx^-1 * Y) * (Y^T * Cx^-1 * Y)^-1, given Cx^-1 * Y (which is
+ * stored with leading dimension "ldInv") */
+static void generateMap_mvdrWeights
+(
+    generateMap_data* h,
+    int nSH,
+    float_complex* Y_grid,
+    int nGrid_dirs,
+    float_complex* invCx_Y,
+    int ldInv,
+    float_complex* W
+)
+{
+    int i, j;
+    float_complex* denum;
+
+    /* denumerator for all grid directions: Y^T * conj(Cx^-1 * Y) */
+    denum = h->gridTmp;
+    memset(denum, 0, nGrid_dirs*sizeof(float_complex));
+    for(j=0; j<nSH; j++)
+        for(i=0; i<nGrid_dirs; i++)
+            denum[i] = ccaddf(denum[i], ccmulf(Y_grid[j*nGrid_dirs+i], conjf(invCx_Y[j*ldInv+i])));
     for(i=0; i<nGrid_dirs; i++)
-        pmap[i] = crealf(Y_Cx_Y[i]);
-    
-    free(Cx_Y);
-    free(Y_Cx_Y);
-    free(Cx_Y_s);
-    free(Y_grid_s);
+        denum[i] = ccdivf(cmplxf(1.0f, 0.0f), denum[i]);
+
+    /* weights */
+    for(j=0; j<nSH; j++)
+        for(i=0; i<nGrid_dirs; i++)
+            W[j*nGrid_dirs+i] = ccmulf(invCx_Y[j*ldInv+i], denum[i]);
 }
 
-void generateMVDRmap
+void generatePWDmap_compute
+(
+    void* const hMap,
+    int order,
+    float_complex* Cx,
+    float_complex* Y_grid,
+    int nGrid_dirs,
+    float* pmap
+)
+{
+    generateMap_data *h = (generateMap_data*)(hMap);
+
+    saf_assert(order<=h->maxOrder && nGrid_dirs<=h->maxNgrid_dirs, "Dimensions exceed those specified upon creation");
+    generateMap_setCx(h, ORDER2NSH(order), Cx);
+
+    /* Calculate PWD powermap: real(diag(Y_grid.'*C_x*Y_grid)) */
+    generateMap_pwd(h, ORDER2NSH(order), h->Cx, Y_grid, nGrid_dirs, pmap);
+}
+
+void generateMVDRmap_compute
 (
+    void* const hMap,
     int order,
     float_complex* Cx,
     float_complex* Y_grid,
@@ -1594,167 +2269,127 @@ void generateMVDRmap
     float_complex* w_MVDR_out
 )
 {
-    int i, j, nSH;
-    float Cx_trace;
-    float_complex *Cx_d, *invCx_Ygrid, *w_MVDR, *invCx_Ygrid_s, *Y_grid_s;
-    float_complex denum;
-    
+    generateMap_data *h = (generateMap_data*)(hMap);
+    int nSH;
+    const float_complex calpha = cmplxf(1.0f, 0.0f), cbeta = cmplxf(0.0f, 0.0f);
+
+    saf_assert(order<=h->maxOrder && nGrid_dirs<=h->maxNgrid_dirs, "Dimensions exceed those specified upon creation");
     nSH = ORDER2NSH(order);
-    w_MVDR = malloc1d(nSH * nGrid_dirs*sizeof(float_complex));
-    Cx_d = malloc1d(nSH*nSH*sizeof(float_complex));
-    invCx_Ygrid = malloc1d(nSH*nGrid_dirs*sizeof(float_complex));
-    invCx_Ygrid_s = malloc1d(nSH*sizeof(float_complex));
-    Y_grid_s = malloc1d(nSH*sizeof(float_complex));
-    
-    /* apply diagonal loading */
-    Cx_trace = 0.0f;
-    for(i=0; i<nSH; i++)
-        Cx_trace += crealf(Cx[i*nSH+i]);
-    Cx_trace /= (float)nSH;
-    memcpy(Cx_d, Cx, nSH*nSH*sizeof(float_complex));
-    for(i=0; i<nSH; i++)
-        Cx_d[i*nSH+i] = craddf(Cx_d[i*nSH+i], regPar*Cx_trace);
-    
-    /* solve the numerator part of the MVDR weights for all grid directions: Cx^-1 * Y */
-    utility_cslslv(NULL, Cx_d, nSH, Y_grid, nGrid_dirs, invCx_Ygrid);
-    for(i=0; i<nGrid_dirs; i++){
-        /* solve the denumerator part of the MVDR weights for each grid direction: Y^T * Cx^-1 * Y */
-        for(j=0; j<nSH; j++){
-            invCx_Ygrid_s[j] = conjf(invCx_Ygrid[j*nGrid_dirs+i]);
-            Y_grid_s[j] = Y_grid[j*nGrid_dirs+i];
-        }
-        /* faster to perform the dot-product for each vector seperately */
-        utility_cvvdot(Y_grid_s, invCx_Ygrid_s, nSH, NO_CONJ, &denum);
-        
-        /* calculate the MVDR weights per grid direction: (Cx^-1 * Y) * (Y^T * Cx^-1 * Y)^-1 */
-        for(j=0; j<nSH; j++)
-            w_MVDR[j*nGrid_dirs +i] = ccdivf(invCx_Ygrid[j*nGrid_dirs +i], denum);
-    }
-    
-    /* generate MVDR powermap, by using the generatePWDmap function with the MVDR weights instead */
-    generatePWDmap(order, Cx, w_MVDR, nGrid_dirs, pmap);
-    
+    generateMap_setCx(h, nSH, Cx);
+
+    /* invert the diagonally loaded covariance matrix */
+    generateMap_invCx(h, nSH, regPar);
+
+    /* the numerator part of the MVDR weights for all grid directions: Cx^-1 * Y */
+    cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nSH, nGrid_dirs, nSH, &calpha,
+                h->invCx, nSH,
+                Y_grid, nGrid_dirs, &cbeta,
+                h->invCx_B, nGrid_dirs);
+
+    /* calculate the MVDR weights for all grid directions: (Cx^-1 * Y) * (Y^T * Cx^-1 * Y)^-1 */
+    generateMap_mvdrWeights(h, nSH, Y_grid, nGrid_dirs, h->invCx_B, nGrid_dirs, h->W);
+
+    /* generate MVDR powermap, by using the PWD approach with the MVDR weights instead */
+    generateMap_pwd(h, nSH, h->Cx, h->W, nGrid_dirs, pmap);
+
     /* optional output of the beamforming weights */
     if (w_MVDR_out!=NULL)
-        memcpy(w_MVDR_out, w_MVDR, nSH * nGrid_dirs*sizeof(float_complex));
-    
-    free(w_MVDR);
-    free(Cx_d);
-    free(invCx_Ygrid);
-    free(invCx_Ygrid_s);
-    free(Y_grid_s);
+        memcpy(w_MVDR_out, h->W, nSH*nGrid_dirs*sizeof(float_complex));
 }
 
 /* EXPERIMENTAL
  * Delikaris-Manias, S., Vilkamo, J., & Pulkki, V. (2016). Signal-dependent spatial filtering based on
  * weighted-orthogonal beamformers in the spherical harmonic domain. IEEE/ACM Transactions on Audio,
  * Speech and Language Processing (TASLP), 24(9), 1507-1519. */
-void generateCroPaCLCMVmap
+void generateCroPaCLCMVmap_compute
 (
+    void* const hMap,
     int order,
     float_complex* Cx,
     float_complex* Y_grid,
     int nGrid_dirs,
     float regPar,
     float lambda,
-    float* pmap  
+    float* pmap
 )
 {
-    int i, j, k, nSH;
-    float Cx_trace, S, G;
+    generateMap_data *h = (generateMap_data*)(hMap);
+    int i, j, nSH, ldB;
+    float S, G;
+    float_complex det, Y_wo_xspec;
+    float_complex* s00, *s01, *s10, *s11, *t0, *t1;
     float* mvdr_map;
-    float_complex* Cx_d, *A, *invCxd_A, *invCxd_A_tmp, *w_LCMV_s, *w_CroPaC, *wo, *Cx_Y, *Cx_Y_s;
-    float_complex b[2]; 
     const float_complex calpha = cmplxf(1.0f, 0.0f), cbeta = cmplxf(0.0f, 0.0f);
-    float_complex A_invCxd_A[2][2];
-    float_complex Y_wo_xspec;
-    
-    b[0] = cmplxf(1.0f, 0.0f);
-    b[1] = cmplxf(0.0f, 0.0f);
+
+    saf_assert(order<=h->maxOrder && nGrid_dirs<=h->maxNgrid_dirs, "Dimensions exceed those specified upon creation");
     nSH = ORDER2NSH(order);
-    Cx_Y = malloc1d(nSH * nGrid_dirs * sizeof(float_complex));
-    Cx_d = malloc1d(nSH*nSH*sizeof(float_complex));
-    A = malloc1d(nSH*2*sizeof(float_complex));
-    invCxd_A = malloc1d(nSH*2*sizeof(float_complex));
-    invCxd_A_tmp = malloc1d(nSH*2*sizeof(float_complex));
-    w_LCMV_s = malloc1d(2*nGrid_dirs*sizeof(float_complex));
-    w_CroPaC = malloc1d(nSH*nGrid_dirs*sizeof(float_complex));
-    wo = malloc1d(nSH*sizeof(float_complex));
-    mvdr_map = malloc1d(nGrid_dirs*sizeof(float));
-    Cx_Y_s = malloc1d(nSH*sizeof(float_complex));
-    
-    /* generate MVDR map and weights to use as a basis */
-    generateMVDRmap(order, Cx, Y_grid, nGrid_dirs, regPar, mvdr_map, w_CroPaC);
-    
+    ldB = 2*nGrid_dirs;
+    mvdr_map = h->gridTmp_r;
+    generateMap_setCx(h, nSH, Cx);
+    Cx = h->Cx;
+
+    /* invert the diagonally loaded covariance matrix */
+    generateMap_invCx(h, nSH, regPar);
+
+    /* The two constraints, 'A', for all grid directions are: Y and Y.*diag(Cx). These are stacked as
+     * B = [Y, diag(Cx)*Y], such that (Cx^-1 * A) may be computed for the whole grid at once */
+    for(j=0; j<nSH; j++){
+        memcpy(&(h->B[j*ldB]), &Y_grid[j*nGrid_dirs], nGrid_dirs*sizeof(float_complex));
+        for(i=0; i<nGrid_dirs; i++)
+            h->B[j*ldB+nGrid_dirs+i] = ccmulf(Y_grid[j*nGrid_dirs+i], Cx[j*nSH+j]);
+    }
+    cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nSH, ldB, nSH, &calpha,
+                h->invCx, nSH,
+                h->B, ldB, &cbeta,
+                h->invCx_B, ldB);
+
+    /* generate MVDR map and weights to use as a basis (Cx^-1 * Y is the first half of the solution) */
+    generateMap_mvdrWeights(h, nSH, Y_grid, nGrid_dirs, h->invCx_B, ldB, h->W);
+    generateMap_pwd(h, nSH, Cx, h->W, nGrid_dirs, mvdr_map);
+
     /* first half of the cross-spectrum */
     cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nSH, nGrid_dirs, nSH, &calpha,
                 Cx, nSH,
                 Y_grid, nGrid_dirs, &cbeta,
-                Cx_Y, nGrid_dirs);
-    
-    /* apply diagonal loading to cov matrix */
-    Cx_trace = 0.0f;
-    for(i=0; i<nSH; i++)
-        Cx_trace += crealf(Cx[i*nSH+i]);
-    Cx_trace /= (float)nSH;
-    memcpy(Cx_d, Cx, nSH*nSH*sizeof(float_complex));
-    for(i=0; i<nSH; i++)
-        Cx_d[i*nSH+i] = craddf(Cx_d[i*nSH+i], regPar*Cx_trace);
-    
-    /* calculate CroPaC beamforming weights for each grid direction */
+                h->Cx_W, nGrid_dirs);
+
+    /* The LCMV weights are: wo = (Cx^-1 * A) * (A^H * conj(Cx^-1 * A))^-1 * b, where b = [1 0]^T. Given the sums
+     * s_kl = A_k^T * (Cx^-1 * A_l) and t_l = (Cx^-1 * A_l)^T * (Cx * Y), the cross-spectrum between the static beam
+     * Y and the adaptive beam wo is then computed in closed form, for all grid directions at once */
+    s00 = &(h->gridTmp[0*nGrid_dirs]);
+    s01 = &(h->gridTmp[1*nGrid_dirs]);
+    s10 = &(h->gridTmp[2*nGrid_dirs]);
+    s11 = &(h->gridTmp[3*nGrid_dirs]);
+    t0  = &(h->gridTmp[4*nGrid_dirs]);
+    t1  = &(h->gridTmp[5*nGrid_dirs]);
+    sumColumnsOfProducts(h->B, ldB, h->invCx_B, ldB, nSH, nGrid_dirs, s00);
+    sumColumnsOfProducts(h->B, ldB, &(h->invCx_B[nGrid_dirs]), ldB, nSH, nGrid_dirs, s01);
+    sumColumnsOfProducts(&(h->B[nGrid_dirs]), ldB, h->invCx_B, ldB, nSH, nGrid_dirs, s10);
+    sumColumnsOfProducts(&(h->B[nGrid_dirs]), ldB, &(h->invCx_B[nGrid_dirs]), ldB, nSH, nGrid_dirs, s11);
+    sumColumnsOfProducts(h->invCx_B, ldB, h->Cx_W, nGrid_dirs, nSH, nGrid_dirs, t0);
+    sumColumnsOfProducts(&(h->invCx_B[nGrid_dirs]), ldB, h->Cx_W, nGrid_dirs, nSH, nGrid_dirs, t1);
     for(i=0; i<nGrid_dirs; i++){
-        for(j=0; j<nSH; j++){
-            A[j*2] = Y_grid[j*nGrid_dirs+i];
-            A[j*2+1] = ccmulf(A[j*2], Cx[j*nSH+j]);
-        }
-        
-        /* solve for minimisation problem for LCMV weights: (Cx^-1 * A) * (A^H * Cx^-1 * A)^-1 * b */
-        utility_cslslv(NULL, Cx_d, nSH, A, 2, invCxd_A);
-        for(j=0; j<nSH*2; j++)
-            invCxd_A_tmp[j] = conjf(invCxd_A[j]);
-        cblas_cgemm(CblasRowMajor, CblasConjTrans, CblasNoTrans, 2, 2, nSH, &calpha,
-                    A, 2,
-                    invCxd_A_tmp, 2, &cbeta,
-                    A_invCxd_A, 2);
-        for(j=0; j<nSH; j++)
-            for(k=0; k<2; k++)
-                invCxd_A_tmp[k*nSH+j] = invCxd_A[j*2+k];
-        utility_cglslv(NULL, (float_complex*)A_invCxd_A, 2, invCxd_A_tmp, nSH, w_LCMV_s);
-        cblas_cgemm(CblasRowMajor, CblasTrans, CblasNoTrans, nSH, 1, 2, &calpha,
-                    w_LCMV_s, nSH,
-                    b, 1, &cbeta,
-                    wo, 1);
-        
-        /* calculate the cross-spectrum between static beam Y, and adaptive beam wo (LCMV) */
-        for(j=0; j<nSH; j++)
-            Cx_Y_s[j] = Cx_Y[j*nGrid_dirs+i];
-        utility_cvvdot(wo, Cx_Y_s, nSH, NO_CONJ, &Y_wo_xspec);
-        
-        /* derive CroPaC weights  */
+        det = ccsubf(ccmulf(conjf(s00[i]), conjf(s11[i])), ccmulf(conjf(s01[i]), conjf(s10[i])));
+        Y_wo_xspec = ccdivf(ccsubf(ccmulf(conjf(s11[i]), t0[i]), ccmulf(conjf(s01[i]), t1[i])), det);
+
+        /* derive CroPaC post-filter gains */
         S = SAF_MIN(cabsf(Y_wo_xspec), mvdr_map[i]); /* ensures distortionless response */
         G = sqrtf(S/(mvdr_map[i]+2.23e-10f));
-        G = SAF_MAX(lambda, G); /* optional spectral floor parameter, to control harshness of attenuation (good for demos) */
-        for(j=0; j<nSH; j++)
-            w_CroPaC[j*nGrid_dirs + i] = crmulf(w_CroPaC[j*nGrid_dirs + i], G);
+        h->gridTmp_r[i] = SAF_MAX(lambda, G); /* optional spectral floor parameter, to control harshness of attenuation (good for demos) */
     }
-    
-    /* generate CroPaC powermap, by using the generatePWDmap function with the CroPaC weights instead */
-    generatePWDmap(order, Cx, w_CroPaC, nGrid_dirs, pmap);
-    
-    free(mvdr_map);
-    free(Cx_d);
-    free(A);
-    free(invCxd_A);
-    free(invCxd_A_tmp);
-    free(w_LCMV_s);
-    free(w_CroPaC);
-    free(wo);
-    free(Cx_Y);
-    free(Cx_Y_s);
+
+    /* apply the gains to the MVDR weights, to obtain the CroPaC weights */
+    for(j=0; j<nSH; j++)
+        for(i=0; i<nGrid_dirs; i++)
+            h->W[j*nGrid_dirs+i] = crmulf(h->W[j*nGrid_dirs+i], h->gridTmp_r[i]);
+
+    /* generate CroPaC powermap, by using the PWD approach with the CroPaC weights instead */
+    generateMap_pwd(h, nSH, Cx, h->W, nGrid_dirs, pmap);
 }
 
-void generateMUSICmap
+void generateMUSICmap_compute
 (
+    void* const hMap,
     int order,
     float_complex* Cx,
     float_complex* Y_grid,
@@ -1764,45 +2399,38 @@ void generateMUSICmap
     float* pmap
 )
 {
-    int i, j, nSH;
-    float_complex* V, *Vn, *Vn_Y;
+    generateMap_data *h = (generateMap_data*)(hMap);
+    int i, j, nSH, nVn;
+    float_complex* Vn_Y;
     const float_complex calpha = cmplxf(1.0f, 0.0f), cbeta = cmplxf(0.0f, 0.0f);
-    float_complex tmp;
-    
+
+    saf_assert(order<=h->maxOrder && nGrid_dirs<=h->maxNgrid_dirs, "Dimensions exceed those specified upon creation");
     nSH = ORDER2NSH(order);
     nSources = SAF_MIN(nSources, nSH/2);
-    V = malloc1d(nSH*nSH*sizeof(float_complex));
-    Vn = malloc1d(nSH*(nSH-nSources)*sizeof(float_complex));
-    Vn_Y = malloc1d((nSH-nSources)*nGrid_dirs*sizeof(float_complex));
-    
+    nVn = nSH-nSources;
+    Vn_Y = h->Cx_W;
+    generateMap_setCx(h, nSH, Cx);
+
     /* obtain eigenvectors */
-    //utility_ceig(Cx, nSH, 1, NULL, V, NULL, NULL);
-    utility_cseig(NULL, Cx, nSH, 1, V, NULL, NULL);
-    
-    /* truncate, to obtain noise sub-space */
-    for (i = 0; i < nSH; i++)
-        for (j = 0; j < nSH - nSources; j++)
-            Vn[i*(nSH - nSources) + j] = V[i*nSH + j + nSources];
-    
-    /* derive the pseudo-spectrum value for each grid direction */
-    cblas_cgemm(CblasRowMajor, CblasTrans, CblasNoTrans, nSH-nSources, nGrid_dirs, nSH, &calpha,
-                Vn, nSH-nSources,
+    generateMap_eigCx(h, nSH);
+
+    /* derive the pseudo-spectrum value for each grid direction (the noise sub-space, Vn, are the last nSH-nSources
+     * columns of V) */
+    cblas_cgemm(CblasRowMajor, CblasTrans, CblasNoTrans, nVn, nGrid_dirs, nSH, &calpha,
+                &(h->V[nSources]), nSH,
                 Y_grid, nGrid_dirs, &cbeta,
                 Vn_Y, nGrid_dirs);
-    for(i=0; i<nGrid_dirs; i++){
-        tmp = cmplxf(0.0f,0.0f);
-        for(j=0; j<nSH-nSources; j++)
-            tmp = ccaddf(tmp, ccmulf(conjf(Vn_Y[j*nGrid_dirs+i]),Vn_Y[j*nGrid_dirs+i]));
-        pmap[i] = logScaleFlag ? logf(1.0f/(crealf(tmp)+2.23e-10f)) : 1.0f/(crealf(tmp)+2.23e-10f);
-    }
-    
-    free(V);
-    free(Vn);
-    free(Vn_Y);
+    memset(pmap, 0, nGrid_dirs*sizeof(float));
+    for(j=0; j<nVn; j++)
+        for(i=0; i<nGrid_dirs; i++)
+            pmap[i] += crealf(Vn_Y[j*nGrid_dirs+i])*crealf(Vn_Y[j*nGrid_dirs+i]) + cimagf(Vn_Y[j*nGrid_dirs+i])*cimagf(Vn_Y[j*nGrid_dirs+i]);
+    for(i=0; i<nGrid_dirs; i++)
+        pmap[i] = logScaleFlag ? logf(1.0f/(pmap[i]+2.23e-10f)) : 1.0f/(pmap[i]+2.23e-10f);
 }
 
-void generateMinNormMap
+void generateMinNormMap_compute
 (
+    void* const hMap,
     int order,
     float_complex* Cx,
     float_complex* Y_grid,
@@ -1812,49 +2440,129 @@ void generateMinNormMap
     float* pmap
 )
 {
-    int i, j, nSH;
-    float_complex* V, *Vn, *Vn1, *Un, *Un_Y;
+    generateMap_data *h = (generateMap_data*)(hMap);
+    int i, nSH, nVn;
+    float_complex* Vn1, *Un_Y;
     const float_complex calpha = cmplxf(1.0f, 0.0f), cbeta = cmplxf(0.0f, 0.0f);
     float_complex Vn1_Vn1H;
-    
+
+    saf_assert(order<=h->maxOrder && nGrid_dirs<=h->maxNgrid_dirs, "Dimensions exceed those specified upon creation");
     nSH = ORDER2NSH(order);
     nSources = SAF_MIN(nSources, nSH/2);
-    V = malloc1d(nSH*nSH*sizeof(float_complex));
-    Vn = malloc1d(nSH*(nSH-nSources)*sizeof(float_complex));
-    Vn1 = malloc1d((nSH-nSources)*sizeof(float_complex));
-    Un = malloc1d(nSH*sizeof(float_complex));
-    Un_Y = malloc1d(nGrid_dirs*sizeof(float_complex));
-    
-    /* obtain eigenvectors */
-    utility_ceig(NULL, Cx, nSH, NULL, V, NULL, NULL);
-    
-    /* truncate, to obtain noise sub-space */
+    nVn = nSH-nSources;
+    Un_Y = h->gridTmp;
+    generateMap_setCx(h, nSH, Cx);
+
+    /* obtain eigenvectors (sorted in decending order of their eigenvalues) */
+    generateMap_eigCx(h, nSH);
+
+    /* the noise sub-space, Vn, are the last nSH-nSources columns of V, and Vn1 is its first row */
+    Vn1 = &(h->V[nSources]);
+
+    /* derive the pseudo-spectrum value for each grid direction. Note that the normaliser is Vn1*Vn1^H = ||Vn1||^2, which
+     * is real and positive. (Without the conjugate, the result would depend on the arbitrary phase that the solver
+     * gives each eigenvector, which scales the whole map by a frame-dependent factor; although the peaks stay put) */
+    utility_cvvdot(Vn1, Vn1, nVn, CONJ, &Vn1_Vn1H);
+    cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, nSH, 1, nVn, &calpha,
+                &(h->V[nSources]), nSH,
+                Vn1, nSH, &cbeta,
+                h->Un, 1);
     for(i=0; i<nSH; i++)
-        for(j=0; j<nSH-nSources; j++)
-            Vn[i*(nSH-nSources)+j] = V[i*nSH + j + nSources];
-    for(j=0; j<nSH-nSources; j++)
-        Vn1[j] = V[j + nSources];
-    
-    /* derive the pseudo-spectrum value for each grid direction */
-    utility_cvvdot(Vn1, Vn1, nSH-nSources, NO_CONJ, &Vn1_Vn1H);
-    cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, nSH, 1, nSH-nSources, &calpha,
-                Vn, nSH-nSources,
-                Vn1, nSH-nSources, &cbeta,
-                Un, 1);
-    for(i=0; i<nSH; i++)
-        Un[i] = ccdivf(Un[i], craddf(Vn1_Vn1H, 2.23e-9f));
+        h->Un[i] = ccdivf(h->Un[i], craddf(Vn1_Vn1H, 2.23e-9f));
     cblas_cgemm(CblasRowMajor, CblasConjTrans, CblasNoTrans, 1, nGrid_dirs, nSH, &calpha,
-                Un, 1,
+                h->Un, 1,
                 Y_grid, nGrid_dirs, &cbeta,
                 Un_Y, nGrid_dirs);
     for(i=0; i<nGrid_dirs; i++)
         pmap[i] = logScaleFlag ? logf(1.0f/(powf(cabsf(Un_Y[i]),2.0f) + 2.23e-9f)) : 1.0f/(powf(cabsf(Un_Y[i]),2.0f) + 2.23e-9f);
-    
-    free(V);
-    free(Vn);
-    free(Vn1);
-    free(Un);
-    free(Un_Y);
+}
+
+void generatePWDmap
+(
+    int order,
+    float_complex* Cx,
+    float_complex* Y_grid,
+    int nGrid_dirs,
+    float* pmap
+)
+{
+    void* hMap;
+
+    generateMap_create(&hMap, order, nGrid_dirs);
+    generatePWDmap_compute(hMap, order, Cx, Y_grid, nGrid_dirs, pmap);
+    generateMap_destroy(&hMap);
+}
+
+void generateMVDRmap
+(
+    int order,
+    float_complex* Cx,
+    float_complex* Y_grid,
+    int nGrid_dirs,
+    float regPar,
+    float* pmap,
+    float_complex* w_MVDR_out
+)
+{
+    void* hMap;
+
+    generateMap_create(&hMap, order, nGrid_dirs);
+    generateMVDRmap_compute(hMap, order, Cx, Y_grid, nGrid_dirs, regPar, pmap, w_MVDR_out);
+    generateMap_destroy(&hMap);
+}
+
+void generateCroPaCLCMVmap
+(
+    int order,
+    float_complex* Cx,
+    float_complex* Y_grid,
+    int nGrid_dirs,
+    float regPar,
+    float lambda,
+    float* pmap
+)
+{
+    void* hMap;
+
+    generateMap_create(&hMap, order, nGrid_dirs);
+    generateCroPaCLCMVmap_compute(hMap, order, Cx, Y_grid, nGrid_dirs, regPar, lambda, pmap);
+    generateMap_destroy(&hMap);
+}
+
+void generateMUSICmap
+(
+    int order,
+    float_complex* Cx,
+    float_complex* Y_grid,
+    int nSources,
+    int nGrid_dirs,
+    int logScaleFlag,
+    float* pmap
+)
+{
+    void* hMap;
+
+    generateMap_create(&hMap, order, nGrid_dirs);
+    generateMUSICmap_compute(hMap, order, Cx, Y_grid, nSources, nGrid_dirs, logScaleFlag, pmap);
+    generateMap_destroy(&hMap);
+}
+
+void generateMinNormMap
+(
+    int order,
+    float_complex* Cx,
+    float_complex* Y_grid,
+    int nSources,
+    int nGrid_dirs,
+    int logScaleFlag,
+    float* pmap
+)
+{
+    void* hMap;
+
+    generateMap_create(&hMap, order, nGrid_dirs);
+    generateMinNormMap_compute(hMap, order, Cx, Y_grid, nSources, nGrid_dirs, logScaleFlag, pmap);
+    generateMap_destroy(&hMap);
 }
 
 
@@ -153,10 +153,10 @@ void unnorm_legendreP_recur(/* Input Arguments */
  * unit sphere
  *
  * The spherical harmonic values are computed WITH the 1/sqrt(4*pi) term.
- * Compared to getSHreal_recur(), this function uses unnorm_legendreP() and
- * double precision, so is more suitable for being computed in an initialisation
- * stage. This version is indeed slower, but more precise (especially for high
- * orders).
+ * Compared to getSHreal_recur(), this function computes the recursion in
+ * double precision, so is more suitable for being computed in an
+ * initialisation stage. This version is slower, but more precise (especially
+ * for high orders). No memory is allocated for orders up to 31.
  *
  * @warning This function assumes [azi, inclination] convention! Note that one
  *          may convert from elevation, with: [azi, pi/2-elev].
@@ -185,13 +185,12 @@ void getSHreal(/* Input Arguments */
  * unit sphere
  *
  * The real spherical harmonics are computed WITH the 1/sqrt(4*pi) term.
- * Compared to getSHreal(), this function uses unnorm_legendreP_recur() and
- * single precision, so is more suitable for being computed in a real-time loop.
- * It sacrifices some precision, and numerical error propogates through the
- * recursion, but it is much faster.
+ * Compared to getSHreal(), this function computes the recursion in single
+ * precision, so is more suitable for being computed in a real-time loop. It
+ * sacrifices some precision, but it is faster.
  *
- * The function also uses static memory buffers for single direction and up to
- * 7th order, which speeds things up considerably for such use cases.
+ * No memory is allocated for orders up to 31, so the function may be called
+ * from real-time processing loops (for any number of directions).
  *
  * @warning This function assumes [azi, inclination] convention! Note that one
  *          may convert from elevation, with: [azi, pi/2-elev].
@@ -215,6 +214,79 @@ void getSHreal_recur(/* Input Arguments */
                      /* Output Arguments */
                      float* Y);
 
+/**
+ * Creates an instance of the real spherical harmonic evaluator
+ *
+ * The normalisation/recursion coefficients of the orthonormalised associated
+ * Legendre functions are precomputed for all orders up to "maxOrder". The
+ * recursion is then carried out for blocks of directions at once (with its
+ * inner loops running across the directions of a block), and the SHs are
+ * written directly into the caller's memory. Therefore, the evaluation does
+ * not allocate any memory and is vectorised, which makes it suitable for both
+ * real-time loops and for evaluating thousands of grid directions (at high
+ * orders) during initialisation.
+ *
+ * @test test__shEvaluator()
+ *
+ * @param[in] phSHE    (&) address of the SH evaluator handle
+ * @param[in] maxOrder Maximum order of spherical harmonic expansion
+ */
+void shEvaluator_create(void ** const phSHE,
+                        int maxOrder);
+
+/**
+ * Destroys an instance of the real spherical harmonic evaluator
+ *
+ * @param[in] phSHE (&) address of the SH evaluator handle
+ */
+void shEvaluator_destroy(void ** const phSHE);
+
+/**
+ * Computes real-valued spherical harmonics for each given direction on the
+ * unit sphere, in single precision (the same values as getSHreal_recur())
+ *
+ * @warning This function assumes [azi, inclination] convention! Note that one
+ *          may convert from elevation, with: [azi, pi/2-elev].
+ *
+ * @param[in]  hSHE     SH evaluator handle
+ * @param[in]  order    Order of spherical harmonic expansion (<=maxOrder)
+ * @param[in]  dirs_rad Directions on the sphere [azi, INCLINATION] convention,
+ *                      in RADIANS; FLAT: nDirs x 2
+ * @param[in]  nDirs    Number of directions
+ * @param[out] Y        The SH weights [WITH the 1/sqrt(4*pi)];
+ *                      FLAT: (order+1)^2 x nDirs
+ */
+void shEvaluator_getSHreal(/* Input Arguments */
+                           void* const hSHE,
+                           int order,
+                           const float* dirs_rad,
+                           int nDirs,
+                           /* Output Arguments */
+                           float* Y);
+
+/**
+ * Computes real-valued spherical harmonics for each given direction on the
+ * unit sphere, in double precision
+ *
+ * @warning This function assumes [azi, inclination] convention! Note that one
+ *          may convert from elevation, with: [azi, pi/2-elev].
+ *
+ * @param[in]  hSHE     SH evaluator handle
+ * @param[in]  order    Order of spherical harmonic expansion (<=maxOrder)
+ * @param[in]  dirs_rad Directions on the sphere [azi, INCLINATION] convention,
+ *                      in RADIANS; FLAT: nDirs x 2
+ * @param[in]  nDirs    Number of directions
+ * @param[out] Y        The SH weights [WITH the 1/sqrt(4*pi)];
+ *                      FLAT: (order+1)^2 x nDirs
+ */
+void shEvaluator_getSHreal_d(/* Input Arguments */
+                             void* const hSHE,
+                             int order,
+                             const double* dirs_rad,
+                             int nDirs,
+                             /* Output Arguments */
+                             double* Y);
+
 /**
  * Computes complex-valued spherical harmonics [1] for each given direction on
  * the unit sphere
@@ -327,6 +399,79 @@ void getSHrotMtxReal(float R[3][3],
                      float* RotMtx,
                      int L);
 
+/**
+ * Applies a real-valued spherical harmonic rotation matrix (as returned by
+ * getSHrotMtxReal()) to a set of SH signals, by exploiting its block-diagonal
+ * structure
+ *
+ * This is equivalent to:
+ * \code{.m}
+ *     outSig = RotMtx * inSig; % where inSig/outSig are: (L+1)^2 x nSamples
+ * \endcode
+ * However, since only one (2n+1)x(2n+1) block per order n is non-zero, the
+ * rotation is instead applied as (L+1) small matrix multiplications. For
+ * L=7, this involves only ~17% of the operations of the dense product.
+ *
+ * @note Any values outside of the diagonal blocks of RotMtx are ignored.
+ *       inSig and outSig must not overlap.
+ *
+ * @test test__applySHrotMtxReal()
+ *
+ * @param[in]  L        Order of spherical harmonic expansion
+ * @param[in]  RotMtx   SH domain rotation matrix; FLAT: (L+1)^2 x ldRot
+ * @param[in]  ldRot    Leading dimension of RotMtx (>= (L+1)^2)
+ * @param[in]  inSig    Input SH signals; FLAT: (L+1)^2 x ldIn
+ * @param[in]  ldIn     Leading dimension of inSig (>= nSamples)
+ * @param[in]  nSamples Number of samples/columns to rotate
+ * @param[in]  ldOut    Leading dimension of outSig (>= nSamples)
+ * @param[out] outSig   Rotated SH signals; FLAT: (L+1)^2 x ldOut
+ */
+void applySHrotMtxReal(/* Input Arguments */
+                       int L,
+                       const float* RotMtx,
+                       int ldRot,
+                       const float* inSig,
+                       int ldIn,
+                       int nSamples,
+                       int ldOut,
+                       /* Output Arguments */
+                       float* outSig);
+
+/**
+ * Bakes a real-valued spherical harmonic rotation matrix (as returned by
+ * getSHrotMtxReal()) into a complex-valued SH decoding matrix, by exploiting
+ * its block-diagonal structure
+ *
+ * This is equivalent to:
+ * \code{.m}
+ *     decMtx_rot = decMtx * RotMtx; % where decMtx/decMtx_rot: nRows x (L+1)^2
+ * \endcode
+ *
+ * @note Any values outside of the diagonal blocks of RotMtx are ignored.
+ *       decMtx and decMtx_rot must not overlap.
+ *
+ * @test test__applySHrotMtxReal()
+ *
+ * @param[in]  L          Order of spherical harmonic expansion
+ * @param[in]  RotMtx     SH domain rotation matrix; FLAT: (L+1)^2 x ldRot
+ * @param[in]  ldRot      Leading dimension of RotMtx (>= (L+1)^2)
+ * @param[in]  decMtx     Decoding matrix; FLAT: nRows x ldDec
+ * @param[in]  ldDec      Leading dimension of decMtx (>= (L+1)^2)
+ * @param[in]  nRows      Number of rows in the decoding matrix
+ * @param[in]  ldDecRot   Leading dimension of decMtx_rot (>= (L+1)^2)
+ * @param[out] decMtx_rot Rotated decoding matrix; FLAT: nRows x ldDecRot
+ */
+void applySHrotMtxRealToDecoder(/* Input Arguments */
+                                int L,
+                                const float* RotMtx,
+                                int ldRot,
+                                const float_complex* decMtx,
+                                int ldDec,
+                                int nRows,
+                                int ldDecRot,
+                                /* Output Arguments */
+                                float_complex* decMtx_rot);
+
 /**
  * Computes the matrices which generate the coefficients of a beampattern of
  * order (sectorOrder+1) that is essentially the product of a pattern of
@@ -959,6 +1104,173 @@ void generateMinNormMap(/* Input arguments */
                         /* Output arguments */
                         float* pmap);
 
+/**
+ * Creates an instance of the activity-map generators, which pre-allocates all
+ * of the memory required by the generate*map_compute() functions
+ *
+ * Unlike e.g. generatePWDmap(), the generate*map_compute() functions do not
+ * allocate any memory, and are therefore suitable for real-time use. The same
+ * handle may be used for all of the map types, any order up to "maxOrder", and
+ * any number of grid directions up to "maxNgrid_dirs".
+ *
+ * The decompositions of the covariance matrix (the inverse for MVDR/CroPaC,
+ * the eigenvectors for MUSIC/MinNorm) are kept in the handle. Passing Cx=NULL
+ * to the generate*map_compute() functions reuses them, along with the
+ * covariance matrix of the last call that provided one (of the same order),
+ * such that only the per-direction part is computed. This is intended for
+ * evaluating the same map for several subsets of the grid directions (e.g.
+ * with saf_gridSearch).
+ *
+ * @test test__generateMap()
+ *
+ * @param[in] phMap         (&) address of the activity-map generator handle
+ * @param[in] maxOrder      Maximum analysis order
+ * @param[in] maxNgrid_dirs Maximum number of grid directions
+ */
+void generateMap_create(void ** const phMap,
+                        int maxOrder,
+                        int maxNgrid_dirs);
+
+/**
+ * Destroys an instance of the activity-map generators
+ *
+ * @param[in] phMap (&) address of the activity-map generator handle
+ */
+void generateMap_destroy(void ** const phMap);
+
+/**
+ * Generates a powermap based on the energy of a plane-wave decomposition (PWD)
+ * (i.e. hyper-cardioid) beamformers; see generatePWDmap()
+ *
+ * @param[in]  hMap       Activity-map generator handle
+ * @param[in]  order      Analysis order
+ * @param[in]  Cx         Correlation/covariance matrix;
+ *                        FLAT: (order+1)^2 x (order+1)^2; or NULL to
+ *                        reuse that of the previous call
+ * @param[in]  Y_grid     Steering vectors for each grid direcionts;
+ *                        FLAT: (order+1)^2 x nGrid_dirs
+ * @param[in]  nGrid_dirs Number of grid directions
+ * @param[out] pmap       Resulting PWD powermap; nGrid_dirs x 1
+ */
+void generatePWDmap_compute(/* Input arguments */
+                            void* const hMap,
+                            int order,
+                            float_complex* Cx,
+                            float_complex* Y_grid,
+                            int nGrid_dirs,
+                            /* Output arguments */
+                            float* pmap);
+
+/**
+ * Generates a powermap based on the energy of adaptive Minimum-Variance
+ * Distortion-less Response (MVDR) beamformers; see generateMVDRmap()
+ *
+ * @param[in]  hMap       Activity-map generator handle
+ * @param[in]  order      Analysis order
+ * @param[in]  Cx         Correlation/covariance matrix;
+ *                        FLAT: (order+1)^2 x (order+1)^2; or NULL to
+ *                        reuse that of the previous call
+ * @param[in]  Y_grid     Steering vectors for each grid direcionts;
+ *                        FLAT: (order+1)^2 x nGrid_dirs
+ * @param[in]  nGrid_dirs Number of grid directions
+ * @param[in]  regPar     Regularisation parameter, for diagonal loading of Cx
+ * @param[out] pmap       Resulting MVDR powermap; nGrid_dirs x 1
+ * @param[out] w_MVDR     (Optional) weights will be copied to this, unless
+ *                        it's NULL; FLAT: nSH x nGrid_dirs || NULL
+ */
+void generateMVDRmap_compute(/* Input arguments */
+                             void* const hMap,
+                             int order,
+                             float_complex* Cx,
+                             float_complex* Y_grid,
+                             int nGrid_dirs,
+                             float regPar,
+                             /* Output arguments */
+                             float* pmap,
+                             float_complex* w_MVDR);
+
+/**
+ * (EXPERIMENTAL) Generates a powermap utilising the CroPaC LCMV post-filter;
+ * see generateCroPaCLCMVmap()
+ *
+ * @param[in]  hMap       Activity-map generator handle
+ * @param[in]  order      Analysis order
+ * @param[in]  Cx         Correlation/covariance matrix;
+ *                        FLAT: (order+1)^2 x (order+1)^2; or NULL to
+ *                        reuse that of the previous call
+ * @param[in]  Y_grid     Steering vectors for each grid direcionts;
+ *                        FLAT: (order+1)^2 x nGrid_dirs
+ * @param[in]  nGrid_dirs Number of grid directions
+ * @param[in]  regPar     Regularisation parameter, for diagonal loading of Cx
+ * @param[in]  lambda     Parameter controlling how harsh CroPaC is applied,
+ *                        0..1; 0: fully CroPaC, 1: fully MVDR
+ * @param[out] pmap       Resulting CroPaC LCMV powermap; nGrid_dirs x 1
+ */
+void generateCroPaCLCMVmap_compute(/* Input arguments */
+                                   void* const hMap,
+                                   int order,
+                                   float_complex* Cx,
+                                   float_complex* Y_grid,
+                                   int nGrid_dirs,
+                                   float regPar,
+                                   float lambda,
+                                   /* Output arguments */
+                                   float* pmap);
+
+/**
+ * Generates an activity-map based on the sub-space multiple-signal
+ * classification (MUSIC) method; see generateMUSICmap()
+ *
+ * @param[in]  hMap         Activity-map generator handle
+ * @param[in]  order        Analysis order
+ * @param[in]  Cx           Correlation/covariance matrix;
+ *                          FLAT: (order+1)^2 x (order+1)^2; or NULL to
+ *                          reuse that of the previous call
+ * @param[in]  Y_grid       Steering vectors for each grid direcionts;
+ *                          FLAT: (order+1)^2 x nGrid_dirs
+ * @param[in]  nSources     Number of sources present in sound scene
+ * @param[in]  nGrid_dirs   Number of grid directions
+ * @param[in]  logScaleFlag '1' log(pmap), '0' pmap.
+ * @param[out] pmap         Resulting MUSIC pseudo-spectrum; nGrid_dirs x 1
+ */
+void generateMUSICmap_compute(/* Input arguments */
+                              void* const hMap,
+                              int order,
+                              float_complex* Cx,
+                              float_complex* Y_grid,
+                              int nSources,
+                              int nGrid_dirs,
+                              int logScaleFlag,
+                              /* Output arguments */
+                              float* pmap);
+
+/**
+ * Generates an activity-map based on the sub-space minimum-norm (MinNorm)
+ * method; see generateMinNormMap()
+ *
+ * @param[in]  hMap         Activity-map generator handle
+ * @param[in]  order        Analysis order
+ * @param[in]  Cx           Correlation/covariance matrix;
+ *                          FLAT: (order+1)^2 x (order+1)^2; or NULL to
+ *                          reuse that of the previous call
+ * @param[in]  Y_grid       Steering vectors for each grid direcionts;
+ *                          FLAT: (order+1)^2 x nGrid_dirs
+ * @param[in]  nSources     Number of sources present in sound scene
+ * @param[in]  nGrid_dirs   Number of grid directions
+ * @param[in]  logScaleFlag '1' log(pmap), '0' pmap.
+ * @param[out] pmap         Resulting MinNorm pseudo-spectrum; nGrid_dirs x 1
+ */
+void generateMinNormMap_compute(/* Input arguments */
+                                void* const hMap,
+                                int order,
+                                float_complex* Cx,
+                                float_complex* Y_grid,
+                                int nSources,
+                                int nGrid_dirs,
+                                int logScaleFlag,
+                                /* Output arguments */
+                                float* pmap);
+
 
 /* ========================================================================== */
 /*              Microphone/Hydrophone array processing functions              */
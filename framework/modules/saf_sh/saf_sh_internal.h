@@ -46,6 +46,27 @@
 extern "C" {
 #endif /* __cplusplus */
 
+/** Number of directions that are evaluated at once by the real SH kernels */
+#define SAF_SH_EVAL_LANES ( 16 )
+/** Maximum order for which getSHreal()/getSHreal_recur() keep their recursion
+ *  coefficients on the stack (i.e. do not allocate any memory) */
+#define SAF_SH_EVAL_MAX_STACK_ORDER ( 31 )
+/** Maximum order for which getSHreal_recur() uses precomputed (single
+ *  precision) recursion coefficients */
+#define SAF_SH_EVAL_TABLE_ORDER ( 15 )
+/** Index of the (n,m) entry in the triangular recursion coefficient tables */
+#define SAF_SH_EVAL_TRI_IDX(n,m) ( (n)*((n)+1)/2 + (m) )
+
+/** Internal data structure for shEvaluator */
+typedef struct _shEvaluator_data {
+    int maxOrder;
+    double* a_d, *b_d;  /**< General recursion coefficients; FLAT: (maxOrder+1)(maxOrder+2)/2 x 1 */
+    double* d_d, *e_d;  /**< Diagonal and sub-diagonal recursion coefficients; (maxOrder+1) x 1 */
+    float* a_f, *b_f;   /**< Single precision copies of a_d, b_d */
+    float* d_f, *e_f;   /**< Single precision copies of d_d, e_d */
+
+}shEvaluator_data;
+
 /** Internal data structure for sphPWD */
 typedef struct _sphPWD_data {
     int order, nSH, nDirs;
@@ -95,6 +116,28 @@ typedef struct _sphESPRIT_data {
 
 }sphESPRIT_data;
 
+/** Internal data structure for the activity-map generators */
+typedef struct _generateMap_data {
+    int maxOrder, maxNSH, maxNgrid_dirs;
+    void* hCinv, *hCseig;
+    float_complex* Cx;        /**< Covariance matrix of the last call that provided one; FLAT: maxNSH x maxNSH */
+    int nSH_Cx;               /**< Dimension of Cx (0: none provided yet) */
+    int invCx_valid;          /**< 1: invCx is up to date with Cx and invCx_regPar, 0: must be recomputed */
+    float invCx_regPar;       /**< Regularisation parameter that was used for invCx */
+    int V_valid;              /**< 1: V is up to date with Cx, 0: must be recomputed */
+    float_complex* Cx_d;      /**< Diagonally loaded covariance matrix; FLAT: maxNSH x maxNSH */
+    float_complex* invCx;     /**< Inverse of Cx_d; FLAT: maxNSH x maxNSH */
+    float_complex* Cx_W;      /**< Cx * beamforming weights; FLAT: maxNSH x maxNgrid_dirs */
+    float_complex* W;         /**< Beamforming weights; FLAT: maxNSH x maxNgrid_dirs */
+    float_complex* B;         /**< Constraints; FLAT: maxNSH x 2*maxNgrid_dirs */
+    float_complex* invCx_B;   /**< Cx^-1 * constraints; FLAT: maxNSH x 2*maxNgrid_dirs */
+    float_complex* V;         /**< Eigenvectors; FLAT: maxNSH x maxNSH */
+    float_complex* Un;        /**< MinNorm vector; maxNSH x 1 */
+    float_complex* gridTmp;   /**< Per-direction accumulators; FLAT: 6 x maxNgrid_dirs */
+    float* gridTmp_r;         /**< Per-direction real values; maxNgrid_dirs x 1 */
+
+}generateMap_data;
+
 
 /* ========================================================================== */
 /*                          Misc. Internal Functions                          */
@@ -206,6 +206,12 @@
 /* Pitch shifting algorithms */
 #include "saf_utility_pitch.h"
 
+/* Multi-channel polyphase resampler */
+#include "saf_utility_resampler.h"
+
+/* A minimal pool of worker threads */
+#include "saf_utility_threads.h"
+
 /* A collection of signal decorrelators */
 #include "saf_utility_decor.h"
 
@@ -215,6 +221,12 @@
 /* For computational geometry functions */
 #include "saf_utility_geometry.h"
 
+/* Coarse-to-fine search over a spherical scanning grid */
+#include "saf_utility_gridSearch.h"
+
+/* Content-addressed, on-disk cache (e.g. for decoding matrices) */
+#include "saf_utility_cache.h"
+
 /* For an implementation of the hybrid complex quadrature mirror filterbank */
 #include "saf_utility_qmf.h"
 
@@ -0,0 +1,212 @@
+/*
+ * Copyright 2026 agent
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * @file saf_utility_cache.c
+ * @ingroup Utilities
+ * @brief A content-addressed, on-disk cache for (expensive to compute) data,
+ *        such as decoding matrices
+ *
+ * @author agent
+ * @date 16.10.2026
+ * @license ISC
+ */
+
+#include "saf_utilities.h"
+#if defined(_WIN32)
+# include <windows.h>
+# define saf_cache_getProcessID() ((unsigned long)GetCurrentProcessId())
+#else
+# include <unistd.h>
+# define saf_cache_getProcessID() ((unsigned long)getpid())
+#endif
+
+/** Version of the cache file format (bump if the layout changes) */
+#define SAF_CACHE_VERSION ( 1 )
+/** 64-bit FNV-1a offset basis */
+#define SAF_CACHE_FNV_OFFSET ( 14695981039346656037ULL )
+/** 64-bit FNV-1a prime */
+#define SAF_CACHE_FNV_PRIME ( 1099511628211ULL )
+
+/** File header of a cache entry */
+typedef struct _saf_cache_header {
+    char magic[4];                /**< "SAFC" */
+    unsigned int version;         /**< #SAF_CACHE_VERSION */
+    unsigned long long key;       /**< Cache key */
+    unsigned long long nBytes;    /**< Number of bytes of data */
+    unsigned long long checksum;  /**< Hash of the data */
+}saf_cache_header;
+
+/** Returns the file path of a cache entry (which must be freed) */
+static char* saf_cache_getFilePath(const char* cacheDir, const char* name, unsigned long long key)
+{
+    char* path;
+    size_t len;
+
+    len = strlen(cacheDir) + strlen(name) + 32;
+    path = malloc1d(len);
+    snprintf(path, len, "%s/%s_%016llx.safc", cacheDir, name, key);
+    return path;
+}
+
+unsigned long long saf_cache_initKey(void)
+{
+    return SAF_CACHE_FNV_OFFSET;
+}
+
+void saf_cache_hashData
+(
+    unsigned long long* key,
+    const void* data,
+    size_t nBytes
+)
+{
+    const unsigned char* bytes;
+    size_t i;
+
+    if(data==NULL)
+        return;
+    bytes = (const unsigned char*)data;
+    for(i=0; i<nBytes; i++){
+        (*key) ^= (unsigned long long)bytes[i];
+        (*key) *= SAF_CACHE_FNV_PRIME;
+    }
+}
+
+void saf_cache_hashInt
+(
+    unsigned long long* key,
+    int value
+)
+{
+    saf_cache_hashData(key, &value, sizeof(int));
+}
+
+int saf_cache_load
+(
+    const char* cacheDir,
+    const char* name,
+    unsigned long long key,
+    size_t nBytes,
+    void* data
+)
+{
+    FILE* file;
+    char* path;
+    saf_cache_header header;
+    unsigned long long checksum;
+    int success;
+
+    if(cacheDir==NULL || name==NULL)
+        return 0;
+    path = saf_cache_getFilePath(cacheDir, name, key);
+    file = fopen(path, "rb");
+    free(path);
+    if(file==NULL)
+        return 0; /* cache miss */
+
+    /* Validate the header, then read the data */
+    success = 0;
+    if(fread(&header, sizeof(saf_cache_header), 1, file)==1 &&
+       memcmp(header.magic, "SAFC", 4)==0 &&
+       header.version==SAF_CACHE_VERSION &&
+       header.key==key &&
+       header.nBytes==(unsigned long long)nBytes)
+    {
+        void* tmp = malloc1d(SAF_MAX(nBytes, 1));
+        if(fread(tmp, 1, nBytes, file)==nBytes){
+            checksum = saf_cache_initKey();
+            saf_cache_hashData(&checksum, tmp, nBytes);
+            if(checksum==header.checksum){
+                memcpy(data, tmp, nBytes);
+                success = 1;
+            }
+        }
+        free(tmp);
+    }
+    fclose(file);
+    return success;
+}
+
+int saf_cache_store
+(
+    const char* cacheDir,
+    const char* name,
+    unsigned long long key,
+    const void* data,
+    size_t nBytes
+)
+{
+    FILE* file;
+    char* path, *tmpPath;
+    size_t len;
+    saf_cache_header header;
+    int success;
+
+    if(cacheDir==NULL || name==NULL)
+        return 0;
+    memset(&header, 0, sizeof(saf_cache_header));
+    memcpy(header.magic, "SAFC", 4);
+    header.version = SAF_CACHE_VERSION;
+    header.key = key;
+    header.nBytes = (unsigned long long)nBytes;
+    header.checksum = saf_cache_initKey();
+    saf_cache_hashData(&(header.checksum), data, nBytes);
+
+    /* Write to a temporary file first. Note that, since the entries are content-addressed, any other instances that
+     * happen to be writing the same entry at the same time will also be writing the same bytes. The temporary file is
+     * named after the process ID (unique between processes) and the address of the header (unique between the threads
+     * of a process) */
+    path = saf_cache_getFilePath(cacheDir, name, key);
+    len = strlen(path) + 48;
+    tmpPath = malloc1d(len);
+    snprintf(tmpPath, len, "%s.%lx_%p.tmp", path, saf_cache_getProcessID(), (void*)&header);
+    success = 0;
+    file = fopen(tmpPath, "wb");
+    if(file!=NULL){
+        success = fwrite(&header, sizeof(saf_cache_header), 1, file)==1 &&
+                  fwrite(data, 1, nBytes, file)==nBytes;
+        success = fclose(file)==0 && success;
+        if(success && rename(tmpPath, path)!=0){
+            /* rename() does not overwrite existing files on all platforms */
+            remove(path);
+            success = rename(tmpPath, path)==0;
+        }
+        if(!success)
+            remove(tmpPath);
+    }
+    free(path);
+    free(tmpPath);
+    return success;
+}
+
+int saf_cache_remove
+(
+    const char* cacheDir,
+    const char* name,
+    unsigned long long key
+)
+{
+    char* path;
+    int success;
+
+    if(cacheDir==NULL || name==NULL)
+        return 0;
+    path = saf_cache_getFilePath(cacheDir, name, key);
+    success = remove(path)==0;
+    free(path);
+    return success;
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2026 agent
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ *@addtogroup Utilities
+ *@{
+ * @file saf_utility_cache.h
+ * @brief A content-addressed, on-disk cache for (expensive to compute) data,
+ *        such as decoding matrices
+ *
+ * Each entry is identified by a 64-bit key, which is a hash of all of the
+ * inputs that were used to compute the data. Entries are stored as compact
+ * binary files: "<cacheDir>/<name>_<key>.safc". Files are first written to a
+ * temporary file and then renamed, such that other instances never read a
+ * partially written entry.
+ *
+ * @author agent
+ * @date 16.10.2026
+ * @license ISC
+ */
+
+#ifndef SAF_CACHE_H_INCLUDED
+#define SAF_CACHE_H_INCLUDED
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* ========================================================================== */
+/*                            Content-addressed Cache                         */
+/* ========================================================================== */
+
+/**
+ * Returns the initial value of a cache key (64-bit FNV-1a offset basis)
+ */
+unsigned long long saf_cache_initKey(void);
+
+/**
+ * Hashes a block of data into a cache key (64-bit FNV-1a)
+ *
+ * @param[in,out] key    Cache key to update
+ * @param[in]     data   Data to hash (no-op if NULL)
+ * @param[in]     nBytes Number of bytes of data
+ */
+void saf_cache_hashData(/* Input Arguments */
+                        unsigned long long* key,
+                        const void* data,
+                        size_t nBytes);
+
+/**
+ * Hashes an integer into a cache key
+ *
+ * @param[in,out] key   Cache key to update
+ * @param[in]     value Value to hash
+ */
+void saf_cache_hashInt(/* Input Arguments */
+                       unsigned long long* key,
+                       int value);
+
+/**
+ * Loads an entry from the cache
+ *
+ * @param[in]  cacheDir Cache directory
+ * @param[in]  name     Name of the type of entry (e.g. "ambi_dec")
+ * @param[in]  key      Cache key
+ * @param[in]  nBytes   Expected number of bytes
+ * @param[out] data     Cached data (only written on success); nBytes x 1
+ * @returns 1 if the entry was found and is valid, 0 otherwise
+ */
+int saf_cache_load(/* Input Arguments */
+                   const char* cacheDir,
+                   const char* name,
+                   unsigned long long key,
+                   size_t nBytes,
+                   /* Output Arguments */
+                   void* data);
+
+/**
+ * Stores an entry in the cache (overwriting any existing entry with this key)
+ *
+ * @note The cache directory must already exist.
+ *
+ * @param[in] cacheDir Cache directory
+ * @param[in] name     Name of the type of entry (e.g. "ambi_dec")
+ * @param[in] key      Cache key
+ * @param[in] data     Data to store; nBytes x 1
+ * @param[in] nBytes   Number of bytes
+ * @returns 1 if the entry was stored, 0 otherwise
+ */
+int saf_cache_store(/* Input Arguments */
+                    const char* cacheDir,
+                    const char* name,
+                    unsigned long long key,
+                    const void* data,
+                    size_t nBytes);
+
+/**
+ * Removes an entry from the cache
+ *
+ * @param[in] cacheDir Cache directory
+ * @param[in] name     Name of the type of entry (e.g. "ambi_dec")
+ * @param[in] key      Cache key
+ * @returns 1 if the entry was removed, 0 otherwise
+ */
+int saf_cache_remove(/* Input Arguments */
+                     const char* cacheDir,
+                     const char* name,
+                     unsigned long long key);
+
+
+#ifdef __cplusplus
+}/* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* SAF_CACHE_H_INCLUDED */
+
+/**@} */ /* doxygen addtogroup Utilities */
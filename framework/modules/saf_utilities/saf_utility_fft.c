@@ -318,11 +318,11 @@ void saf_stft_create
     h->fftsize = 2*winsize;
     saf_rfft_create(&(h->hFFT), h->fftsize);
     h->insig_rect_win = calloc1d(h->fftsize, sizeof(float));
-    h->insig_win = calloc1d(h->fftsize, sizeof(float));
+    h->insig_win = calloc1d_aligned(h->fftsize, sizeof(float));
 
     /* Intermediate buffers */
-    h->tmp_fft = malloc1d(h->nBands * sizeof(float_complex));
-    h->outsig_win = malloc1d(h->fftsize*sizeof(float));
+    h->tmp_fft = malloc1d_aligned(h->nBands * sizeof(float_complex));
+    h->outsig_win = malloc1d_aligned(h->fftsize*sizeof(float));
     h->nPrevHops = winsize/hopsize-1;
     if (h->nPrevHops>0)
         h->prev_inhops = (float***)calloc3d(h->nPrevHops, nCHin, hopsize, sizeof(float));
@@ -354,8 +354,9 @@ void saf_stft_destroy
         free(h->window);
         free(h->overlapAddBuffer);
         free(h->insig_rect_win);
-        free(h->insig_win);
-        free(h->tmp_fft);
+        free_aligned(h->insig_win);
+        free_aligned(h->tmp_fft);
+        free_aligned(h->outsig_win);
         free(h->prev_inhops);
         free(h);
         h=NULL;
@@ -542,10 +543,10 @@ void saf_rfft_create
     saf_assert(N>=2 && ISEVEN(N), "Only even (non zero) FFT sizes are supported");
     h->useKissFFT_FLAG = 0;
 #if defined(SAF_USE_FFTW)
-    h->fwd_bufferTD = malloc1d(h->N*sizeof(float));
-    h->bwd_bufferTD = malloc1d(h->N*sizeof(float));
-    h->fwd_bufferFD = malloc1d((h->N/2+1)*sizeof(fftwf_complex));
-    h->bwd_bufferFD = malloc1d((h->N/2+1)*sizeof(fftwf_complex));
+    h->fwd_bufferTD = malloc1d_aligned(h->N*sizeof(float));
+    h->bwd_bufferTD = malloc1d_aligned(h->N*sizeof(float));
+    h->fwd_bufferFD = malloc1d_aligned((h->N/2+1)*sizeof(fftwf_complex));
+    h->bwd_bufferFD = malloc1d_aligned((h->N/2+1)*sizeof(fftwf_complex));
     h->p_fwd = fftwf_plan_dft_r2c_1d(h->N, h->fwd_bufferTD, h->fwd_bufferFD, FFTW_ESTIMATE);
     h->p_bwd = fftwf_plan_dft_c2r_1d(h->N, h->bwd_bufferFD, h->bwd_bufferTD, FFTW_ESTIMATE);
 #elif defined(SAF_USE_INTEL_IPP)
@@ -584,10 +585,10 @@ void saf_rfft_create
         /* Note that DFT lengths must satisfy: f * 2.^g, where f is 1, 3, 5, or 15, and g >=4 */
         saf_assert(h->DFT_fwd!=0 && h->DFT_bwd!=0, "Failed to create vDSP DFT");
 # ifndef SAF_USE_INTERLEAVED_VDSP
-        h->VDSP_split_tmp.realp = malloc1d((h->N/2)*sizeof(float));
-        h->VDSP_split_tmp.imagp = malloc1d((h->N/2)*sizeof(float));
-        h->VDSP_split.realp = malloc1d((h->N/2)*sizeof(float));
-        h->VDSP_split.imagp = malloc1d((h->N/2)*sizeof(float));
+        h->VDSP_split_tmp.realp = malloc1d_aligned((h->N/2)*sizeof(float));
+        h->VDSP_split_tmp.imagp = malloc1d_aligned((h->N/2)*sizeof(float));
+        h->VDSP_split.realp = malloc1d_aligned((h->N/2)*sizeof(float));
+        h->VDSP_split.imagp = malloc1d_aligned((h->N/2)*sizeof(float));
 # endif
     }
 #elif defined(SAF_USE_INTEL_MKL_LP64) || defined(SAF_USE_INTEL_MKL_ILP64)
@@ -621,10 +622,10 @@ void saf_rfft_destroy
     saf_rfft_data *h = (saf_rfft_data*)(*phFFT);
     if(h!=NULL){
 #if defined(SAF_USE_FFTW)
-        free(h->fwd_bufferTD);
-        free(h->bwd_bufferTD);
-        free(h->fwd_bufferFD);
-        free(h->bwd_bufferFD);
+        free_aligned(h->fwd_bufferTD);
+        free_aligned(h->bwd_bufferTD);
+        free_aligned(h->fwd_bufferFD);
+        free_aligned(h->bwd_bufferFD);
         fftwf_destroy_plan(h->p_bwd);
         fftwf_destroy_plan(h->p_fwd);
 #elif defined(SAF_USE_INTEL_IPP)
@@ -646,10 +647,10 @@ void saf_rfft_destroy
 # else
             vDSP_DFT_DestroySetup(h->DFT_fwd);
             vDSP_DFT_DestroySetup(h->DFT_bwd);
-            free(h->VDSP_split_tmp.realp);
-            free(h->VDSP_split_tmp.imagp);
-            free(h->VDSP_split.realp);
-            free(h->VDSP_split.imagp);
+            free_aligned(h->VDSP_split_tmp.realp);
+            free_aligned(h->VDSP_split_tmp.imagp);
+            free_aligned(h->VDSP_split.realp);
+            free_aligned(h->VDSP_split.imagp);
 # endif
         }
 #elif defined(SAF_USE_INTEL_MKL_LP64) || defined(SAF_USE_INTEL_MKL_ILP64)
@@ -771,10 +772,10 @@ void saf_fft_create
     saf_assert(N>=2, "Only even (non zero) FFT sizes are supported");
     h->useKissFFT_FLAG = 0;
 #if defined(SAF_USE_FFTW)
-    h->fwd_bufferTD = malloc1d(h->N*sizeof(fftwf_complex));
-    h->bwd_bufferTD = malloc1d(h->N*sizeof(fftwf_complex));
-    h->fwd_bufferFD = malloc1d(h->N*sizeof(fftwf_complex));
-    h->bwd_bufferFD = malloc1d(h->N*sizeof(fftwf_complex));
+    h->fwd_bufferTD = malloc1d_aligned(h->N*sizeof(fftwf_complex));
+    h->bwd_bufferTD = malloc1d_aligned(h->N*sizeof(fftwf_complex));
+    h->fwd_bufferFD = malloc1d_aligned(h->N*sizeof(fftwf_complex));
+    h->bwd_bufferFD = malloc1d_aligned(h->N*sizeof(fftwf_complex));
     h->p_fwd = fftwf_plan_dft_1d(h->N, h->fwd_bufferTD, h->fwd_bufferFD, FFTW_FORWARD,  FFTW_ESTIMATE);
     h->p_bwd = fftwf_plan_dft_1d(h->N, h->bwd_bufferFD, h->bwd_bufferTD, FFTW_BACKWARD, FFTW_ESTIMATE);
 #elif defined(SAF_USE_INTEL_IPP)
@@ -813,10 +814,10 @@ void saf_fft_create
         /* Note that DFT lengths must satisfy: f * 2.^g, where f is 1, 3, 5, or 15, and g >=3 */
         saf_assert(h->DFT_fwd!=0 && h->DFT_bwd!=0, "Failed to create vDSP DFT");
 # ifndef SAF_USE_INTERLEAVED_VDSP
-        h->VDSP_split_tmp.realp = malloc1d((h->N)*sizeof(float));
-        h->VDSP_split_tmp.imagp = malloc1d((h->N)*sizeof(float));
-        h->VDSP_split.realp = malloc1d((h->N)*sizeof(float));
-        h->VDSP_split.imagp = malloc1d((h->N)*sizeof(float));
+        h->VDSP_split_tmp.realp = malloc1d_aligned((h->N)*sizeof(float));
+        h->VDSP_split_tmp.imagp = malloc1d_aligned((h->N)*sizeof(float));
+        h->VDSP_split.realp = malloc1d_aligned((h->N)*sizeof(float));
+        h->VDSP_split.imagp = malloc1d_aligned((h->N)*sizeof(float));
 # endif
     }
 #elif defined(SAF_USE_INTEL_MKL_LP64) || defined(SAF_USE_INTEL_MKL_ILP64)
@@ -848,10 +849,10 @@ void saf_fft_destroy
     
     if(h!=NULL){
 #if defined(SAF_USE_FFTW)
-        free(h->fwd_bufferTD);
-        free(h->bwd_bufferTD);
-        free(h->fwd_bufferFD);
-        free(h->bwd_bufferFD);
+        free_aligned(h->fwd_bufferTD);
+        free_aligned(h->bwd_bufferTD);
+        free_aligned(h->fwd_bufferFD);
+        free_aligned(h->bwd_bufferFD);
         fftwf_destroy_plan(h->p_bwd);
         fftwf_destroy_plan(h->p_fwd);
 #elif defined(SAF_USE_INTEL_IPP)
@@ -873,10 +874,10 @@ void saf_fft_destroy
 # else
             vDSP_DFT_DestroySetup(h->DFT_fwd);
             vDSP_DFT_DestroySetup(h->DFT_bwd);
-            free(h->VDSP_split_tmp.realp);
-            free(h->VDSP_split_tmp.imagp);
-            free(h->VDSP_split.realp);
-            free(h->VDSP_split.imagp);
+            free_aligned(h->VDSP_split_tmp.realp);
+            free_aligned(h->VDSP_split_tmp.imagp);
+            free_aligned(h->VDSP_split.realp);
+            free_aligned(h->VDSP_split.imagp);
 # endif
         }
 #elif defined(SAF_USE_INTEL_MKL_LP64) || defined(SAF_USE_INTEL_MKL_ILP64)
@@ -210,6 +210,39 @@ void quaternion2euler
     }
 }
 
+void quaternionSlerp
+(
+    quaternion_data* Q1,
+    quaternion_data* Q2,
+    float t,
+    quaternion_data* Q
+)
+{
+    int i;
+    float cosTheta, sign, theta, sinTheta, w1, w2, norm;
+
+    cosTheta = Q1->w*Q2->w + Q1->x*Q2->x + Q1->y*Q2->y + Q1->z*Q2->z;
+    sign = cosTheta < 0.0f ? -1.0f : 1.0f; /* take the shortest path */
+    cosTheta = SAF_MIN(fabsf(cosTheta), 1.0f);
+
+    /* Revert to linear interpolation when the quaternions are (almost) the same */
+    if(cosTheta > 0.9995f){
+        w1 = 1.0f-t;
+        w2 = t;
+    }
+    else{
+        theta = acosf(cosTheta);
+        sinTheta = sinf(theta);
+        w1 = sinf((1.0f-t)*theta)/sinTheta;
+        w2 = sinf(t*theta)/sinTheta;
+    }
+    for(i=0; i<4; i++)
+        Q->Q[i] = w1*Q1->Q[i] + sign*w2*Q2->Q[i];
+    norm = sqrtf(Q->w*Q->w + Q->x*Q->x + Q->y*Q->y + Q->z*Q->z);
+    for(i=0; i<4; i++)
+        Q->Q[i] /= norm;
+}
+
 void euler2rotationMatrix
 (
     float alpha,
@@ -105,6 +105,23 @@ void quaternion2euler(/* Input Arguments */
                       float* beta,
                       float* gamma);
 
+/**
+ * Spherical linear interpolation (slerp) between two unit quaternions
+ *
+ * The shortest path is taken (i.e. Q2 is negated if the two quaternions lie in
+ * opposite hemispheres), and the result is re-normalised.
+ *
+ * @param[in]  Q1 Quaternion at t=0
+ * @param[in]  Q2 Quaternion at t=1
+ * @param[in]  t  Interpolation point [0..1]
+ * @param[out] Q  Interpolated quaternion
+ */
+void quaternionSlerp(/* Input Arguments */
+                     quaternion_data* Q1,
+                     quaternion_data* Q2,
+                     float t,
+                     /* Output Arguments */
+                     quaternion_data* Q);
 /**
  * Constructs a 3x3 rotation matrix from the Euler angles
  *
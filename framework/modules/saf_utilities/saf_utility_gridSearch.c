@@ -0,0 +1,357 @@
+/*
+ * Copyright 2026 agent
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * @file saf_utility_gridSearch.c
+ * @ingroup Utilities
+ * @brief A coarse-to-fine search over a spherical scanning grid
+ *
+ * @author agent
+ * @date 16.10.2026
+ * @license ISC
+ */
+
+#include "saf_utilities.h"
+#include "saf_externals.h"
+
+/** Coarse directions within this many covering radii are neighbours */
+#define SAF_GRIDSEARCH_NEIGHBOUR_RADIUS ( 2.2f )
+/** Number of coarse directions used to interpolate each grid direction */
+#define SAF_GRIDSEARCH_NUM_INTERP ( 3 )
+
+/**
+ * Main structure for the coarse-to-fine grid search
+ */
+typedef struct _saf_gridSearch_data
+{
+    /* parameters */
+    int nDirs;          /**< Number of grid directions */
+    int nCoarse;        /**< Number of coarse directions */
+    int nInterp;        /**< Number of coarse directions used for interpolation */
+
+    /* look-ups */
+    int* coarseInds;    /**< Grid indices of the coarse directions; nCoarse x 1 */
+    int* cellOffsets;   /**< Start of each coarse cell in cellInds; (nCoarse+1) x 1 */
+    int* cellInds;      /**< Grid directions, grouped by their nearest coarse direction; nDirs x 1 */
+    int* nbOffsets;     /**< Start of each neighbour list in nbInds; (nCoarse+1) x 1 */
+    int* nbInds;        /**< Neighbouring coarse directions of each coarse direction */
+    int* interpInds;    /**< Coarse directions used for interpolation; FLAT: nDirs x nInterp */
+    float* interpW;     /**< Interpolation weights; FLAT: nDirs x nInterp */
+
+    /* run-time */
+    float* coarseVals;  /**< Coarse map; nCoarse x 1 */
+    int* cands;         /**< Local maxima of the coarse map; nCoarse x 1 */
+    int* evaluated;     /**< 1: direction has been evaluated, 0: has not; nDirs x 1 */
+    int* evalInds;      /**< Directions to evaluate during refinement; nDirs x 1 */
+    float* evalVals;    /**< Map values of evalInds; nDirs x 1 */
+    float* fineVals;    /**< Exact map values (where evaluated); nDirs x 1 */
+    int nEvals;         /**< Number of evaluations during the last search */
+
+}saf_gridSearch_data;
+
+void saf_gridSearch_create
+(
+    void ** const phGS,
+    float* grid_dirs_deg,
+    int nDirs,
+    int nCoarseDirs
+)
+{
+    *phGS = malloc1d(sizeof(saf_gridSearch_data));
+    saf_gridSearch_data *h = (saf_gridSearch_data*)(*phGS);
+    int i, c, c2, k, next, nNb;
+    int* owner, *count;
+    float r, d, dmin, dots[SAF_GRIDSEARCH_NUM_INTERP], sumW;
+    float* xyz, *maxDot;
+
+    saf_assert(nDirs>0, "Invalid input arguments");
+    h->nDirs = nDirs;
+    h->nCoarse = SAF_CLAMP(nCoarseDirs, 1, nDirs);
+    h->nInterp = SAF_MIN(SAF_GRIDSEARCH_NUM_INTERP, h->nCoarse);
+    xyz = malloc1d(nDirs*3*sizeof(float));
+    unitSph2cart(grid_dirs_deg, nDirs, 1, xyz);
+
+    /* Pick the coarse directions by farthest-point sampling; also keeping track of the nearest coarse direction */
+    h->coarseInds = malloc1d(h->nCoarse*sizeof(int));
+    owner = malloc1d(nDirs*sizeof(int));
+    maxDot = malloc1d(nDirs*sizeof(float));
+    for(i=0; i<nDirs; i++)
+        maxDot[i] = -2.0f;
+    next = 0;
+    for(c=0; c<h->nCoarse; c++){
+        h->coarseInds[c] = next;
+        for(i=0; i<nDirs; i++){
+            d = xyz[i*3]*xyz[next*3] + xyz[i*3+1]*xyz[next*3+1] + xyz[i*3+2]*xyz[next*3+2];
+            if(d>maxDot[i]){
+                maxDot[i] = d;
+                owner[i] = c;
+            }
+        }
+        maxDot[next] = 2.0f; /* (so that it is never picked again) */
+        dmin = 2.0f;
+        for(i=0; i<nDirs; i++){
+            if(maxDot[i]<dmin){
+                dmin = maxDot[i];
+                next = i;
+            }
+        }
+    }
+
+    /* Covering radius (the largest angle between a grid direction and its nearest coarse direction) */
+    r = 0.0f;
+    for(i=0; i<nDirs; i++)
+        if(maxDot[i]<=1.0f)
+            r = SAF_MAX(r, acosf(SAF_CLAMP(maxDot[i], -1.0f, 1.0f)));
+
+    /* Group the grid directions into cells, one per coarse direction */
+    h->cellOffsets = calloc1d(h->nCoarse+1, sizeof(int));
+    h->cellInds = malloc1d(nDirs*sizeof(int));
+    count = calloc1d(h->nCoarse, sizeof(int));
+    for(i=0; i<nDirs; i++)
+        h->cellOffsets[owner[i]+1]++;
+    for(c=0; c<h->nCoarse; c++)
+        h->cellOffsets[c+1] += h->cellOffsets[c];
+    for(i=0; i<nDirs; i++)
+        h->cellInds[h->cellOffsets[owner[i]] + count[owner[i]]++] = i;
+
+    /* Neighbouring coarse directions (i.e. those whose cells may also contain the peak) */
+    h->nbOffsets = calloc1d(h->nCoarse+1, sizeof(int));
+    h->nbInds = NULL;
+    for(k=0; k<2; k++){ /* (first pass counts, second pass fills) */
+        nNb = 0;
+        for(c=0; c<h->nCoarse; c++){
+            for(c2=0; c2<h->nCoarse; c2++){
+                if(c2==c)
+                    continue;
+                i = h->coarseInds[c];
+                next = h->coarseInds[c2];
+                d = xyz[i*3]*xyz[next*3] + xyz[i*3+1]*xyz[next*3+1] + xyz[i*3+2]*xyz[next*3+2];
+                if(acosf(SAF_CLAMP(d, -1.0f, 1.0f)) <= SAF_GRIDSEARCH_NEIGHBOUR_RADIUS*r){
+                    if(k==1)
+                        h->nbInds[nNb] = c2;
+                    nNb++;
+                }
+            }
+            if(k==0)
+                h->nbOffsets[c+1] = nNb;
+        }
+        if(k==0)
+            h->nbInds = malloc1d(SAF_MAX(nNb,1)*sizeof(int));
+    }
+
+    /* Inverse-distance interpolation weights, from the nearest coarse directions */
+    h->interpInds = malloc1d(nDirs*(h->nInterp)*sizeof(int));
+    h->interpW = malloc1d(nDirs*(h->nInterp)*sizeof(float));
+    for(i=0; i<nDirs; i++){
+        for(k=0; k<h->nInterp; k++)
+            dots[k] = -2.0f;
+        for(c=0; c<h->nCoarse; c++){
+            next = h->coarseInds[c];
+            d = xyz[i*3]*xyz[next*3] + xyz[i*3+1]*xyz[next*3+1] + xyz[i*3+2]*xyz[next*3+2];
+            for(k=h->nInterp-1; k>=0 && d>dots[k]; k--){ /* insertion into the (descending) list */
+                if(k<h->nInterp-1){
+                    dots[k+1] = dots[k];
+                    h->interpInds[i*(h->nInterp)+k+1] = h->interpInds[i*(h->nInterp)+k];
+                }
+                dots[k] = d;
+                h->interpInds[i*(h->nInterp)+k] = c;
+            }
+        }
+        sumW = 0.0f;
+        for(k=0; k<h->nInterp; k++){
+            d = acosf(SAF_CLAMP(dots[k], -1.0f, 1.0f));
+            if(acosf(SAF_CLAMP(dots[0], -1.0f, 1.0f)) < 1e-5f) /* coincides with a coarse direction */
+                h->interpW[i*(h->nInterp)+k] = k==0 ? 1.0f : 0.0f;
+            else
+                h->interpW[i*(h->nInterp)+k] = 1.0f/d;
+            sumW += h->interpW[i*(h->nInterp)+k];
+        }
+        for(k=0; k<h->nInterp; k++)
+            h->interpW[i*(h->nInterp)+k] /= sumW;
+    }
+
+    /* Run-time buffers */
+    h->coarseVals = malloc1d(h->nCoarse*sizeof(float));
+    h->cands = malloc1d(h->nCoarse*sizeof(int));
+    h->evaluated = malloc1d(nDirs*sizeof(int));
+    h->evalInds = malloc1d(nDirs*sizeof(int));
+    h->evalVals = malloc1d(nDirs*sizeof(float));
+    h->fineVals = malloc1d(nDirs*sizeof(float));
+    h->nEvals = 0;
+
+    /* clean-up */
+    free(xyz);
+    free(owner);
+    free(maxDot);
+    free(count);
+}
+
+void saf_gridSearch_destroy
+(
+    void ** const phGS
+)
+{
+    saf_gridSearch_data *h = (saf_gridSearch_data*)(*phGS);
+
+    if(h!=NULL){
+        free(h->coarseInds);
+        free(h->cellOffsets);
+        free(h->cellInds);
+        free(h->nbOffsets);
+        free(h->nbInds);
+        free(h->interpInds);
+        free(h->interpW);
+        free(h->coarseVals);
+        free(h->cands);
+        free(h->evaluated);
+        free(h->evalInds);
+        free(h->evalVals);
+        free(h->fineVals);
+        free(h);
+        h = NULL;
+        *phGS = NULL;
+    }
+}
+
+int saf_gridSearch_getNumEvaluations
+(
+    void * const hGS
+)
+{
+    saf_gridSearch_data *h = (saf_gridSearch_data*)(hGS);
+    return h->nEvals;
+}
+
+int saf_gridSearch_apply
+(
+    void * const hGS,
+    saf_gridSearch_evalFcn evalFcn,
+    void* userData,
+    int nPeaks,
+    float* map,
+    int* peak_inds
+)
+{
+    saf_gridSearch_data *h = (saf_gridSearch_data*)(hGS);
+    int i, j, k, c, cc, nb, nCands, nEval, best, nFound, isMax, tmp;
+
+    saf_assert(nPeaks>=1 && nPeaks<=h->nDirs, "Invalid input arguments");
+
+    /* Coarse map */
+    evalFcn(userData, h->coarseInds, h->nCoarse, h->coarseVals);
+    memset(h->evaluated, 0, h->nDirs*sizeof(int));
+    for(c=0; c<h->nCoarse; c++){
+        h->fineVals[h->coarseInds[c]] = h->coarseVals[c];
+        h->evaluated[h->coarseInds[c]] = 1;
+    }
+
+    /* Local maxima of the coarse map (ties are given to the lower index) */
+    nCands = 0;
+    for(c=0; c<h->nCoarse; c++){
+        isMax = 1;
+        for(j=h->nbOffsets[c]; j<h->nbOffsets[c+1] && isMax; j++){
+            nb = h->nbInds[j];
+            if(h->coarseVals[nb] > h->coarseVals[c] || (h->coarseVals[nb] == h->coarseVals[c] && nb < c))
+                isMax = 0;
+        }
+        if(isMax)
+            h->cands[nCands++] = c;
+    }
+
+    /* Keep the nPeaks highest (partial selection sort, since nPeaks is typically small) */
+    for(k=0; k<SAF_MIN(nCands, nPeaks); k++){
+        best = k;
+        for(j=k+1; j<nCands; j++)
+            if(h->coarseVals[h->cands[j]] > h->coarseVals[h->cands[best]])
+                best = j;
+        tmp = h->cands[k];
+        h->cands[k] = h->cands[best];
+        h->cands[best] = tmp;
+    }
+    nCands = SAF_MIN(nCands, nPeaks);
+
+    /* Evaluate the remaining directions within the cells of each candidate and its neighbours */
+    nEval = 0;
+    for(k=0; k<nCands; k++){
+        c = h->cands[k];
+        for(j=h->nbOffsets[c]-1; j<h->nbOffsets[c+1]; j++){
+            cc = j<h->nbOffsets[c] ? c : h->nbInds[j];
+            for(i=h->cellOffsets[cc]; i<h->cellOffsets[cc+1]; i++){
+                if(!h->evaluated[h->cellInds[i]]){
+                    h->evaluated[h->cellInds[i]] = 1;
+                    h->evalInds[nEval++] = h->cellInds[i];
+                }
+            }
+        }
+    }
+    if(nEval>0)
+        evalFcn(userData, h->evalInds, nEval, h->evalVals);
+    for(i=0; i<nEval; i++)
+        h->fineVals[h->evalInds[i]] = h->evalVals[i];
+    h->nEvals = h->nCoarse + nEval;
+
+    /* The peak of each candidate's region (skipping any found already, since the regions may overlap) */
+    nFound = 0;
+    for(k=0; k<nCands; k++){
+        c = h->cands[k];
+        best = h->coarseInds[c];
+        for(j=h->nbOffsets[c]-1; j<h->nbOffsets[c+1]; j++){
+            cc = j<h->nbOffsets[c] ? c : h->nbInds[j];
+            for(i=h->cellOffsets[cc]; i<h->cellOffsets[cc+1]; i++)
+                if(h->fineVals[h->cellInds[i]] > h->fineVals[best])
+                    best = h->cellInds[i];
+        }
+        for(j=0; j<nFound; j++)
+            if(h->cands[j]==best)
+                break;
+        if(j==nFound)
+            h->cands[nFound++] = best; /* (re-using cands, since cands[k] is no longer needed for k>=nFound) */
+    }
+    if(peak_inds!=NULL){
+        memcpy(peak_inds, h->cands, nFound*sizeof(int));
+
+        /* If there are fewer local maxima than peaks wanted, then fall back to the highest map values not already picked
+         * (as with iterative peak-picking over the full map; directions that were not evaluated are only used as a last resort) */
+        for(k=nFound; k<nPeaks; k++){
+            best = -1;
+            for(i=0; i<h->nDirs; i++){
+                for(j=0; j<k; j++)
+                    if(peak_inds[j]==i)
+                        break;
+                if(j<k)
+                    continue;
+                if(best==-1 || (h->evaluated[i] && (!h->evaluated[best] || h->fineVals[i] > h->fineVals[best])))
+                    best = i;
+            }
+            peak_inds[k] = best;
+        }
+    }
+
+    /* Full map; exact where evaluated, interpolated from the coarse map elsewhere */
+    if(map!=NULL){
+        for(i=0; i<h->nDirs; i++){
+            if(h->evaluated[i])
+                map[i] = h->fineVals[i];
+            else{
+                map[i] = 0.0f;
+                for(k=0; k<h->nInterp; k++)
+                    map[i] += h->interpW[i*(h->nInterp)+k] * h->coarseVals[h->interpInds[i*(h->nInterp)+k]];
+            }
+        }
+    }
+
+    return nFound;
+}
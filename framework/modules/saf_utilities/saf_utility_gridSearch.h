@@ -0,0 +1,130 @@
+/*
+ * Copyright 2026 agent
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ *@addtogroup Utilities
+ *@{
+ * @file saf_utility_gridSearch.h
+ * @brief A coarse-to-fine search over a spherical scanning grid
+ *
+ * @author agent
+ * @date 16.10.2026
+ * @license ISC
+ */
+
+#ifndef SAF_GRIDSEARCH_H_INCLUDED
+#define SAF_GRIDSEARCH_H_INCLUDED
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* ========================================================================== */
+/*                           Coarse-to-fine Grid Search                       */
+/* ========================================================================== */
+
+/**
+ * Callback which evaluates a map (e.g. a power-map or pseudo-spectrum) for a
+ * subset of the scanning grid directions
+ *
+ * @param[in]  userData User data, as passed to saf_gridSearch_apply()
+ * @param[in]  inds     Indices of the grid directions to evaluate; nInds x 1
+ * @param[in]  nInds    Number of grid directions to evaluate
+ * @param[out] vals     Map values for the requested directions; nInds x 1
+ */
+typedef void (*saf_gridSearch_evalFcn)(void* userData,
+                                       const int* inds,
+                                       int nInds,
+                                       float* vals);
+
+/**
+ * Creates an instance of the coarse-to-fine grid search
+ *
+ * Rather than evaluating a map for all of the grid directions, the map is
+ * first evaluated for a coarse, approximately uniform, subset of them (chosen
+ * via farthest-point sampling). The local maxima of this coarse map are then
+ * refined, by evaluating all of the grid directions in their vicinity.
+ * All of the neighbour look-ups and interpolation weights are computed here,
+ * such that saf_gridSearch_apply() does not allocate any memory.
+ *
+ * @test test__saf_gridSearch()
+ *
+ * @param[in] phGS          (&) address of grid search handle
+ * @param[in] grid_dirs_deg Scanning grid directions, in degrees; FLAT: nDirs x 2
+ * @param[in] nDirs         Number of scanning grid directions
+ * @param[in] nCoarseDirs   Number of coarse grid directions (<nDirs)
+ */
+void saf_gridSearch_create(/* Input Arguments */
+                           void ** const phGS,
+                           float* grid_dirs_deg,
+                           int nDirs,
+                           int nCoarseDirs);
+
+/**
+ * Destroys an instance of the coarse-to-fine grid search
+ *
+ * @param[in] phGS (&) address of grid search handle
+ */
+void saf_gridSearch_destroy(/* Input Arguments */
+                            void ** const phGS);
+
+/**
+ * Returns the number of directions that were evaluated during the last
+ * saf_gridSearch_apply() call
+ *
+ * @param[in] hGS grid search handle
+ * @returns number of map evaluations
+ */
+int saf_gridSearch_getNumEvaluations(/* Input Arguments */
+                                     void * const hGS);
+
+/**
+ * Searches for the nPeaks highest peaks in a map, evaluating it coarse-to-fine
+ *
+ * @note If map is not NULL, then the map values for the directions which were
+ *       not evaluated are interpolated from the coarse map. The values in the
+ *       vicinity of the peaks are exact.
+ * @note If the map has fewer than nPeaks local maxima, then the remaining
+ *       entries of peak_inds are the highest (evaluated) map values which
+ *       were not already picked.
+ *
+ * @param[in]  hGS       grid search handle
+ * @param[in]  evalFcn   Callback which evaluates the map
+ * @param[in]  userData  User data passed to evalFcn
+ * @param[in]  nPeaks    Number of peaks to find
+ * @param[out] map       Map for all grid directions (set to NULL if not
+ *                       wanted); nDirs x 1
+ * @param[out] peak_inds Grid indices of the highest peaks, in descending
+ *                       order (set to NULL if not wanted); nPeaks x 1
+ * @returns the number of local maxima found (<=nPeaks)
+ */
+int saf_gridSearch_apply(/* Input Arguments */
+                         void * const hGS,
+                         saf_gridSearch_evalFcn evalFcn,
+                         void* userData,
+                         int nPeaks,
+                         /* Output Arguments */
+                         float* map,
+                         int* peak_inds);
+
+
+#ifdef __cplusplus
+}/* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* SAF_GRIDSEARCH_H_INCLUDED */
+
+/**@} */ /* doxygen addtogroup Utilities */
@@ -35,13 +35,13 @@
  * Data structure for the matrix convolver.
  */
 typedef struct _safMatConv_data {
-    int hopSize, fftSize, nBins;
+    int hopSize, fftSize, nBins, nBinsPad;
     int length_h, nCHin, nCHout;
     int numFilterBlocks, numOvrlpAddBlocks;
     int usePartFLAG;
     void* hFFT;
-    float* x_pad, *y_pad, *hx_n, *z_n, *ovrlpAddBuffer, *y_n_overlap;
-    float_complex* H_f, *X_n, *HX_n;
+    float* x_pad, *y_pad, *z_n, *ovrlpAddBuffer, *y_n_overlap;
+    float_complex* H_f, *X_n, *Z_n;
     float_complex** Hpart_f;
     
 }safMatConv_data;
@@ -74,22 +74,22 @@ void  saf_matrixConv_create
         //h->numOvrlpAddBlocks = nextpow2((int)(ceilf((float)(hopSize+length_h-1)/(float)hopSize)+0.1f));
         h->fftSize = (h->numOvrlpAddBlocks)*hopSize;
         h->nBins = h->fftSize/2 + 1;
+        h->nBinsPad = (int)aligned_dim((size_t)h->nBins, sizeof(float_complex)); /* each spectrum starts on a 64-byte boundary */
         
         /* Allocate memory for buffers and perform fft on H */
         h->ovrlpAddBuffer = calloc1d(nCHout*(h->fftSize), sizeof(float));
         h->x_pad = calloc1d((h->nCHin)*(h->fftSize), sizeof(float)); // CALLOC
         h->y_pad = malloc1d((h->nCHout)*(h->fftSize)*sizeof(float));
-        h->hx_n = malloc1d((h->fftSize) * sizeof(float));
-        h->H_f = malloc1d((h->nCHout)*(h->nCHin)*(h->nBins)*sizeof(float_complex));
-        h->X_n = malloc1d((h->nCHout)*(h->nCHin)*(h->nBins)*sizeof(float_complex));
-        h->HX_n = malloc1d((h->nCHout)*(h->nCHin)*(h->nBins)*sizeof(float_complex));
+        h->H_f = calloc1d_aligned((h->nCHout)*(h->nCHin)*(h->nBinsPad), sizeof(float_complex));
+        h->X_n = calloc1d_aligned((h->nCHin)*(h->nBinsPad), sizeof(float_complex));
+        h->Z_n = calloc1d_aligned(h->nBinsPad, sizeof(float_complex));
         h->z_n = malloc1d((h->fftSize) * sizeof(float));
         saf_rfft_create(&(h->hFFT), h->fftSize);
         h_pad = calloc1d(h->fftSize, sizeof(float));
         for(no=0; no<nCHout; no++){
             for(ni=0; ni<nCHin; ni++){
                 memcpy(h_pad, &(H[no*nCHin*length_h+ni*length_h]), length_h*sizeof(float));
-                saf_rfft_forward(h->hFFT, h_pad, &(h->H_f[no*nCHin*(h->nBins)+ni*(h->nBins)]));
+                saf_rfft_forward(h->hFFT, h_pad, &(h->H_f[no*nCHin*(h->nBinsPad)+ni*(h->nBinsPad)]));
             }
         }
         free(h_pad);
@@ -99,6 +99,7 @@ void  saf_matrixConv_create
         h->length_h = length_h;
         h->fftSize = 2*(h->hopSize);
         h->nBins = hopSize+1;
+        h->nBinsPad = (int)aligned_dim((size_t)h->nBins, sizeof(float_complex)); /* each spectrum starts on a 64-byte boundary */
         h->numFilterBlocks = (int)ceilf((float)length_h/(float)hopSize); /* number of partitions */
         saf_assert(h->numFilterBlocks>=1, "Number of filter blocks/partitions must be at least 1");
         
@@ -106,20 +107,19 @@ void  saf_matrixConv_create
         h_pad = calloc1d(h->numFilterBlocks * hopSize, sizeof(float));
         h_pad_2hops = calloc1d(2 * hopSize, sizeof(float));
         h->Hpart_f = malloc1d(nCHout*sizeof(float_complex*));
-        h->X_n = calloc1d(h->numFilterBlocks * nCHin * (h->nBins), sizeof(float_complex));
-        h->HX_n = malloc1d(h->numFilterBlocks * nCHin * (h->nBins) * sizeof(float_complex));
+        h->X_n = calloc1d_aligned(h->numFilterBlocks * nCHin * (h->nBinsPad), sizeof(float_complex));
+        h->Z_n = calloc1d_aligned(h->nBinsPad, sizeof(float_complex));
         h->x_pad = calloc1d(2 * hopSize, sizeof(float));
-        h->hx_n = malloc1d(h->numFilterBlocks*nCHin*(h->fftSize)*sizeof(float));
         h->y_n_overlap = calloc1d(nCHout*hopSize, sizeof(float));
         h->z_n = malloc1d((h->fftSize) * sizeof(float));
         saf_rfft_create(&(h->hFFT), h->fftSize);
         for(no=0; no<nCHout; no++){
-            h->Hpart_f[no] = malloc1d(h->numFilterBlocks*nCHin*(h->nBins)*sizeof(float_complex));
+            h->Hpart_f[no] = calloc1d_aligned(h->numFilterBlocks*nCHin*(h->nBinsPad), sizeof(float_complex));
             for(ni=0; ni<nCHin; ni++){
                 memcpy(h_pad, &H[no*nCHin*length_h+ni*length_h], length_h*sizeof(float)); /* zero pad filter, to be multiple of hopsize */
                 for (nb=0; nb<h->numFilterBlocks; nb++){
                     memcpy(h_pad_2hops, &(h_pad[nb*hopSize]), hopSize*sizeof(float));
-                    saf_rfft_forward(h->hFFT, h_pad_2hops, &(h->Hpart_f[no][nb*nCHin*(h->nBins)+ni*(h->nBins)]));
+                    saf_rfft_forward(h->hFFT, h_pad_2hops, &(h->Hpart_f[no][nb*nCHin*(h->nBinsPad)+ni*(h->nBinsPad)]));
                 }
             }
         }
@@ -139,20 +139,19 @@ void saf_matrixConv_destroy
     
     if(h!=NULL){
         saf_rfft_destroy(&(h->hFFT));
-        free(h->X_n);
+        free_aligned(h->X_n);
         free(h->x_pad);
         free(h->z_n);
-        free(h->hx_n);
-        free(h->HX_n);
+        free_aligned(h->Z_n);
         if(!h->usePartFLAG){
             free(h->ovrlpAddBuffer);
             free(h->y_pad);
-            free(h->H_f);
+            free_aligned(h->H_f);
         }
         else{
             free(h->y_n_overlap);
             for(no=0; no<h->nCHout; no++)
-                free(h->Hpart_f[no]);
+                free_aligned(h->Hpart_f[no]);
             free(h->Hpart_f);
         }
         free(h);
@@ -168,31 +167,22 @@ void saf_matrixConv_apply
 )
 {
     safMatConv_data *h = (safMatConv_data*)(hMC);
-    int ni, no, nb;
+    int ni, no;
     
     /* apply non-partitioned convolution */
     if(!h->usePartFLAG){
         /* zero-pad input signals and perform fft */
         for(ni=0; ni<h->nCHin; ni++){
             cblas_scopy(h->hopSize, &inputSig[ni*(h->hopSize)], 1, &(h->x_pad[ni*(h->fftSize)]), 1);
-            saf_rfft_forward(h->hFFT, &(h->x_pad[ni*(h->fftSize)]), &(h->X_n[ni*(h->nBins)]));
+            saf_rfft_forward(h->hFFT, &(h->x_pad[ni*(h->fftSize)]), &(h->X_n[ni*(h->nBinsPad)]));
         }
 
-        /* Replicate for all outputs */
-        for(no=1; no<h->nCHout; no++)
-            cblas_ccopy(h->nCHin*(h->nBins), h->X_n, 1, &(h->X_n[no*ni*(h->nBins)]), 1);
-
-        /* Multiply spectra together */
-        utility_cvvmul(h->H_f, h->X_n, (h->nCHout)*(h->nCHin)*h->nBins, h->HX_n);
-
         /* Loop over outputs */
         for(no=0; no<h->nCHout; no++){
-            /* ifft and sum */
-            memset(h->z_n, 0, (h->fftSize) * sizeof(float));
-            for(ni=0; ni<h->nCHin; ni++){
-                saf_rfft_backward(h->hFFT, &(h->HX_n[no*(h->nCHin)*(h->nBins)+ni*(h->nBins)]), h->hx_n);
-                cblas_saxpy(h->fftSize, 1.0f, h->hx_n, 1, h->z_n, 1);
-            }
+            /* Multiply spectra together and sum over the inputs (the ifft is linear, so only one is needed) */
+            memset(h->Z_n, 0, (h->nBins) * sizeof(float_complex));
+            utility_cvvmuladd_batch(&(h->H_f[no*(h->nCHin)*(h->nBinsPad)]), h->nBinsPad, h->X_n, h->nBinsPad, h->nBins, h->nCHin, h->Z_n);
+            saf_rfft_backward(h->hFFT, h->Z_n, h->z_n);
 
             /* shuffle the over-lap add buffer */
             memmove(&(h->ovrlpAddBuffer[no*(h->fftSize)]), &(h->ovrlpAddBuffer[no*(h->fftSize)+(h->hopSize)]), (h->numOvrlpAddBlocks-1)*(h->hopSize)*sizeof(float));
@@ -208,23 +198,18 @@ void saf_matrixConv_apply
     /* apply partitioned convolution */
     else{
         /* zero-pad input signals and perform fft. Store in partition slot 1. */
-        memmove(&(h->X_n[1*(h->nCHin)*(h->nBins)]), h->X_n, (h->numFilterBlocks-1)*(h->nCHin)*(h->nBins)*sizeof(float_complex)); /* shuffle */
+        memmove(&(h->X_n[1*(h->nCHin)*(h->nBinsPad)]), h->X_n, (h->numFilterBlocks-1)*(h->nCHin)*(h->nBinsPad)*sizeof(float_complex)); /* shuffle */
         for(ni=0; ni<h->nCHin; ni++){ 
             cblas_scopy(h->hopSize, &(inputSig[ni*(h->hopSize)]), 1, h->x_pad, 1);
-            saf_rfft_forward(h->hFFT, h->x_pad, &(h->X_n[0*(h->nCHin)*(h->nBins)+ni*(h->nBins)]));
+            saf_rfft_forward(h->hFFT, h->x_pad, &(h->X_n[0*(h->nCHin)*(h->nBinsPad)+ni*(h->nBinsPad)]));
         }
         
         /* apply convolution and inverse fft */
         for(no=0; no<h->nCHout; no++){
-            utility_cvvmul(h->Hpart_f[no], h->X_n, h->numFilterBlocks * (h->nCHin) * (h->nBins), h->HX_n); /* This is the bulk of the CPU work */
-            for(nb=0; nb<h->numFilterBlocks; nb++)
-                for(ni=0; ni<h->nCHin; ni++)
-                    saf_rfft_backward(h->hFFT, &(h->HX_n[nb*(h->nCHin)*(h->nBins)+ni*(h->nBins)]), &(h->hx_n[nb*(h->nCHin)*(h->fftSize)+ni*(h->fftSize)]));
-            
             /* output frame for this channel is the sum over all partitions and input channels */
-            memset(h->z_n, 0, (h->fftSize) * sizeof(float));
-            for(nb=0; nb<h->numFilterBlocks*(h->nCHin); nb++)
-                cblas_saxpy(h->fftSize, 1.0f, &(h->hx_n[nb*(h->fftSize)]), 1, h->z_n, 1);
+            memset(h->Z_n, 0, (h->nBins) * sizeof(float_complex));
+            utility_cvvmuladd_batch(h->Hpart_f[no], h->nBinsPad, h->X_n, h->nBinsPad, h->nBins, h->numFilterBlocks * (h->nCHin), h->Z_n); /* This is the bulk of the CPU work */
+            saf_rfft_backward(h->hFFT, h->Z_n, h->z_n);
 
             /* sum with overlap buffer and copy the result to the output buffer */
             utility_svvadd(h->z_n, (const float*)&(h->y_n_overlap[no*(h->hopSize)]), h->hopSize, &(outputSig[no*(h->hopSize)]));
@@ -244,13 +229,13 @@ void saf_matrixConv_apply
  * Data structure for the multi-channel convolver.
  */
 typedef struct _safMulConv_data {
-    int hopSize, fftSize, nBins;
+    int hopSize, fftSize, nBins, nBinsPad;
     int length_h, nCH;
     int numOvrlpAddBlocks, numFilterBlocks;
     int usePartFLAG;
     void* hFFT;
-    float* x_pad, *z_n, *ovrlpAddBuffer, *hx_n, *y_n_overlap;
-    float_complex* X_n, *HX_n, *Z_n, *H_f, *Hpart_f;
+    float* x_pad, *z_n, *ovrlpAddBuffer, *y_n_overlap;
+    float_complex* X_n, *Z_n, *H_f, *Hpart_f;
     
 }safMulConv_data;
 
@@ -279,19 +264,20 @@ void saf_multiConv_create
         h->numOvrlpAddBlocks = (int)(ceilf((float)(hopSize+length_h-1)/(float)hopSize)+0.1f);
         h->fftSize = (h->numOvrlpAddBlocks*hopSize);
         h->nBins = h->fftSize/2 + 1;
+        h->nBinsPad = (int)aligned_dim((size_t)h->nBins, sizeof(float_complex)); /* each spectrum starts on a 64-byte boundary */
         
         /* Allocate memory for buffers and perform fft on partitioned H */
         h->ovrlpAddBuffer = calloc1d(nCH*h->fftSize, sizeof(float));
         h_pad = calloc1d(h->fftSize, sizeof(float));
-        h->H_f = malloc1d(nCH*(h->nBins)*sizeof(float_complex));
-        h->X_n = calloc1d(nCH * (h->nBins), sizeof(float_complex));
-        h->Z_n = malloc1d(nCH * (h->nBins) * sizeof(float_complex));
+        h->H_f = calloc1d_aligned(nCH*(h->nBinsPad), sizeof(float_complex));
+        h->X_n = calloc1d_aligned(nCH * (h->nBinsPad), sizeof(float_complex));
+        h->Z_n = calloc1d_aligned(nCH * (h->nBinsPad), sizeof(float_complex));
         h->x_pad = calloc1d(h->fftSize, sizeof(float));
         h->z_n = malloc1d(nCH*(h->fftSize)*sizeof(float));
         saf_rfft_create(&(h->hFFT), h->fftSize);
         for(nc=0; nc<nCH; nc++){
             memcpy(h_pad, &H[nc*length_h], length_h*sizeof(float)); /* zero pad filter, to be multiple of hopsize */
-            saf_rfft_forward(h->hFFT, h_pad, &(h->H_f[nc*(h->nBins)]));
+            saf_rfft_forward(h->hFFT, h_pad, &(h->H_f[nc*(h->nBinsPad)]));
         }
         
         free(h_pad);
@@ -300,17 +286,17 @@ void saf_multiConv_create
         /* intialise partitioned convolution mode */
         h->fftSize = 2*(h->hopSize);
         h->nBins = hopSize+1;
+        h->nBinsPad = (int)aligned_dim((size_t)h->nBins, sizeof(float_complex)); /* each spectrum starts on a 64-byte boundary */
         h->numFilterBlocks = (int)ceilf((float)length_h/(float)hopSize); /* number of partitions */
         saf_assert(h->numFilterBlocks>=1, "Number of filter blocks/partitions must be at least 1");
         
         /* Allocate memory for buffers and perform fft on partitioned H */
         h_pad = calloc1d(h->numFilterBlocks * hopSize, sizeof(float));
         h_pad_2hops = calloc1d(2 * hopSize, sizeof(float));
-        h->Hpart_f = malloc1d(h->numFilterBlocks*nCH*(h->nBins)*sizeof(float_complex));
-        h->X_n = calloc1d(h->numFilterBlocks * nCH * (h->nBins), sizeof(float_complex));
-        h->HX_n = calloc1d(h->numFilterBlocks * nCH * (h->nBins), sizeof(float_complex));
+        h->Hpart_f = calloc1d_aligned(h->numFilterBlocks*nCH*(h->nBinsPad), sizeof(float_complex));
+        h->X_n = calloc1d_aligned(h->numFilterBlocks * nCH * (h->nBinsPad), sizeof(float_complex));
+        h->Z_n = calloc1d_aligned(h->nBinsPad, sizeof(float_complex));
         h->x_pad = calloc1d(2 * hopSize, sizeof(float));
-        h->hx_n = malloc1d(h->numFilterBlocks*nCH*(h->fftSize)*sizeof(float));
         h->z_n = calloc1d(h->fftSize, sizeof(float));
         h->y_n_overlap = calloc1d(nCH*hopSize, sizeof(float));
         saf_rfft_create(&(h->hFFT), h->fftSize);
@@ -318,7 +304,7 @@ void saf_multiConv_create
             memcpy(h_pad, &H[nc*length_h], length_h*sizeof(float)); /* zero pad filter, to be multiple of hopsize */
             for (nb=0; nb<h->numFilterBlocks; nb++){
                 memcpy(h_pad_2hops, &(h_pad[nb*hopSize]), hopSize*sizeof(float));
-                saf_rfft_forward(h->hFFT, h_pad_2hops, &(h->Hpart_f[nb*nCH*(h->nBins)+nc*(h->nBins)]));
+                saf_rfft_forward(h->hFFT, h_pad_2hops, &(h->Hpart_f[nb*nCH*(h->nBinsPad)+nc*(h->nBinsPad)]));
             }
         }
         
@@ -336,18 +322,15 @@ void saf_multiConv_destroy
     
     if(h!=NULL){
         saf_rfft_destroy(&(h->hFFT));
-        free(h->X_n);
+        free_aligned(h->X_n);
         free(h->x_pad);
         free(h->z_n);
-        if(!h->usePartFLAG){
-            free(h->Z_n);
-            free(h->H_f);
-        }
+        free_aligned(h->Z_n);
+        if(!h->usePartFLAG)
+            free_aligned(h->H_f);
         else{
-            free(h->HX_n);
-            free(h->hx_n);
             free(h->y_n_overlap);
-            free(h->Hpart_f);
+            free_aligned(h->Hpart_f);
         }
         free(h);
         h=NULL;
@@ -362,20 +345,20 @@ void saf_multiConv_apply
 )
 {
     safMulConv_data *h = (safMulConv_data*)(hMC);
-    int nc, nb;
+    int nc;
     
     /* apply non-partitioned convolution */
     if(!h->usePartFLAG){
         /* zero-pad input signals and perform fft. */
         for(nc=0; nc<h->nCH; nc++){
             memcpy(h->x_pad, &(inputSig[nc*(h->hopSize)]), h->hopSize *sizeof(float));
-            saf_rfft_forward(h->hFFT, h->x_pad, &(h->X_n[nc*(h->nBins)]));
+            saf_rfft_forward(h->hFFT, h->x_pad, &(h->X_n[nc*(h->nBinsPad)]));
         }
         
         /* apply convolution and inverse fft */
-        utility_cvvmul(h->H_f, h->X_n, (h->nCH) * (h->nBins), h->Z_n); /* This is the bulk of the CPU work */
+        utility_cvvmul(h->H_f, h->X_n, (h->nCH) * (h->nBinsPad), h->Z_n); /* This is the bulk of the CPU work */
         for(nc=0; nc<h->nCH; nc++){
-            saf_rfft_backward(h->hFFT, &(h->Z_n[nc*(h->nBins)]), &(h->z_n[nc*(h->fftSize)]));
+            saf_rfft_backward(h->hFFT, &(h->Z_n[nc*(h->nBinsPad)]), &(h->z_n[nc*(h->fftSize)]));
             
             /* sum with overlap buffer and copy the result to the output buffer */
             utility_svvcopy(&(h->ovrlpAddBuffer[nc*(h->fftSize)+(h->hopSize)]), (h->numOvrlpAddBlocks-1)*(h->hopSize), &(h->ovrlpAddBuffer[nc*(h->fftSize)]));
@@ -387,22 +370,19 @@ void saf_multiConv_apply
     /* apply partitioned convolution */
     else{
         /* zero-pad input signals and perform fft. Store in partition slot 1. */
-        memcpy(&(h->X_n[1*(h->nCH)*(h->nBins)]), h->X_n, (h->numFilterBlocks-1)*(h->nCH)*(h->nBins)*sizeof(float_complex));
+        memcpy(&(h->X_n[1*(h->nCH)*(h->nBinsPad)]), h->X_n, (h->numFilterBlocks-1)*(h->nCH)*(h->nBinsPad)*sizeof(float_complex));
         for(nc=0; nc<h->nCH; nc++){
             memcpy(h->x_pad, &(inputSig[nc*(h->hopSize)]), h->hopSize * sizeof(float));
-            saf_rfft_forward(h->hFFT, h->x_pad, &(h->X_n[0*(h->nCH)*(h->nBins)+nc*(h->nBins)]));
+            saf_rfft_forward(h->hFFT, h->x_pad, &(h->X_n[0*(h->nCH)*(h->nBinsPad)+nc*(h->nBinsPad)]));
         }
         
         /* apply convolution and inverse fft */
-        utility_cvvmul(h->Hpart_f, h->X_n, h->numFilterBlocks * (h->nCH) * (h->nBins), h->HX_n); /* This is the bulk of the CPU work */
         for(nc=0; nc<h->nCH; nc++){
-            for(nb=0; nb<h->numFilterBlocks; nb++)
-                saf_rfft_backward(h->hFFT, &(h->HX_n[nb*(h->nCH)*(h->nBins)+nc*(h->nBins)]), &(h->hx_n[nb*(h->nCH)*(h->fftSize)+nc*(h->fftSize)]));
-            
             /* output frame for this channel is the sum over all partitions */
-            memset(h->z_n, 0, h->fftSize*sizeof(float));
-            for(nb=0; nb<h->numFilterBlocks; nb++)
-                cblas_saxpy(h->fftSize, 1.0f, (const float*)&(h->hx_n[nb*(h->nCH)*(h->fftSize)+nc*(h->fftSize)]), 1, h->z_n, 1);
+            memset(h->Z_n, 0, (h->nBins)*sizeof(float_complex));
+            utility_cvvmuladd_batch(&(h->Hpart_f[nc*(h->nBinsPad)]), (h->nCH)*(h->nBinsPad), &(h->X_n[nc*(h->nBinsPad)]), (h->nCH)*(h->nBinsPad),
+                                    h->nBins, h->numFilterBlocks, h->Z_n); /* This is the bulk of the CPU work */
+            saf_rfft_backward(h->hFFT, h->Z_n, h->z_n);
             
             /* sum with overlap buffer and copy the result to the output buffer */
             utility_svvadd(h->z_n, (const float*)&(h->y_n_overlap[nc*(h->hopSize)]), h->hopSize, &(outputSig[nc* (h->hopSize)]));
@@ -421,17 +401,17 @@ void saf_multiConv_apply
  * Data structure for the time-varying convolver.
  */
 typedef struct _safTVConv_data {
-    int hopSize, fftSize, nBins;
+    int hopSize, fftSize, nBins, nBinsPad;
     int length_h, nIRs, nCHout;
     int numFilterBlocks;
     void* hFFT;
-    float* x_pad, *hx_n,
+    float* x_pad,
             *z_n, *z_n_last, *z_n_last2,
             *y_n_overlap, *y_n_overlap_last,
             *out1, *out2,
             *fadeIn, *fadeOut,
             *outFadeIn, *outFadeOut;
-    float_complex* X_n, *HX_n;
+    float_complex* X_n, *Z_n;
     float_complex*** Hpart_f;
     int posIdx_last, posIdx_last2;
 }safTVConv_data;
@@ -468,6 +448,7 @@ void  saf_TVConv_create
     h->length_h = length_h;
     h->fftSize = 2*(h->hopSize);
     h->nBins = hopSize+1;
+    h->nBinsPad = (int)aligned_dim((size_t)h->nBins, sizeof(float_complex)); /* each spectrum starts on a 64-byte boundary */
     h->numFilterBlocks = (int)ceilf((float)length_h/(float)hopSize); /* number of partitions */
     saf_assert(h->numFilterBlocks>=1, "Number of filter blocks/partitions must be at least 1");
     
@@ -475,10 +456,9 @@ void  saf_TVConv_create
     h_pad = calloc1d(h->numFilterBlocks * hopSize, sizeof(float));
     h_pad_2hops = calloc1d(2 * hopSize, sizeof(float));
     h->Hpart_f = (float_complex***) malloc2d(nIRs, nCHout, sizeof(float_complex*));
-    h->X_n = calloc1d(h->numFilterBlocks * (h->nBins), sizeof(float_complex));
-    h->HX_n = malloc1d(h->numFilterBlocks * (h->nBins) * sizeof(float_complex));
+    h->X_n = calloc1d_aligned(h->numFilterBlocks * (h->nBinsPad), sizeof(float_complex));
+    h->Z_n = calloc1d_aligned(h->nBinsPad, sizeof(float_complex));
     h->x_pad = calloc1d(2 * hopSize, sizeof(float));
-    h->hx_n = malloc1d(h->numFilterBlocks*(h->fftSize)*sizeof(float));
     h->y_n_overlap = calloc1d(nCHout*hopSize, sizeof(float));
     h->y_n_overlap_last = calloc1d(nCHout*hopSize, sizeof(float));
     h->z_n = malloc1d((h->fftSize) * sizeof(float));
@@ -497,11 +477,11 @@ void  saf_TVConv_create
     saf_rfft_create(&(h->hFFT), h->fftSize);
     for(np=0; np<nIRs; np++){
         for(no=0; no<nCHout; no++){
-            h->Hpart_f[np][no] = malloc1d(h->numFilterBlocks*(h->nBins)*sizeof(float_complex));
+            h->Hpart_f[np][no] = calloc1d_aligned(h->numFilterBlocks*(h->nBinsPad), sizeof(float_complex));
             memcpy(h_pad, &H[np][no*length_h], length_h*sizeof(float)); /* zero pad filter, to be multiple of hopsize */
             for (nb=0; nb<h->numFilterBlocks; nb++){
                 memcpy(h_pad_2hops, &(h_pad[nb*hopSize]), hopSize*sizeof(float));
-                saf_rfft_forward(h->hFFT, h_pad_2hops, &(h->Hpart_f[np][no][nb*(h->nBins)]));
+                saf_rfft_forward(h->hFFT, h_pad_2hops, &(h->Hpart_f[np][no][nb*(h->nBinsPad)]));
             }
         }
     }
@@ -520,13 +500,12 @@ void saf_TVConv_destroy
     
     if(h!=NULL){
         saf_rfft_destroy(&(h->hFFT));
-        free(h->X_n);
+        free_aligned(h->X_n);
         free(h->x_pad);
         free(h->z_n);
         free(h->z_n_last);
         free(h->z_n_last2);
-        free(h->hx_n);
-        free(h->HX_n);
+        free_aligned(h->Z_n);
         free(h->y_n_overlap);
         free(h->y_n_overlap_last);
         free(h->out1);
@@ -537,7 +516,7 @@ void saf_TVConv_destroy
         free(h->outFadeOut);
         for(np=0; np<h->nIRs; np++){
             for(no=0; no<h->nCHout; no++)
-                free(h->Hpart_f[np][no]);
+                free_aligned(h->Hpart_f[np][no]);
         }
         free(h->Hpart_f);
         }
@@ -554,48 +533,36 @@ void saf_TVConv_apply
 )
 {
     safTVConv_data *h = (safTVConv_data*)(hTVC);
-    int no, nb;
+    int no;
     
     /* zero-pad input signals and perform fft. Store in partition slot 1. */
-    memmove(&(h->X_n[1*(h->nBins)]), h->X_n, (h->numFilterBlocks-1)*(h->nBins)*sizeof(float_complex)); /* shuffle */
+    memmove(&(h->X_n[1*(h->nBinsPad)]), h->X_n, (h->numFilterBlocks-1)*(h->nBinsPad)*sizeof(float_complex)); /* shuffle */
     
     cblas_scopy(h->hopSize, inputSig, 1, h->x_pad, 1);
     saf_rfft_forward(h->hFFT, h->x_pad, h->X_n);
     
     /* apply convolution and inverse fft */
     for(no=0; no<h->nCHout; no++){
-        utility_cvvmul(h->Hpart_f[irIdx][no], h->X_n, h->numFilterBlocks * (h->nBins), h->HX_n); /* This is the bulk of the CPU work */
-        for(nb=0; nb<h->numFilterBlocks; nb++)
-            saf_rfft_backward(h->hFFT, &(h->HX_n[nb*(h->nBins)]), &(h->hx_n[nb*(h->fftSize)]));
-        
         /* output frame for this channel is the sum over all partitions */
-        memset(h->z_n, 0, (h->fftSize) * sizeof(float));
-        for(nb=0; nb<h->numFilterBlocks; nb++)
-            cblas_saxpy(h->fftSize, 1.0f, &(h->hx_n[nb*(h->fftSize)]), 1, h->z_n, 1);
+        memset(h->Z_n, 0, (h->nBins) * sizeof(float_complex));
+        utility_cvvmuladd_batch(h->Hpart_f[irIdx][no], h->nBinsPad, h->X_n, h->nBinsPad, h->nBins, h->numFilterBlocks, h->Z_n); /* This is the bulk of the CPU work */
+        saf_rfft_backward(h->hFFT, h->Z_n, h->z_n);
         
         /* If position changed perform convolution at previous steps too */
         if(irIdx != h->posIdx_last){
-            utility_cvvmul(h->Hpart_f[h->posIdx_last][no], h->X_n, h->numFilterBlocks * (h->nBins), h->HX_n);
-            for(nb=0; nb<h->numFilterBlocks; nb++)
-                saf_rfft_backward(h->hFFT, &(h->HX_n[nb*(h->nBins)]), &(h->hx_n[nb*(h->fftSize)]));
-            
             /* output frame for this channel is the sum over all partitions */
-            memset(h->z_n_last, 0, (h->fftSize) * sizeof(float));
-            for(nb=0; nb<h->numFilterBlocks; nb++)
-                cblas_saxpy(h->fftSize, 1.0f, &(h->hx_n[nb*(h->fftSize)]), 1, h->z_n_last, 1);
+            memset(h->Z_n, 0, (h->nBins) * sizeof(float_complex));
+            utility_cvvmuladd_batch(h->Hpart_f[h->posIdx_last][no], h->nBinsPad, h->X_n, h->nBinsPad, h->nBins, h->numFilterBlocks, h->Z_n);
+            saf_rfft_backward(h->hFFT, h->Z_n, h->z_n_last);
         }
         else {
             utility_svvcopy(h->z_n, h->fftSize, h->z_n_last);
         }
         if(h->posIdx_last != h->posIdx_last2){
-            utility_cvvmul(h->Hpart_f[h->posIdx_last2][no], h->X_n, h->numFilterBlocks * (h->nBins), h->HX_n);
-            for(nb=0; nb<h->numFilterBlocks; nb++)
-                saf_rfft_backward(h->hFFT, &(h->HX_n[nb*(h->nBins)]), &(h->hx_n[nb*(h->fftSize)]));
-            
             /* output frame for this channel is the sum over all partitions */
-            memset(h->z_n_last2, 0, (h->fftSize) * sizeof(float));
-            for(nb=0; nb<h->numFilterBlocks; nb++)
-                cblas_saxpy(h->fftSize, 1.0f, &(h->hx_n[nb*(h->fftSize)]), 1, h->z_n_last2, 1);
+            memset(h->Z_n, 0, (h->nBins) * sizeof(float_complex));
+            utility_cvvmuladd_batch(h->Hpart_f[h->posIdx_last2][no], h->nBinsPad, h->X_n, h->nBinsPad, h->nBins, h->numFilterBlocks, h->Z_n);
+            saf_rfft_backward(h->hFFT, h->Z_n, h->z_n_last2);
         }
         else {
             utility_svvcopy(h->z_n_last, h->fftSize, h->z_n_last2);
@@ -0,0 +1,239 @@
+/*
+ * Copyright 2026 agent
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * @file saf_utility_resampler.c
+ * @ingroup Utilities
+ * @brief A multi-channel polyphase resampler
+ *
+ * @author agent
+ * @date 16.10.2026
+ * @license ISC
+ */
+
+#include "saf_utilities.h"
+#include "saf_externals.h"
+
+/** Number of prototype filter taps either side of the centre tap (at 1:1) */
+#define SAF_RESAMPLER_HALF_LENGTH ( 64 )
+/** Maximum number of polyphase components to store */
+#define SAF_RESAMPLER_MAX_NUM_PHASES ( 1024 )
+/** Cut-off frequency of the prototype filter, relative to Nyquist */
+#define SAF_RESAMPLER_ROLLOFF ( 0.975 )
+/** Kaiser window beta parameter (~90dB stop-band attenuation) */
+#define SAF_RESAMPLER_KAISER_BETA ( 9.0 )
+
+/**
+ * Main structure for the polyphase resampler
+ */
+typedef struct _saf_resampler_data
+{
+    /* parameters */
+    int nCH, fs_in, fs_out, maxNsamplesIn, maxNsamplesOut;
+    int L;         /**< Interpolation factor */
+    int M;         /**< Decimation factor */
+    int halfLen;   /**< Number of taps either side of the current input sample */
+    int nTaps;     /**< Number of taps per polyphase component; 2*halfLen */
+    int nPhases;   /**< Number of stored polyphase components */
+
+    /* internals */
+    float* coeffs; /**< Polyphase filter components; FLAT: nPhases x nTaps */
+    float* buffer; /**< Input history; FLAT: (maxNsamplesIn+nTaps) x nCH */
+    float* outTmp; /**< Sample-major output; FLAT: maxNsamplesOut x nCH */
+    int bufLen;    /**< Number of samples currently in the buffer */
+    int readPos;   /**< Buffer index of the input sample preceding the output */
+    int phase;     /**< Current phase (0..L-1) */
+
+}saf_resampler_data;
+
+/** Zeroth-order modified Bessel function of the first kind (series form) */
+static double besselI0(double x)
+{
+    int k;
+    double sum, term, xx;
+    sum = term = 1.0;
+    xx = x*x/4.0;
+    for(k=1; k<64 && term>1e-12*sum; k++){
+        term *= xx/((double)k*(double)k);
+        sum += term;
+    }
+    return sum;
+}
+
+/** Returns the greatest common divisor of two positive integers */
+static int gcd_i(int a, int b)
+{
+    int t;
+    while(b!=0){
+        t = b;
+        b = a % b;
+        a = t;
+    }
+    return a;
+}
+
+void saf_resampler_create
+(
+    void ** const phRes,
+    int nCH,
+    int fs_in,
+    int fs_out,
+    int maxNsamplesIn
+)
+{
+    *phRes = malloc1d(sizeof(saf_resampler_data));
+    saf_resampler_data *h = (saf_resampler_data*)(*phRes);
+    int g, q, i;
+    double fc, ratio, tau, x, I0beta;
+
+    saf_assert(nCH>0 && fs_in>0 && fs_out>0 && maxNsamplesIn>0, "Invalid input arguments");
+    h->nCH = nCH;
+    h->fs_in = fs_in;
+    h->fs_out = fs_out;
+    h->maxNsamplesIn = maxNsamplesIn;
+
+    /* Rational conversion factor */
+    g = gcd_i(fs_in, fs_out);
+    h->L = fs_out/g;
+    h->M = fs_in/g;
+    ratio = (double)h->L/(double)h->M;
+
+    /* The filter must also be longer when its cut-off is lowered to avoid aliasing (i.e. when downsampling) */
+    h->halfLen = (int)ceil((double)SAF_RESAMPLER_HALF_LENGTH * SAF_MAX(1.0, 1.0/ratio));
+    h->nTaps = 2*h->halfLen;
+    h->nPhases = SAF_MIN(h->L, SAF_RESAMPLER_MAX_NUM_PHASES);
+    h->maxNsamplesOut = (int)ceil((double)maxNsamplesIn*ratio) + 1;
+
+    /* Design the Kaiser-windowed sinc prototype, and store its polyphase components. Note that, each component
+     * is stored in the order in which the (oldest to newest) buffered input samples are to be weighted */
+    fc = 0.5 * SAF_RESAMPLER_ROLLOFF * SAF_MIN(1.0, ratio); /* cut-off, relative to the input sampling rate */
+    I0beta = besselI0(SAF_RESAMPLER_KAISER_BETA);
+    h->coeffs = malloc1d(h->nPhases*h->nTaps*sizeof(float));
+    for(q=0; q<h->nPhases; q++){
+        for(i=0; i<h->nTaps; i++){
+            /* Distance from the output sample to the input sample, in input samples */
+            tau = (double)q/(double)h->nPhases + (double)(h->halfLen - 1 - i);
+            x = tau/(double)h->halfLen;
+            h->coeffs[q*h->nTaps+i] = fabs(x) >= 1.0 ? 0.0f :
+                (float)(2.0*fc * (fabs(tau)<1e-9 ? 1.0 : sin(2.0*SAF_PId*fc*tau)/(2.0*SAF_PId*fc*tau)) *
+                        besselI0(SAF_RESAMPLER_KAISER_BETA*sqrt(1.0-x*x))/I0beta);
+        }
+    }
+
+    /* Buffers */
+    h->buffer = malloc1d((h->maxNsamplesIn+h->nTaps)*nCH*sizeof(float));
+    h->outTmp = malloc1d(h->maxNsamplesOut*nCH*sizeof(float));
+    saf_resampler_reset(*phRes);
+}
+
+void saf_resampler_destroy
+(
+    void ** const phRes
+)
+{
+    saf_resampler_data *h = (saf_resampler_data*)(*phRes);
+
+    if(h!=NULL){
+        free(h->coeffs);
+        free(h->buffer);
+        free(h->outTmp);
+        free(h);
+        h = NULL;
+        *phRes = NULL;
+    }
+}
+
+void saf_resampler_reset
+(
+    void * const hRes
+)
+{
+    saf_resampler_data *h = (saf_resampler_data*)(hRes);
+
+    /* Zero history preceding the first input sample */
+    memset(h->buffer, 0, (h->maxNsamplesIn+h->nTaps)*h->nCH*sizeof(float));
+    h->bufLen = h->halfLen-1;
+    h->readPos = h->halfLen-1;
+    h->phase = 0;
+}
+
+int saf_resampler_getLatency
+(
+    void * const hRes
+)
+{
+    saf_resampler_data *h = (saf_resampler_data*)(hRes);
+    return h->halfLen;
+}
+
+int saf_resampler_getMaxNsamplesOut
+(
+    void * const hRes
+)
+{
+    saf_resampler_data *h = (saf_resampler_data*)(hRes);
+    return h->maxNsamplesOut;
+}
+
+int saf_resampler_apply
+(
+    void * const hRes,
+    float** inputSigs,
+    int nSamplesIn,
+    float** outputSigs
+)
+{
+    saf_resampler_data *h = (saf_resampler_data*)(hRes);
+    int ch, nOut, q, shift;
+
+    saf_assert(nSamplesIn<=h->maxNsamplesIn, "nSamplesIn exceeds the maximum specified upon creation");
+
+    /* Append the new input samples to the (sample-major) buffer */
+    for(ch=0; ch<h->nCH; ch++)
+        cblas_scopy(nSamplesIn, inputSigs[ch], 1, h->buffer + h->bufLen*h->nCH + ch, h->nCH);
+    h->bufLen += nSamplesIn;
+
+    /* Compute all output samples for which the required input samples are available */
+    nOut = 0;
+    while(h->readPos + h->halfLen < h->bufLen){
+        q = h->nPhases==h->L ? h->phase : (int)(((long long)h->phase*(long long)h->nPhases)/(long long)h->L);
+        cblas_sgemv(CblasRowMajor, CblasTrans, h->nTaps, h->nCH, 1.0f,
+                    h->buffer + (h->readPos - h->halfLen + 1)*h->nCH, h->nCH,
+                    h->coeffs + q*h->nTaps, 1, 0.0f,
+                    h->outTmp + nOut*h->nCH, 1);
+        nOut++;
+
+        /* Advance */
+        h->phase += h->M;
+        h->readPos += h->phase / h->L;
+        h->phase = h->phase % h->L;
+    }
+    saf_assert(nOut<=h->maxNsamplesOut, "Output buffer overrun");
+
+    /* Output */
+    for(ch=0; ch<h->nCH; ch++)
+        cblas_scopy(nOut, h->outTmp + ch, h->nCH, outputSigs[ch], 1);
+
+    /* Discard the input samples that are no longer required */
+    shift = h->readPos - h->halfLen + 1;
+    if(shift>0){
+        memmove(h->buffer, h->buffer + shift*h->nCH, (h->bufLen-shift)*h->nCH*sizeof(float));
+        h->bufLen -= shift;
+        h->readPos -= shift;
+    }
+
+    return nOut;
+}
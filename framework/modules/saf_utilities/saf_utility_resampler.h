@@ -0,0 +1,138 @@
+/*
+ * Copyright 2026 agent
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ *@addtogroup Utilities
+ *@{
+ * @file saf_utility_resampler.h
+ * @brief A multi-channel polyphase resampler
+ *
+ * @author agent
+ * @date 16.10.2026
+ * @license ISC
+ */
+
+#ifndef SAF_RESAMPLER_H_INCLUDED
+#define SAF_RESAMPLER_H_INCLUDED
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* ========================================================================== */
+/*                             Polyphase Resampler                            */
+/* ========================================================================== */
+
+/**
+ * Creates an instance of the multi-channel polyphase resampler
+ *
+ * The conversion is carried out with a rational factor L/M (i.e., the two
+ * sampling rates divided by their greatest common divisor). A Kaiser-windowed
+ * sinc prototype filter is designed only once, upon creation, and stored as
+ * L polyphase components. The input signals are held internally in a
+ * sample-major layout, such that each output sample is computed for all
+ * channels at once, via a single matrix-vector product. This makes the
+ * resampler particularly efficient when many channels share the same pair of
+ * sampling rates (e.g. when resampling HRIR sets).
+ *
+ * @note If L exceeds an internal maximum number of phases, then the phase
+ *       table is quantised to this maximum (i.e. the nearest earlier phase is
+ *       used), which introduces a timing error of less than 1/1024 samples.
+ *
+ * @test test__saf_resampler()
+ *
+ * @param[in] phRes         (&) address of resampler handle
+ * @param[in] nCH           Number of channels
+ * @param[in] fs_in         Input sampling rate, in Hz
+ * @param[in] fs_out        Output sampling rate, in Hz
+ * @param[in] maxNsamplesIn Maximum number of input samples that will be passed
+ *                          to saf_resampler_apply() per call
+ */
+void saf_resampler_create(/* Input Arguments */
+                          void ** const phRes,
+                          int nCH,
+                          int fs_in,
+                          int fs_out,
+                          int maxNsamplesIn);
+
+/**
+ * Destroys an instance of the polyphase resampler
+ *
+ * @param[in] phRes (&) address of resampler handle
+ */
+void saf_resampler_destroy(/* Input Arguments */
+                           void ** const phRes);
+
+/**
+ * Flushes the internal buffers with zeros
+ *
+ * @param[in] hRes resampler handle
+ */
+void saf_resampler_reset(/* Input Arguments */
+                         void * const hRes);
+
+/**
+ * Returns the latency of the resampler, in input samples
+ *
+ * The output signals are time-aligned with the input signals (i.e. the
+ * filter is zero-phase), however, output samples are only produced once this
+ * number of input samples beyond them has been received. Passing this number
+ * of zeros after the end of a signal, therefore, returns the remaining tail.
+ *
+ * @param[in] hRes resampler handle
+ * @returns latency, in input samples
+ */
+int saf_resampler_getLatency(/* Input Arguments */
+                             void * const hRes);
+
+/**
+ * Returns the maximum number of output samples per saf_resampler_apply() call
+ *
+ * @param[in] hRes resampler handle
+ * @returns maximum number of output samples
+ */
+int saf_resampler_getMaxNsamplesOut(/* Input Arguments */
+                                    void * const hRes);
+
+/**
+ * Resamples the current block of input signals
+ *
+ * @note The number of output samples may vary between calls (e.g. when
+ *       converting 44.1kHz to 48kHz, with a fixed input block size). Therefore,
+ *       each output buffer should have room for at least
+ *       saf_resampler_getMaxNsamplesOut() samples.
+ *
+ * @param[in]  hRes       resampler handle
+ * @param[in]  inputSigs  Input signals; nCH x nSamplesIn
+ * @param[in]  nSamplesIn Number of input samples (<= maxNsamplesIn)
+ * @param[out] outputSigs Output signals; nCH x (returned number of samples)
+ * @returns the number of output samples written to each channel
+ */
+int saf_resampler_apply(/* Input Arguments */
+                        void * const hRes,
+                        float** inputSigs,
+                        int nSamplesIn,
+                        /* Output Arguments */
+                        float** outputSigs);
+
+
+#ifdef __cplusplus
+}/* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* SAF_RESAMPLER_H_INCLUDED */
+
+/**@} */ /* doxygen addtogroup Utilities */
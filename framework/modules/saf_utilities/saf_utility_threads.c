@@ -0,0 +1,303 @@
+/*
+ * Copyright 2026 agent
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * @file saf_utility_threads.c
+ * @ingroup Utilities
+ * @brief A minimal pool of worker threads, for parallelising loops over
+ *        independent jobs (e.g. frequency bands or matrices in a batch)
+ *
+ * @author agent
+ * @date 16.10.2026
+ * @license ISC
+ */
+
+#include "saf_utilities.h"
+#if defined(_WIN32)
+# include <windows.h>
+  typedef HANDLE             saf_thread;
+  typedef CRITICAL_SECTION   saf_mutex;
+  typedef CONDITION_VARIABLE saf_cond;
+# define saf_mutex_init(m)     InitializeCriticalSection(m)
+# define saf_mutex_destroy(m)  DeleteCriticalSection(m)
+# define saf_mutex_lock(m)     EnterCriticalSection(m)
+# define saf_mutex_unlock(m)   LeaveCriticalSection(m)
+# define saf_cond_init(c)      InitializeConditionVariable(c)
+# define saf_cond_destroy(c)   ((void)(c))
+# define saf_cond_wait(c,m)    SleepConditionVariableCS(c, m, INFINITE)
+# define saf_cond_signal(c)    WakeConditionVariable(c)
+# define saf_cond_broadcast(c) WakeAllConditionVariable(c)
+#else
+# include <pthread.h>
+# include <unistd.h>
+  typedef pthread_t          saf_thread;
+  typedef pthread_mutex_t    saf_mutex;
+  typedef pthread_cond_t     saf_cond;
+# define saf_mutex_init(m)     pthread_mutex_init(m, NULL)
+# define saf_mutex_destroy(m)  pthread_mutex_destroy(m)
+# define saf_mutex_lock(m)     pthread_mutex_lock(m)
+# define saf_mutex_unlock(m)   pthread_mutex_unlock(m)
+# define saf_cond_init(c)      pthread_cond_init(c, NULL)
+# define saf_cond_destroy(c)   pthread_cond_destroy(c)
+# define saf_cond_wait(c,m)    pthread_cond_wait(c, m)
+# define saf_cond_signal(c)    pthread_cond_signal(c)
+# define saf_cond_broadcast(c) pthread_cond_broadcast(c)
+#endif
+
+/** Maximum number of threads */
+#define SAF_THREAD_POOL_MAX_NUM_THREADS ( 64 )
+
+struct _saf_threadPool_data;
+
+/** Per-worker data */
+typedef struct _saf_threadPool_worker {
+    struct _saf_threadPool_data* pool;
+    int threadIdx;
+    saf_thread thread;
+}saf_threadPool_worker;
+
+/**
+ * Main structure for the thread pool
+ */
+typedef struct _saf_threadPool_data {
+    int nThreads;
+    int nRefs;           /**< Number of references; see saf_threadPool_retain() */
+    saf_threadPool_worker* workers;
+    saf_mutex mutex;
+    saf_cond startCond;  /**< Signalled when a new set of jobs is available */
+    saf_cond doneCond;   /**< Signalled when the last worker has finished */
+
+    /* current set of jobs (protected by the mutex) */
+    saf_threadPool_jobFn jobFn;
+    void* userData;
+    int nJobs;
+    int nextJob;         /**< Index of the next job to carry out */
+    int nBusyWorkers;    /**< Number of workers yet to finish the current set */
+    unsigned int generation; /**< Incremented for each new set of jobs */
+    int quitFLAG;
+
+}saf_threadPool_data;
+
+/** Carries out jobs until there are none left */
+static void saf_threadPool_doJobs
+(
+    saf_threadPool_data* h,
+    int threadIdx
+)
+{
+    int jobIdx;
+    for(;;){
+        saf_mutex_lock(&h->mutex);
+        jobIdx = h->nextJob < h->nJobs ? h->nextJob++ : -1;
+        saf_mutex_unlock(&h->mutex);
+        if(jobIdx<0)
+            return;
+        h->jobFn(h->userData, jobIdx, threadIdx);
+    }
+}
+
+/** The main loop of each worker thread */
+#if defined(_WIN32)
+static DWORD WINAPI saf_threadPool_workerLoop(LPVOID arg)
+#else
+static void* saf_threadPool_workerLoop(void* arg)
+#endif
+{
+    saf_threadPool_worker* w = (saf_threadPool_worker*)arg;
+    saf_threadPool_data* h = w->pool;
+    unsigned int generation;
+
+    generation = 0; /* (i.e. the value upon creation; not read from the pool, as the first set of jobs may already be waiting) */
+    saf_mutex_lock(&h->mutex);
+    for(;;){
+        /* Sleep until there are new jobs, or until the pool is destroyed */
+        while(h->generation==generation && !h->quitFLAG)
+            saf_cond_wait(&h->startCond, &h->mutex);
+        if(h->quitFLAG)
+            break;
+        generation = h->generation;
+        saf_mutex_unlock(&h->mutex);
+
+        saf_threadPool_doJobs(h, w->threadIdx);
+
+        saf_mutex_lock(&h->mutex);
+        if(--(h->nBusyWorkers)==0)
+            saf_cond_signal(&h->doneCond);
+    }
+    saf_mutex_unlock(&h->mutex);
+#if defined(_WIN32)
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+void saf_threadPool_create
+(
+    void ** const phPool,
+    int nThreads
+)
+{
+    *phPool = malloc1d(sizeof(saf_threadPool_data));
+    saf_threadPool_data *h = (saf_threadPool_data*)(*phPool);
+    int i, spawned;
+
+    h->nThreads = SAF_CLAMP(nThreads, 1, SAF_THREAD_POOL_MAX_NUM_THREADS);
+    h->nRefs = 1;
+    h->jobFn = NULL;
+    h->userData = NULL;
+    h->nJobs = h->nextJob = h->nBusyWorkers = 0;
+    h->generation = 0;
+    h->quitFLAG = 0;
+    saf_mutex_init(&h->mutex);
+    saf_cond_init(&h->startCond);
+    saf_cond_init(&h->doneCond);
+
+    /* Spawn the workers (the calling thread is thread 0) */
+    h->workers = h->nThreads>1 ? malloc1d((h->nThreads-1)*sizeof(saf_threadPool_worker)) : NULL;
+    for(i=0; i<h->nThreads-1; i++){
+        h->workers[i].pool = h;
+        h->workers[i].threadIdx = i+1;
+#if defined(_WIN32)
+        h->workers[i].thread = CreateThread(NULL, 0, saf_threadPool_workerLoop, &(h->workers[i]), 0, NULL);
+        spawned = h->workers[i].thread!=NULL;
+#else
+        spawned = pthread_create(&(h->workers[i].thread), NULL, saf_threadPool_workerLoop, &(h->workers[i]))==0;
+#endif
+        if(!spawned){
+            /* Carry on with however many threads could be spawned */
+            saf_print_warning("Failed to spawn all of the requested worker threads");
+            h->nThreads = i+1;
+            break;
+        }
+    }
+}
+
+void saf_threadPool_destroy
+(
+    void ** const phPool
+)
+{
+    saf_threadPool_data *h = (saf_threadPool_data*)(*phPool);
+    int i, nRefs;
+
+    if(h!=NULL){
+        /* Release this reference (the pool is kept alive for any others) */
+        saf_mutex_lock(&h->mutex);
+        nRefs = --(h->nRefs);
+        saf_mutex_unlock(&h->mutex);
+        if(nRefs>0){
+            *phPool = NULL;
+            return;
+        }
+
+        /* Wake up and join the workers */
+        saf_mutex_lock(&h->mutex);
+        h->quitFLAG = 1;
+        saf_cond_broadcast(&h->startCond);
+        saf_mutex_unlock(&h->mutex);
+        for(i=0; i<h->nThreads-1; i++){
+#if defined(_WIN32)
+            WaitForSingleObject(h->workers[i].thread, INFINITE);
+            CloseHandle(h->workers[i].thread);
+#else
+            pthread_join(h->workers[i].thread, NULL);
+#endif
+        }
+        saf_cond_destroy(&h->startCond);
+        saf_cond_destroy(&h->doneCond);
+        saf_mutex_destroy(&h->mutex);
+        free(h->workers);
+        free(h);
+        h = NULL;
+        *phPool = NULL;
+    }
+}
+
+void saf_threadPool_retain
+(
+    void * const hPool
+)
+{
+    saf_threadPool_data *h = (saf_threadPool_data*)(hPool);
+
+    if(h!=NULL){
+        saf_mutex_lock(&h->mutex);
+        h->nRefs++;
+        saf_mutex_unlock(&h->mutex);
+    }
+}
+
+int saf_threadPool_getNumThreads
+(
+    void * const hPool
+)
+{
+    saf_threadPool_data *h = (saf_threadPool_data*)(hPool);
+    return h==NULL ? 1 : h->nThreads;
+}
+
+int saf_threadPool_getNumProcessors(void)
+{
+    long nProcs;
+#if defined(_WIN32)
+    SYSTEM_INFO sysInfo;
+    GetSystemInfo(&sysInfo);
+    nProcs = (long)sysInfo.dwNumberOfProcessors;
+#else
+    nProcs = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return (int)SAF_MIN(SAF_MAX(nProcs, 1), SAF_THREAD_POOL_MAX_NUM_THREADS);
+}
+
+void saf_threadPool_run
+(
+    void * const hPool,
+    int nJobs,
+    saf_threadPool_jobFn jobFn,
+    void* userData
+)
+{
+    saf_threadPool_data *h = (saf_threadPool_data*)(hPool);
+    int i;
+
+    /* Single-threaded */
+    if(h==NULL || h->nThreads==1 || nJobs<2){
+        for(i=0; i<nJobs; i++)
+            jobFn(userData, i, 0);
+        return;
+    }
+
+    /* Hand the jobs over to the workers */
+    saf_mutex_lock(&h->mutex);
+    h->jobFn = jobFn;
+    h->userData = userData;
+    h->nJobs = nJobs;
+    h->nextJob = 0;
+    h->nBusyWorkers = h->nThreads-1;
+    h->generation++;
+    saf_cond_broadcast(&h->startCond);
+    saf_mutex_unlock(&h->mutex);
+
+    /* Also help out */
+    saf_threadPool_doJobs(h, 0);
+
+    /* Wait for the workers to finish */
+    saf_mutex_lock(&h->mutex);
+    while(h->nBusyWorkers>0)
+        saf_cond_wait(&h->doneCond, &h->mutex);
+    saf_mutex_unlock(&h->mutex);
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2026 agent
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+ * OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ *@addtogroup Utilities
+ *@{
+ * @file saf_utility_threads.h
+ * @brief A minimal pool of worker threads, for parallelising loops over
+ *        independent jobs (e.g. frequency bands or matrices in a batch)
+ *
+ * @author agent
+ * @date 16.10.2026
+ * @license ISC
+ */
+
+#ifndef SAF_THREADS_H_INCLUDED
+#define SAF_THREADS_H_INCLUDED
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* ========================================================================== */
+/*                                 Thread Pool                                */
+/* ========================================================================== */
+
+/**
+ * Prototype for a job that may be given to saf_threadPool_run()
+ *
+ * @param[in] userData  User data, as passed to saf_threadPool_run()
+ * @param[in] jobIdx    Index of the job to carry out; 0..nJobs-1
+ * @param[in] threadIdx Index of the thread carrying out the job;
+ *                      0..nThreads-1 (e.g. for selecting per-thread scratch
+ *                      memory). The calling thread is always index 0.
+ */
+typedef void (*saf_threadPool_jobFn)(void* userData,
+                                     int jobIdx,
+                                     int threadIdx);
+
+/**
+ * Creates a pool of worker threads
+ *
+ * The workers are spawned once, upon creation, and then sleep until they are
+ * given jobs via saf_threadPool_run(). The calling thread also takes part in
+ * carrying out the jobs, therefore, nThreads-1 workers are spawned. If
+ * nThreads is 1, then no threads are spawned, and all jobs are simply carried
+ * out in order, by the calling thread.
+ *
+ * @test test__saf_threadPool()
+ *
+ * @param[in] phPool   (&) address of thread pool handle
+ * @param[in] nThreads Total number of threads (including the calling thread)
+ */
+void saf_threadPool_create(/* Input Arguments */
+                           void ** const phPool,
+                           int nThreads);
+
+/**
+ * Releases a reference to the pool, and destroys (joins) the worker threads
+ * once no references remain (see saf_threadPool_retain())
+ *
+ * @note The handle is set to NULL in either case.
+ *
+ * @param[in] phPool (&) address of thread pool handle
+ */
+void saf_threadPool_destroy(/* Input Arguments */
+                            void ** const phPool);
+
+/**
+ * Adds a reference to the pool, for objects which share a pool created
+ * elsewhere
+ *
+ * The pool is created with one reference, and is only destroyed once
+ * saf_threadPool_destroy() has been called once for every reference; i.e. the
+ * objects sharing it may be destroyed in any order.
+ *
+ * @param[in] hPool Thread pool handle (nothing happens if NULL)
+ */
+void saf_threadPool_retain(/* Input Arguments */
+                           void * const hPool);
+
+/**
+ * Returns the total number of threads in the pool (including the calling
+ * thread), or 1 if hPool is NULL
+ */
+int saf_threadPool_getNumThreads(/* Input Arguments */
+                                 void * const hPool);
+
+/**
+ * Returns the number of processors which are currently online (at least 1,
+ * and at most the maximum number of threads supported by the pool)
+ */
+int saf_threadPool_getNumProcessors(void);
+
+/**
+ * Carries out nJobs jobs across the threads in the pool, and returns once all
+ * of them have been completed
+ *
+ * @note The order in which the jobs are carried out is undefined. Jobs must
+ *       therefore be independent of one another. This function should not be
+ *       called from more than one thread at the same time.
+ *
+ * @param[in] hPool    Thread pool handle (if NULL, then all jobs are carried
+ *                     out in order, by the calling thread)
+ * @param[in] nJobs    Number of jobs
+ * @param[in] jobFn    The job function
+ * @param[in] userData User data, passed on to every call of jobFn
+ */
+void saf_threadPool_run(/* Input Arguments */
+                        void * const hPool,
+                        int nJobs,
+                        saf_threadPool_jobFn jobFn,
+                        void* userData);
+
+
+#ifdef __cplusplus
+}/* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* SAF_THREADS_H_INCLUDED */
+
+/**@} */ /* doxygen addtogroup Utilities */
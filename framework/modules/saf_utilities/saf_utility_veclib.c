@@ -124,6 +124,525 @@
   typedef double_complex        veclib_double_complex; /**< complex: 16-bytes */
 #endif
 
+/** Non-zero if all three pointers lie on a MD_MALLOC_ALIGNMENT byte boundary
+ *  (i.e. if they were returned by one of the md_malloc "_aligned" functions) */
+#define VECLIB_ARE_ALIGNED(a,b,c) ( (((size_t)(a)|(size_t)(b)|(size_t)(c)) & (MD_MALLOC_ALIGNMENT-1)) == 0 )
+
+
+/* ========================================================================== */
+/*                         Run-time SIMD Dispatching                          */
+/* ========================================================================== */
+
+#if defined(SAF_ENABLE_SIMD_RUNTIME_DISPATCH)
+/*
+ * Every variant of the kernels below is compiled into SAF, regardless of the
+ * compiler flags; by enabling the respective instruction set(s) on a per-
+ * function basis. The most capable variant that is supported by the host CPU
+ * is then selected upon first use.
+ */
+# if defined(__GNUC__) || defined(__clang__)
+#  define SAF_TARGET_SSE3   __attribute__((target("sse,sse2,sse3")))
+#  define SAF_TARGET_AVX2   __attribute__((target("avx,avx2,fma")))
+#  define SAF_TARGET_AVX512 __attribute__((target("avx512f")))
+# else /* MSVC permits the use of any intrinsic without additional flags */
+#  define SAF_TARGET_SSE3
+#  define SAF_TARGET_AVX2
+#  define SAF_TARGET_AVX512
+# endif
+
+/** Vector-vector kernel prototype; c = op(a, b) */
+typedef void (*veclib_svv_kernel)(const float*, const float*, const int, float*);
+/** Vector-scalar kernel prototype; c = op(a, s) */
+typedef void (*veclib_svs_kernel)(const float*, const float, const int, float*);
+/** Vector kernel prototype; c = op(a) */
+typedef void (*veclib_sv_kernel)(const float*, const int, float*);
+/** Split-complex vector-vector kernel prototype; c = op(a, b) */
+typedef void (*veclib_cvv_split_kernel)(const float*, const float*, const float*, const float*, const int, float*, float*);
+
+/** Table of kernels for one instruction set */
+typedef struct _veclib_simd_kernels{
+    SAF_SIMD_INSTRUCTION_SET isa; /**< Instruction set */
+    veclib_svv_kernel svvadd;     /**< c = a + b */
+    veclib_svv_kernel svvsub;     /**< c = a - b */
+    veclib_svv_kernel svvmul;     /**< c = a .* b */
+    veclib_svv_kernel cvvmul;     /**< c = a .* b (interleaved complex) */
+    veclib_svv_kernel cvvmuladd;  /**< c = c + a .* b (interleaved complex) */
+    veclib_svs_kernel svsadd;     /**< c = a + s */
+    veclib_svs_kernel svssub;     /**< c = a - s */
+    veclib_sv_kernel  svrecip;    /**< c = 1/a */
+    veclib_cvv_split_kernel cvvmul_split;    /**< c = a .* b (split complex) */
+    veclib_cvv_split_kernel cvvmuladd_split; /**< c = c + a .* b (split complex) */
+}veclib_simd_kernels;
+
+/* Scalar: */
+static void svvadd_scalar(const float* a, const float* b, const int len, float* c){
+    int i;
+    for(i=0; i<len; i++)
+        c[i] = a[i] + b[i];
+}
+static void svvsub_scalar(const float* a, const float* b, const int len, float* c){
+    int i;
+    for(i=0; i<len; i++)
+        c[i] = a[i] - b[i];
+}
+static void svvmul_scalar(const float* a, const float* b, const int len, float* c){
+    int i;
+    for(i=0; i<len; i++)
+        c[i] = a[i] * b[i];
+}
+static void cvvmul_scalar(const float* a, const float* b, const int len, float* c){
+    int i;
+    for(i=0; i<len; i++){
+        c[2*i]   = a[2*i] * b[2*i]   - a[2*i+1] * b[2*i+1];
+        c[2*i+1] = a[2*i] * b[2*i+1] + a[2*i+1] * b[2*i];
+    }
+}
+static void cvvmuladd_scalar(const float* a, const float* b, const int len, float* c){
+    int i;
+    float re;
+    for(i=0; i<len; i++){
+        re        = a[2*i] * b[2*i]   - a[2*i+1] * b[2*i+1];
+        c[2*i+1] += a[2*i] * b[2*i+1] + a[2*i+1] * b[2*i];
+        c[2*i]   += re;
+    }
+}
+static void svsadd_scalar(const float* a, const float s, const int len, float* c){
+    int i;
+    for(i=0; i<len; i++)
+        c[i] = a[i] + s;
+}
+static void svssub_scalar(const float* a, const float s, const int len, float* c){
+    int i;
+    for(i=0; i<len; i++)
+        c[i] = a[i] - s;
+}
+static void svrecip_scalar(const float* a, const int len, float* c){
+    int i;
+    for(i=0; i<len; i++)
+        c[i] = 1.0f/a[i];
+}
+static void cvvmul_split_scalar(const float* ar, const float* ai, const float* br, const float* bi, const int len, float* cr, float* ci){
+    int i;
+    float re;
+    for(i=0; i<len; i++){
+        re    = ar[i] * br[i] - ai[i] * bi[i];
+        ci[i] = ar[i] * bi[i] + ai[i] * br[i];
+        cr[i] = re;
+    }
+}
+static void cvvmuladd_split_scalar(const float* ar, const float* ai, const float* br, const float* bi, const int len, float* cr, float* ci){
+    int i;
+    float re;
+    for(i=0; i<len; i++){
+        re     = ar[i] * br[i] - ai[i] * bi[i];
+        ci[i] += ar[i] * bi[i] + ai[i] * br[i];
+        cr[i] += re;
+    }
+}
+
+/* SSE, SSE2, SSE3: */
+SAF_TARGET_SSE3 static void svvadd_sse3(const float* a, const float* b, const int len, float* c){
+    int i;
+    for(i=0; i<(len-3); i+=4)
+        _mm_storeu_ps(c+i, _mm_add_ps(_mm_loadu_ps(a+i), _mm_loadu_ps(b+i)));
+    for(; i<len; i++)
+        c[i] = a[i] + b[i];
+}
+SAF_TARGET_SSE3 static void svvsub_sse3(const float* a, const float* b, const int len, float* c){
+    int i;
+    for(i=0; i<(len-3); i+=4)
+        _mm_storeu_ps(c+i, _mm_sub_ps(_mm_loadu_ps(a+i), _mm_loadu_ps(b+i)));
+    for(; i<len; i++)
+        c[i] = a[i] - b[i];
+}
+SAF_TARGET_SSE3 static void svvmul_sse3(const float* a, const float* b, const int len, float* c){
+    int i;
+    for(i=0; i<(len-3); i+=4)
+        _mm_storeu_ps(c+i, _mm_mul_ps(_mm_loadu_ps(a+i), _mm_loadu_ps(b+i)));
+    for(; i<len; i++)
+        c[i] = a[i] * b[i];
+}
+SAF_TARGET_SSE3 static void cvvmul_sse3(const float* a, const float* b, const int len, float* c){
+    int i;
+    for(i=0; i<(len-1); i+=2){
+        __m128 src1 = _mm_moveldup_ps(_mm_loadu_ps(a+2*i)); /* real parts of a */
+        __m128 src2 = _mm_loadu_ps(b+2*i);
+        __m128 tmp1 = _mm_mul_ps(src1, src2);
+        __m128 b1 = _mm_shuffle_ps(src2, src2, _MM_SHUFFLE(2, 3, 0, 1)); /* swap real+imag parts of b */
+        src1 = _mm_movehdup_ps(_mm_loadu_ps(a+2*i)); /* imag parts of a */
+        _mm_storeu_ps(c+2*i, _mm_addsub_ps(tmp1, _mm_mul_ps(src1, b1)));
+    }
+    cvvmul_scalar(a+2*i, b+2*i, len-i, c+2*i);
+}
+SAF_TARGET_SSE3 static void cvvmuladd_sse3(const float* a, const float* b, const int len, float* c){
+    int i;
+    for(i=0; i<(len-1); i+=2){
+        __m128 src1 = _mm_moveldup_ps(_mm_loadu_ps(a+2*i)); /* real parts of a */
+        __m128 src2 = _mm_loadu_ps(b+2*i);
+        __m128 tmp1 = _mm_mul_ps(src1, src2);
+        __m128 b1 = _mm_shuffle_ps(src2, src2, _MM_SHUFFLE(2, 3, 0, 1)); /* swap real+imag parts of b */
+        src1 = _mm_movehdup_ps(_mm_loadu_ps(a+2*i)); /* imag parts of a */
+        _mm_storeu_ps(c+2*i, _mm_add_ps(_mm_loadu_ps(c+2*i), _mm_addsub_ps(tmp1, _mm_mul_ps(src1, b1))));
+    }
+    cvvmuladd_scalar(a+2*i, b+2*i, len-i, c+2*i);
+}
+SAF_TARGET_SSE3 static void svsadd_sse3(const float* a, const float s, const int len, float* c){
+    int i;
+    __m128 s4 = _mm_set1_ps(s);
+    for(i=0; i<(len-3); i+=4)
+        _mm_storeu_ps(c+i, _mm_add_ps(_mm_loadu_ps(a+i), s4));
+    for(; i<len; i++)
+        c[i] = a[i] + s;
+}
+SAF_TARGET_SSE3 static void svssub_sse3(const float* a, const float s, const int len, float* c){
+    int i;
+    __m128 s4 = _mm_set1_ps(s);
+    for(i=0; i<(len-3); i+=4)
+        _mm_storeu_ps(c+i, _mm_sub_ps(_mm_loadu_ps(a+i), s4));
+    for(; i<len; i++)
+        c[i] = a[i] - s;
+}
+SAF_TARGET_SSE3 static void svrecip_sse3(const float* a, const int len, float* c){
+    int i;
+    for(i=0; i<(len-3); i+=4)
+        _mm_storeu_ps(c+i, _mm_rcp_ps(_mm_loadu_ps(a+i)));
+    for(; i<len; i++)
+        c[i] = 1.0f/a[i];
+}
+SAF_TARGET_SSE3 static void cvvmul_split_sse3(const float* ar, const float* ai, const float* br, const float* bi, const int len, float* cr, float* ci){
+    int i;
+    for(i=0; i<(len-3); i+=4){
+        __m128 xr = _mm_loadu_ps(ar+i), xi = _mm_loadu_ps(ai+i);
+        __m128 yr = _mm_loadu_ps(br+i), yi = _mm_loadu_ps(bi+i);
+        _mm_storeu_ps(cr+i, _mm_sub_ps(_mm_mul_ps(xr, yr), _mm_mul_ps(xi, yi)));
+        _mm_storeu_ps(ci+i, _mm_add_ps(_mm_mul_ps(xr, yi), _mm_mul_ps(xi, yr)));
+    }
+    cvvmul_split_scalar(ar+i, ai+i, br+i, bi+i, len-i, cr+i, ci+i);
+}
+SAF_TARGET_SSE3 static void cvvmuladd_split_sse3(const float* ar, const float* ai, const float* br, const float* bi, const int len, float* cr, float* ci){
+    int i;
+    for(i=0; i<(len-3); i+=4){
+        __m128 xr = _mm_loadu_ps(ar+i), xi = _mm_loadu_ps(ai+i);
+        __m128 yr = _mm_loadu_ps(br+i), yi = _mm_loadu_ps(bi+i);
+        __m128 re = _mm_sub_ps(_mm_mul_ps(xr, yr), _mm_mul_ps(xi, yi));
+        __m128 im = _mm_add_ps(_mm_mul_ps(xr, yi), _mm_mul_ps(xi, yr));
+        _mm_storeu_ps(cr+i, _mm_add_ps(_mm_loadu_ps(cr+i), re));
+        _mm_storeu_ps(ci+i, _mm_add_ps(_mm_loadu_ps(ci+i), im));
+    }
+    cvvmuladd_split_scalar(ar+i, ai+i, br+i, bi+i, len-i, cr+i, ci+i);
+}
+
+/* AVX, AVX2, FMA: */
+SAF_TARGET_AVX2 static void svvadd_avx2(const float* a, const float* b, const int len, float* c){
+    int i;
+    for(i=0; i<(len-7); i+=8)
+        _mm256_storeu_ps(c+i, _mm256_add_ps(_mm256_loadu_ps(a+i), _mm256_loadu_ps(b+i)));
+    for(; i<len; i++)
+        c[i] = a[i] + b[i];
+}
+SAF_TARGET_AVX2 static void svvsub_avx2(const float* a, const float* b, const int len, float* c){
+    int i;
+    for(i=0; i<(len-7); i+=8)
+        _mm256_storeu_ps(c+i, _mm256_sub_ps(_mm256_loadu_ps(a+i), _mm256_loadu_ps(b+i)));
+    for(; i<len; i++)
+        c[i] = a[i] - b[i];
+}
+SAF_TARGET_AVX2 static void svvmul_avx2(const float* a, const float* b, const int len, float* c){
+    int i;
+    for(i=0; i<(len-7); i+=8)
+        _mm256_storeu_ps(c+i, _mm256_mul_ps(_mm256_loadu_ps(a+i), _mm256_loadu_ps(b+i)));
+    for(; i<len; i++)
+        c[i] = a[i] * b[i];
+}
+SAF_TARGET_AVX2 static void cvvmul_avx2(const float* a, const float* b, const int len, float* c){
+    int i;
+    __m256i permute_ri = _mm256_set_epi32(6, 7, 4, 5, 2, 3, 0, 1);
+    for(i=0; i<(len-3); i+=4){
+        __m256 src1 = _mm256_moveldup_ps(_mm256_loadu_ps(a+2*i)); /* real parts of a */
+        __m256 src2 = _mm256_loadu_ps(b+2*i);
+        __m256 tmp1 = _mm256_mul_ps(src1, src2);
+        __m256 b1 = _mm256_permutevar8x32_ps(src2, permute_ri); /* swap real+imag parts of b */
+        src1 = _mm256_movehdup_ps(_mm256_loadu_ps(a+2*i)); /* imag parts of a */
+        _mm256_storeu_ps(c+2*i, _mm256_addsub_ps(tmp1, _mm256_mul_ps(src1, b1)));
+    }
+    cvvmul_scalar(a+2*i, b+2*i, len-i, c+2*i);
+}
+SAF_TARGET_AVX2 static void cvvmuladd_avx2(const float* a, const float* b, const int len, float* c){
+    int i;
+    __m256i permute_ri = _mm256_set_epi32(6, 7, 4, 5, 2, 3, 0, 1);
+    __m256 negate_re = _mm256_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f);
+    for(i=0; i<(len-3); i+=4){
+        __m256 src1 = _mm256_loadu_ps(a+2*i);
+        __m256 src2 = _mm256_loadu_ps(b+2*i);
+        __m256 b1 = _mm256_permutevar8x32_ps(src2, permute_ri); /* swap real+imag parts of b */
+        __m256 ai = _mm256_xor_ps(_mm256_movehdup_ps(src1), negate_re); /* |-b1|b1|-b2|b2|...| */
+        /* c + ar.*b + (+/-)ai.*swap(b), as two fused multiply-adds */
+        _mm256_storeu_ps(c+2*i, _mm256_fmadd_ps(_mm256_moveldup_ps(src1), src2, _mm256_fmadd_ps(ai, b1, _mm256_loadu_ps(c+2*i))));
+    }
+    cvvmuladd_sse3(a+2*i, b+2*i, len-i, c+2*i);
+}
+SAF_TARGET_AVX2 static void svsadd_avx2(const float* a, const float s, const int len, float* c){
+    int i;
+    __m256 s8 = _mm256_set1_ps(s);
+    for(i=0; i<(len-7); i+=8)
+        _mm256_storeu_ps(c+i, _mm256_add_ps(_mm256_loadu_ps(a+i), s8));
+    for(; i<len; i++)
+        c[i] = a[i] + s;
+}
+SAF_TARGET_AVX2 static void svssub_avx2(const float* a, const float s, const int len, float* c){
+    int i;
+    __m256 s8 = _mm256_set1_ps(s);
+    for(i=0; i<(len-7); i+=8)
+        _mm256_storeu_ps(c+i, _mm256_sub_ps(_mm256_loadu_ps(a+i), s8));
+    for(; i<len; i++)
+        c[i] = a[i] - s;
+}
+SAF_TARGET_AVX2 static void svrecip_avx2(const float* a, const int len, float* c){
+    int i;
+    for(i=0; i<(len-7); i+=8)
+        _mm256_storeu_ps(c+i, _mm256_rcp_ps(_mm256_loadu_ps(a+i)));
+    for(; i<len; i++)
+        c[i] = 1.0f/a[i];
+}
+SAF_TARGET_AVX2 static void cvvmul_split_avx2(const float* ar, const float* ai, const float* br, const float* bi, const int len, float* cr, float* ci){
+    int i;
+    for(i=0; i<(len-7); i+=8){
+        __m256 xr = _mm256_loadu_ps(ar+i), xi = _mm256_loadu_ps(ai+i);
+        __m256 yr = _mm256_loadu_ps(br+i), yi = _mm256_loadu_ps(bi+i);
+        _mm256_storeu_ps(cr+i, _mm256_fmsub_ps(xr, yr, _mm256_mul_ps(xi, yi)));
+        _mm256_storeu_ps(ci+i, _mm256_fmadd_ps(xr, yi, _mm256_mul_ps(xi, yr)));
+    }
+    cvvmul_split_sse3(ar+i, ai+i, br+i, bi+i, len-i, cr+i, ci+i);
+}
+SAF_TARGET_AVX2 static void cvvmuladd_split_avx2(const float* ar, const float* ai, const float* br, const float* bi, const int len, float* cr, float* ci){
+    int i;
+    for(i=0; i<(len-7); i+=8){
+        __m256 xr = _mm256_loadu_ps(ar+i), xi = _mm256_loadu_ps(ai+i);
+        __m256 yr = _mm256_loadu_ps(br+i), yi = _mm256_loadu_ps(bi+i);
+        _mm256_storeu_ps(cr+i, _mm256_fmadd_ps(xr, yr, _mm256_fnmadd_ps(xi, yi, _mm256_loadu_ps(cr+i))));
+        _mm256_storeu_ps(ci+i, _mm256_fmadd_ps(xr, yi, _mm256_fmadd_ps(xi, yr, _mm256_loadu_ps(ci+i))));
+    }
+    cvvmuladd_split_sse3(ar+i, ai+i, br+i, bi+i, len-i, cr+i, ci+i);
+}
+
+/* AVX-512F: */
+SAF_TARGET_AVX512 static void svvadd_avx512(const float* a, const float* b, const int len, float* c){
+    int i;
+    for(i=0; i<(len-15); i+=16)
+        _mm512_storeu_ps(c+i, _mm512_add_ps(_mm512_loadu_ps(a+i), _mm512_loadu_ps(b+i)));
+    for(; i<len; i++)
+        c[i] = a[i] + b[i];
+}
+SAF_TARGET_AVX512 static void svvsub_avx512(const float* a, const float* b, const int len, float* c){
+    int i;
+    for(i=0; i<(len-15); i+=16)
+        _mm512_storeu_ps(c+i, _mm512_sub_ps(_mm512_loadu_ps(a+i), _mm512_loadu_ps(b+i)));
+    for(; i<len; i++)
+        c[i] = a[i] - b[i];
+}
+SAF_TARGET_AVX512 static void svvmul_avx512(const float* a, const float* b, const int len, float* c){
+    int i;
+    for(i=0; i<(len-15); i+=16)
+        _mm512_storeu_ps(c+i, _mm512_mul_ps(_mm512_loadu_ps(a+i), _mm512_loadu_ps(b+i)));
+    for(; i<len; i++)
+        c[i] = a[i] * b[i];
+}
+SAF_TARGET_AVX512 static void cvvmul_avx512(const float* a, const float* b, const int len, float* c){
+    int i;
+    if(VECLIB_ARE_ALIGNED(a, b, c)){ /* no cache-line splits, so the aligned loads/stores may be used */
+        for(i=0; i<(len-7); i+=8){
+            __m512 src1 = _mm512_load_ps(a+2*i);
+            __m512 src2 = _mm512_load_ps(b+2*i);
+            __m512 b1 = _mm512_permute_ps(src2, _MM_SHUFFLE(2, 3, 0, 1));
+            __m512 tmp2 = _mm512_mul_ps(_mm512_movehdup_ps(src1), b1);
+            _mm512_store_ps(c+2*i, _mm512_fmaddsub_ps(_mm512_moveldup_ps(src1), src2, tmp2));
+        }
+        cvvmul_avx2(a+2*i, b+2*i, len-i, c+2*i);
+        return;
+    }
+    for(i=0; i<(len-7); i+=8){
+        __m512 src1 = _mm512_loadu_ps(a+2*i);
+        __m512 src2 = _mm512_loadu_ps(b+2*i);
+        __m512 b1 = _mm512_permute_ps(src2, _MM_SHUFFLE(2, 3, 0, 1)); /* swap real+imag parts of b */
+        __m512 tmp2 = _mm512_mul_ps(_mm512_movehdup_ps(src1), b1);  /* imag parts of a */
+        _mm512_storeu_ps(c+2*i, _mm512_fmaddsub_ps(_mm512_moveldup_ps(src1), src2, tmp2));
+    }
+    cvvmul_avx2(a+2*i, b+2*i, len-i, c+2*i);
+}
+SAF_TARGET_AVX512 static void cvvmuladd_avx512(const float* a, const float* b, const int len, float* c){
+    int i;
+    __m512i negate_re = _mm512_set1_epi64((long long)0x0000000080000000LL); /* sign bit of each real part */
+    if(VECLIB_ARE_ALIGNED(a, b, c)){
+        for(i=0; i<(len-7); i+=8){
+            __m512 src1 = _mm512_load_ps(a+2*i);
+            __m512 src2 = _mm512_load_ps(b+2*i);
+            __m512 b1 = _mm512_permute_ps(src2, _MM_SHUFFLE(2, 3, 0, 1));
+            __m512 ai = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_movehdup_ps(src1)), negate_re));
+            _mm512_store_ps(c+2*i, _mm512_fmadd_ps(_mm512_moveldup_ps(src1), src2, _mm512_fmadd_ps(ai, b1, _mm512_load_ps(c+2*i))));
+        }
+        cvvmuladd_avx2(a+2*i, b+2*i, len-i, c+2*i);
+        return;
+    }
+    for(i=0; i<(len-7); i+=8){
+        __m512 src1 = _mm512_loadu_ps(a+2*i);
+        __m512 src2 = _mm512_loadu_ps(b+2*i);
+        __m512 b1 = _mm512_permute_ps(src2, _MM_SHUFFLE(2, 3, 0, 1)); /* swap real+imag parts of b */
+        __m512 ai = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_movehdup_ps(src1)), negate_re));
+        _mm512_storeu_ps(c+2*i, _mm512_fmadd_ps(_mm512_moveldup_ps(src1), src2, _mm512_fmadd_ps(ai, b1, _mm512_loadu_ps(c+2*i))));
+    }
+    cvvmuladd_avx2(a+2*i, b+2*i, len-i, c+2*i);
+}
+SAF_TARGET_AVX512 static void svsadd_avx512(const float* a, const float s, const int len, float* c){
+    int i;
+    __m512 s16 = _mm512_set1_ps(s);
+    for(i=0; i<(len-15); i+=16)
+        _mm512_storeu_ps(c+i, _mm512_add_ps(_mm512_loadu_ps(a+i), s16));
+    for(; i<len; i++)
+        c[i] = a[i] + s;
+}
+SAF_TARGET_AVX512 static void svssub_avx512(const float* a, const float s, const int len, float* c){
+    int i;
+    __m512 s16 = _mm512_set1_ps(s);
+    for(i=0; i<(len-15); i+=16)
+        _mm512_storeu_ps(c+i, _mm512_sub_ps(_mm512_loadu_ps(a+i), s16));
+    for(; i<len; i++)
+        c[i] = a[i] - s;
+}
+SAF_TARGET_AVX512 static void svrecip_avx512(const float* a, const int len, float* c){
+    int i;
+    for(i=0; i<(len-15); i+=16)
+        _mm512_storeu_ps(c+i, _mm512_rcp14_ps(_mm512_loadu_ps(a+i)));
+    for(; i<len; i++)
+        c[i] = 1.0f/a[i];
+}
+SAF_TARGET_AVX512 static void cvvmul_split_avx512(const float* ar, const float* ai, const float* br, const float* bi, const int len, float* cr, float* ci){
+    int i;
+    for(i=0; i<(len-15); i+=16){
+        __m512 xr = _mm512_loadu_ps(ar+i), xi = _mm512_loadu_ps(ai+i);
+        __m512 yr = _mm512_loadu_ps(br+i), yi = _mm512_loadu_ps(bi+i);
+        _mm512_storeu_ps(cr+i, _mm512_fmsub_ps(xr, yr, _mm512_mul_ps(xi, yi)));
+        _mm512_storeu_ps(ci+i, _mm512_fmadd_ps(xr, yi, _mm512_mul_ps(xi, yr)));
+    }
+    cvvmul_split_avx2(ar+i, ai+i, br+i, bi+i, len-i, cr+i, ci+i);
+}
+SAF_TARGET_AVX512 static void cvvmuladd_split_avx512(const float* ar, const float* ai, const float* br, const float* bi, const int len, float* cr, float* ci){
+    int i;
+    for(i=0; i<(len-15); i+=16){
+        __m512 xr = _mm512_loadu_ps(ar+i), xi = _mm512_loadu_ps(ai+i);
+        __m512 yr = _mm512_loadu_ps(br+i), yi = _mm512_loadu_ps(bi+i);
+        _mm512_storeu_ps(cr+i, _mm512_fmadd_ps(xr, yr, _mm512_fnmadd_ps(xi, yi, _mm512_loadu_ps(cr+i))));
+        _mm512_storeu_ps(ci+i, _mm512_fmadd_ps(xr, yi, _mm512_fmadd_ps(xi, yr, _mm512_loadu_ps(ci+i))));
+    }
+    cvvmuladd_split_avx2(ar+i, ai+i, br+i, bi+i, len-i, cr+i, ci+i);
+}
+
+/** Kernel tables, indexed by SAF_SIMD_INSTRUCTION_SET */
+static const veclib_simd_kernels veclib_kernelTables[4] = {
+    { SAF_SIMD_NONE,   svvadd_scalar, svvsub_scalar, svvmul_scalar, cvvmul_scalar, cvvmuladd_scalar, svsadd_scalar, svssub_scalar, svrecip_scalar,
+                       cvvmul_split_scalar, cvvmuladd_split_scalar },
+    { SAF_SIMD_SSE3,   svvadd_sse3,   svvsub_sse3,   svvmul_sse3,   cvvmul_sse3,   cvvmuladd_sse3,   svsadd_sse3,   svssub_sse3,   svrecip_sse3,
+                       cvvmul_split_sse3,   cvvmuladd_split_sse3   },
+    { SAF_SIMD_AVX2,   svvadd_avx2,   svvsub_avx2,   svvmul_avx2,   cvvmul_avx2,   cvvmuladd_avx2,   svsadd_avx2,   svssub_avx2,   svrecip_avx2,
+                       cvvmul_split_avx2,   cvvmuladd_split_avx2   },
+    { SAF_SIMD_AVX512, svvadd_avx512, svvsub_avx512, svvmul_avx512, cvvmul_avx512, cvvmuladd_avx512, svsadd_avx512, svssub_avx512, svrecip_avx512,
+                       cvvmul_split_avx512, cvvmuladd_split_avx512 }
+};
+
+/** Currently selected kernel table (NULL until first use) */
+static const veclib_simd_kernels* veclib_activeKernels = NULL;
+
+/** Queries the host CPU for the most capable supported instruction set */
+static SAF_SIMD_INSTRUCTION_SET veclib_detectSIMDsupport(void)
+{
+# if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f"))
+        return SAF_SIMD_AVX512;
+    if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return SAF_SIMD_AVX2;
+    if(__builtin_cpu_supports("sse3"))
+        return SAF_SIMD_SSE3;
+    return SAF_SIMD_NONE;
+# elif defined(_MSC_VER)
+    int info[4], nIds;
+    unsigned long long xcr0;
+    int sse3, osxsave, avx, fma, avx2, avx512f;
+    __cpuid(info, 0);
+    nIds = info[0];
+    __cpuid(info, 1);
+    sse3    = (info[2] & (1<<0))  != 0;
+    fma     = (info[2] & (1<<12)) != 0;
+    osxsave = (info[2] & (1<<27)) != 0;
+    avx     = (info[2] & (1<<28)) != 0;
+    avx2 = avx512f = 0;
+    if(nIds>=7){
+        __cpuidex(info, 7, 0);
+        avx2    = (info[1] & (1<<5))  != 0;
+        avx512f = (info[1] & (1<<16)) != 0;
+    }
+    /* The OS must also preserve the extended register states upon context switches */
+    xcr0 = osxsave ? _xgetbv(0) : 0;
+    if(avx512f && (xcr0 & 0xE6)==0xE6)
+        return SAF_SIMD_AVX512;
+    if(avx && avx2 && fma && (xcr0 & 0x6)==0x6)
+        return SAF_SIMD_AVX2;
+    if(sse3)
+        return SAF_SIMD_SSE3;
+    return SAF_SIMD_NONE;
+# else
+    return SAF_SIMD_NONE;
+# endif
+}
+
+/** Returns the currently selected kernel table (selecting one upon first use) */
+static const veclib_simd_kernels* veclib_kernels(void)
+{
+    if(veclib_activeKernels==NULL)
+        veclib_activeKernels = &veclib_kernelTables[veclib_detectSIMDsupport()];
+    return veclib_activeKernels;
+}
+#endif /* SAF_ENABLE_SIMD_RUNTIME_DISPATCH */
+
+SAF_SIMD_INSTRUCTION_SET utility_getSIMDsupport(void)
+{
+#if defined(SAF_ENABLE_SIMD_RUNTIME_DISPATCH)
+    return veclib_detectSIMDsupport();
+#elif defined(SAF_ENABLE_SIMD) && defined(__AVX512F__)
+    return SAF_SIMD_AVX512;
+#elif defined(SAF_ENABLE_SIMD) && defined(__AVX__) && defined(__AVX2__)
+    return SAF_SIMD_AVX2;
+#elif defined(SAF_ENABLE_SIMD)
+    return SAF_SIMD_SSE3;
+#else
+    return SAF_SIMD_NONE;
+#endif
+}
+
+SAF_SIMD_INSTRUCTION_SET utility_getSIMDinstructionSet(void)
+{
+#if defined(SAF_ENABLE_SIMD_RUNTIME_DISPATCH)
+    return veclib_kernels()->isa;
+#else
+    return utility_getSIMDsupport();
+#endif
+}
+
+void utility_setSIMDinstructionSet
+(
+    SAF_SIMD_INSTRUCTION_SET isa
+)
+{
+#if defined(SAF_ENABLE_SIMD_RUNTIME_DISPATCH)
+    SAF_SIMD_INSTRUCTION_SET supported;
+    supported = veclib_detectSIMDsupport();
+    if((int)isa > (int)supported)
+        isa = supported;
+    veclib_activeKernels = &veclib_kernelTables[isa];
+#else
+    SAF_UNUSED(isa); /* fixed at compile-time */
+#endif
+}
+
 
 /* ========================================================================== */
 /*                     Built-in CBLAS Functions (Level 0)                     */
@@ -532,6 +1051,8 @@ void utility_svrecip
     vDSP_svdiv(&one, a, 1, c, 1, (vDSP_Length)len);
 #elif defined(SAF_USE_INTEL_MKL_LP64) || defined(SAF_USE_INTEL_MKL_ILP64)
     vmsInv(len, a, c, SAF_INTEL_MKL_VML_MODE);
+#elif defined(SAF_ENABLE_SIMD_RUNTIME_DISPATCH)
+    veclib_kernels()->svrecip(a, len, c);
 #elif defined(SAF_ENABLE_SIMD)
     int i;
     i = 0;
@@ -662,6 +1183,8 @@ void utility_svvadd
     vDSP_vadd(a, 1, b, 1, c, 1, (vDSP_Length)len);
 #elif defined(SAF_USE_INTEL_MKL_LP64) || defined(SAF_USE_INTEL_MKL_ILP64)
     vmsAdd(len, a, b, c, SAF_INTEL_MKL_VML_MODE);
+#elif defined(SAF_ENABLE_SIMD_RUNTIME_DISPATCH)
+    veclib_kernels()->svvadd(a, b, len, c);
 #elif defined(SAF_ENABLE_SIMD)
     int i;
     i = 0;
@@ -718,6 +1241,8 @@ void utility_cvvadd
     vDSP_vadd((float*)a, 1, (float*)b, 1, (float*)c, 1, /*re+im*/2*(vDSP_Length)len);
 #elif defined(SAF_USE_INTEL_MKL_LP64) || defined(SAF_USE_INTEL_MKL_ILP64)
     vmcAdd(len, (MKL_Complex8*)a, (MKL_Complex8*)b, (MKL_Complex8*)c, SAF_INTEL_MKL_VML_MODE);
+#elif defined(SAF_ENABLE_SIMD_RUNTIME_DISPATCH)
+    veclib_kernels()->svvadd((float*)a, (float*)b, /*re+im*/2*len, (float*)c);
 #elif defined(SAF_ENABLE_SIMD)
     int i, len2;
     float* sa, *sb, *sc;
@@ -875,6 +1400,8 @@ void utility_svvsub
     vDSP_vsub(b, 1, a, 1, c, 1, (vDSP_Length)len);        /* 'a' and 'b' are switched */
 #elif defined(SAF_USE_INTEL_MKL_LP64) || defined(SAF_USE_INTEL_MKL_ILP64)
     vmsSub(len, a, b, c, SAF_INTEL_MKL_VML_MODE);
+#elif defined(SAF_ENABLE_SIMD_RUNTIME_DISPATCH)
+    veclib_kernels()->svvsub(a, b, len, c);
 #elif defined(SAF_ENABLE_SIMD)
     int i;
     i = 0;
@@ -931,6 +1458,8 @@ void utility_cvvsub
     vDSP_vsub((float*)b, 1, (float*)a, 1, (float*)c, 1, /*re+im*/2*(vDSP_Length)len); /* 'a' and 'b' are switched */
 #elif defined(SAF_USE_INTEL_MKL_LP64) || defined(SAF_USE_INTEL_MKL_ILP64)
     vmcSub(len, (MKL_Complex8*)a, (MKL_Complex8*)b, (MKL_Complex8*)c, SAF_INTEL_MKL_VML_MODE);
+#elif defined(SAF_ENABLE_SIMD_RUNTIME_DISPATCH)
+    veclib_kernels()->svvsub((float*)a, (float*)b, /*re+im*/2*len, (float*)c);
 #elif defined(SAF_ENABLE_SIMD)
     int i, len2;
     float* sa, *sb, *sc;
@@ -1088,6 +1617,8 @@ void utility_svvmul
     vDSP_vmul(a, 1, b, 1, c, 1, (vDSP_Length)len);
 #elif defined(SAF_USE_INTEL_MKL_LP64) || defined(SAF_USE_INTEL_MKL_ILP64)
     vmsMul(len, a, b, c, SAF_INTEL_MKL_VML_MODE);
+#elif defined(SAF_ENABLE_SIMD_RUNTIME_DISPATCH)
+    veclib_kernels()->svvmul(a, b, len, c);
 #elif defined(SAF_ENABLE_SIMD)
     int i;
     i = 0;
@@ -1149,13 +1680,39 @@ void utility_cvvmul
     vDSP_vmmsb((float*)a/*real*/, 2, (float*)b/*real*/, 2, (float*)a+1/*imag*/, 2, (float*)b+1/*imag*/, 2, (float*)c/*real*/, 2, (vDSP_Length)len);
 #elif defined(SAF_USE_INTEL_MKL_LP64) || defined(SAF_USE_INTEL_MKL_ILP64)
     vmcMul(len, (MKL_Complex8*)a, (MKL_Complex8*)b, (MKL_Complex8*)c, SAF_INTEL_MKL_VML_MODE);
+#elif defined(SAF_ENABLE_SIMD_RUNTIME_DISPATCH)
+    veclib_kernels()->cvvmul((float*)a, (float*)b, len, (float*)c);
 #elif defined(SAF_ENABLE_SIMD)
     int i;
     float* sa, *sb, *sc;
     sa = (float*)a; sb = (float*)b; sc = (float*)c;
-# if (defined(__AVX__) && defined(__AVX2__)) || defined(__AVX512F__) /* I couldn't figure out an alternative for addsub with AVX-512... */
+    i = 0;
+# if defined(__AVX512F__) /* AVX-512 has no addsub, but fmaddsub does the same job (with one fewer multiply) */
+    if(VECLIB_ARE_ALIGNED(sa, sb, sc)){
+        /* Same as below, but with aligned loads/stores */
+        for(; i<(len-7); i+=8){
+            __m512 src1 = _mm512_load_ps(sa+2*i);
+            __m512 src2 = _mm512_load_ps(sb+2*i);
+            __m512 b1 = _mm512_permute_ps(src2, _MM_SHUFFLE(2, 3, 0, 1));
+            __m512 tmp2 = _mm512_mul_ps(_mm512_movehdup_ps(src1), b1);
+            _mm512_store_ps(sc+2*i, _mm512_fmaddsub_ps(_mm512_moveldup_ps(src1), src2, tmp2));
+        }
+    }
+    for(; i<(len-7); i+=8){
+        /* Load real+imag parts of a and b */
+        __m512 src1 = _mm512_loadu_ps(sa+2*i); /*|a1|b1|a2|b2|...|a8|b8|*/
+        __m512 src2 = _mm512_loadu_ps(sb+2*i); /*|c1|d1|c2|d2|...|c8|d8|*/
+        /* Swap the real+imag parts of b to be imag+real instead: */
+        __m512 b1 = _mm512_permute_ps(src2, _MM_SHUFFLE(2, 3, 0, 1)); /*|d1|c1|d2|c2|...|d8|c8|*/
+        /* Multiply with only the imag parts of a */
+        __m512 tmp2 = _mm512_mul_ps(_mm512_movehdup_ps(src1)/*|b1|b1|...|b8|b8|*/, b1);
+        /* Multiply the real parts of a with b, then subtract tmp2 from even indices and add to odd indices */
+        _mm512_storeu_ps(sc+2*i, _mm512_fmaddsub_ps(_mm512_moveldup_ps(src1)/*|a1|a1|...|a8|a8|*/, src2, tmp2));
+    }
+# endif
+# if defined(__AVX__) && defined(__AVX2__)
     __m256i permute_ri = _mm256_set_epi32(6, 7, 4, 5, 2, 3, 0, 1);
-    for(i=0; i<(len-3); i+=4){
+    for(; i<(len-3); i+=4){
         /* Load only the real parts of a */
         __m256 src1 = _mm256_moveldup_ps(_mm256_loadu_ps(sa+2*i)/*|a1|b1|a2|b2|a3|b3|a4|b4|*/); /*|a1|a1|a2|a2|a3|a3|a4|a4|*/
         /* Load real+imag parts of b */
@@ -1172,7 +1729,7 @@ void utility_cvvmul
         _mm256_storeu_ps(sc+2*i, _mm256_addsub_ps(tmp1, tmp2));
     }
 # elif defined(__SSE__) && defined(__SSE2__) && defined(__SSE3__)
-    for(i=0; i<(len-1); i+=2){
+    for(; i<(len-1); i+=2){
         /* Load only the real parts of a */
         __m128 src1 = _mm_moveldup_ps(_mm_loadu_ps(sa+2*i)/*|a1|b1|a2|b2|*/); /*|a1|a1|a2|a2|*/
         /* Load real+imag parts of b */
@@ -1215,6 +1772,257 @@ void utility_cvvmul
 #endif
 }
 
+void utility_cvvmuladd
+(
+    const float_complex* a,
+    const float_complex* b,
+    const int len,
+    float_complex* c
+)
+{
+    /* Checks: */
+#ifndef NDEBUG
+    saf_assert(a!=c && b!=c, "In-place operation is not supported.");
+#endif
+
+    /* The operation: */
+#if defined(SAF_USE_INTEL_IPP)
+    ippsAddProduct_32fc((Ipp32fc*)a, (Ipp32fc*)b, (Ipp32fc*)c, len);
+#elif defined(SAF_USE_APPLE_ACCELERATE)
+    DSPSplitComplex sa, sb, sc; /* (interleaved data may be described with a stride of 2) */
+    sa.realp = (float*)a; sa.imagp = (float*)a+1;
+    sb.realp = (float*)b; sb.imagp = (float*)b+1;
+    sc.realp = (float*)c; sc.imagp = (float*)c+1;
+    vDSP_zvma(&sa, 2, &sb, 2, &sc, 2, &sc, 2, (vDSP_Length)len);
+#elif defined(SAF_USE_INTEL_MKL_LP64) || defined(SAF_USE_INTEL_MKL_ILP64)
+    /* VML has no complex multiply-accumulate, so multiply in small (cache-resident) blocks and accumulate */
+    int i, blockLen;
+    MKL_Complex8 tmp[256];
+    for(i=0; i<len; i+=256){
+        blockLen = SAF_MIN(256, len-i);
+        vmcMul(blockLen, (MKL_Complex8*)(a+i), (MKL_Complex8*)(b+i), tmp, SAF_INTEL_MKL_VML_MODE);
+        cblas_saxpy(/*re+im*/2*blockLen, 1.0f, (float*)tmp, 1, (float*)(c+i), 1);
+    }
+#elif defined(SAF_ENABLE_SIMD_RUNTIME_DISPATCH)
+    veclib_kernels()->cvvmuladd((float*)a, (float*)b, len, (float*)c);
+#elif defined(SAF_ENABLE_SIMD)
+    int i;
+    float re;
+    float* sa, *sb, *sc;
+    sa = (float*)a; sb = (float*)b; sc = (float*)c;
+    i = 0;
+# if defined(__AVX512F__)
+    __m512i negate_re = _mm512_set1_epi64((long long)0x0000000080000000LL); /* sign bit of each real part */
+    if(VECLIB_ARE_ALIGNED(sa, sb, sc)){
+        /* Same as below, but with aligned loads/stores */
+        for(; i<(len-7); i+=8){
+            __m512 src1 = _mm512_load_ps(sa+2*i);
+            __m512 src2 = _mm512_load_ps(sb+2*i);
+            __m512 b1 = _mm512_permute_ps(src2, _MM_SHUFFLE(2, 3, 0, 1));
+            __m512 ai = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_movehdup_ps(src1)), negate_re));
+            _mm512_store_ps(sc+2*i, _mm512_fmadd_ps(_mm512_moveldup_ps(src1), src2, _mm512_fmadd_ps(ai, b1, _mm512_load_ps(sc+2*i))));
+        }
+    }
+    for(; i<(len-7); i+=8){
+        /* Load real+imag parts of a and b */
+        __m512 src1 = _mm512_loadu_ps(sa+2*i); /*|a1|b1|a2|b2|...|a8|b8|*/
+        __m512 src2 = _mm512_loadu_ps(sb+2*i); /*|c1|d1|c2|d2|...|c8|d8|*/
+        /* Swap the real+imag parts of b to be imag+real instead: */
+        __m512 b1 = _mm512_permute_ps(src2, _MM_SHUFFLE(2, 3, 0, 1)); /*|d1|c1|d2|c2|...|d8|c8|*/
+        /* Imag parts of a, with the sign flipped for the even indices */
+        __m512 ai = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_movehdup_ps(src1)), negate_re)); /*|-b1|b1|...|-b8|b8|*/
+        /* c + real(a).*b + ai.*b1 */
+        _mm512_storeu_ps(sc+2*i, _mm512_fmadd_ps(_mm512_moveldup_ps(src1), src2, _mm512_fmadd_ps(ai, b1, _mm512_loadu_ps(sc+2*i))));
+    }
+# endif
+# if defined(__AVX__) && defined(__AVX2__)
+    __m256i permute_ri = _mm256_set_epi32(6, 7, 4, 5, 2, 3, 0, 1);
+    for(; i<(len-3); i+=4){
+        /* Same as utility_cvvmul(), but with the result added to c */
+        __m256 src1 = _mm256_moveldup_ps(_mm256_loadu_ps(sa+2*i)); /*|a1|a1|a2|a2|a3|a3|a4|a4|*/
+        __m256 src2 = _mm256_loadu_ps(sb+2*i); /*|c1|d1|c2|d2|c3|d3|c4|d4|*/
+        __m256 tmp1 = _mm256_mul_ps(src1, src2);
+        __m256 b1 = _mm256_permutevar8x32_ps(src2, permute_ri);
+        src1 = _mm256_movehdup_ps(_mm256_loadu_ps(sa+2*i)); /*|b1|b1|b2|b2|b3|b3|b4|b4|*/
+        __m256 tmp2 = _mm256_mul_ps(src1, b1);
+        _mm256_storeu_ps(sc+2*i, _mm256_add_ps(_mm256_loadu_ps(sc+2*i), _mm256_addsub_ps(tmp1, tmp2)));
+    }
+# elif defined(__SSE__) && defined(__SSE2__) && defined(__SSE3__)
+    for(; i<(len-1); i+=2){
+        /* Same as utility_cvvmul(), but with the result added to c */
+        __m128 src1 = _mm_moveldup_ps(_mm_loadu_ps(sa+2*i)); /*|a1|a1|a2|a2|*/
+        __m128 src2 = _mm_loadu_ps(sb+2*i); /*|c1|d1|c2|d2|*/
+        __m128 tmp1 = _mm_mul_ps(src1, src2);
+        __m128 b1 = _mm_shuffle_ps(src2, src2, _MM_SHUFFLE(2, 3, 0, 1));
+        src1 = _mm_movehdup_ps(_mm_loadu_ps(sa+2*i)); /*|b1|b1|b2|b2|*/
+        __m128 tmp2 = _mm_mul_ps(src1, b1);
+        _mm_storeu_ps(sc+2*i, _mm_add_ps(_mm_loadu_ps(sc+2*i), _mm_addsub_ps(tmp1, tmp2)));
+    }
+# endif
+    for(;i<len; i++){ /* The residual (if len was not divisable by the step size): */
+        re         = sa[2*i] * sb[2*i]   - sa[2*i+1] * sb[2*i+1];
+        sc[2*i+1] += sa[2*i] * sb[2*i+1] + sa[2*i+1] * sb[2*i];
+        sc[2*i]   += re;
+    }
+#elif __STDC_VERSION__ >= 199901L
+    int i;
+    for (i = 0; i < len; i++)
+        c[i] += a[i] * b[i];
+#else
+    int i;
+    for (i = 0; i < len; i++)
+        c[i] = ccaddf(c[i], ccmulf(a[i], b[i]));
+#endif
+}
+
+void utility_cvvmuladd_batch
+(
+    const float_complex* a,
+    const int stride_a,
+    const float_complex* b,
+    const int stride_b,
+    const int len,
+    const int nBatch,
+    float_complex* c
+)
+{
+    int n;
+
+    /* Note that the accumulator, c, is only len long, and therefore remains in cache throughout */
+    for(n=0; n<nBatch; n++)
+        utility_cvvmuladd(a + n*stride_a, b + n*stride_b, len, c);
+}
+
+void utility_cvvmul_split
+(
+    const float* a_re,
+    const float* a_im,
+    const float* b_re,
+    const float* b_im,
+    const int len,
+    float* c_re,
+    float* c_im
+)
+{
+#if defined(SAF_USE_APPLE_ACCELERATE)
+    DSPSplitComplex sa, sb, sc;
+    sa.realp = (float*)a_re; sa.imagp = (float*)a_im;
+    sb.realp = (float*)b_re; sb.imagp = (float*)b_im;
+    sc.realp = c_re;         sc.imagp = c_im;
+    vDSP_zvmul(&sa, 1, &sb, 1, &sc, 1, (vDSP_Length)len, 1/*no conj*/);
+#elif defined(SAF_ENABLE_SIMD_RUNTIME_DISPATCH)
+    veclib_kernels()->cvvmul_split(a_re, a_im, b_re, b_im, len, c_re, c_im);
+#elif defined(SAF_ENABLE_SIMD)
+    int i;
+    float re;
+    i = 0;
+# if defined(__AVX512F__)
+    for(; i<(len-15); i+=16){
+        __m512 xr = _mm512_loadu_ps(a_re+i), xi = _mm512_loadu_ps(a_im+i);
+        __m512 yr = _mm512_loadu_ps(b_re+i), yi = _mm512_loadu_ps(b_im+i);
+        _mm512_storeu_ps(c_re+i, _mm512_fmsub_ps(xr, yr, _mm512_mul_ps(xi, yi)));
+        _mm512_storeu_ps(c_im+i, _mm512_fmadd_ps(xr, yi, _mm512_mul_ps(xi, yr)));
+    }
+# endif
+# if defined(__AVX__) && defined(__AVX2__)
+    for(; i<(len-7); i+=8){
+        __m256 xr = _mm256_loadu_ps(a_re+i), xi = _mm256_loadu_ps(a_im+i);
+        __m256 yr = _mm256_loadu_ps(b_re+i), yi = _mm256_loadu_ps(b_im+i);
+        _mm256_storeu_ps(c_re+i, _mm256_sub_ps(_mm256_mul_ps(xr, yr), _mm256_mul_ps(xi, yi)));
+        _mm256_storeu_ps(c_im+i, _mm256_add_ps(_mm256_mul_ps(xr, yi), _mm256_mul_ps(xi, yr)));
+    }
+# endif
+# if defined(__SSE__) && defined(__SSE2__) && defined(__SSE3__)
+    for(; i<(len-3); i+=4){
+        __m128 xr = _mm_loadu_ps(a_re+i), xi = _mm_loadu_ps(a_im+i);
+        __m128 yr = _mm_loadu_ps(b_re+i), yi = _mm_loadu_ps(b_im+i);
+        _mm_storeu_ps(c_re+i, _mm_sub_ps(_mm_mul_ps(xr, yr), _mm_mul_ps(xi, yi)));
+        _mm_storeu_ps(c_im+i, _mm_add_ps(_mm_mul_ps(xr, yi), _mm_mul_ps(xi, yr)));
+    }
+# endif
+    for(; i<len; i++){ /* The residual (if len was not divisable by the step size): */
+        re      = a_re[i] * b_re[i] - a_im[i] * b_im[i];
+        c_im[i] = a_re[i] * b_im[i] + a_im[i] * b_re[i];
+        c_re[i] = re;
+    }
+#else
+    int i;
+    float re;
+    for(i=0; i<len; i++){
+        re      = a_re[i] * b_re[i] - a_im[i] * b_im[i];
+        c_im[i] = a_re[i] * b_im[i] + a_im[i] * b_re[i];
+        c_re[i] = re;
+    }
+#endif
+}
+
+void utility_cvvmuladd_split
+(
+    const float* a_re,
+    const float* a_im,
+    const float* b_re,
+    const float* b_im,
+    const int len,
+    float* c_re,
+    float* c_im
+)
+{
+#if defined(SAF_USE_APPLE_ACCELERATE)
+    DSPSplitComplex sa, sb, sc;
+    sa.realp = (float*)a_re; sa.imagp = (float*)a_im;
+    sb.realp = (float*)b_re; sb.imagp = (float*)b_im;
+    sc.realp = c_re;         sc.imagp = c_im;
+    vDSP_zvma(&sa, 1, &sb, 1, &sc, 1, &sc, 1, (vDSP_Length)len);
+#elif defined(SAF_ENABLE_SIMD_RUNTIME_DISPATCH)
+    veclib_kernels()->cvvmuladd_split(a_re, a_im, b_re, b_im, len, c_re, c_im);
+#elif defined(SAF_ENABLE_SIMD)
+    int i;
+    float re;
+    i = 0;
+# if defined(__AVX512F__)
+    for(; i<(len-15); i+=16){
+        __m512 xr = _mm512_loadu_ps(a_re+i), xi = _mm512_loadu_ps(a_im+i);
+        __m512 yr = _mm512_loadu_ps(b_re+i), yi = _mm512_loadu_ps(b_im+i);
+        _mm512_storeu_ps(c_re+i, _mm512_fmadd_ps(xr, yr, _mm512_fnmadd_ps(xi, yi, _mm512_loadu_ps(c_re+i))));
+        _mm512_storeu_ps(c_im+i, _mm512_fmadd_ps(xr, yi, _mm512_fmadd_ps(xi, yr, _mm512_loadu_ps(c_im+i))));
+    }
+# endif
+# if defined(__AVX__) && defined(__AVX2__)
+    for(; i<(len-7); i+=8){
+        __m256 xr = _mm256_loadu_ps(a_re+i), xi = _mm256_loadu_ps(a_im+i);
+        __m256 yr = _mm256_loadu_ps(b_re+i), yi = _mm256_loadu_ps(b_im+i);
+        __m256 re8 = _mm256_sub_ps(_mm256_mul_ps(xr, yr), _mm256_mul_ps(xi, yi));
+        __m256 im8 = _mm256_add_ps(_mm256_mul_ps(xr, yi), _mm256_mul_ps(xi, yr));
+        _mm256_storeu_ps(c_re+i, _mm256_add_ps(_mm256_loadu_ps(c_re+i), re8));
+        _mm256_storeu_ps(c_im+i, _mm256_add_ps(_mm256_loadu_ps(c_im+i), im8));
+    }
+# endif
+# if defined(__SSE__) && defined(__SSE2__) && defined(__SSE3__)
+    for(; i<(len-3); i+=4){
+        __m128 xr = _mm_loadu_ps(a_re+i), xi = _mm_loadu_ps(a_im+i);
+        __m128 yr = _mm_loadu_ps(b_re+i), yi = _mm_loadu_ps(b_im+i);
+        __m128 re4 = _mm_sub_ps(_mm_mul_ps(xr, yr), _mm_mul_ps(xi, yi));
+        __m128 im4 = _mm_add_ps(_mm_mul_ps(xr, yi), _mm_mul_ps(xi, yr));
+        _mm_storeu_ps(c_re+i, _mm_add_ps(_mm_loadu_ps(c_re+i), re4));
+        _mm_storeu_ps(c_im+i, _mm_add_ps(_mm_loadu_ps(c_im+i), im4));
+    }
+# endif
+    for(; i<len; i++){ /* The residual (if len was not divisable by the step size): */
+        re       = a_re[i] * b_re[i] - a_im[i] * b_im[i];
+        c_im[i] += a_re[i] * b_im[i] + a_im[i] * b_re[i];
+        c_re[i] += re;
+    }
+#else
+    int i;
+    float re;
+    for(i=0; i<len; i++){
+        re       = a_re[i] * b_re[i] - a_im[i] * b_im[i];
+        c_im[i] += a_re[i] * b_im[i] + a_im[i] * b_re[i];
+        c_re[i] += re;
+    }
+#endif
+}
+
 
 /* ========================================================================== */
 /*                     Vector-Vector Dot Product (?vvdot)                     */
@@ -1388,6 +2196,8 @@ void utility_svsadd
     ippsAddC_32f((Ipp32f*)a, (Ipp32f)s[0], (Ipp32f*)c, len);
 #elif defined(SAF_USE_APPLE_ACCELERATE)
     vDSP_vsadd(a, 1, s, c, 1, (vDSP_Length)len);
+#elif defined(SAF_ENABLE_SIMD_RUNTIME_DISPATCH)
+    veclib_kernels()->svsadd(a, s[0], len, c);
 #elif defined(SAF_ENABLE_SIMD)
     int i;
 # if defined(__AVX512F__)
@@ -1431,6 +2241,8 @@ void utility_svssub
     float inv_s;
     inv_s = -s[0];
     vDSP_vsadd(a, 1, &inv_s, c, 1, (vDSP_Length)len);
+#elif defined(SAF_ENABLE_SIMD_RUNTIME_DISPATCH)
+    veclib_kernels()->svssub(a, s[0], len, c);
 #elif defined(SAF_ENABLE_SIMD)
     int i;
 # if defined(__AVX512F__)
@@ -1521,6 +2333,8 @@ void utility_ssvd_create(void ** const phWork, int maxDim1, int maxDim2)
 {
     *phWork = malloc1d(sizeof(utility_ssvd_data));
     utility_ssvd_data *h = (utility_ssvd_data*)(*phWork);
+    veclib_int m, n, info;
+    float wkopt;
 
     h->maxDim1 = maxDim1;
     h->maxDim2 = maxDim2;
@@ -1530,6 +2344,20 @@ void utility_ssvd_create(void ** const phWork, int maxDim1, int maxDim2)
     h->u = malloc1d(maxDim1*maxDim1*sizeof(float));
     h->vt = malloc1d(maxDim2*maxDim2*sizeof(float));
     h->work = NULL;
+
+    /* Allocate the "work" memory required for the maximum dimensions now, rather than upon the first call */
+    m = maxDim1; n = maxDim2;
+    wkopt = 0.0f;
+#if defined(SAF_VECLIB_USE_LAPACK_FORTRAN_INTERFACE)
+    h->currentWorkSize = -1;
+    sgesvd_( "A", "A", &m, &n, h->a, &m, h->s, h->u, &m, h->vt, &n, &wkopt, &(h->currentWorkSize), &info );
+#elif defined(SAF_VECLIB_USE_LAPACKE_INTERFACE)
+    info = LAPACKE_sgesvd_work(CblasColMajor, 'A', 'A', m, n, h->a, m, h->s, h->u, m, h->vt, n, &wkopt, -1);
+#endif
+    SAF_UNUSED(info);
+    h->currentWorkSize = (veclib_int)wkopt;
+    if(h->currentWorkSize>0)
+        h->work = malloc1d(h->currentWorkSize*sizeof(float));
 }
 
 void utility_ssvd_destroy(void ** const phWork)
@@ -1666,6 +2494,8 @@ void utility_csvd_create(void ** const phWork, int maxDim1, int maxDim2)
 {
     *phWork = malloc1d(sizeof(utility_csvd_data));
     utility_csvd_data *h = (utility_csvd_data*)(*phWork);
+    veclib_int m, n, info;
+    float_complex wkopt;
 
     h->maxDim1 = maxDim1;
     h->maxDim2 = maxDim2;
@@ -1676,6 +2506,22 @@ void utility_csvd_create(void ** const phWork, int maxDim1, int maxDim2)
     h->vt = malloc1d(maxDim2*maxDim2*sizeof(float_complex));
     h->rwork = malloc1d(maxDim1*SAF_MAX(1, 5*SAF_MIN(maxDim2,maxDim1))*sizeof(float));
     h->work = NULL;
+
+    /* Allocate the "work" memory required for the maximum dimensions now, rather than upon the first call */
+    m = maxDim1; n = maxDim2;
+    wkopt = cmplxf(0.0f, 0.0f);
+#if defined(SAF_VECLIB_USE_LAPACK_FORTRAN_INTERFACE)
+    h->currentWorkSize = -1;
+    cgesvd_( "A", "A", &m, &n, (veclib_float_complex*)h->a, &m, h->s, (veclib_float_complex*)h->u, &m,
+            (veclib_float_complex*)h->vt, &n, (veclib_float_complex*)&wkopt, &(h->currentWorkSize), h->rwork, &info );
+#elif defined(SAF_VECLIB_USE_LAPACKE_INTERFACE)
+    info = LAPACKE_cgesvd_work(CblasColMajor, 'A', 'A', m, n, (veclib_float_complex*)h->a, m, h->s, (veclib_float_complex*)h->u, m,
+                               (veclib_float_complex*)h->vt, n, (veclib_float_complex*)&wkopt, -1, h->rwork);
+#endif
+    SAF_UNUSED(info);
+    h->currentWorkSize = (veclib_int)(crealf(wkopt)+0.01f);
+    if(h->currentWorkSize>0)
+        h->work = malloc1d(h->currentWorkSize*sizeof(float_complex));
 }
 
 void utility_csvd_destroy(void ** const phWork)
@@ -1836,12 +2682,28 @@ void utility_sseig_create(void ** const phWork, int maxDim)
 {
     *phWork = malloc1d(sizeof(utility_sseig_data));
     utility_sseig_data *h = (utility_sseig_data*)(*phWork);
+    veclib_int n, info;
+    float wkopt;
 
     h->maxDim = maxDim;
     h->currentWorkSize = 0;
     h->w = malloc1d(maxDim*sizeof(float));
     h->a = malloc1d(maxDim*maxDim*sizeof(float));
     h->work = NULL;
+
+    /* Allocate the "work" memory required for the maximum dimensions now, rather than upon the first call */
+    n = maxDim;
+    wkopt = 0.0f;
+#if defined(SAF_VECLIB_USE_LAPACK_FORTRAN_INTERFACE)
+    h->currentWorkSize = -1;
+    ssyev_( "Vectors", "Upper", &n, h->a, &n, h->w, &wkopt, &(h->currentWorkSize), &info );
+#elif defined(SAF_VECLIB_USE_LAPACKE_INTERFACE)
+    info = LAPACKE_ssyev_work(CblasColMajor, 'V', 'U', n, h->a, n, h->w, &wkopt, -1);
+#endif
+    SAF_UNUSED(info);
+    h->currentWorkSize = (veclib_int)wkopt;
+    if(h->currentWorkSize>0)
+        h->work = malloc1d(h->currentWorkSize*sizeof(float));
 }
 
 void utility_sseig_destroy(void ** const phWork)
@@ -1975,12 +2837,26 @@ void utility_cseig_create(void ** const phWork, int maxDim)
 {
     *phWork = malloc1d(sizeof(utility_cseig_data));
     utility_cseig_data *h = (utility_cseig_data*)(*phWork);
+    veclib_int n, lwork, info;
+    float_complex wkopt;
 
     h->maxDim = maxDim;
     h->currentWorkSize = SAF_MAX(1, 2*maxDim-1);
     h->rwork = malloc1d((3*maxDim-2)*sizeof(float));
     h->w = malloc1d(maxDim*sizeof(float));
     h->a = malloc1d(maxDim*maxDim*sizeof(float_complex));
+
+    /* Allocate the "work" memory required for the maximum dimensions now, rather than upon the first call */
+    n = maxDim;
+    lwork = -1;
+    wkopt = cmplxf(0.0f, 0.0f);
+#if defined(SAF_VECLIB_USE_LAPACK_FORTRAN_INTERFACE)
+    cheev_( "Vectors", "Upper", &n, (veclib_float_complex*)h->a, &n, h->w, (veclib_float_complex*)&wkopt, &lwork, h->rwork, &info );
+#elif defined(SAF_VECLIB_USE_LAPACKE_INTERFACE)
+    info = LAPACKE_cheev_work(CblasColMajor, 'V', 'U', n, (veclib_float_complex*)h->a, n, h->w, (veclib_float_complex*)&wkopt, lwork, h->rwork);
+#endif
+    SAF_UNUSED(info);
+    h->currentWorkSize = SAF_MAX(h->currentWorkSize, (veclib_int)crealf(wkopt));
     h->work = malloc1d(h->currentWorkSize*sizeof(float_complex));
 }
 
@@ -2680,6 +3556,838 @@ void utility_zeig
 }
 
 
+/* ========================================================================== */
+/*               Batched Decompositions (?seig_batch, ?svd_batch)             */
+/* ========================================================================== */
+
+/** Number of matrices decomposed together by the Jacobi kernels (i.e. one
+ *  AVX-512 register's worth of floats) */
+#define VECLIB_JACOBI_WIDTH ( 16 )
+/** Largest dimension for which the Jacobi eigenvalue kernel is used (beyond
+ *  which, LAPACK is faster, despite its per-call overhead) */
+#define VECLIB_JACOBI_EIG_MAX_DIM ( 6 )
+/** Largest dimension for which the Jacobi singular value kernel is used */
+#define VECLIB_JACOBI_SVD_MAX_DIM ( 16 )
+/** Largest dimension supported by the Jacobi kernels */
+#define VECLIB_JACOBI_MAX_DIM ( 16 )
+/** Maximum number of Jacobi sweeps */
+#define VECLIB_JACOBI_MAX_SWEEPS ( 24 )
+/** Relative size of the off-diagonal elements at which a sweep is deemed to
+ *  have converged */
+#define VECLIB_JACOBI_TOL ( 2e-7f )
+/** Index into a group of matrices stored in the Jacobi (structure-of-arrays)
+ *  layout, such that the loops over the matrices (b) may be vectorised */
+#define VECLIB_JIDX(i,j,n) ( ((i)*(n)+(j))*VECLIB_JACOBI_WIDTH )
+
+/** In-place square root of one group of (non-negative) values */
+static void veclib_jacobi_sqrt
+(
+    float* x
+)
+{
+    int b;
+#if defined(SAF_ENABLE_SIMD)
+    for(b=0; b<VECLIB_JACOBI_WIDTH; b+=4)
+        _mm_storeu_ps(x+b, _mm_sqrt_ps(_mm_loadu_ps(x+b)));
+#else
+    for(b=0; b<VECLIB_JACOBI_WIDTH; b++)
+        x[b] = sqrtf(x[b]);
+#endif
+}
+
+/**
+ * Computes the parameters of the Jacobi rotations
+ * G = [c, s; -conj(s), c], which diagonalise the 2x2 Hermitian matrices
+ * [app, apq; conj(apq), aqq], for each matrix of the group. The diagonal of the
+ * rotated 2x2 matrices is then [app-shift, aqq+shift].
+ */
+static void veclib_jacobi_rotations
+(
+    const float* app,
+    const float* aqq,
+    const float* apq_re,
+    const float* apq_im,
+    float* c,
+    float* s_re,
+    float* s_im,
+    float* shift
+)
+{
+    int b;
+    float r[VECLIB_JACOBI_WIDTH], rr[VECLIB_JACOBI_WIDTH], tau[VECLIB_JACOBI_WIDTH];
+    float t[VECLIB_JACOBI_WIDTH], sq[VECLIB_JACOBI_WIDTH];
+
+    /* The square roots are taken in separate loops, so that the remaining loops may be vectorised */
+    for(b=0; b<VECLIB_JACOBI_WIDTH; b++)
+        r[b] = apq_re[b]*apq_re[b] + apq_im[b]*apq_im[b];
+    veclib_jacobi_sqrt(r);
+    for(b=0; b<VECLIB_JACOBI_WIDTH; b++){
+        rr[b] = r[b] > FLT_MIN ? r[b] : 1.0f;
+        tau[b] = (aqq[b]-app[b])/(2.0f*rr[b]);
+        sq[b] = 1.0f + tau[b]*tau[b];
+    }
+    veclib_jacobi_sqrt(sq);
+    for(b=0; b<VECLIB_JACOBI_WIDTH; b++){
+        t[b] = (tau[b] < 0.0f ? -1.0f : 1.0f)/(fabsf(tau[b]) + sq[b]);
+        t[b] = r[b] > FLT_MIN ? t[b] : 0.0f;
+        sq[b] = 1.0f + t[b]*t[b];
+    }
+    veclib_jacobi_sqrt(sq);
+    for(b=0; b<VECLIB_JACOBI_WIDTH; b++){
+        c[b] = 1.0f/sq[b];
+        s_re[b] = t[b]*c[b]*apq_re[b]/rr[b];
+        s_im[b] = t[b]*c[b]*apq_im[b]/rr[b];
+        shift[b] = t[b]*r[b];
+    }
+}
+
+/**
+ * Applies the Jacobi rotations to columns p and q, i.e. X = X*G
+ *
+ * @note The results are first written to local arrays, since the compiler
+ *       cannot otherwise prove that the four rows do not overlap, and would
+ *       therefore not vectorise the inner loop.
+ */
+static void veclib_jacobi_rotateColumns
+(
+    float* xr,
+    float* xi,
+    int nRows,
+    int nCols,
+    int p,
+    int q,
+    const float* c_in,
+    const float* s_re_in,
+    const float* s_im_in
+)
+{
+    int k, b;
+    float* pr, *pi, *qr, *qi;
+    float c[VECLIB_JACOBI_WIDTH], s_re[VECLIB_JACOBI_WIDTH], s_im[VECLIB_JACOBI_WIDTH];
+    float yr[4][VECLIB_JACOBI_WIDTH];
+
+    memcpy(c, c_in, VECLIB_JACOBI_WIDTH*sizeof(float));
+    memcpy(s_re, s_re_in, VECLIB_JACOBI_WIDTH*sizeof(float));
+    memcpy(s_im, s_im_in, VECLIB_JACOBI_WIDTH*sizeof(float));
+    for(k=0; k<nRows; k++){
+        pr = &xr[VECLIB_JIDX(k,p,nCols)]; pi = &xi[VECLIB_JIDX(k,p,nCols)];
+        qr = &xr[VECLIB_JIDX(k,q,nCols)]; qi = &xi[VECLIB_JIDX(k,q,nCols)];
+        for(b=0; b<VECLIB_JACOBI_WIDTH; b++){
+            yr[0][b] = c[b]*pr[b] - (s_re[b]*qr[b] + s_im[b]*qi[b]); /* c*x_p - conj(s)*x_q */
+            yr[1][b] = c[b]*pi[b] - (s_re[b]*qi[b] - s_im[b]*qr[b]);
+            yr[2][b] = s_re[b]*pr[b] - s_im[b]*pi[b] + c[b]*qr[b];   /* s*x_p + c*x_q */
+            yr[3][b] = s_re[b]*pi[b] + s_im[b]*pr[b] + c[b]*qi[b];
+        }
+        memcpy(pr, yr[0], VECLIB_JACOBI_WIDTH*sizeof(float));
+        memcpy(pi, yr[1], VECLIB_JACOBI_WIDTH*sizeof(float));
+        memcpy(qr, yr[2], VECLIB_JACOBI_WIDTH*sizeof(float));
+        memcpy(qi, yr[3], VECLIB_JACOBI_WIDTH*sizeof(float));
+    }
+}
+
+/** Sets a group of matrices (nCols x nCols) to identity */
+static void veclib_jacobi_identity
+(
+    float* xr,
+    float* xi,
+    int n
+)
+{
+    int i, b;
+    memset(xr, 0, n*n*VECLIB_JACOBI_WIDTH*sizeof(float));
+    memset(xi, 0, n*n*VECLIB_JACOBI_WIDTH*sizeof(float));
+    for(i=0; i<n; i++)
+        for(b=0; b<VECLIB_JACOBI_WIDTH; b++)
+            xr[VECLIB_JIDX(i,i,n)+b] = 1.0f;
+}
+
+/**
+ * Cyclic Jacobi eigenvalue decomposition of a group of Hermitian matrices
+ * (n x n), stored in the Jacobi layout. Upon return, the diagonals of 'a' hold
+ * the (unsorted) eigenvalues, and the columns of 'v' the eigenvectors.
+ */
+static void veclib_jacobi_cseig
+(
+    float* ar,
+    float* ai,
+    int n,
+    float* vr,
+    float* vi
+)
+{
+    int p, q, k, b, sweep, converged;
+    float c[VECLIB_JACOBI_WIDTH], s_re[VECLIB_JACOBI_WIDTH], s_im[VECLIB_JACOBI_WIDTH];
+    float shift[VECLIB_JACOBI_WIDTH], app[VECLIB_JACOBI_WIDTH], aqq[VECLIB_JACOBI_WIDTH];
+    float off[VECLIB_JACOBI_WIDTH], tot[VECLIB_JACOBI_WIDTH];
+
+    veclib_jacobi_identity(vr, vi, n);
+    for(sweep=0; sweep<VECLIB_JACOBI_MAX_SWEEPS; sweep++){
+        /* Converged once the off-diagonal energy is negligible for all matrices */
+        memset(off, 0, VECLIB_JACOBI_WIDTH*sizeof(float));
+        memset(tot, 0, VECLIB_JACOBI_WIDTH*sizeof(float));
+        for(p=0; p<n; p++){
+            for(b=0; b<VECLIB_JACOBI_WIDTH; b++)
+                tot[b] += ar[VECLIB_JIDX(p,p,n)+b]*ar[VECLIB_JIDX(p,p,n)+b];
+            for(q=p+1; q<n; q++)
+                for(b=0; b<VECLIB_JACOBI_WIDTH; b++)
+                    off[b] += ar[VECLIB_JIDX(p,q,n)+b]*ar[VECLIB_JIDX(p,q,n)+b] + ai[VECLIB_JIDX(p,q,n)+b]*ai[VECLIB_JIDX(p,q,n)+b];
+        }
+        converged = 1;
+        for(b=0; b<VECLIB_JACOBI_WIDTH; b++)
+            converged &= off[b] <= VECLIB_JACOBI_TOL*VECLIB_JACOBI_TOL*tot[b];
+        if(converged)
+            break;
+
+        /* Sweep over all off-diagonal elements */
+        for(p=0; p<n-1; p++){
+            for(q=p+1; q<n; q++){
+                memcpy(app, &ar[VECLIB_JIDX(p,p,n)], VECLIB_JACOBI_WIDTH*sizeof(float));
+                memcpy(aqq, &ar[VECLIB_JIDX(q,q,n)], VECLIB_JACOBI_WIDTH*sizeof(float));
+                veclib_jacobi_rotations(app, aqq, &ar[VECLIB_JIDX(p,q,n)], &ai[VECLIB_JIDX(p,q,n)], c, s_re, s_im, shift);
+
+                /* A = G^H*A*G; only the columns are rotated, since rows p and q then follow from the Hermitian symmetry
+                 * (and the 2x2 block from the rotation parameters) */
+                veclib_jacobi_rotateColumns(ar, ai, n, n, p, q, c, s_re, s_im);
+                for(k=0; k<n; k++){
+                    if(k==p || k==q)
+                        continue;
+                    for(b=0; b<VECLIB_JACOBI_WIDTH; b++){
+                        ar[VECLIB_JIDX(p,k,n)+b] =  ar[VECLIB_JIDX(k,p,n)+b];
+                        ai[VECLIB_JIDX(p,k,n)+b] = -ai[VECLIB_JIDX(k,p,n)+b];
+                        ar[VECLIB_JIDX(q,k,n)+b] =  ar[VECLIB_JIDX(k,q,n)+b];
+                        ai[VECLIB_JIDX(q,k,n)+b] = -ai[VECLIB_JIDX(k,q,n)+b];
+                    }
+                }
+                for(b=0; b<VECLIB_JACOBI_WIDTH; b++){
+                    ar[VECLIB_JIDX(p,p,n)+b] = app[b] - shift[b];
+                    ar[VECLIB_JIDX(q,q,n)+b] = aqq[b] + shift[b];
+                    ar[VECLIB_JIDX(p,q,n)+b] = ai[VECLIB_JIDX(p,q,n)+b] = 0.0f;
+                    ar[VECLIB_JIDX(q,p,n)+b] = ai[VECLIB_JIDX(q,p,n)+b] = 0.0f;
+                    ai[VECLIB_JIDX(p,p,n)+b] = ai[VECLIB_JIDX(q,q,n)+b] = 0.0f;
+                }
+                veclib_jacobi_rotateColumns(vr, vi, n, n, p, q, c, s_re, s_im);
+            }
+        }
+    }
+    for(k=0; k<n; k++)
+        for(b=0; b<VECLIB_JACOBI_WIDTH; b++)
+            ai[VECLIB_JIDX(k,k,n)+b] = 0.0f;
+}
+
+/**
+ * One-sided (Hestenes) Jacobi singular value decomposition of a group of
+ * matrices (m x n, m>=n), stored in the Jacobi layout. Upon return, the
+ * columns of 'x' are orthogonal (i.e. U*diag(sing)), and 'v' holds the right
+ * singular vectors, such that x_in = x_out*v^H.
+ */
+static void veclib_jacobi_csvd
+(
+    float* xr,
+    float* xi,
+    int m,
+    int n,
+    float* vr,
+    float* vi
+)
+{
+    int p, q, k, b, sweep, converged;
+    float c[VECLIB_JACOBI_WIDTH], s_re[VECLIB_JACOBI_WIDTH], s_im[VECLIB_JACOBI_WIDTH];
+    float alpha[VECLIB_JACOBI_WIDTH], beta[VECLIB_JACOBI_WIDTH];
+    float gamma_re[VECLIB_JACOBI_WIDTH], gamma_im[VECLIB_JACOBI_WIDTH], shift[VECLIB_JACOBI_WIDTH];
+    const float* pr, *pi, *qr, *qi;
+
+    veclib_jacobi_identity(vr, vi, n);
+    for(sweep=0; sweep<VECLIB_JACOBI_MAX_SWEEPS; sweep++){
+        converged = 1;
+        for(p=0; p<n-1; p++){
+            for(q=p+1; q<n; q++){
+                /* Gram matrix of columns p and q: [alpha, gamma; conj(gamma), beta] */
+                memset(alpha, 0, VECLIB_JACOBI_WIDTH*sizeof(float));
+                memset(beta, 0, VECLIB_JACOBI_WIDTH*sizeof(float));
+                memset(gamma_re, 0, VECLIB_JACOBI_WIDTH*sizeof(float));
+                memset(gamma_im, 0, VECLIB_JACOBI_WIDTH*sizeof(float));
+                for(k=0; k<m; k++){
+                    pr = &xr[VECLIB_JIDX(k,p,n)]; pi = &xi[VECLIB_JIDX(k,p,n)];
+                    qr = &xr[VECLIB_JIDX(k,q,n)]; qi = &xi[VECLIB_JIDX(k,q,n)];
+                    for(b=0; b<VECLIB_JACOBI_WIDTH; b++){
+                        alpha[b] += pr[b]*pr[b] + pi[b]*pi[b];
+                        beta[b] += qr[b]*qr[b] + qi[b]*qi[b];
+                        gamma_re[b] += pr[b]*qr[b] + pi[b]*qi[b];
+                        gamma_im[b] += pr[b]*qi[b] - pi[b]*qr[b];
+                    }
+                }
+                for(b=0; b<VECLIB_JACOBI_WIDTH; b++)
+                    converged &= (gamma_re[b]*gamma_re[b] + gamma_im[b]*gamma_im[b]) <= VECLIB_JACOBI_TOL*VECLIB_JACOBI_TOL*alpha[b]*beta[b];
+
+                /* Orthogonalise the two columns */
+                veclib_jacobi_rotations(alpha, beta, gamma_re, gamma_im, c, s_re, s_im, shift);
+                veclib_jacobi_rotateColumns(xr, xi, m, n, p, q, c, s_re, s_im);
+                veclib_jacobi_rotateColumns(vr, vi, n, n, p, q, c, s_re, s_im);
+            }
+        }
+        if(converged)
+            break;
+    }
+}
+
+/**
+ * Completes the columns of a unitary matrix (FLAT: m x m, row-major), for which
+ * only the columns flagged in 'isSet' are orthonormal, via Gram-Schmidt on the
+ * standard basis vectors
+ */
+static void veclib_completeUnitary
+(
+    float_complex* U,
+    int m,
+    int* isSet
+)
+{
+    int j, l, k, e, pass;
+    float norm2, scale, proj_re, proj_im, ur, ui;
+    float* pU;
+
+    /* (written out in real arithmetic, since complex multiplication may not be inlined by the compiler) */
+    pU = (float*)U;
+    e = 0;
+    for(j=0; j<m; j++){
+        if(isSet[j])
+            continue;
+        for(; e<m; e++){
+            /* Start from the e-th standard basis vector, and project out all set columns (twice, for numerical stability) */
+            for(k=0; k<m; k++){
+                pU[2*(k*m+j)] = k==e ? 1.0f : 0.0f;
+                pU[2*(k*m+j)+1] = 0.0f;
+            }
+            for(pass=0; pass<2; pass++){
+                for(l=0; l<m; l++){
+                    if(!isSet[l])
+                        continue;
+                    proj_re = proj_im = 0.0f;
+                    for(k=0; k<m; k++){
+                        ur = pU[2*(k*m+l)]; ui = pU[2*(k*m+l)+1];
+                        proj_re += ur*pU[2*(k*m+j)] + ui*pU[2*(k*m+j)+1];
+                        proj_im += ur*pU[2*(k*m+j)+1] - ui*pU[2*(k*m+j)];
+                    }
+                    for(k=0; k<m; k++){
+                        ur = pU[2*(k*m+l)]; ui = pU[2*(k*m+l)+1];
+                        pU[2*(k*m+j)]   -= proj_re*ur - proj_im*ui;
+                        pU[2*(k*m+j)+1] -= proj_re*ui + proj_im*ur;
+                    }
+                }
+            }
+            norm2 = 0.0f;
+            for(k=0; k<m; k++)
+                norm2 += pU[2*(k*m+j)]*pU[2*(k*m+j)] + pU[2*(k*m+j)+1]*pU[2*(k*m+j)+1];
+            if(norm2 > 0.25f){ /* i.e. not (nearly) in the span of the set columns */
+                scale = 1.0f/sqrtf(norm2);
+                for(k=0; k<m; k++){
+                    pU[2*(k*m+j)] *= scale;
+                    pU[2*(k*m+j)+1] *= scale;
+                }
+                isSet[j] = 1;
+                e++;
+                break;
+            }
+        }
+    }
+}
+
+/** Sorts the indices of the values in ascending (or decending) order */
+static void veclib_sortIndices
+(
+    const float* vals,
+    int n,
+    int descendFLAG,
+    int* idx
+)
+{
+    int i, j, tmp;
+    for(i=0; i<n; i++)
+        idx[i] = i;
+    for(i=1; i<n; i++){ /* insertion sort (n is small) */
+        tmp = idx[i];
+        for(j=i; j>0 && (descendFLAG ? vals[idx[j-1]] < vals[tmp] : vals[idx[j-1]] > vals[tmp]); j--)
+            idx[j] = idx[j-1];
+        idx[j] = tmp;
+    }
+}
+
+/** Data structure for utility_cseig_batch() and utility_csvd_batch() */
+typedef struct _utility_batch_data {
+    int maxDim1, maxDim2, nThreads;
+    int jacobiMaxDim;   /**< Largest dim decomposed via the Jacobi kernels */
+    void* hPool;
+    float** xr, **xi;   /**< Per-thread groups of matrices; Jacobi layout */
+    float** vr, **vi;   /**< Per-thread groups of matrices; Jacobi layout */
+    void** hLapack;     /**< Per-thread LAPACK work structs (large dims only) */
+
+    /* Arguments of the current call */
+    const float_complex* A;
+    int dim1, dim2, nBatch, sortDecFLAG;
+    float_complex* U, *S, *V;
+    float* sing;
+
+}utility_batch_data;
+
+/** Creates the work struct used by both batched decompositions */
+static void utility_batch_create
+(
+    void ** const phWork,
+    int maxDim1,
+    int maxDim2,
+    int isSVD,
+    void* const hPool
+)
+{
+    *phWork = malloc1d(sizeof(utility_batch_data));
+    utility_batch_data *h = (utility_batch_data*)(*phWork);
+    int t, maxDim, jDim;
+
+    h->maxDim1 = maxDim1;
+    h->maxDim2 = maxDim2;
+    h->jacobiMaxDim = isSVD ? VECLIB_JACOBI_SVD_MAX_DIM : VECLIB_JACOBI_EIG_MAX_DIM;
+    h->hPool = hPool;
+    h->nThreads = saf_threadPool_getNumThreads(hPool);
+    maxDim = SAF_MAX(maxDim1, maxDim2);
+    jDim = SAF_MIN(maxDim, h->jacobiMaxDim);
+    h->xr = (float**)calloc1d(h->nThreads, sizeof(float*));
+    h->xi = (float**)calloc1d(h->nThreads, sizeof(float*));
+    h->vr = (float**)calloc1d(h->nThreads, sizeof(float*));
+    h->vi = (float**)calloc1d(h->nThreads, sizeof(float*));
+    h->hLapack = (void**)calloc1d(h->nThreads, sizeof(void*));
+    for(t=0; t<h->nThreads; t++){
+        h->xr[t] = malloc1d_aligned(jDim*jDim*VECLIB_JACOBI_WIDTH*sizeof(float));
+        h->xi[t] = malloc1d_aligned(jDim*jDim*VECLIB_JACOBI_WIDTH*sizeof(float));
+        h->vr[t] = malloc1d_aligned(jDim*jDim*VECLIB_JACOBI_WIDTH*sizeof(float));
+        h->vi[t] = malloc1d_aligned(jDim*jDim*VECLIB_JACOBI_WIDTH*sizeof(float));
+        if(maxDim>h->jacobiMaxDim){ /* (larger problems are passed on to LAPACK) */
+            if(isSVD)
+                utility_csvd_create(&(h->hLapack[t]), maxDim1, maxDim2);
+            else
+                utility_cseig_create(&(h->hLapack[t]), maxDim1);
+        }
+    }
+}
+
+/** Destroys the work struct used by both batched decompositions */
+static void utility_batch_destroy
+(
+    void ** const phWork,
+    int isSVD
+)
+{
+    utility_batch_data *h = (utility_batch_data*)(*phWork);
+    int t;
+
+    if(h!=NULL){
+        for(t=0; t<h->nThreads; t++){
+            free_aligned(h->xr[t]);
+            free_aligned(h->xi[t]);
+            free_aligned(h->vr[t]);
+            free_aligned(h->vi[t]);
+            if(isSVD)
+                utility_csvd_destroy(&(h->hLapack[t]));
+            else
+                utility_cseig_destroy(&(h->hLapack[t]));
+        }
+        free(h->xr);
+        free(h->xi);
+        free(h->vr);
+        free(h->vi);
+        free(h->hLapack);
+        free(h);
+        h=NULL;
+        *phWork = NULL;
+    }
+}
+
+void utility_cseig_batch_create(void ** const phWork, int maxDim, void* const hPool)
+{
+    utility_batch_create(phWork, maxDim, maxDim, 0, hPool);
+}
+
+void utility_cseig_batch_destroy(void ** const phWork)
+{
+    utility_batch_destroy(phWork, 0);
+}
+
+/** Decomposes one group of matrices (or one matrix, for large dims) */
+static void utility_cseig_batch_job
+(
+    void* userData,
+    int jobIdx,
+    int threadIdx
+)
+{
+    utility_batch_data *h = (utility_batch_data*)(userData);
+    int i, j, b, b0, nb, n;
+    int idx[VECLIB_JACOBI_MAX_DIM];
+    float w[VECLIB_JACOBI_MAX_DIM];
+    float* xr, *xi, *vr, *vi;
+
+    n = h->dim1;
+    if(n>h->jacobiMaxDim){
+        utility_cseig(h->hLapack[threadIdx], &(h->A[jobIdx*n*n]), n, h->sortDecFLAG,
+                      h->V==NULL ? NULL : &(h->V[jobIdx*n*n]),
+                      h->S==NULL ? NULL : &(h->S[jobIdx*n*n]),
+                      h->sing==NULL ? NULL : &(h->sing[jobIdx*n]));
+        return;
+    }
+    xr = h->xr[threadIdx]; xi = h->xi[threadIdx];
+    vr = h->vr[threadIdx]; vi = h->vi[threadIdx];
+    b0 = jobIdx*VECLIB_JACOBI_WIDTH;
+    nb = SAF_MIN(VECLIB_JACOBI_WIDTH, h->nBatch-b0);
+
+    /* Load the group (any unused slots are left as zero matrices) */
+    memset(xr, 0, n*n*VECLIB_JACOBI_WIDTH*sizeof(float));
+    memset(xi, 0, n*n*VECLIB_JACOBI_WIDTH*sizeof(float));
+    for(b=0; b<nb; b++){
+        for(i=0; i<n; i++){
+            for(j=0; j<n; j++){
+                xr[VECLIB_JIDX(i,j,n)+b] = crealf(h->A[(b0+b)*n*n + i*n + j]);
+                xi[VECLIB_JIDX(i,j,n)+b] = cimagf(h->A[(b0+b)*n*n + i*n + j]);
+            }
+        }
+    }
+
+    veclib_jacobi_cseig(xr, xi, n, vr, vi);
+
+    /* Sort and output */
+    for(b=0; b<nb; b++){
+        for(i=0; i<n; i++)
+            w[i] = xr[VECLIB_JIDX(i,i,n)+b];
+        veclib_sortIndices(w, n, h->sortDecFLAG, idx);
+        if(h->V!=NULL)
+            for(i=0; i<n; i++)
+                for(j=0; j<n; j++)
+                    h->V[(b0+b)*n*n + i*n + j] = cmplxf(vr[VECLIB_JIDX(i,idx[j],n)+b], vi[VECLIB_JIDX(i,idx[j],n)+b]);
+        if(h->S!=NULL){
+            memset(&(h->S[(b0+b)*n*n]), 0, n*n*sizeof(float_complex));
+            for(i=0; i<n; i++)
+                h->S[(b0+b)*n*n + i*n + i] = cmplxf(w[idx[i]], 0.0f);
+        }
+        if(h->sing!=NULL)
+            for(i=0; i<n; i++)
+                h->sing[(b0+b)*n + i] = w[idx[i]];
+    }
+}
+
+void utility_cseig_batch
+(
+    void* const hWork,
+    const float_complex* A,
+    const int dim,
+    const int nBatch,
+    int sortDecFLAG,
+    float_complex* V,
+    float_complex* D,
+    float* eig
+)
+{
+    utility_batch_data *h;
+
+    /* Work struct */
+    if(hWork==NULL)
+        utility_cseig_batch_create((void**)&h, dim, NULL);
+    else{
+        h = (utility_batch_data*)(hWork);
+#ifndef NDEBUG
+        saf_assert(dim<=h->maxDim1, "dim exceeds the maximum length specified");
+#endif
+    }
+
+    /* Split the batch into jobs (S/sing hold D/eig) */
+    h->A = A;
+    h->dim1 = h->dim2 = dim;
+    h->nBatch = nBatch;
+    h->sortDecFLAG = sortDecFLAG;
+    h->U = NULL;
+    h->S = D;
+    h->V = V;
+    h->sing = eig;
+    saf_threadPool_run(h->hPool, dim>h->jacobiMaxDim ? nBatch : (nBatch+VECLIB_JACOBI_WIDTH-1)/VECLIB_JACOBI_WIDTH,
+                       utility_cseig_batch_job, (void*)h);
+
+    if(hWork == NULL)
+        utility_cseig_batch_destroy((void**)&h);
+}
+
+void utility_csvd_batch_create(void ** const phWork, int maxDim1, int maxDim2, void* const hPool)
+{
+    utility_batch_create(phWork, maxDim1, maxDim2, 1, hPool);
+}
+
+void utility_csvd_batch_destroy(void ** const phWork)
+{
+    utility_batch_destroy(phWork, 1);
+}
+
+/** Decomposes one group of matrices (or one matrix, for large dims) */
+static void utility_csvd_batch_job
+(
+    void* userData,
+    int jobIdx,
+    int threadIdx
+)
+{
+    utility_batch_data *h = (utility_batch_data*)(userData);
+    int i, j, b, b0, nb, m, n, dim1, dim2, wide;
+    int idx[VECLIB_JACOBI_MAX_DIM], isSet[VECLIB_JACOBI_MAX_DIM];
+    float sv[VECLIB_JACOBI_MAX_DIM];
+    float* xr, *xi, *vr, *vi;
+    float_complex* Uo, *Vo, *Ub, *Vb;
+    float scale;
+
+    dim1 = h->dim1;
+    dim2 = h->dim2;
+    if(SAF_MAX(dim1, dim2)>h->jacobiMaxDim){
+        utility_csvd(h->hLapack[threadIdx], &(h->A[jobIdx*dim1*dim2]), dim1, dim2,
+                     h->U==NULL ? NULL : &(h->U[jobIdx*dim1*dim1]),
+                     h->S==NULL ? NULL : &(h->S[jobIdx*dim1*dim2]),
+                     h->V==NULL ? NULL : &(h->V[jobIdx*dim2*dim2]),
+                     h->sing==NULL ? NULL : &(h->sing[jobIdx*SAF_MIN(dim1, dim2)]));
+        return;
+    }
+    xr = h->xr[threadIdx]; xi = h->xi[threadIdx];
+    vr = h->vr[threadIdx]; vi = h->vi[threadIdx];
+    b0 = jobIdx*VECLIB_JACOBI_WIDTH;
+    nb = SAF_MIN(VECLIB_JACOBI_WIDTH, h->nBatch-b0);
+
+    /* The one-sided Jacobi method requires m>=n, so wide matrices are decomposed as A^H = (V*S*U^H)^H */
+    wide = dim1 < dim2;
+    m = wide ? dim2 : dim1;
+    n = wide ? dim1 : dim2;
+
+    /* Load the group (any unused slots are left as zero matrices) */
+    memset(xr, 0, m*n*VECLIB_JACOBI_WIDTH*sizeof(float));
+    memset(xi, 0, m*n*VECLIB_JACOBI_WIDTH*sizeof(float));
+    for(b=0; b<nb; b++){
+        for(i=0; i<dim1; i++){
+            for(j=0; j<dim2; j++){
+                if(wide){
+                    xr[VECLIB_JIDX(j,i,n)+b] = crealf(h->A[(b0+b)*dim1*dim2 + i*dim2 + j]);
+                    xi[VECLIB_JIDX(j,i,n)+b] = -cimagf(h->A[(b0+b)*dim1*dim2 + i*dim2 + j]);
+                }
+                else{
+                    xr[VECLIB_JIDX(i,j,n)+b] = crealf(h->A[(b0+b)*dim1*dim2 + i*dim2 + j]);
+                    xi[VECLIB_JIDX(i,j,n)+b] = cimagf(h->A[(b0+b)*dim1*dim2 + i*dim2 + j]);
+                }
+            }
+        }
+    }
+
+    veclib_jacobi_csvd(xr, xi, m, n, vr, vi);
+
+    /* Sort and output */
+    for(b=0; b<nb; b++){
+        /* Singular values are the norms of the orthogonalised columns */
+        for(j=0; j<n; j++){
+            sv[j] = 0.0f;
+            for(i=0; i<m; i++)
+                sv[j] += xr[VECLIB_JIDX(i,j,n)+b]*xr[VECLIB_JIDX(i,j,n)+b] + xi[VECLIB_JIDX(i,j,n)+b]*xi[VECLIB_JIDX(i,j,n)+b];
+            sv[j] = sqrtf(sv[j]);
+        }
+        veclib_sortIndices(sv, n, 1, idx);
+        if(h->sing!=NULL)
+            for(j=0; j<n; j++)
+                h->sing[(b0+b)*n + j] = sv[idx[j]];
+        if(h->S!=NULL){
+            memset(&(h->S[(b0+b)*dim1*dim2]), 0, dim1*dim2*sizeof(float_complex));
+            for(j=0; j<n; j++)
+                h->S[(b0+b)*dim1*dim2 + j*dim2 + j] = cmplxf(sv[idx[j]], 0.0f);
+        }
+
+        /* The left (m x m) and right (n x n) singular vectors of the tall matrix */
+        Uo = wide ? h->V : h->U;
+        Vo = wide ? h->U : h->V;
+        if(Uo!=NULL){
+            Ub = &Uo[(b0+b)*m*m];
+            memset(isSet, 0, m*sizeof(int));
+            for(j=0; j<n; j++){
+                if(sv[idx[j]] > (float)m*FLT_EPSILON*sv[idx[0]] && sv[idx[j]] > FLT_MIN){
+                    scale = 1.0f/sv[idx[j]];
+                    for(i=0; i<m; i++)
+                        Ub[i*m+j] = cmplxf(scale*xr[VECLIB_JIDX(i,idx[j],n)+b], scale*xi[VECLIB_JIDX(i,idx[j],n)+b]);
+                    isSet[j] = 1;
+                }
+            }
+            veclib_completeUnitary(Ub, m, isSet); /* (for the null-space, and for m>n) */
+        }
+        if(Vo!=NULL){
+            Vb = &Vo[(b0+b)*n*n];
+            for(i=0; i<n; i++)
+                for(j=0; j<n; j++)
+                    Vb[i*n+j] = cmplxf(vr[VECLIB_JIDX(i,idx[j],n)+b], vi[VECLIB_JIDX(i,idx[j],n)+b]);
+        }
+    }
+}
+
+void utility_csvd_batch
+(
+    void* const hWork,
+    const float_complex* A,
+    const int dim1,
+    const int dim2,
+    const int nBatch,
+    float_complex* U,
+    float_complex* S,
+    float_complex* V,
+    float* sing
+)
+{
+    utility_batch_data *h;
+
+    /* Work struct */
+    if(hWork==NULL)
+        utility_csvd_batch_create((void**)&h, dim1, dim2, NULL);
+    else{
+        h = (utility_batch_data*)(hWork);
+#ifndef NDEBUG
+        saf_assert(dim1<=h->maxDim1 && dim2<=h->maxDim2, "dim1/dim2 exceed the maximum lengths specified");
+#endif
+    }
+
+    /* Split the batch into jobs */
+    h->A = A;
+    h->dim1 = dim1;
+    h->dim2 = dim2;
+    h->nBatch = nBatch;
+    h->U = U;
+    h->S = S;
+    h->V = V;
+    h->sing = sing;
+    saf_threadPool_run(h->hPool, SAF_MAX(dim1, dim2)>h->jacobiMaxDim ? nBatch : (nBatch+VECLIB_JACOBI_WIDTH-1)/VECLIB_JACOBI_WIDTH,
+                       utility_csvd_batch_job, (void*)h);
+
+    if(hWork == NULL)
+        utility_csvd_batch_destroy((void**)&h);
+}
+
+
+/* ========================================================================== */
+/*                     Covariance Matrix Tracking (?covtrk)                   */
+/* ========================================================================== */
+
+/** Data structure for utility_ccovtrk_update() */
+typedef struct _utility_ccovtrk_data {
+    int maxDim, nBands;
+    int* dim;              /**< Dimension of the last update, per band; nBands x 1 */
+    float_complex* C;      /**< Packed upper triangles; FLAT: nBands x (maxDim*(maxDim+1)/2) */
+    float_complex* C_tmp;  /**< Upper triangle of the current block; FLAT: maxDim x maxDim */
+}utility_ccovtrk_data;
+
+void utility_ccovtrk_create(void ** const phCov, int maxDim, int nBands)
+{
+    *phCov = malloc1d(sizeof(utility_ccovtrk_data));
+    utility_ccovtrk_data *h = (utility_ccovtrk_data*)(*phCov);
+
+    h->maxDim = maxDim;
+    h->nBands = nBands;
+    h->dim = malloc1d(nBands*sizeof(int));
+    h->C = malloc1d(nBands*(maxDim*(maxDim+1)/2)*sizeof(float_complex));
+    h->C_tmp = malloc1d(maxDim*maxDim*sizeof(float_complex));
+    utility_ccovtrk_reset(*phCov);
+}
+
+void utility_ccovtrk_destroy(void ** const phCov)
+{
+    utility_ccovtrk_data *h = (utility_ccovtrk_data*)(*phCov);
+
+    if(h!=NULL){
+        free(h->dim);
+        free(h->C);
+        free(h->C_tmp);
+        free(h);
+        h=NULL;
+        *phCov = NULL;
+    }
+}
+
+void utility_ccovtrk_reset(void* const hCov)
+{
+    utility_ccovtrk_data *h = (utility_ccovtrk_data*)(hCov);
+    int band;
+
+    for(band=0; band<h->nBands; band++)
+        h->dim[band] = h->maxDim;
+    memset(h->C, 0, h->nBands*(h->maxDim*(h->maxDim+1)/2)*sizeof(float_complex));
+}
+
+void utility_ccovtrk_update
+(
+    void* const hCov,
+    int band,
+    const float_complex* X,
+    int dim,
+    int nSamples,
+    float avgCoeff,
+    float_complex* C_new
+)
+{
+    utility_ccovtrk_data *h = (utility_ccovtrk_data*)(hCov);
+    int i, j, len;
+    float a, b;
+    float* pC, *pT;
+
+    saf_assert(dim<=h->maxDim && band<h->nBands, "dim/band exceed the maximum specified");
+    pC = (float*)&(h->C[band*(h->maxDim*(h->maxDim+1)/2)]);
+    if(h->dim[band]!=dim){
+        memset(pC, 0, (dim*(dim+1)/2)*sizeof(float_complex));
+        h->dim[band] = dim;
+    }
+
+    /* Upper triangle of X*X^H */
+    cblas_cherk(CblasRowMajor, CblasUpper, CblasNoTrans, dim, nSamples, 1.0f,
+                X, nSamples, 0.0f,
+                h->C_tmp, dim);
+
+    /* Temporal averaging, fused with the packing of each row (re+im) */
+    a = avgCoeff;
+    b = 1.0f-avgCoeff;
+    for(i=0; i<dim; i++){
+        pT = (float*)&(h->C_tmp[i*dim+i]);
+        len = 2*(dim-i);
+        for(j=0; j<len; j++)
+            pC[j] = a*pC[j] + b*pT[j];
+        pC += len;
+    }
+
+    /* Optionally, also output the full (non-averaged) matrix */
+    if(C_new!=NULL){
+        for(i=0; i<dim; i++){
+            for(j=0; j<i; j++)
+                C_new[i*dim+j] = conjf(h->C_tmp[j*dim+i]);
+            memcpy(&C_new[i*dim+i], &(h->C_tmp[i*dim+i]), (dim-i)*sizeof(float_complex));
+        }
+    }
+}
+
+void utility_ccovtrk_get
+(
+    void* const hCov,
+    int band,
+    int dim,
+    float_complex* C
+)
+{
+    utility_ccovtrk_data *h = (utility_ccovtrk_data*)(hCov);
+    int i, j;
+    float_complex* pC;
+
+    if(h->dim[band]!=dim){
+        memset(C, 0, dim*dim*sizeof(float_complex));
+        return;
+    }
+    pC = &(h->C[band*(h->maxDim*(h->maxDim+1)/2)]);
+    for(i=0; i<dim; i++){
+        memcpy(&C[i*dim+i], pC, (dim-i)*sizeof(float_complex));
+        for(j=i+1; j<dim; j++)
+            C[j*dim+i] = conjf(pC[j-i]);
+        pC += dim-i;
+    }
+}
+
+
 /* ========================================================================== */
 /*                       General Linear Solver (?glslv)                       */
 /* ========================================================================== */
@@ -42,6 +42,17 @@ typedef enum {
   CONJ = 2      /**< Take the conjugate */
 }CONJ_FLAG;
 
+/**
+ * SIMD instruction sets, which may be employed by the SIMD accelerated fall-
+ * back implementations (in ascending order of capability)
+ */
+typedef enum {
+  SAF_SIMD_NONE = 0, /**< No SIMD intrinsics (plain C) */
+  SAF_SIMD_SSE3,     /**< SSE, SSE2 and SSE3 */
+  SAF_SIMD_AVX2,     /**< AVX, AVX2 and FMA */
+  SAF_SIMD_AVX512    /**< AVX-512F */
+}SAF_SIMD_INSTRUCTION_SET;
+
 #ifdef SAF_USE_BUILT_IN_NAIVE_CBLAS
  enum { CblasRowMajor = 101, CblasColMajor = 102 } CBLAS_ORDER;
  enum { CblasNoTrans = 111, CblasTrans = 112, CblasConjTrans = 113 } CBLAS_TRANSPOSE;
@@ -95,6 +106,47 @@ void cblas_sgemm(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
 #endif
 
 
+/* ========================================================================== */
+/*                         Run-time SIMD Dispatching                          */
+/* ========================================================================== */
+
+/**
+ * Returns the most capable SIMD instruction set that may be employed
+ *
+ * If SAF_ENABLE_SIMD_RUNTIME_DISPATCH is defined, then this is the most capable
+ * instruction set supported by the host CPU. Whereas, if SAF_ENABLE_SIMD is
+ * defined instead, then this is the instruction set that was selected at
+ * compile-time. Otherwise, SAF_SIMD_NONE is returned.
+ *
+ * @test test__veclib_simdDispatch()
+ */
+SAF_SIMD_INSTRUCTION_SET utility_getSIMDsupport(void);
+
+/**
+ * Returns the SIMD instruction set that is currently employed by the SIMD
+ * accelerated fall-back implementations (e.g. utility_svvadd())
+ */
+SAF_SIMD_INSTRUCTION_SET utility_getSIMDinstructionSet(void);
+
+/**
+ * Overrides the SIMD instruction set employed by the SIMD accelerated fall-back
+ * implementations
+ *
+ * By default, the most capable instruction set supported by the host CPU is
+ * selected upon first use. Requesting an instruction set that is not supported
+ * by the host CPU will instead select the most capable one that is.
+ *
+ * @note This only has an effect if SAF_ENABLE_SIMD_RUNTIME_DISPATCH is defined,
+ *       and is intended mainly for testing and benchmarking purposes. It is not
+ *       thread-safe to call this function while other threads are calling the
+ *       affected veclib functions.
+ *
+ * @param[in] isa Instruction set to employ (see SAF_SIMD_INSTRUCTION_SET)
+ */
+void utility_setSIMDinstructionSet(/* Input Arguments */
+                                   SAF_SIMD_INSTRUCTION_SET isa);
+
+
 /* ========================================================================== */
 /*                     Find Index of Min-Abs-Value (?iminv)                   */
 /* ========================================================================== */
@@ -608,6 +660,126 @@ void utility_cvvmul(/* Input Arguments */
                     /* Output Arguments */
                     float_complex* c);
 
+/**
+ * Single-precision, complex, element-wise vector-vector multiply-accumulate,
+ * i.e.
+ * \code{.m}
+ *     c = c + a.*b
+ * \endcode
+ *
+ * Unlike calling utility_cvvmul() followed by e.g. cblas_caxpy(), this does not
+ * require a temporary vector, and makes only a single pass over c.
+ *
+ * @note In-place operation is not supported (i.e. c may not be a or b)
+ * @test test__veclib_cvvmuladd()
+ *
+ * @param[in]     a   Input vector a; len x 1
+ * @param[in]     b   Input vector b; len x 1
+ * @param[in]     len Vector length
+ * @param[in,out] c   Accumulator vector c; len x 1
+ */
+void utility_cvvmuladd(/* Input Arguments */
+                       const float_complex* a,
+                       const float_complex* b,
+                       const int len,
+                       /* Input/Output Arguments */
+                       float_complex* c);
+
+/**
+ * Single-precision, complex, batched element-wise vector-vector multiply-
+ * accumulate, i.e.
+ * \code{.m}
+ *     for n = 1:nBatch
+ *         c = c + a(:,n).*b(:,n)
+ *     end
+ * \endcode
+ * where the n'th vector of a starts at a[(n-1)*stride_a] (and likewise for b)
+ *
+ * This is the inner loop of a (uniformly) partitioned convolver, where a are
+ * the filter partitions, b are the frequency-domain delay-line of the input,
+ * and c is the output spectrum. Since the inverse FFT is linear, only a single
+ * inverse FFT of c is then required.
+ *
+ * @test test__veclib_cvvmuladd()
+ *
+ * @param[in]     a        Input vectors a; FLAT: nBatch x stride_a
+ * @param[in]     stride_a Distance between the starts of consecutive a vectors
+ * @param[in]     b        Input vectors b; FLAT: nBatch x stride_b
+ * @param[in]     stride_b Distance between the starts of consecutive b vectors
+ * @param[in]     len      Vector length
+ * @param[in]     nBatch   Number of vector pairs to multiply and accumulate
+ * @param[in,out] c        Accumulator vector c; len x 1
+ */
+void utility_cvvmuladd_batch(/* Input Arguments */
+                             const float_complex* a,
+                             const int stride_a,
+                             const float_complex* b,
+                             const int stride_b,
+                             const int len,
+                             const int nBatch,
+                             /* Input/Output Arguments */
+                             float_complex* c);
+
+/**
+ * Single-precision, complex, element-wise vector-vector multiplication, where
+ * the real and imaginary parts are stored in separate vectors (split-complex)
+ * i.e.
+ * \code{.m}
+ *     c = a.*b
+ * \endcode
+ *
+ * Since no shuffling of the real and imaginary parts is required, this is
+ * generally faster than utility_cvvmul(), if the data are already split.
+ *
+ * @note In-place operation is supported (i.e. c may be a or b)
+ * @test test__veclib_cvvmul()
+ *
+ * @param[in]  a_re Real part of input vector a; len x 1
+ * @param[in]  a_im Imaginary part of input vector a; len x 1
+ * @param[in]  b_re Real part of input vector b; len x 1
+ * @param[in]  b_im Imaginary part of input vector b; len x 1
+ * @param[in]  len  Vector length
+ * @param[out] c_re Real part of output vector c; len x 1
+ * @param[out] c_im Imaginary part of output vector c; len x 1
+ */
+void utility_cvvmul_split(/* Input Arguments */
+                          const float* a_re,
+                          const float* a_im,
+                          const float* b_re,
+                          const float* b_im,
+                          const int len,
+                          /* Output Arguments */
+                          float* c_re,
+                          float* c_im);
+
+/**
+ * Single-precision, complex, element-wise vector-vector multiply-accumulate,
+ * where the real and imaginary parts are stored in separate vectors
+ * (split-complex) i.e.
+ * \code{.m}
+ *     c = c + a.*b
+ * \endcode
+ *
+ * @test test__veclib_cvvmul()
+ *
+ * @param[in]     a_re Real part of input vector a; len x 1
+ * @param[in]     a_im Imaginary part of input vector a; len x 1
+ * @param[in]     b_re Real part of input vector b; len x 1
+ * @param[in]     b_im Imaginary part of input vector b; len x 1
+ * @param[in]     len  Vector length
+ * @param[in,out] c_re Real part of accumulator vector c; len x 1
+ * @param[in,out] c_im Imaginary part of accumulator vector c; len x 1
+ */
+void utility_cvvmuladd_split(/* Input Arguments */
+                             const float* a_re,
+                             const float* a_im,
+                             const float* b_re,
+                             const float* b_im,
+                             const int len,
+                             /* Input/Output Arguments */
+                             float* c_re,
+                             float* c_im);
+
 
 /* ========================================================================== */
 /*                     Vector-Vector Dot Product (?vvdot)                     */
@@ -1204,6 +1376,216 @@ void utility_zeig(/* Input Arguments */
                   double_complex* eig);
 
 
+/* ========================================================================== */
+/*               Batched Decompositions (?seig_batch, ?svd_batch)             */
+/* ========================================================================== */
+
+/**
+ * (Optional) Pre-allocate the working struct used by utility_cseig_batch()
+ *
+ * @param[in] phWork (&) address of work handle, to give to
+ *                   utility_cseig_batch()
+ * @param[in] maxDim Max size 'dim' can be when calling utility_cseig_batch()
+ * @param[in] hPool  Thread pool handle (see saf_threadPool_create()), over
+ *                   which the batch should be split; or NULL for single-
+ *                   threaded. Note the pool must outlive the work struct.
+ */
+void utility_cseig_batch_create(void ** const phWork,
+                                int maxDim,
+                                void* const hPool);
+
+/** De-allocate the working struct used by utility_cseig_batch() */
+void utility_cseig_batch_destroy(void ** const phWork);
+
+/**
+ * Eigenvalue decomposition of a batch of SYMMETRIC/HERMITIAN matrices: single
+ * precision complex, i.e.
+ * \code{.m}
+ *     for b=1:nBatch, [V(:,:,b),D(:,:,b)] = eig(A(:,:,b)); end
+ * \endcode
+ *
+ * Intended for the many small problems that arise in per-band spatial
+ * analysis, where calling utility_cseig() for each band is dominated by the
+ * per-call overhead of LAPACK. For small matrices (dim<=6), the matrices are
+ * decomposed in groups of 16 via cyclic Jacobi rotations, which are
+ * vectorised across the matrices of each group. Larger matrices are passed on
+ * to LAPACK, one at a time. The groups/matrices are shared across the threads
+ * of the thread pool given to utility_cseig_batch_create() (if any).
+ *
+ * @note The eigen vectors are unique only up to a (complex) scaling, which
+ *       may therefore differ from those returned by utility_cseig().
+ *
+ * @test test__utility_cseig_batch()
+ *
+ * @param[in]  hWork       Handle for the work struct (set to NULL if not
+ *                         available, in which case memory is allocated on the
+ *                         fly, and no threading is used)
+ * @param[in]  A           Input SYMMETRIC square matrices;
+ *                         FLAT: nBatch x dim x dim
+ * @param[in]  dim         Dimensions for each square matrix
+ * @param[in]  nBatch      Number of matrices
+ * @param[in]  sortDecFLAG '1' sort eigen values and vectors in decending order.
+ *                         '0' ascending
+ * @param[out] V           Eigen vectors (set to NULL if not needed);
+ *                         FLAT: nBatch x dim x dim
+ * @param[out] D           Eigen values along the diagonal (set to NULL if not
+ *                         needed); FLAT: nBatch x dim x dim
+ * @param[out] eig         Eigen values not diagonalised (set to NULL if not
+ *                         needed); FLAT: nBatch x dim
+ */
+void utility_cseig_batch(/* Input Arguments */
+                         void* const hWork,
+                         const float_complex* A,
+                         const int dim,
+                         const int nBatch,
+                         int sortDecFLAG,
+                         /* Output Arguments */
+                         float_complex* V,
+                         float_complex* D,
+                         float* eig);
+
+/**
+ * (Optional) Pre-allocate the working struct used by utility_csvd_batch()
+ *
+ * @param[in] phWork  (&) address of work handle, to give to
+ *                    utility_csvd_batch()
+ * @param[in] maxDim1 Max size 'dim1' can be when calling utility_csvd_batch()
+ * @param[in] maxDim2 Max size 'dim2' can be when calling utility_csvd_batch()
+ * @param[in] hPool   Thread pool handle (see saf_threadPool_create()), over
+ *                    which the batch should be split; or NULL for single-
+ *                    threaded. Note the pool must outlive the work struct.
+ */
+void utility_csvd_batch_create(void ** const phWork,
+                               int maxDim1,
+                               int maxDim2,
+                               void* const hPool);
+
+/** De-allocate the working struct used by utility_csvd_batch() */
+void utility_csvd_batch_destroy(void ** const phWork);
+
+/**
+ * Singular value decomposition of a batch of matrices: single precision
+ * complex, i.e.
+ * \code{.m}
+ *     for b=1:nBatch, [U(:,:,b),S(:,:,b),V(:,:,b)] = svd(A(:,:,b)); end
+ * \endcode
+ *
+ * Small matrices (max(dim1,dim2)<=16) are decomposed in groups of 16 via
+ * one-sided (Hestenes) Jacobi rotations, which are vectorised across the
+ * matrices of each group. Larger matrices are passed on to LAPACK, one at a
+ * time. See utility_cseig_batch() regarding the threading.
+ *
+ * @note Like utility_csvd(), V is returned untransposed, and the singular
+ *       values are in decending order. The singular vectors are unique only up
+ *       to a (complex) scaling, which may differ from those of utility_csvd().
+ *
+ * @test test__utility_csvd_batch()
+ *
+ * @param[in]  hWork  Handle for the work struct (set to NULL if not available,
+ *                    in which case memory is allocated on the fly, and no
+ *                    threading is used)
+ * @param[in]  A      Input matrices; FLAT: nBatch x dim1 x dim2
+ * @param[in]  dim1   First dimension of each matrix
+ * @param[in]  dim2   Second dimension of each matrix
+ * @param[in]  nBatch Number of matrices
+ * @param[out] U      Left matrices (set to NULL if not needed);
+ *                    FLAT: nBatch x dim1 x dim1
+ * @param[out] S      Singular values along the diagonal min(dim1, dim2), (set
+ *                    to NULL if not needed); FLAT: nBatch x dim1 x dim2
+ * @param[out] V      Right matrices (UNTRANSPOSED!) (set to NULL if not
+ *                    needed); FLAT: nBatch x dim2 x dim2
+ * @param[out] sing   Singular values as vectors, (set to NULL if not needed);
+ *                    FLAT: nBatch x min(dim1, dim2)
+ */
+void utility_csvd_batch(/* Input Arguments */
+                        void* const hWork,
+                        const float_complex* A,
+                        const int dim1,
+                        const int dim2,
+                        const int nBatch,
+                        /* Output Arguments */
+                        float_complex* U,
+                        float_complex* S,
+                        float_complex* V,
+                        float* sing);
+
+
+/* ========================================================================== */
+/*                     Covariance Matrix Tracking (?covtrk)                   */
+/* ========================================================================== */
+
+/**
+ * Creates an instance of a (per-band) covariance matrix tracker
+ *
+ * The tracker holds the temporally averaged covariance matrices of a set of
+ * signals, for each band, i.e.
+ * \code{.m}
+ *     C(:,:,band) = avgCoeff*C(:,:,band) + (1-avgCoeff)*X*X';
+ * \endcode
+ * Since the matrices are Hermitian, only their upper triangles are computed
+ * (via cblas_cherk) and stored (packed, row-by-row). Compared to the usual
+ * cblas_cgemm followed by cblas_sscal and cblas_saxpy over the full matrices,
+ * this roughly halves both the computations and memory, and the temporal
+ * averaging is fused into the packing of each new matrix.
+ *
+ * @test test__utility_ccovtrk()
+ *
+ * @param[in] phCov  (&) address of the covariance tracker handle
+ * @param[in] maxDim Maximum number of signals (i.e. matrix dimension)
+ * @param[in] nBands Number of bands
+ */
+void utility_ccovtrk_create(void ** const phCov,
+                            int maxDim,
+                            int nBands);
+
+/** Destroys an instance of the covariance matrix tracker */
+void utility_ccovtrk_destroy(void ** const phCov);
+
+/** Flushes the covariance matrices of all bands with zeros */
+void utility_ccovtrk_reset(void* const hCov);
+
+/**
+ * Updates the covariance matrix of one band with a new block of signals
+ *
+ * @note If 'dim' differs from that of the previous update of this band, then
+ *       the matrix of this band is first reset.
+ *
+ * @param[in]  hCov     Covariance tracker handle
+ * @param[in]  band     Band index
+ * @param[in]  X        Input signals; FLAT: dim x nSamples
+ * @param[in]  dim      Number of signals (<=maxDim)
+ * @param[in]  nSamples Number of samples (e.g. time slots)
+ * @param[in]  avgCoeff Temporal averaging coefficient, [0..1]
+ * @param[out] C_new    The non-averaged covariance matrix of this block, i.e.
+ *                      X*X' (set to NULL if not needed); FLAT: dim x dim
+ */
+void utility_ccovtrk_update(/* Input Arguments */
+                            void* const hCov,
+                            int band,
+                            const float_complex* X,
+                            int dim,
+                            int nSamples,
+                            float avgCoeff,
+                            /* Output Arguments */
+                            float_complex* C_new);
+
+/**
+ * Returns the (full) averaged covariance matrix of one band
+ *
+ * @param[in]  hCov Covariance tracker handle
+ * @param[in]  band Band index
+ * @param[in]  dim  Number of signals (if this differs from that of the last
+ *                  update of this band, then zeros are returned)
+ * @param[out] C    Covariance matrix; FLAT: dim x dim
+ */
+void utility_ccovtrk_get(/* Input Arguments */
+                         void* const hCov,
+                         int band,
+                         int dim,
+                         /* Output Arguments */
+                         float_complex* C);
+
+
 /* ========================================================================== */
 /*                       General Linear Solver (?glslv)                       */
 /* ========================================================================== */
@@ -62,6 +62,25 @@ void generateVBAPgainTable3D_srcs
     int* N_gtable /* & S */,
     int* nTriangles
 )
+{
+    generateVBAPgainTable3D_srcs_threaded(src_dirs_deg, S, ls_dirs_deg, L, omitLargeTriangles, enableDummies, spread,
+                                          NULL, gtable, N_gtable, nTriangles);
+}
+
+void generateVBAPgainTable3D_srcs_threaded
+(
+    float* src_dirs_deg,
+    int S,
+    float* ls_dirs_deg,
+    int L,
+    int omitLargeTriangles,
+    int enableDummies,
+    float spread,
+    void* const hPool,
+    float** gtable /* &: S x L */,
+    int* N_gtable /* & S */,
+    int* nTriangles
+)
 {
     int N_points, numOutVertices, numOutFaces;
     int* out_faces;
@@ -133,7 +152,7 @@ void generateVBAPgainTable3D_srcs
     
     /* Calculate VBAP gains for each source position */
     N_points = S;
-    vbap3D(src_dirs_deg, N_points, numOutVertices, out_faces, numOutFaces, spread, layoutInvMtx, gtable);
+    vbap3D_threaded(src_dirs_deg, N_points, numOutVertices, out_faces, numOutFaces, spread, layoutInvMtx, hPool, gtable);
     if(enableDummies){
         if(needDummy[0] || needDummy[1]){
             /* remove the gains for the dummy loudspeakers, they have served their purpose and can now be laid to rest */
@@ -181,6 +200,25 @@ void generateVBAPgainTable3D
     int* N_gtable,
     int* nTriangles
 )
+{
+    generateVBAPgainTable3D_threaded(ls_dirs_deg, L, az_res_deg, el_res_deg, omitLargeTriangles, enableDummies, spread,
+                                     NULL, gtable, N_gtable, nTriangles);
+}
+
+void generateVBAPgainTable3D_threaded
+(
+    float* ls_dirs_deg,
+    int L,
+    int az_res_deg,
+    int el_res_deg,
+    int omitLargeTriangles,
+    int enableDummies,
+    float spread,
+    void* const hPool,
+    float** gtable /* N_srcs x N_lspkrs  */,
+    int* N_gtable,
+    int* nTriangles
+)
 {
     int i, j, N_azi, N_ele, N_points, numOutVertices, numOutFaces;
     int* out_faces;
@@ -270,7 +308,7 @@ void generateVBAPgainTable3D
 
     /* Calculate VBAP gains for each source position */
     N_points = N_azi*N_ele;
-    vbap3D(src_dirs, N_points, numOutVertices, out_faces, numOutFaces, spread, layoutInvMtx,  gtable);
+    vbap3D_threaded(src_dirs, N_points, numOutVertices, out_faces, numOutFaces, spread, layoutInvMtx, hPool, gtable);
     
     /* remove the gains for the dummy loudspeakers, they have served their purpose and can now be laid to rest */
     if(enableDummies){
@@ -783,36 +821,62 @@ void getSpreadSrcDirs3D
 }
 
 
-void vbap3D
+/** Number of source directions computed per job, by vbap3D_threaded() */
+#define VBAP3D_DIRS_PER_JOB ( 64 )
+/** Number of auxiliary sources used for spreading, by vbap3D() */
+#define VBAP3D_N_SPREAD_SRCS ( 8 )
+/** Number of rings of auxiliary sources used for spreading, by vbap3D() */
+#define VBAP3D_N_SPREAD_RINGS ( 1 )
+
+/** Data shared by the jobs of vbap3D_threaded() */
+typedef struct _vbap3D_jobData {
+    float* src_dirs;           /**< Source directions in degrees; FLAT: src_num x 2 */
+    int src_num;               /**< Number of sources */
+    int ls_num;                /**< Number of loudspeakers */
+    int* ls_groups;            /**< Loudspeaker triangle indices; FLAT: nFaces x 3 */
+    int nFaces;                /**< Number of loudspeaker triangles */
+    float spread;              /**< Spreading in degrees */
+    float* layoutInvMtx;       /**< Inverted loudspeaker matrices; FLAT: nFaces x 9 */
+    float* GainMtx;            /**< Output gains; FLAT: src_num x ls_num */
+    float* gains;              /**< Scratch gains, per thread; FLAT: nThreads x ls_num */
+    float* U_spread;           /**< Scratch spread directions, per thread; FLAT: nThreads x (nSpreadSrcs*nRings+1) x 3 */
+
+}vbap3D_jobData;
+
+/** Computes the VBAP/MDAP gains for one block of #VBAP3D_DIRS_PER_JOB source directions */
+static void vbap3D_job
 (
-    float* src_dirs,
-    int src_num,
-    int ls_num,
-    int* ls_groups,
-    int nFaces,
-    float spread,
-    float* layoutInvMtx,
-    float** GainMtx
+    void* userData,
+    int jobIdx,
+    int threadIdx
 )
 {
-    int i, j, ns, nspr;
+    vbap3D_jobData* d = (vbap3D_jobData*)userData;
+    int i, j, ns, nspr, ns_start, ns_end, ls_num, nFaces;
+    int* ls_groups;
     float azi_rad, elev_rad, min_val, g_tmp_rms, gains_rms;
     float u[3], g_tmp[3], ls_invMtx_s[3];
-    float* gains;
+    float* gains, *layoutInvMtx, *GainMtx;
 
-    (*GainMtx) = malloc1d(src_num*ls_num*sizeof(float));
-    gains = malloc1d(ls_num*sizeof(float));
+    ls_num = d->ls_num;
+    nFaces = d->nFaces;
+    ls_groups = d->ls_groups;
+    layoutInvMtx = d->layoutInvMtx;
+    GainMtx = d->GainMtx;
+    gains = &(d->gains[threadIdx*ls_num]);
+    ns_start = jobIdx*VBAP3D_DIRS_PER_JOB;
+    ns_end = SAF_MIN(ns_start+VBAP3D_DIRS_PER_JOB, d->src_num);
 
     /* MDAP (with spread) */
-    if (spread > 0.1f) {
-        const int nSpreadSrcs = 8;
-        const int nRings = 1;
+    if (d->spread > 0.1f) {
+        const int nSpreadSrcs = VBAP3D_N_SPREAD_SRCS;
+        const int nRings = VBAP3D_N_SPREAD_RINGS;
         float* U_spread;
-        U_spread = malloc1d((nRings*nSpreadSrcs+1)*3*sizeof(float));
-        for(ns=0; ns<src_num; ns++){
-            azi_rad  = src_dirs[ns*2+0]*SAF_PI/180.0f;
-            elev_rad = src_dirs[ns*2+1]*SAF_PI/180.0f;
-            getSpreadSrcDirs3D(azi_rad, elev_rad, spread, nSpreadSrcs, nRings, U_spread);
+        U_spread = &(d->U_spread[threadIdx*(nRings*nSpreadSrcs+1)*3]);
+        for(ns=ns_start; ns<ns_end; ns++){
+            azi_rad  = d->src_dirs[ns*2+0]*SAF_PI/180.0f;
+            elev_rad = d->src_dirs[ns*2+1]*SAF_PI/180.0f;
+            getSpreadSrcDirs3D(azi_rad, elev_rad, d->spread, nSpreadSrcs, nRings, U_spread);
             memset(gains, 0, ls_num*sizeof(float));
             for(nspr=0; nspr<(nRings*nSpreadSrcs+1); nspr++){
                 u[0] = U_spread[nspr*3+0];
@@ -846,16 +910,14 @@ void vbap3D
                 gains_rms += powf(gains[i], 2.0f);
             gains_rms = sqrtf(gains_rms);
             for(i=0; i<ls_num; i++)
-                (*GainMtx)[ns*ls_num+i] = SAF_MAX(gains[i]/gains_rms, 0.0f);
+                GainMtx[ns*ls_num+i] = SAF_MAX(gains[i]/gains_rms, 0.0f);
         }
-
-        free(U_spread);
     }
     /* VBAP (no spread) */
     else{
-        for(ns=0; ns<src_num; ns++){
-            azi_rad  = src_dirs[ns*2+0]*SAF_PI/180.0f;
-            elev_rad = src_dirs[ns*2+1]*SAF_PI/180.0f;
+        for(ns=ns_start; ns<ns_end; ns++){
+            azi_rad  = d->src_dirs[ns*2+0]*SAF_PI/180.0f;
+            elev_rad = d->src_dirs[ns*2+1]*SAF_PI/180.0f;
             u[0] = cosf(azi_rad)*cosf(elev_rad);
             u[1] = sinf(azi_rad)*cosf(elev_rad);
             u[2] = sinf(elev_rad);
@@ -888,11 +950,61 @@ void vbap3D
                 gains_rms += powf(gains[i], 2.0f);
             gains_rms = sqrtf(gains_rms);
             for(i=0; i<ls_num; i++)
-                (*GainMtx)[ns*ls_num+i] = SAF_MAX(gains[i]/gains_rms, 0.0f);
+                GainMtx[ns*ls_num+i] = SAF_MAX(gains[i]/gains_rms, 0.0f);
         }
     }
+}
 
-    free(gains);
+void vbap3D
+(
+    float* src_dirs,
+    int src_num,
+    int ls_num,
+    int* ls_groups,
+    int nFaces,
+    float spread,
+    float* layoutInvMtx,
+    float** GainMtx
+)
+{
+    vbap3D_threaded(src_dirs, src_num, ls_num, ls_groups, nFaces, spread, layoutInvMtx, NULL, GainMtx);
+}
+
+void vbap3D_threaded
+(
+    float* src_dirs,
+    int src_num,
+    int ls_num,
+    int* ls_groups,
+    int nFaces,
+    float spread,
+    float* layoutInvMtx,
+    void* const hPool,
+    float** GainMtx
+)
+{
+    int nThreads;
+    vbap3D_jobData d;
+
+    (*GainMtx) = malloc1d(src_num*ls_num*sizeof(float));
+
+    /* Each direction is independent, so the directions are split into blocks, which are shared between the threads
+     * (each with its own scratch memory) */
+    nThreads = saf_threadPool_getNumThreads(hPool);
+    d.src_dirs = src_dirs;
+    d.src_num = src_num;
+    d.ls_num = ls_num;
+    d.ls_groups = ls_groups;
+    d.nFaces = nFaces;
+    d.spread = spread;
+    d.layoutInvMtx = layoutInvMtx;
+    d.GainMtx = (*GainMtx);
+    d.gains = malloc1d(nThreads*ls_num*sizeof(float));
+    d.U_spread = malloc1d(nThreads*(VBAP3D_N_SPREAD_RINGS*VBAP3D_N_SPREAD_SRCS+1)*3*sizeof(float));
+    saf_threadPool_run(hPool, (src_num+VBAP3D_DIRS_PER_JOB-1)/VBAP3D_DIRS_PER_JOB, vbap3D_job, (void*)&d);
+
+    free(d.gains);
+    free(d.U_spread);
 }
 
 void findLsPairs
@@ -1017,3 +1129,470 @@ void vbap2D
 
     free(gains);
 }
+
+/* ========================================================================== */
+/*                                VBAP Renderer                               */
+/* ========================================================================== */
+
+/** Resolution of the triangle look-up grid, in degrees */
+#define VBAP_RENDERER_CELL_RES ( 10 )
+/** Number of azimuth cells in the triangle look-up grid */
+#define VBAP_RENDERER_N_CELLS_AZI ( 360/VBAP_RENDERER_CELL_RES )
+/** Number of elevation cells in the triangle look-up grid */
+#define VBAP_RENDERER_N_CELLS_ELEV ( 180/VBAP_RENDERER_CELL_RES )
+/**
+ * Margin (in radians) added to the bounding cap of each triangle, such that
+ * directions which lie just outside of a triangle (but still within the
+ * tolerance used by vbap3D()) are not missed */
+#define VBAP_RENDERER_CAP_MARGIN ( 0.02 )
+/** Number of auxiliary sources used for spreading (same as vbap3D()) */
+#define VBAP_RENDERER_N_SPREAD_SRCS ( 8 )
+
+/**
+ * Data structure for the VBAP renderer
+ */
+typedef struct _vbapRenderer_data {
+    int L;                     /**< Number of loudspeakers */
+    int L_d;                   /**< Number of loudspeakers, including dummies */
+    int nFaces;                /**< Number of loudspeaker triangles */
+    float spread;              /**< Spread in degrees */
+    int* faces;                /**< Loudspeaker triangle indices; FLAT: nFaces x 3 */
+    float* layoutInvMtx;       /**< Inverted loudspeaker matrices; FLAT: nFaces x 9 */
+    int* adjacency;            /**< Neighbouring triangle across the edge opposite each vertex (-1: none); FLAT: nFaces x 3 */
+    int* cellOffsets;          /**< Start of the candidate triangles of each cell in cellFaces; (nCells+1) x 1 */
+    int* cellFaces;            /**< Candidate triangle indices, for all cells (ascending per cell) */
+    float* gains_d;            /**< Scratch gains, including dummies; L_d x 1 */
+    float* U_spread;           /**< Scratch spread directions; FLAT: (nSpreadSrcs+1) x 3 */
+
+    /* LRU cache */
+    int cacheSize;             /**< Maximum number of cached directions (0: disabled) */
+    int nCached;               /**< Current number of cached directions */
+    unsigned long long clock;  /**< Incremented on every query */
+    float* cache_dirs_deg;     /**< Cached directions; FLAT: cacheSize x 2 */
+    float* cache_gains;        /**< Cached gains; FLAT: cacheSize x L */
+    unsigned long long* cache_lastUsed; /**< When each entry was last used; cacheSize x 1 */
+
+}vbapRenderer_data;
+
+/** Triangulates a loudspeaker layout, adding dummies (as in generateVBAPgainTable3D()) if requested */
+static void vbapRenderer_triangulate
+(
+    float* ls_dirs_deg,
+    int L,
+    int omitLargeTriangles,
+    int enableDummies,
+    float** out_vertices,
+    int* numOutVertices,
+    int** out_faces,
+    int* numOutFaces
+)
+{
+    int i, L_d;
+    int needDummy[2] = {1, 1};
+    float* ls_dirs_d_deg;
+
+    if(enableDummies){
+        /* scan the loudspeaker directions to see if dummies need to be added */
+        for(i=0; i<L; i++){
+            if(ls_dirs_deg[i*2+1] <= -ADD_DUMMY_LIMIT)
+                needDummy[0] = 0;
+            if(ls_dirs_deg[i*2+1] >=  ADD_DUMMY_LIMIT)
+                needDummy[1] = 0;
+        }
+        if(needDummy[0] || needDummy[1]){
+            /* add dummies to the extreme top/bottom as required */
+            L_d = L+needDummy[0]+needDummy[1];
+            ls_dirs_d_deg = malloc1d(L_d*2*sizeof(float));
+            memcpy(ls_dirs_d_deg, ls_dirs_deg, L*2*sizeof(float));
+            if (needDummy[0]){
+                ls_dirs_d_deg[i*2+0] = 0.0f;
+                ls_dirs_d_deg[i*2+1] = -90.0f;
+                i++;
+            }
+            if (needDummy[1]){
+                ls_dirs_d_deg[i*2+0] = 0.0f;
+                ls_dirs_d_deg[i*2+1] = 90.0f;
+            }
+            findLsTriplets(ls_dirs_d_deg, L_d, omitLargeTriangles, out_vertices, numOutVertices, out_faces, numOutFaces);
+            free(ls_dirs_d_deg);
+            return;
+        }
+    }
+    findLsTriplets(ls_dirs_deg, L, omitLargeTriangles, out_vertices, numOutVertices, out_faces, numOutFaces);
+}
+
+/** Returns the look-up grid cell which contains a direction, given in degrees */
+static int vbapRenderer_getCell
+(
+    float azi_deg,
+    float elev_deg
+)
+{
+    int ia, ie;
+    float a;
+
+    a = fmodf(azi_deg+180.0f, 360.0f);
+    if(a<0.0f)
+        a += 360.0f;
+    ia = SAF_MIN(SAF_MAX((int)(a/(float)VBAP_RENDERER_CELL_RES), 0), VBAP_RENDERER_N_CELLS_AZI-1);
+    ie = SAF_MIN(SAF_MAX((int)((elev_deg+90.0f)/(float)VBAP_RENDERER_CELL_RES), 0), VBAP_RENDERER_N_CELLS_ELEV-1);
+    return ie*VBAP_RENDERER_N_CELLS_AZI + ia;
+}
+
+/**
+ * Computes the gains of one triangle for a direction, using the same arithmetic
+ * as vbap3D(). Returns 1 if the direction lies within it (in which case the
+ * gains are normalised), or 0 otherwise (in which case the unnormalised gains
+ * are returned, the most negative of which indicates which edge the direction
+ * lies beyond) */
+static int vbapRenderer_triangleGains
+(
+    float* invMtx,
+    float u[3],
+    float g_tmp[3]
+)
+{
+    int j;
+    float min_val, g_tmp_rms;
+
+    utility_svvdot(&invMtx[0], u, 3, &g_tmp[0]);
+    utility_svvdot(&invMtx[3], u, 3, &g_tmp[1]);
+    utility_svvdot(&invMtx[6], u, 3, &g_tmp[2]);
+    min_val = 2.23e13f;
+    g_tmp_rms = 0.0;
+    for(j=0; j<3; j++){
+        min_val = SAF_MIN(min_val, g_tmp[j]);
+        g_tmp_rms +=  powf(g_tmp[j], 2.0f);
+    }
+    g_tmp_rms = sqrtf(g_tmp_rms);
+    if(min_val>-0.001){
+        for(j=0; j<3; j++)
+            g_tmp[j] /= g_tmp_rms;
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * Returns the first triangle (in the look-up grid cell of the direction) which
+ * contains the direction, and its gains; or -1 if there is none */
+static int vbapRenderer_findTriangle
+(
+    vbapRenderer_data* h,
+    float azi_deg,
+    float elev_deg,
+    float u[3],
+    float g_tmp[3]
+)
+{
+    int k, cell;
+
+    cell = vbapRenderer_getCell(azi_deg, elev_deg);
+    for(k=h->cellOffsets[cell]; k<h->cellOffsets[cell+1]; k++)
+        if(vbapRenderer_triangleGains(&(h->layoutInvMtx[h->cellFaces[k]*9]), u, g_tmp))
+            return h->cellFaces[k];
+    return -1;
+}
+
+/** Normalises the gains (including any dummies), and then discards the dummies */
+static void vbapRenderer_normaliseGains
+(
+    vbapRenderer_data* h,
+    float* gains
+)
+{
+    int i;
+    float gains_rms;
+
+    gains_rms = 0.0;
+    for(i=0; i<h->L_d; i++)
+        gains_rms += powf(h->gains_d[i], 2.0f);
+    gains_rms = sqrtf(gains_rms);
+    for(i=0; i<h->L; i++)
+        gains[i] = SAF_MAX(h->gains_d[i]/gains_rms, 0.0f);
+}
+
+void vbapRenderer_create
+(
+    void ** const phVbap,
+    float* ls_dirs_deg,
+    int L,
+    int omitLargeTriangles,
+    int enableDummies,
+    float spread,
+    int cacheSize
+)
+{
+    *phVbap = malloc1d(sizeof(vbapRenderer_data));
+    vbapRenderer_data *h = (vbapRenderer_data*)(*phVbap);
+    int i, j, k, ia, ie, nCells, nCandidates, pass;
+    int* faceEverywhere;
+    float* vertices;
+    double cell_u[3], cell_rad, cell_maxcos, cell_azi, cell_elev, el0, el1, dotp, norm;
+    double* face_c, *face_rad;
+
+    h->L = L;
+    h->spread = spread;
+
+    /* Triangulate, and invert the loudspeaker matrices (this is all that is kept of the layout) */
+    vertices = NULL;
+    h->faces = NULL;
+    h->layoutInvMtx = NULL;
+    vbapRenderer_triangulate(ls_dirs_deg, L, omitLargeTriangles, enableDummies, &vertices, &(h->L_d), &(h->faces), &(h->nFaces));
+    invertLsMtx3D(vertices, h->faces, h->nFaces, &(h->layoutInvMtx));
+
+    /* Find the neighbouring triangle across each edge (i.e. the other triangle which shares its two vertices) */
+    h->adjacency = malloc1d(SAF_MAX(h->nFaces,1)*3*sizeof(int));
+    for(i=0; i<h->nFaces; i++){
+        for(k=0; k<3; k++){
+            ia = h->faces[i*3+(k+1)%3];
+            ie = h->faces[i*3+(k+2)%3];
+            h->adjacency[i*3+k] = -1;
+            for(j=0; j<h->nFaces && h->adjacency[i*3+k]==-1; j++){
+                if(j!=i &&
+                   (h->faces[j*3+0]==ia || h->faces[j*3+1]==ia || h->faces[j*3+2]==ia) &&
+                   (h->faces[j*3+0]==ie || h->faces[j*3+1]==ie || h->faces[j*3+2]==ie))
+                    h->adjacency[i*3+k] = j;
+            }
+        }
+    }
+
+    /* Bounding cap of each triangle: its (normalised) centroid, and the largest angle to its vertices */
+    face_c = malloc1d(SAF_MAX(h->nFaces,1)*3*sizeof(double));
+    face_rad = malloc1d(SAF_MAX(h->nFaces,1)*sizeof(double));
+    faceEverywhere = malloc1d(SAF_MAX(h->nFaces,1)*sizeof(int));
+    for(i=0; i<h->nFaces; i++){
+        for(j=0; j<3; j++)
+            face_c[i*3+j] = (double)vertices[h->faces[i*3+0]*3+j] + (double)vertices[h->faces[i*3+1]*3+j] + (double)vertices[h->faces[i*3+2]*3+j];
+        norm = sqrt(face_c[i*3+0]*face_c[i*3+0] + face_c[i*3+1]*face_c[i*3+1] + face_c[i*3+2]*face_c[i*3+2]);
+        face_rad[i] = 0.0;
+        for(j=0; j<3; j++)
+            face_c[i*3+j] /= SAF_MAX(norm, 1e-12);
+        for(k=0; k<3; k++){
+            dotp = 0.0;
+            for(j=0; j<3; j++)
+                dotp += face_c[i*3+j] * (double)vertices[h->faces[i*3+k]*3+j];
+            face_rad[i] = SAF_MAX(face_rad[i], acos(SAF_MAX(SAF_MIN(dotp, 1.0), -1.0)));
+        }
+        face_rad[i] += VBAP_RENDERER_CAP_MARGIN;
+        /* A spherical triangle is only guaranteed to lie within its bounding cap if the cap is smaller than a
+         * hemisphere; otherwise, the triangle is a candidate for all cells */
+        faceEverywhere[i] = face_rad[i] >= SAF_PId/2.0 || norm < 1e-6;
+    }
+
+    /* Find the candidate triangles for each cell of the look-up grid. A triangle is a candidate if its bounding
+     * cap overlaps with the bounding cap of the cell. The first pass counts, and the second fills */
+    nCells = VBAP_RENDERER_N_CELLS_AZI*VBAP_RENDERER_N_CELLS_ELEV;
+    h->cellOffsets = malloc1d((nCells+1)*sizeof(int));
+    h->cellFaces = NULL;
+    for(pass=0; pass<2; pass++){
+        nCandidates = 0;
+        for(ie=0; ie<VBAP_RENDERER_N_CELLS_ELEV; ie++){
+            el0 = (-90.0 + (double)(ie*VBAP_RENDERER_CELL_RES))*SAF_PId/180.0;
+            el1 = el0 + (double)VBAP_RENDERER_CELL_RES*SAF_PId/180.0;
+            cell_elev = (el0+el1)/2.0;
+            cell_maxcos = el0<=0.0 && el1>=0.0 ? 1.0 : cos(SAF_MIN(fabs(el0), fabs(el1)));
+            /* Any point in the cell may be reached from its centre by moving along the meridian, and then along
+             * the parallel (which is never shorter than the great-circle path) */
+            cell_rad = ((double)VBAP_RENDERER_CELL_RES/2.0)*SAF_PId/180.0 * (1.0 + cell_maxcos);
+            for(ia=0; ia<VBAP_RENDERER_N_CELLS_AZI; ia++){
+                cell_azi = (-180.0 + ((double)ia+0.5)*(double)VBAP_RENDERER_CELL_RES)*SAF_PId/180.0;
+                cell_u[0] = cos(cell_azi)*cos(cell_elev);
+                cell_u[1] = sin(cell_azi)*cos(cell_elev);
+                cell_u[2] = sin(cell_elev);
+                if(pass==0)
+                    h->cellOffsets[ie*VBAP_RENDERER_N_CELLS_AZI + ia] = nCandidates;
+                for(i=0; i<h->nFaces; i++){
+                    dotp = cell_u[0]*face_c[i*3+0] + cell_u[1]*face_c[i*3+1] + cell_u[2]*face_c[i*3+2];
+                    if(faceEverywhere[i] || acos(SAF_MAX(SAF_MIN(dotp, 1.0), -1.0)) <= cell_rad + face_rad[i]){
+                        if(pass==1)
+                            h->cellFaces[nCandidates] = i;
+                        nCandidates++;
+                    }
+                }
+            }
+        }
+        if(pass==0){
+            h->cellOffsets[nCells] = nCandidates;
+            h->cellFaces = malloc1d(SAF_MAX(nCandidates,1)*sizeof(int));
+        }
+    }
+
+    /* Scratch and cache */
+    h->gains_d = malloc1d(h->L_d*sizeof(float));
+    h->U_spread = malloc1d((VBAP_RENDERER_N_SPREAD_SRCS+1)*3*sizeof(float));
+    h->cacheSize = SAF_MAX(cacheSize, 0);
+    h->nCached = 0;
+    h->clock = 0;
+    h->cache_dirs_deg = h->cacheSize>0 ? malloc1d(h->cacheSize*2*sizeof(float)) : NULL;
+    h->cache_gains = h->cacheSize>0 ? malloc1d(h->cacheSize*L*sizeof(float)) : NULL;
+    h->cache_lastUsed = h->cacheSize>0 ? malloc1d(h->cacheSize*sizeof(unsigned long long)) : NULL;
+
+    /* clean-up */
+    free(vertices);
+    free(face_c);
+    free(face_rad);
+    free(faceEverywhere);
+}
+
+void vbapRenderer_destroy
+(
+    void ** const phVbap
+)
+{
+    vbapRenderer_data *h = (vbapRenderer_data*)(*phVbap);
+
+    if(h!=NULL){
+        free(h->faces);
+        free(h->layoutInvMtx);
+        free(h->adjacency);
+        free(h->cellOffsets);
+        free(h->cellFaces);
+        free(h->gains_d);
+        free(h->U_spread);
+        free(h->cache_dirs_deg);
+        free(h->cache_gains);
+        free(h->cache_lastUsed);
+        free(h);
+        h = NULL;
+        *phVbap = NULL;
+    }
+}
+
+int vbapRenderer_getNumTriangles
+(
+    void * const hVbap
+)
+{
+    vbapRenderer_data *h = (vbapRenderer_data*)(hVbap);
+    return h->nFaces;
+}
+
+void vbapRenderer_getGains
+(
+    void * const hVbap,
+    float azi_deg,
+    float elev_deg,
+    float* gains
+)
+{
+    vbapRenderer_data *h = (vbapRenderer_data*)(hVbap);
+    int i, j, k, n, cell, lru;
+    float azi_rad, elev_rad;
+    float u[3], g_tmp[3];
+
+    h->clock++;
+
+    /* Return the cached gains, if this direction was queried recently */
+    for(n=0; n<h->nCached; n++){
+        if(h->cache_dirs_deg[n*2+0]==azi_deg && h->cache_dirs_deg[n*2+1]==elev_deg){
+            h->cache_lastUsed[n] = h->clock;
+            memcpy(gains, &(h->cache_gains[n*h->L]), h->L*sizeof(float));
+            return;
+        }
+    }
+
+    azi_rad  = azi_deg*SAF_PI/180.0f;
+    elev_rad = elev_deg*SAF_PI/180.0f;
+    memset(h->gains_d, 0, h->L_d*sizeof(float));
+
+    /* MDAP (with spread): sum the gains of all triangles containing each of the spread directions */
+    if (h->spread > 0.1f) {
+        getSpreadSrcDirs3D(azi_rad, elev_rad, h->spread, VBAP_RENDERER_N_SPREAD_SRCS, 1, h->U_spread);
+        for(n=0; n<VBAP_RENDERER_N_SPREAD_SRCS+1; n++){
+            for(j=0; j<3; j++)
+                u[j] = h->U_spread[n*3+j];
+            cell = vbapRenderer_getCell(atan2f(u[1], u[0])*180.0f/SAF_PI, asinf(SAF_MAX(SAF_MIN(u[2], 1.0f), -1.0f))*180.0f/SAF_PI);
+            for(k=h->cellOffsets[cell]; k<h->cellOffsets[cell+1]; k++){
+                i = h->cellFaces[k];
+                if(vbapRenderer_triangleGains(&(h->layoutInvMtx[i*9]), u, g_tmp))
+                    for(j=0; j<3; j++)
+                        h->gains_d[h->faces[i*3+j]] += g_tmp[j];
+            }
+        }
+    }
+    /* VBAP (no spread): take the first triangle containing the source direction */
+    else{
+        u[0] = cosf(azi_rad)*cosf(elev_rad);
+        u[1] = sinf(azi_rad)*cosf(elev_rad);
+        u[2] = sinf(elev_rad);
+        i = vbapRenderer_findTriangle(h, azi_deg, elev_deg, u, g_tmp);
+        if(i>=0)
+            for(j=0; j<3; j++)
+                h->gains_d[h->faces[i*3+j]] = g_tmp[j];
+    }
+    vbapRenderer_normaliseGains(h, gains);
+
+    /* Store in the cache, replacing the least recently used entry if it is full */
+    if(h->cacheSize>0){
+        if(h->nCached<h->cacheSize)
+            lru = h->nCached++;
+        else{
+            lru = 0;
+            for(n=1; n<h->cacheSize; n++)
+                if(h->cache_lastUsed[n] < h->cache_lastUsed[lru])
+                    lru = n;
+        }
+        h->cache_dirs_deg[lru*2+0] = azi_deg;
+        h->cache_dirs_deg[lru*2+1] = elev_deg;
+        h->cache_lastUsed[lru] = h->clock;
+        memcpy(&(h->cache_gains[lru*h->L]), gains, h->L*sizeof(float));
+    }
+}
+
+void vbapRenderer_getGainsTracked
+(
+    void * const hVbap,
+    float azi_deg,
+    float elev_deg,
+    int* triangleIdx,
+    float* gains
+)
+{
+    vbapRenderer_data *h = (vbapRenderer_data*)(hVbap);
+    int i, j, step, found;
+    float azi_rad, elev_rad, gains_rms;
+    float u[3], g_tmp[3];
+
+    /* MDAP sums over all triangles containing each of the spread directions, so there is nothing to track */
+    if (h->spread > 0.1f) {
+        vbapRenderer_getGains(hVbap, azi_deg, elev_deg, gains);
+        (*triangleIdx) = -1;
+        return;
+    }
+
+    azi_rad  = azi_deg*SAF_PI/180.0f;
+    elev_rad = elev_deg*SAF_PI/180.0f;
+    u[0] = cosf(azi_rad)*cosf(elev_rad);
+    u[1] = sinf(azi_rad)*cosf(elev_rad);
+    u[2] = sinf(elev_rad);
+
+    /* Walk from the previously enclosing triangle, always crossing the edge opposite the most negative gain (i.e.
+     * the edge which the direction lies furthest beyond). For small movements, this is the same triangle, or one
+     * of its neighbours */
+    found = -1;
+    i = (*triangleIdx);
+    for(step=0; step<h->nFaces && i>=0 && i<h->nFaces; step++){
+        if(vbapRenderer_triangleGains(&(h->layoutInvMtx[i*9]), u, g_tmp)){
+            found = i;
+            break;
+        }
+        j = g_tmp[0] < g_tmp[1] ? (g_tmp[0] < g_tmp[2] ? 0 : 2) : (g_tmp[1] < g_tmp[2] ? 1 : 2);
+        i = h->adjacency[i*3+j];
+    }
+
+    /* Otherwise (no previous triangle, or the walk ran into a gap in the triangulation), use the look-up grid */
+    if(found<0)
+        found = vbapRenderer_findTriangle(h, azi_deg, elev_deg, u, g_tmp);
+
+    /* Only the gains of the enclosing triangle are non-zero, so only these need to be normalised (and any dummies
+     * are then discarded) */
+    memset(gains, 0, h->L*sizeof(float));
+    if(found>=0){
+        gains_rms = sqrtf(g_tmp[0]*g_tmp[0] + g_tmp[1]*g_tmp[1] + g_tmp[2]*g_tmp[2]);
+        for(j=0; j<3; j++)
+            if(h->faces[found*3+j] < h->L)
+                gains[h->faces[found*3+j]] = SAF_MAX(g_tmp[j]/gains_rms, 0.0f);
+    }
+    (*triangleIdx) = found;
+}
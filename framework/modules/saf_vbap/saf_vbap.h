@@ -83,6 +83,43 @@ void generateVBAPgainTable3D_srcs(/* Input arguments */
                                   int* N_gtable,
                                   int* nTriangles);
 
+/**
+ * Same as generateVBAPgainTable3D_srcs(), except the source directions are
+ * split between the threads of a thread pool (see saf_threadPool_create())
+ *
+ * @note The gains are the same as those given by
+ *       generateVBAPgainTable3D_srcs(), regardless of the number of threads.
+ * @test test__generateVBAPgainTable3D_threaded()
+ *
+ * @param[in]  src_dirs_deg       Source directions in degrees; FLAT: S x 2
+ * @param[in]  S                  Number of Sources
+ * @param[in]  ls_dirs_deg        Loudspeaker directions in degrees; FLAT: L x 2
+ * @param[in]  L                  Number of loudspeakers
+ * @param[in]  omitLargeTriangles '0' normal triangulation, '1' remove large
+ *                                triangles
+ * @param[in]  enableDummies      '0' disabled, '1' enabled, and dummies are
+ *                                placed at +/-90 elevation if required
+ * @param[in]  spread             Spreading factor in degrees, 0: VBAP, >0: MDAP
+ * @param[in]  hPool              Thread pool handle (NULL: single-threaded)
+ * @param[out] gtable             (&) The 3D VBAP gain table energy normalised;
+ *                                FLAT: N_gtable x L
+ * @param[out] N_gtable           (&) number of points in the gain table
+ * @param[out] nTriangles         (&) number of loudspeaker triangles
+ */
+void generateVBAPgainTable3D_srcs_threaded(/* Input arguments */
+                                           float* src_dirs_deg,
+                                           int S,
+                                           float* ls_dirs_deg,
+                                           int L,
+                                           int omitLargeTriangles,
+                                           int enableDummies,
+                                           float spread,
+                                           void* const hPool,
+                                           /* Output arguments */
+                                           float** gtable,
+                                           int* N_gtable,
+                                           int* nTriangles);
+
 /**
  * Generates a 3-D VBAP gain table based on specified loudspeaker directions,
  * with optional spreading [2]
@@ -139,6 +176,43 @@ void generateVBAPgainTable3D(/* Input arguments */
                              int* N_gtable,
                              int* nTriangles);
 
+/**
+ * Same as generateVBAPgainTable3D(), except the grid directions are split
+ * between the threads of a thread pool (see saf_threadPool_create())
+ *
+ * @note The gains are the same as those given by generateVBAPgainTable3D(),
+ *       regardless of the number of threads.
+ * @test test__generateVBAPgainTable3D_threaded()
+ *
+ * @param[in]  ls_dirs_deg        Loudspeaker directions in degrees; FLAT: L x 2
+ * @param[in]  L                  Number of loudspeakers
+ * @param[in]  az_res_deg         Azimuthal resolution in degrees
+ * @param[in]  el_res_deg         Elevation resolution in degrees
+ * @param[in]  omitLargeTriangles '0' normal triangulation, '1' remove large
+ *                                triangles
+ * @param[in]  enableDummies      '0' disabled, '1' enabled. Dummies are placed
+ *                                at +/-90 elevation if required
+ * @param[in]  spread             Spreading factor in degrees, 0: VBAP, >0: MDAP
+ * @param[in]  hPool              Thread pool handle (NULL: single-threaded)
+ * @param[out] gtable             (&) The 3D VBAP gain table ENERGY normalised;
+ *                                FLAT: N_gtable x L
+ * @param[out] N_gtable           (&) number of points in the gain table
+ * @param[out] nTriangles         (&) number of loudspeaker triangles
+ */
+void generateVBAPgainTable3D_threaded(/* Input arguments */
+                                      float* ls_dirs_deg,
+                                      int L,
+                                      int az_res_deg,
+                                      int el_res_deg,
+                                      int omitLargeTriangles,
+                                      int enableDummies,
+                                      float spread,
+                                      void* const hPool,
+                                      /* Output arguments */
+                                      float** gtable,
+                                      int* N_gtable,
+                                      int* nTriangles);
+
 /**
  * Compresses a VBAP gain table to use less memory and CPU (by removing the
  * elements which are just zero)
@@ -401,6 +475,36 @@ void vbap3D(/* Input Arguments */
             /* Output Arguments */
             float** GainMtx);
 
+/**
+ * Same as vbap3D(), except the source directions are split (in blocks) between
+ * the threads of a thread pool (see saf_threadPool_create()); each thread
+ * using its own scratch memory
+ *
+ * @param[in]  src_dirs     Source directions in degrees; FLAT: src_num x 2
+ * @param[in]  src_num      Number of sources
+ * @param[in]  ls_num       Number of loudspeakers
+ * @param[in]  ls_groups    Loudspeaker triangle indices, see findLsTriplets();
+ *                          FLAT: nFaces x 3
+ * @param[in]  nFaces       Number of true loudspeaker triangles
+ * @param[in]  spread       Spreading in degrees, 0: VBAP, >0: MDAP
+ * @param[in]  layoutInvMtx Inverted 3x3 loudspeaker matrix flattened, see
+ *                          invertLsMtx3D(); FLAT: nFaces x 9
+ * @param[in]  hPool        Thread pool handle (NULL: single-threaded)
+ * @param[out] GainMtx      (&) Loudspeaker VBAP gain table;
+ *                          FLAT: src_num x ls_num
+ */
+void vbap3D_threaded(/* Input Arguments */
+                     float* src_dirs,
+                     int src_num,
+                     int ls_num,
+                     int* ls_groups,
+                     int nFaces,
+                     float spread,
+                     float* layoutInvMtx,
+                     void* const hPool,
+                     /* Output Arguments */
+                     float** GainMtx);
+
 /**
  * Calculates loudspeaker pairs for a circular grid of loudspeaker directions
  *
@@ -458,6 +562,114 @@ void vbap2D(/* Input Arguments */
             float** GainMtx);
 
 
+/* ========================================================================== */
+/*                                VBAP Renderer                               */
+/* ========================================================================== */
+
+/**
+ * Creates an instance of a VBAP renderer, which computes 3D VBAP/MDAP gains on
+ * demand (rather than for a dense grid of directions, as with
+ * generateVBAPgainTable3D())
+ *
+ * Only the loudspeaker triangles and their inverted matrices are kept, along
+ * with a coarse look-up grid over azimuth/elevation, which lists the
+ * triangles that may contain the directions in each of its cells. Therefore,
+ * only a few triangles are tested per query, and the memory needed does not
+ * depend on the angular resolution of the queries. The gains are the same as
+ * those given by vbap3D() for the same triangulation.
+ *
+ * @note An LRU cache of the most recently queried directions may also be
+ *       enabled. Queries update this cache, so an instance must not be queried
+ *       from more than one thread at a time.
+ * @test test__vbapRenderer()
+ *
+ * @param[in] phVbap             (&) address of VBAP renderer handle
+ * @param[in] ls_dirs_deg        Loudspeaker directions in degrees;
+ *                               FLAT: L x 2
+ * @param[in] L                  Number of loudspeakers
+ * @param[in] omitLargeTriangles '0' normal triangulation, '1' remove large
+ *                               triangles
+ * @param[in] enableDummies      '0' disabled, '1' enabled. Dummies are placed
+ *                               at +/-90 elevation if required
+ * @param[in] spread             Spreading in degrees, 0: VBAP, >0: MDAP
+ * @param[in] cacheSize          Number of directions to cache (0: disabled)
+ */
+void vbapRenderer_create(/* Input Arguments */
+                         void ** const phVbap,
+                         float* ls_dirs_deg,
+                         int L,
+                         int omitLargeTriangles,
+                         int enableDummies,
+                         float spread,
+                         int cacheSize);
+
+/**
+ * Destroys an instance of a VBAP renderer
+ *
+ * @param[in] phVbap (&) address of VBAP renderer handle
+ */
+void vbapRenderer_destroy(/* Input Arguments */
+                          void ** const phVbap);
+
+/**
+ * Returns the number of loudspeaker triangles used by a VBAP renderer
+ *
+ * @param[in] hVbap VBAP renderer handle
+ * @returns number of triangles
+ */
+int vbapRenderer_getNumTriangles(/* Input Arguments */
+                                 void * const hVbap);
+
+/**
+ * Computes the VBAP/MDAP gains for one source direction
+ *
+ * @note This function does not allocate any memory.
+ *
+ * @param[in]  hVbap    VBAP renderer handle
+ * @param[in]  azi_deg  Source azimuth, in degrees
+ * @param[in]  elev_deg Source elevation, in degrees
+ * @param[out] gains    Loudspeaker gains; L x 1
+ */
+void vbapRenderer_getGains(/* Input Arguments */
+                           void * const hVbap,
+                           float azi_deg,
+                           float elev_deg,
+                           /* Output Arguments */
+                           float* gains);
+
+/**
+ * Computes the VBAP gains for one (moving) source direction, starting the
+ * search from the triangle which enclosed this source previously
+ *
+ * Adjacent triangles are walked, towards the source direction, until the
+ * enclosing triangle is found. Therefore, when sources move only a little
+ * between calls, this takes only a few steps on average (and the gains are
+ * exact, rather than quantised to a grid). The look-up grid is used if there
+ * is no previous triangle, or if the walk runs into a gap in the
+ * triangulation. The LRU cache is not used.
+ *
+ * @note With spreading (MDAP) enabled, this is the same as
+ *       vbapRenderer_getGains(), and triangleIdx is set to -1. This function
+ *       does not allocate any memory.
+ * @test test__vbapRenderer_tracked()
+ *
+ * @param[in]     hVbap       VBAP renderer handle
+ * @param[in]     azi_deg     Source azimuth, in degrees
+ * @param[in]     elev_deg    Source elevation, in degrees
+ * @param[in,out] triangleIdx (&) Enclosing triangle of this source; set to -1
+ *                            before the first call for each source, and then
+ *                            pass the returned value back in for the next one
+ * @param[out]    gains       Loudspeaker gains; L x 1
+ */
+void vbapRenderer_getGainsTracked(/* Input Arguments */
+                                  void * const hVbap,
+                                  float azi_deg,
+                                  float elev_deg,
+                                  int* triangleIdx,
+                                  /* Output Arguments */
+                                  float* gains);
+
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif /* __cplusplus */
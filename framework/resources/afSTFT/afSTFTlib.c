@@ -176,8 +176,8 @@ void afSTFT_create
     if(nCHout>0){
         h->STFTOutputFrameTF = malloc1d(nCHout * sizeof(complexVector));
         for(ch=0; ch < nCHout; ch++) {
-            h->STFTOutputFrameTF[ch].re = (float*)calloc1d(h->nBands, sizeof(float));
-            h->STFTOutputFrameTF[ch].im = (float*)calloc1d(h->nBands, sizeof(float));
+            h->STFTOutputFrameTF[ch].re = (float*)calloc1d_aligned(h->nBands, sizeof(float));
+            h->STFTOutputFrameTF[ch].im = (float*)calloc1d_aligned(h->nBands, sizeof(float));
         }
     }
     else
@@ -187,8 +187,8 @@ void afSTFT_create
     if(nCHin>0){
         h->STFTInputFrameTF = malloc1d(nCHin * sizeof(complexVector));
         for(ch=0; ch < nCHin; ch++) {
-            h->STFTInputFrameTF[ch].re = (float*)calloc1d(h->nBands, sizeof(float));
-            h->STFTInputFrameTF[ch].im = (float*)calloc1d(h->nBands, sizeof(float));
+            h->STFTInputFrameTF[ch].re = (float*)calloc1d_aligned(h->nBands, sizeof(float));
+            h->STFTInputFrameTF[ch].im = (float*)calloc1d_aligned(h->nBands, sizeof(float));
         }
     }
     else
@@ -208,13 +208,13 @@ void afSTFT_destroy
         afSTFTlib_free(h->hInt);
         if(h->STFTInputFrameTF!=NULL){
             for (ch = 0; ch< h->nCHin; ch++) {
-                free(h->STFTInputFrameTF[ch].re);
-                free(h->STFTInputFrameTF[ch].im);
+                free_aligned(h->STFTInputFrameTF[ch].re);
+                free_aligned(h->STFTInputFrameTF[ch].im);
             }
         }
         for (ch = 0; ch< h->nCHout; ch++) {
-            free(h->STFTOutputFrameTF[ch].re);
-            free(h->STFTOutputFrameTF[ch].im);
+            free_aligned(h->STFTOutputFrameTF[ch].re);
+            free_aligned(h->STFTOutputFrameTF[ch].im);
         }
         free(h->STFTInputFrameTF);
         free(h->STFTOutputFrameTF);
@@ -488,24 +488,24 @@ void afSTFT_channelChange
     /* resize buffers */
     if(h->nCHin!=new_nCHin){
         for(i=new_nCHin; i<h->nCHin; i++){
-            free(h->STFTInputFrameTF[i].re);
-            free(h->STFTInputFrameTF[i].im);
+            free_aligned(h->STFTInputFrameTF[i].re);
+            free_aligned(h->STFTInputFrameTF[i].im);
         }
         h->STFTInputFrameTF = realloc1d(h->STFTInputFrameTF, sizeof(complexVector)*new_nCHin);
         for(i=h->nCHin; i<new_nCHin; i++){
-            h->STFTInputFrameTF[i].re = (float*)calloc1d(h->nBands, sizeof(float));
-            h->STFTInputFrameTF[i].im = (float*)calloc1d(h->nBands, sizeof(float));
+            h->STFTInputFrameTF[i].re = (float*)calloc1d_aligned(h->nBands, sizeof(float));
+            h->STFTInputFrameTF[i].im = (float*)calloc1d_aligned(h->nBands, sizeof(float));
         }
     }
     if(h->nCHout!=new_nCHout){
         for(i=new_nCHout; i<h->nCHout; i++){
-            free(h->STFTOutputFrameTF[i].re);
-            free(h->STFTOutputFrameTF[i].im);
+            free_aligned(h->STFTOutputFrameTF[i].re);
+            free_aligned(h->STFTOutputFrameTF[i].im);
         }
         h->STFTOutputFrameTF = realloc1d(h->STFTOutputFrameTF, sizeof(complexVector)*new_nCHout);
         for(i=h->nCHout; i<new_nCHout; i++){
-            h->STFTOutputFrameTF[i].re = (float*)calloc1d(h->nBands, sizeof(float));
-            h->STFTOutputFrameTF[i].im = (float*)calloc1d(h->nBands, sizeof(float));
+            h->STFTOutputFrameTF[i].re = (float*)calloc1d_aligned(h->nBands, sizeof(float));
+            h->STFTOutputFrameTF[i].im = (float*)calloc1d_aligned(h->nBands, sizeof(float));
         }
     }
     if( SAF_MAX(h->nCHin, h->nCHout) != SAF_MAX(new_nCHin, new_nCHout))
@@ -673,3 +673,97 @@ void afSTFT_FIRtoFilterbankCoeffs
     free(irFB);
 }
 
+void afSTFT_filterbankCoeffsToFIR
+(
+    float_complex* hFB /* nBands x nCH x N_dirs */,
+    int N_dirs,
+    int nCH,
+    int hopSize,
+    int hybridmode,
+    int fir_len,
+    int delay,
+    float* hIR /* N_dirs x nCH x fir_len */
+)
+{
+    int i, j, k, n, band, nd, nm, nBands, nBins, winLen;
+    float f, frac, mag, phase;
+    float* centreFreqs, *uniformFreqs, *mags, *phases, *win, *ir;
+    float_complex* H;
+    void* hFFT;
+
+    assert(fir_len % 2 == 0);
+    assert(delay >= 0 && delay < fir_len);
+    nBands = hopSize + (hybridmode ? 5 : 1);
+    nBins = fir_len/2 + 1;
+
+    /* Band centre frequencies, normalised w.r.t. the sampling rate */
+    centreFreqs = malloc1d(nBands*sizeof(float));
+    uniformFreqs = malloc1d((hopSize+1)*sizeof(float));
+    getUniformFreqVector(hopSize*2, 1.0f, uniformFreqs);
+    if(hybridmode){
+        cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, 9, 1, 5, 1.0f,
+                    (const float*)__stft2hybCentreFreq, 5,
+                    uniformFreqs, 1, 0.0f,
+                    centreFreqs, 1);
+        for(i=9, j=5; i<nBands; i++, j++)
+            centreFreqs[i] = uniformFreqs[j];
+    }
+    else
+        memcpy(centreFreqs, uniformFreqs, nBands*sizeof(float));
+
+    /* Window applied to the designed responses; fading out their tails over the last third of the taps after the
+     * modelling delay, so that they are not truncated abruptly at fir_len. (The taps before the delay are left as
+     * they are, since they hold the part of the response made causal by the delay) */
+    win = malloc1d(fir_len*sizeof(float));
+    winLen = (fir_len-delay)/3;
+    for(n=0; n<fir_len; n++)
+        win[n] = n < fir_len-winLen ? 1.0f : 0.5f + 0.5f*cosf(SAF_PI*(float)(n-(fir_len-winLen)+1)/(float)winLen);
+
+    mags = malloc1d(nBands*sizeof(float));
+    phases = malloc1d(nBands*sizeof(float));
+    H = malloc1d(nBins*sizeof(float_complex));
+    ir = malloc1d(fir_len*sizeof(float));
+    saf_rfft_create(&hFFT, fir_len);
+    for(nd=0; nd<N_dirs; nd++){
+        for(nm=0; nm<nCH; nm++){
+            /* Magnitudes and unwrapped phases over frequency */
+            for(band=0; band<nBands; band++){
+                mags[band] = cabsf(hFB[band*nCH*N_dirs + nm*N_dirs + nd]);
+                phases[band] = atan2f(cimagf(hFB[band*nCH*N_dirs + nm*N_dirs + nd]), crealf(hFB[band*nCH*N_dirs + nm*N_dirs + nd]));
+                if(band>0){
+                    while(phases[band]-phases[band-1] > SAF_PI)
+                        phases[band] -= 2.0f*SAF_PI;
+                    while(phases[band]-phases[band-1] < -SAF_PI)
+                        phases[band] += 2.0f*SAF_PI;
+                }
+            }
+
+            /* Interpolate onto the uniform grid, and apply the modelling delay */
+            for(k=0, band=0; k<nBins; k++){
+                f = (float)k/(float)fir_len;
+                while(band<nBands-2 && f>centreFreqs[band+1])
+                    band++;
+                frac = (f-centreFreqs[band])/(centreFreqs[band+1]-centreFreqs[band]);
+                frac = SAF_CLAMP(frac, 0.0f, 1.0f);
+                mag = (1.0f-frac)*mags[band] + frac*mags[band+1];
+                phase = (1.0f-frac)*phases[band] + frac*phases[band+1] - 2.0f*SAF_PI*f*(float)delay;
+                H[k] = crmulf(cexpf(cmplxf(0.0f, phase)), mag);
+            }
+            H[0] = cmplxf(crealf(H[0]), 0.0f);
+            H[nBins-1] = cmplxf(crealf(H[nBins-1]), 0.0f);
+            saf_rfft_backward(hFFT, H, ir);
+            utility_svvmul(ir, win, fir_len, &hIR[nd*nCH*fir_len + nm*fir_len]);
+        }
+    }
+
+    /* clean-up */
+    saf_rfft_destroy(&hFFT);
+    free(centreFreqs);
+    free(uniformFreqs);
+    free(mags);
+    free(phases);
+    free(H);
+    free(win);
+    free(ir);
+}
+
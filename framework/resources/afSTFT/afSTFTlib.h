@@ -269,6 +269,40 @@ void afSTFT_FIRtoFilterbankCoeffs(/* Input Arguments */
                                   /* Output Arguments */
                                   float_complex* hFB);
 
+/**
+ * Converts Filterbank Coefficients back into FIR filters (i.e. the reverse of
+ * afSTFT_FIRtoFilterbankCoeffs())
+ *
+ * The magnitudes and (unwrapped) phases of the coefficients are linearly
+ * interpolated from the band centre frequencies onto a uniform frequency grid,
+ * a modelling delay is applied, and the FIRs are then obtained via an inverse
+ * FFT. The tails of the FIRs (the last third of the taps after the modelling
+ * delay) are faded out with a half-Hann window. Note that the coefficients are only defined up to a common delay (the
+ * one removed by afSTFT_FIRtoFilterbankCoeffs()), so the "delay" should be
+ * large enough to render the FIRs causal (e.g. to accommodate any ITDs).
+ *
+ * @param[in]  hFB        Filterbank coefficients; FLAT: N_bands x nCH x N_dirs
+ * @param[in]  N_dirs     Number of FIR sets
+ * @param[in]  nCH        Number of channels per FIR set
+ * @param[in]  hopSize    Hop size
+ * @param[in]  hybridmode 0: disabled, 1:enabled
+ * @param[in]  fir_len    Length of the FIRs (even); note that 2*hopSize places
+ *                        the FFT bins on the (non-hybrid) band centre
+ *                        frequencies
+ * @param[in]  delay      Modelling delay, in samples (<fir_len)
+ * @param[out] hIR        Time-domain FIRs; FLAT: N_dirs x nCH x fir_len
+ */
+void afSTFT_filterbankCoeffsToFIR(/* Input Arguments */
+                                  float_complex* hFB,
+                                  int N_dirs,
+                                  int nCH,
+                                  int hopSize,
+                                  int hybridmode,
+                                  int fir_len,
+                                  int delay,
+                                  /* Output Arguments */
+                                  float* hIR);
+
 
 #ifdef __cplusplus
 }/* extern "C" */
@@ -42,11 +42,15 @@
  * @license MIT
  */
 
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE) && !defined(__APPLE__)
+# define _POSIX_C_SOURCE 200112L /* for posix_memalign() */
+#endif
 #include <stdio.h>
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <stdint.h>
 #include "md_malloc.h"
 
 #ifndef MIN
@@ -56,9 +60,38 @@
 # define MAX(a,b) (( (a) > (b) ) ? (a) : (b))
 #endif
 
+/* Thread-local storage class specifier */
+#if defined(_MSC_VER)
+# define MD_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+# define MD_THREAD_LOCAL _Thread_local
+#else
+# define MD_THREAD_LOCAL __thread /* (GCC/Clang extension) */
+#endif
+
+/* Real-time region checking (see md_rt_setCheckMode()); the region depth is per-thread, since the "_process" functions
+ * of different objects may be called from different threads */
+static MD_RT_CHECK_MODES md_rt_mode = MD_RT_CHECK_DISABLED;
+static MD_THREAD_LOCAL int md_rt_depth = 0;
+static unsigned long md_rt_nAllocations = 0;
+
+/** Called by the allocation functions; reacts if inside a real-time region */
+static void md_rt_check(const char* funcName, size_t nBytes)
+{
+    if(md_rt_depth<=0 || md_rt_mode==MD_RT_CHECK_DISABLED)
+        return;
+    md_rt_nAllocations++;
+    if(md_rt_mode==MD_RT_CHECK_ABORT){
+        fprintf(stderr, "Error: '%s' was called with %zu bytes inside a real-time region.\n", funcName, nBytes);
+        abort();
+    }
+}
+
 void* malloc1d(size_t dim1_data_size)
 {
-    void *ptr = malloc(dim1_data_size);
+    void *ptr;
+    md_rt_check("malloc1d", dim1_data_size);
+    ptr = malloc(dim1_data_size);
 #if !defined(NDEBUG)
     if (ptr == NULL && dim1_data_size!=0)
         fprintf(stderr, "Error: 'malloc1d' failed to allocate %zu bytes.\n", dim1_data_size);
@@ -68,7 +101,9 @@ void* malloc1d(size_t dim1_data_size)
 
 void* calloc1d(size_t dim1, size_t data_size)
 {
-    void *ptr = calloc(dim1, data_size);
+    void *ptr;
+    md_rt_check("calloc1d", dim1*data_size);
+    ptr = calloc(dim1, data_size);
 #if !defined(NDEBUG)
     if (ptr == NULL && dim1!=0)
         fprintf(stderr, "Error: 'calloc1d' failed to allocate %zu bytes.\n", dim1*data_size);
@@ -78,6 +113,7 @@ void* calloc1d(size_t dim1, size_t data_size)
 
 void* realloc1d(void* ptr, size_t dim1_data_size)
 {
+    md_rt_check("realloc1d", dim1_data_size);
     ptr = realloc(ptr, dim1_data_size);
 #if !defined(NDEBUG)
     if (ptr == NULL && dim1_data_size!=0)
@@ -543,3 +579,293 @@ void****** realloc6d(void****** ptr, size_t dim1, size_t dim2, size_t dim3, size
                          p5[i*dim2*dim3*dim4*dim5 + j*dim3*dim4*dim5 + k*dim4*dim5 + l*dim5 + p] = &p6[i*stride1 + j*stride2 + k*stride3 + l*stride4 + p*stride5];
     return ptr;
 }
+
+size_t aligned_dim(size_t dim, size_t data_size)
+{
+    size_t nBytes;
+    if(data_size==0)
+        return dim;
+    nBytes = ((dim*data_size + MD_MALLOC_ALIGNMENT - 1) / MD_MALLOC_ALIGNMENT) * MD_MALLOC_ALIGNMENT;
+    /* (for data sizes that do not divide the alignment, keep adding elements until the row length is a multiple of it) */
+    while(nBytes % data_size != 0)
+        nBytes += MD_MALLOC_ALIGNMENT;
+    return nBytes/data_size;
+}
+
+void* malloc1d_aligned(size_t dim1_data_size)
+{
+    void *ptr;
+    md_rt_check("malloc1d_aligned", dim1_data_size);
+#if defined(_WIN32)
+    ptr = _aligned_malloc(dim1_data_size==0 ? 1 : dim1_data_size, MD_MALLOC_ALIGNMENT);
+#else
+    if(posix_memalign(&ptr, MD_MALLOC_ALIGNMENT, dim1_data_size==0 ? 1 : dim1_data_size)!=0)
+        ptr = NULL;
+#endif
+#if !defined(NDEBUG)
+    if (ptr == NULL && dim1_data_size!=0)
+        fprintf(stderr, "Error: 'malloc1d_aligned' failed to allocate %zu bytes.\n", dim1_data_size);
+#endif
+    return ptr;
+}
+
+void* calloc1d_aligned(size_t dim1, size_t data_size)
+{
+    void *ptr;
+    ptr = malloc1d_aligned(dim1*data_size);
+    if(ptr!=NULL)
+        memset(ptr, 0, dim1*data_size);
+    return ptr;
+}
+
+void free_aligned(void* ptr)
+{
+#if defined(_WIN32)
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+void** calloc2d_aligned(size_t dim1, size_t dim2, size_t data_size)
+{
+    size_t i, stride, header;
+    void** ptr;
+    unsigned char* p2;
+    stride = aligned_dim(dim2, data_size)*data_size;
+    header = aligned_dim(dim1, sizeof(void*))*sizeof(void*); /* pointer table, padded such that the first row is aligned */
+    ptr = malloc1d_aligned(header + dim1*stride);
+    if(ptr==NULL)
+        return NULL;
+    p2 = (unsigned char*)ptr + header;
+    memset(p2, 0, dim1*stride);
+    for(i=0; i<dim1; i++)
+        ptr[i] = &p2[i*stride];
+    return ptr;
+}
+
+void*** calloc3d_aligned(size_t dim1, size_t dim2, size_t dim3, size_t data_size)
+{
+    size_t i, j, stride1, stride2, header;
+    void*** ptr;
+    void** p2;
+    unsigned char* p3;
+    stride2 = aligned_dim(dim3, data_size)*data_size;
+    stride1 = dim2*stride2;
+    header = aligned_dim(dim1+dim1*dim2, sizeof(void*))*sizeof(void*); /* pointer tables, padded such that the first row is aligned */
+    ptr = malloc1d_aligned(header + dim1*stride1);
+    if(ptr==NULL)
+        return NULL;
+    p2 = (void**)(ptr + dim1);
+    p3 = (unsigned char*)ptr + header;
+    memset(p3, 0, dim1*stride1);
+    for(i=0;i<dim1;i++)
+        ptr[i] = &p2[i*dim2];
+    for(i=0;i<dim1;i++)
+        for(j=0;j<dim2;j++)
+            p2[i*dim2+j] = &p3[i*stride1 + j*stride2];
+    return ptr;
+}
+
+/** Data structure for the memory arena */
+typedef struct _md_arena_data {
+    unsigned char* data; /**< The contiguous block of memory */
+    size_t capacity;     /**< Size of the block, in bytes */
+    size_t used;         /**< Number of bytes handed out so far */
+}md_arena_data;
+
+/** Rounds a number of bytes up to a multiple of MD_MALLOC_ALIGNMENT */
+static size_t md_arena_roundUp(size_t nBytes)
+{
+    return ((nBytes + MD_MALLOC_ALIGNMENT - 1) / MD_MALLOC_ALIGNMENT) * MD_MALLOC_ALIGNMENT;
+}
+
+size_t md_arena_size1d(size_t dim1_data_size)
+{
+    return md_arena_roundUp(dim1_data_size);
+}
+
+size_t md_arena_size2d(size_t dim1, size_t dim2, size_t data_size)
+{
+    return md_arena_roundUp(md_arena_roundUp(dim1*sizeof(void*)) + dim1*dim2*data_size);
+}
+
+size_t md_arena_size3d(size_t dim1, size_t dim2, size_t dim3, size_t data_size)
+{
+    return md_arena_roundUp(md_arena_roundUp(dim1*sizeof(void**) + dim1*dim2*sizeof(void*)) + dim1*dim2*dim3*data_size);
+}
+
+void md_arena_create(void** phArena, size_t capacity)
+{
+    md_arena_data* h;
+    h = (md_arena_data*)malloc1d(sizeof(md_arena_data));
+    *phArena = (void*)h;
+    if(h==NULL)
+        return;
+    h->capacity = md_arena_roundUp(capacity);
+    h->used = 0;
+    h->data = (unsigned char*)malloc1d_aligned(h->capacity);
+    if(h->data==NULL)
+        h->capacity = 0;
+    else
+        memset(h->data, 0, h->capacity); /* (pages-in the whole block) */
+}
+
+void md_arena_destroy(void** phArena)
+{
+    md_arena_data* h = (md_arena_data*)(*phArena);
+    if(h!=NULL){
+        free_aligned(h->data);
+        free(h);
+        *phArena = NULL;
+    }
+}
+
+void md_arena_reset(void* hArena)
+{
+    md_arena_data* h = (md_arena_data*)(hArena);
+    h->used = 0;
+}
+
+size_t md_arena_getUsed(void* hArena)
+{
+    md_arena_data* h = (md_arena_data*)(hArena);
+    return h->used;
+}
+
+size_t md_arena_getCapacity(void* hArena)
+{
+    md_arena_data* h = (md_arena_data*)(hArena);
+    return h->capacity;
+}
+
+void* malloc1d_arena(void* hArena, size_t dim1_data_size)
+{
+    md_arena_data* h = (md_arena_data*)(hArena);
+    size_t nBytes;
+    void* ptr;
+    if(h==NULL)
+        return malloc1d(dim1_data_size);
+    nBytes = md_arena_roundUp(dim1_data_size);
+    if(nBytes > h->capacity - h->used){
+#if !defined(NDEBUG)
+        fprintf(stderr, "Error: 'malloc1d_arena' failed to allocate %zu bytes (%zu of %zu bytes remaining).\n",
+                dim1_data_size, h->capacity - h->used, h->capacity);
+#endif
+        return NULL;
+    }
+    ptr = (void*)(h->data + h->used);
+    h->used += nBytes;
+    return ptr;
+}
+
+void* calloc1d_arena(void* hArena, size_t dim1, size_t data_size)
+{
+    void *ptr;
+    if(hArena==NULL)
+        return calloc1d(dim1, data_size);
+    ptr = malloc1d_arena(hArena, dim1*data_size);
+    if(ptr!=NULL)
+        memset(ptr, 0, dim1*data_size);
+    return ptr;
+}
+
+void** malloc2d_arena(void* hArena, size_t dim1, size_t dim2, size_t data_size)
+{
+    size_t i, stride, header;
+    void** ptr;
+    unsigned char* p2;
+    if(hArena==NULL)
+        return malloc2d(dim1, dim2, data_size);
+    stride = dim2*data_size;
+    header = md_arena_roundUp(dim1*sizeof(void*)); /* (such that the data is also aligned) */
+    ptr = malloc1d_arena(hArena, header + dim1*stride);
+    if(ptr==NULL)
+        return NULL;
+    p2 = (unsigned char*)ptr + header;
+    for(i=0; i<dim1; i++)
+        ptr[i] = &p2[i*stride];
+    return ptr;
+}
+
+void** calloc2d_arena(void* hArena, size_t dim1, size_t dim2, size_t data_size)
+{
+    void** ptr;
+    if(hArena==NULL)
+        return calloc2d(dim1, dim2, data_size);
+    ptr = malloc2d_arena(hArena, dim1, dim2, data_size);
+    if(ptr!=NULL)
+        memset(FLATTEN2D(ptr), 0, dim1*dim2*data_size);
+    return ptr;
+}
+
+void*** malloc3d_arena(void* hArena, size_t dim1, size_t dim2, size_t dim3, size_t data_size)
+{
+    size_t i, j, stride1, stride2, header;
+    void*** ptr;
+    void** p2;
+    unsigned char* p3;
+    if(hArena==NULL)
+        return malloc3d(dim1, dim2, dim3, data_size);
+    stride1 = dim2*dim3*data_size;
+    stride2 = dim3*data_size;
+    header = md_arena_roundUp(dim1*sizeof(void**) + dim1*dim2*sizeof(void*)); /* (such that the data is also aligned) */
+    ptr = malloc1d_arena(hArena, header + dim1*stride1);
+    if(ptr==NULL)
+        return NULL;
+    p2 = (void**)(ptr + dim1);
+    p3 = (unsigned char*)ptr + header;
+    for(i=0;i<dim1;i++)
+        ptr[i] = &p2[i*dim2];
+    for(i=0;i<dim1;i++)
+        for(j=0;j<dim2;j++)
+            p2[i*dim2+j] = &p3[i*stride1 + j*stride2];
+    return ptr;
+}
+
+void*** calloc3d_arena(void* hArena, size_t dim1, size_t dim2, size_t dim3, size_t data_size)
+{
+    void*** ptr;
+    if(hArena==NULL)
+        return calloc3d(dim1, dim2, dim3, data_size);
+    ptr = malloc3d_arena(hArena, dim1, dim2, dim3, data_size);
+    if(ptr!=NULL)
+        memset(FLATTEN3D(ptr), 0, dim1*dim2*dim3*data_size);
+    return ptr;
+}
+
+void free_arena(void* hArena, void* ptr)
+{
+    md_arena_data* h = (md_arena_data*)(hArena);
+    if(h==NULL || (uintptr_t)ptr < (uintptr_t)h->data || (uintptr_t)ptr >= (uintptr_t)h->data + h->capacity)
+        free(ptr); /* (not a chunk of the arena) */
+}
+
+void md_rt_setCheckMode(MD_RT_CHECK_MODES mode)
+{
+    md_rt_mode = mode;
+}
+
+void md_rt_enterRegion(void)
+{
+    if(md_rt_mode==MD_RT_CHECK_DISABLED)
+        return;
+    md_rt_depth++;
+}
+
+void md_rt_exitRegion(void)
+{
+    if(md_rt_mode==MD_RT_CHECK_DISABLED || md_rt_depth<=0)
+        return; /* (also if the check was only enabled after the region was entered) */
+    md_rt_depth--;
+}
+
+unsigned long md_rt_getNumAllocations(void)
+{
+    return md_rt_nAllocations;
+}
+
+void md_rt_resetNumAllocations(void)
+{
+    md_rt_nAllocations = 0;
+}
@@ -91,6 +91,12 @@ extern "C" {
  * of data
  */
 #define FLATTEN6D(A) (*****A) /* || (&A[0][0][0][0][0][0]) */
+
+/**
+ * Alignment (in bytes) of the memory returned by the "_aligned" allocation
+ * functions (64 bytes is one cache-line, and one AVX-512 register)
+ */
+#define MD_MALLOC_ALIGNMENT ( 64 )
     
 /** 1-D malloc (same as malloc, but with error checking) */
 void* malloc1d(size_t dim1_data_size);
@@ -169,6 +175,181 @@ void****** calloc6d(size_t dim1, size_t dim2, size_t dim3, size_t dim4,
 void****** realloc6d(void****** ptr, size_t dim1, size_t dim2, size_t dim3,
                      size_t dim4, size_t dim5, size_t dim6, size_t data_size);
 
+/**
+ * Returns the number of elements of data_size bytes, which are required to pad
+ * a row of dim elements to a multiple of MD_MALLOC_ALIGNMENT bytes (i.e. the
+ * row stride used by calloc2d_aligned() and calloc3d_aligned())
+ */
+size_t aligned_dim(size_t dim, size_t data_size);
+
+/**
+ * 1-D malloc, which returns memory aligned to MD_MALLOC_ALIGNMENT bytes
+ *
+ * @warning Use free_aligned() (NOT free()) to deallocate!
+ * @test test__malloc_aligned()
+ */
+void* malloc1d_aligned(size_t dim1_data_size);
+
+/**
+ * 1-D calloc, which returns memory aligned to MD_MALLOC_ALIGNMENT bytes
+ *
+ * @warning Use free_aligned() (NOT free()) to deallocate!
+ */
+void* calloc1d_aligned(size_t dim1, size_t data_size);
+
+/**
+ * Deallocates memory returned by any of the "_aligned" allocation functions
+ * (which is simply free(), except on Windows)
+ */
+void free_aligned(void* ptr);
+
+/**
+ * 2-D calloc, where each row starts on a MD_MALLOC_ALIGNMENT byte boundary
+ *
+ * The rows are padded to aligned_dim(dim2, data_size) elements, therefore,
+ * unlike calloc2d(), FLATTEN2D() does not return a dim1 x dim2 contiguous block
+ * of data (unless dim2*data_size is already a multiple of MD_MALLOC_ALIGNMENT).
+ * The rows may still be indexed normally though, e.g. A[i][j].
+ *
+ * @warning Use free_aligned() (NOT free()) to deallocate!
+ * @test test__malloc_aligned()
+ */
+void** calloc2d_aligned(size_t dim1, size_t dim2, size_t data_size);
+
+/**
+ * 3-D calloc, where each (innermost) row starts on a MD_MALLOC_ALIGNMENT byte
+ * boundary
+ *
+ * The rows are padded to aligned_dim(dim3, data_size) elements (see
+ * calloc2d_aligned())
+ *
+ * @warning Use free_aligned() (NOT free()) to deallocate!
+ * @test test__malloc_aligned()
+ */
+void*** calloc3d_aligned(size_t dim1, size_t dim2, size_t dim3,
+                         size_t data_size);
+
+/**
+ * Creates a memory arena, i.e. one contiguous block of memory, from which the
+ * "_arena" allocation functions hand out chunks (by simply advancing an
+ * offset)
+ *
+ * The whole block is written to upon creation, so that it is already paged-in
+ * when used. Therefore, an object may be given an arena which was created off
+ * the audio thread, and then safely carry out any of its (remaining)
+ * allocations on the processing path. The chunks are not freed individually;
+ * the arena may instead be reset or destroyed as a whole.
+ *
+ * @test test__md_arena()
+ *
+ * @param[in] phArena  (&) address of the arena handle
+ * @param[in] capacity Size of the arena, in bytes
+ */
+void md_arena_create(void** phArena, size_t capacity);
+
+/** Destroys a memory arena (and therefore, all chunks allocated from it) */
+void md_arena_destroy(void** phArena);
+
+/** Returns all chunks to the arena (their contents become invalid) */
+void md_arena_reset(void* hArena);
+
+/** Returns the number of bytes of the arena currently allocated */
+size_t md_arena_getUsed(void* hArena);
+
+/** Returns the capacity of the arena, in bytes */
+size_t md_arena_getCapacity(void* hArena);
+
+/** Returns the number of bytes of an arena taken by malloc1d_arena() */
+size_t md_arena_size1d(size_t dim1_data_size);
+
+/** Returns the number of bytes of an arena taken by malloc2d_arena() */
+size_t md_arena_size2d(size_t dim1, size_t dim2, size_t data_size);
+
+/** Returns the number of bytes of an arena taken by malloc3d_arena() */
+size_t md_arena_size3d(size_t dim1, size_t dim2, size_t dim3,
+                       size_t data_size);
+
+/**
+ * 1-D malloc from an arena, which returns memory aligned to
+ * MD_MALLOC_ALIGNMENT bytes
+ *
+ * If hArena is NULL, then this is simply malloc1d(). Otherwise, NULL is
+ * returned if the arena does not have enough space remaining.
+ *
+ * @warning Use free_arena() (NOT free()) to deallocate!
+ */
+void* malloc1d_arena(void* hArena, size_t dim1_data_size);
+
+/** 1-D calloc from an arena (see malloc1d_arena()) */
+void* calloc1d_arena(void* hArena, size_t dim1, size_t data_size);
+
+/** 2-D malloc from an arena (see malloc1d_arena()); same layout as malloc2d() */
+void** malloc2d_arena(void* hArena, size_t dim1, size_t dim2, size_t data_size);
+
+/** 2-D calloc from an arena (see malloc1d_arena()); same layout as calloc2d() */
+void** calloc2d_arena(void* hArena, size_t dim1, size_t dim2, size_t data_size);
+
+/** 3-D malloc from an arena (see malloc1d_arena()); same layout as malloc3d() */
+void*** malloc3d_arena(void* hArena, size_t dim1, size_t dim2, size_t dim3,
+                       size_t data_size);
+
+/** 3-D calloc from an arena (see malloc1d_arena()); same layout as calloc3d() */
+void*** calloc3d_arena(void* hArena, size_t dim1, size_t dim2, size_t dim3,
+                       size_t data_size);
+
+/**
+ * Deallocates memory returned by any of the "_arena" allocation functions
+ *
+ * If hArena is NULL, or ptr does not point into the arena (e.g. memory which
+ * was instead taken from the heap, because the arena was full), then this is
+ * simply free(). Otherwise, it does nothing, since the chunks are only returned
+ * to the arena via md_arena_reset().
+ */
+void free_arena(void* hArena, void* ptr);
+
+/** Options for checking for allocations made inside real-time regions */
+typedef enum {
+    MD_RT_CHECK_DISABLED, /**< Real-time regions are ignored (default) */
+    MD_RT_CHECK_COUNT,    /**< Allocations inside real-time regions are counted */
+    MD_RT_CHECK_ABORT     /**< Allocations inside real-time regions print the
+                           *   offending allocation function and call abort() */
+} MD_RT_CHECK_MODES;
+
+/**
+ * Sets how the md_malloc allocation functions should react when they are
+ * called from within a real-time region (see md_rt_enterRegion())
+ *
+ * This is intended for debugging and testing purposes, i.e. for verifying that
+ * a processing function does not allocate memory on the heap. Note that only
+ * allocations made via this library are detected (i.e. not direct calls to
+ * malloc() etc.). The check mode and the allocation count are global, whereas
+ * the real-time regions are tracked per-thread; i.e. only allocations made by
+ * the same thread that entered a region are detected. The mode should be set
+ * while no region is active.
+ *
+ * @test test__md_rt_check()
+ */
+void md_rt_setCheckMode(MD_RT_CHECK_MODES mode);
+
+/**
+ * Marks the start of a real-time region (e.g. the body of a "_process"
+ * function); regions may be nested
+ */
+void md_rt_enterRegion(void);
+
+/** Marks the end of a real-time region (see md_rt_enterRegion()) */
+void md_rt_exitRegion(void);
+
+/**
+ * Returns the number of allocations made inside real-time regions, since the
+ * last call to md_rt_resetNumAllocations() (only counted if the check mode is
+ * MD_RT_CHECK_COUNT)
+ */
+unsigned long md_rt_getNumAllocations(void);
+
+/** Resets the number of allocations made inside real-time regions to zero */
+void md_rt_resetNumAllocations(void);
+
 
 #ifdef __cplusplus
 } /*extern "C"*/
@@ -86,6 +86,16 @@ extern "C" {
 /** Main unit testing program */
 int main_test(void);
 
+/**
+ * Creates a new (uniquely named) directory in the system's temporary folder,
+ * and returns its path (which must be freed), or NULL if this fails */
+char* saf_test_createTempDir(void);
+/**
+ * Removes the files in a directory created with saf_test_createTempDir(), and
+ * then the directory itself, and frees its path. Returns the number of files
+ * that were removed */
+int saf_test_removeTempDir(char** path);
+
 /* ========================================================================== */
 /*                      SAF utilities module unit tests                       */
 /* ========================================================================== */
@@ -104,7 +114,7 @@ void test__cart2sph(void);
 void test__delaunaynd(void);
 /**
  * Testing that quaternion2rotationMatrix() and rotationMatrix2quaternion()
- * are reversible */
+ * are reversible, and that quaternionSlerp() interpolates between them */
 void test__quaternion(void);
 /**
  * Testing for perfect reconstruction of the saf_stft (when configured for 50%
@@ -121,7 +131,8 @@ void test__saf_rfft(void);
  * Testing the forward and backward complex-complex FFT (saf_fft) */
 void test__saf_fft(void);
 /**
- * Testing the saf_matrixConv */
+ * Testing the saf_matrixConv (partitioned and non-partitioned), against direct
+ * convolution */
 void test__saf_matrixConv(void);
 /**
  * Testing the (near)-perfect reconstruction performance of the QMF filterbank
@@ -131,6 +142,47 @@ void test__qmf(void);
  * Testing that the smb_pitchShifter can shift the energy of input spectra by
  * one octave down */
 void test__smb_pitchShifter(void);
+/**
+ * Testing that the saf_resampler can resample multi-channel signals block-wise
+ * (while retaining their time-alignment) */
+void test__saf_resampler(void);
+/**
+ * Testing that the coarse-to-fine saf_gridSearch finds the peaks of a map,
+ * while evaluating only a fraction of the grid directions */
+void test__saf_gridSearch(void);
+/**
+ * Testing that the saf_cache stores and retrieves entries, and that any change
+ * to the hashed inputs results in a cache miss */
+void test__saf_cache(void);
+/**
+ * Testing that the SIMD accelerated veclib functions produce the same results
+ * with every instruction set supported by the host CPU */
+void test__veclib_simdDispatch(void);
+/**
+ * Testing the interleaved and split-complex vector-vector multiplication (and
+ * multiply-accumulate) functions, with every supported instruction set */
+void test__veclib_cvvmul(void);
+/**
+ * Testing the (single and batched) complex multiply-accumulate functions, with
+ * every supported instruction set */
+void test__veclib_cvvmuladd(void);
+/**
+ * Testing that all jobs given to the thread pool are carried out exactly once,
+ * over repeated runs (and that a shared pool outlives its first release) */
+void test__saf_threadPool(void);
+/**
+ * Testing utility_cseig_batch() against utility_cseig(), and that the
+ * decompositions of each matrix are valid (both the Jacobi and LAPACK paths,
+ * with and without threading) */
+void test__utility_cseig_batch(void);
+/**
+ * Testing utility_csvd_batch() against utility_csvd(), and that the
+ * decompositions of each matrix are valid (tall, wide and square matrices) */
+void test__utility_csvd_batch(void);
+/**
+ * Testing utility_ccovtrk_update() against the full cblas_cgemm and temporal
+ * averaging over the whole matrices */
+void test__utility_ccovtrk(void);
 /**
  * Testing the sortf() function (sorting real floating point numbers) */
 void test__sortf(void);
@@ -196,6 +248,15 @@ void test__formulate_M_and_Cr(void);
  * Testing the formulate_M_and_Cr_cmplx() function, and verifying that the
  * output mixing matrices yield signals that have the target covariance */
 void test__formulate_M_and_Cr_cmplx(void);
+/**
+ * Testing that formulate_M_and_Cr_cmplx_batch() yields the same mixing
+ * matrices as formulate_M_and_Cr_cmplx() applied to each band in turn */
+void test__formulate_M_and_Cr_cmplx_batch(void);
+/**
+ * Testing that the eigenvalue decomposition option of formulate_M_and_Cr() and
+ * formulate_M_and_Cr_cmplx() yields the same mixing matrices as the default
+ * SVD based option */
+void test__cdf4sap_decompositionMethods(void);
 
 
 /* ========================================================================== */
@@ -209,6 +270,10 @@ void test__getLoudspeakerDecoderMtx(void);
 /**
  * Testing the truncation EQ */
 void test__truncationEQ(void);
+/**
+ * Testing that the single-pass HOA convention transform gives the same result
+ * as convertHOAChannelConvention() followed by convertHOANormConvention() */
+void test__getHOAConventionTransform(void);
 
 
 /* ========================================================================== */
@@ -222,12 +287,19 @@ void test__getSHreal(void);
  * Testing that the getSHreal_recur() function is somewhat numerically identical
  * to the full-fat getSHreal() function */
 void test__getSHreal_recur(void);
+/**
+ * Testing that the SH evaluator (shEvaluator_create()) matches getSHreal() */
+void test__shEvaluator(void);
 /**
  * Testing the orthogonality of the getSHcomplex() function */
 void test__getSHcomplex(void);
 /**
  * Testing the spherical harmonic rotation matrix function getSHrotMtxReal() */
 void test__getSHrotMtxReal(void);
+/**
+ * Testing the block-diagonal SH rotation functions applySHrotMtxReal() and
+ * applySHrotMtxRealToDecoder() against dense matrix multiplications */
+void test__applySHrotMtxReal(void);
 /**
  * Testing the real to complex spherical harmonic conversion, using
  * getSHcomplex() as the reference */
@@ -252,6 +324,9 @@ void test__sphMUSIC(void);
 /**
  * Testing the DoA estimation performance of sphPWD() */
 void test__sphPWD(void);
+/**
+ * Testing the activity-map generators (generateMap_create()) */
+void test__generateMap(void);
 /**
  * Testing the DoA estimation performance of sphESPRIT() */
 void test__sphESPRIT(void);
@@ -267,6 +342,10 @@ void test__sphModalCoeffs(void);
 /**
  * Testing that resampleHRIRs() is resampling adequately */
 void test__resampleHRIRs(void);
+/**
+ * Testing that interpHRTFs_tri() (direction-major HRTFs, three per target
+ * direction) gives the same result as interpHRTFs() */
+void test__interpHRTFs_tri(void);
 
 
 /* ========================================================================== */
@@ -277,6 +356,12 @@ void test__resampleHRIRs(void);
  * Testing the ims shoebox simulator, when applying the echograms in the time-
  * domain */
 void test__ims_shoebox_TD(void);
+
+/**
+ * Testing that the ims shoebox simulator gives the same time-domain output
+ * when all of its buffers are taken from a memory arena of the size returned
+ * by ims_shoebox_getRequiredArenaSize() */
+void test__ims_shoebox_TD_arena(void);
 /**
  * Testing the ims shoebox simulator, when generating room impulse respones
  * (RIRs) from the computed echograms */
@@ -287,6 +372,19 @@ void test__ims_shoebox_RIR(void);
 /*                         SAF vbap module unit tests                         */
 /* ========================================================================== */
 
+/**
+ * Testing that the VBAP renderer gives the same gains as the VBAP gain table
+ * functions, for VBAP and MDAP */
+void test__vbapRenderer(void);
+/**
+ * Testing that the VBAP renderer finds the same gains by walking from the
+ * previous triangle of a moving source, as with its look-up grid */
+void test__vbapRenderer_tracked(void);
+/**
+ * Testing that the threaded VBAP gain table generation gives the same gains as
+ * the single-threaded version */
+void test__generateVBAPgainTable3D_threaded(void);
+
 
 /* ========================================================================== */
 /*                     SAF sofa reader module unit tests                      */
@@ -330,6 +428,14 @@ void test__tracker3d(void);
 /** Test for hades */
 void test__hades(void);
 
+/** Test for hades: the output with and without change detection, for a static scene */
+void test__hades_changeDetection(void);
+
+/**
+ * Test for hades: the analysis with one thread and with multiple threads
+ * should estimate the same spatial parameters */
+void test__hades_multiThreadedAnalysis(void);
+
 #endif /* SAF_ENABLE_HADES_MODULE */
 
 
@@ -341,6 +447,11 @@ void test__hades(void);
  * Testing the alias-free STFT filterbank (near)-perfect reconstruction
  * performance */
 void test__afSTFT(void);
+/**
+ * Testing that the FIRs designed by afSTFT_filterbankCoeffsToFIR() give back
+ * the filterbank coefficients they were designed from, when passed through
+ * afSTFT_FIRtoFilterbankCoeffs() */
+void test__afSTFT_filterbankCoeffsToFIR(void);
 /**
  * Testing the realloc2d_r() function (reallocating 2-D array, while retaining
  * the previous data order; except truncated or extended) */
@@ -354,6 +465,19 @@ void test__malloc5d(void);
 /**
  * Testing that malloc6d() works, and is truely contiguously allocated */
 void test__malloc6d(void);
+/**
+ * Testing that the md_malloc "_aligned" variants return zeroed memory, where
+ * every row starts on a MD_MALLOC_ALIGNMENT byte boundary */
+void test__malloc_aligned(void);
+/**
+ * Testing that the md_malloc arena hands out aligned, non-overlapping chunks
+ * (with the same layouts as the heap variants), fails gracefully once it is
+ * full, and falls back to the heap when no arena is given */
+void test__md_arena(void);
+/**
+ * Testing that only the allocations made inside md_malloc real-time regions
+ * are counted */
+void test__md_rt_check(void);
 
 
 /* ========================================================================== */
@@ -366,10 +490,28 @@ void test__malloc6d(void);
  * Testing the SAF ambi_bin.h example (this may also serve as a tutorial on how
  * to use it) */
 void test__saf_example_ambi_bin(void);
+/**
+ * Testing that the FIR decoding path of the SAF ambi_bin.h example gives a
+ * similar output to the time-frequency domain path (at a lower latency) */
+void test__saf_example_ambi_bin_FIRdecoding(void);
+/**
+ * Testing that the SAF ambi_bin.h example gives the same output when its
+ * decoder is loaded from the on-disk decoder cache, as when it is computed */
+void test__saf_example_ambi_bin_decoderCache(void);
 /**
  * Testing the SAF ambi_dec.h example (this may also serve as a tutorial on how
  * to use it) */
 void test__saf_example_ambi_dec(void);
+/**
+ * Testing that the FIR decoding path of the SAF ambi_dec.h example gives a
+ * similar output to the time-frequency domain path (at a lower latency), for
+ * both loudspeaker and binaural output */
+void test__saf_example_ambi_dec_FIRdecoding(void);
+/**
+ * Testing that the SAF ambi_dec.h example gives the same output when its
+ * decoders (and HRTFs) are loaded from the on-disk decoder cache, as when they
+ * are computed */
+void test__saf_example_ambi_dec_decoderCache(void);
 /**
  * Testing the SAF ambi_enc.h example (this may also serve as a tutorial on how
  * to use it) */
@@ -378,6 +520,10 @@ void test__saf_example_ambi_enc(void);
  * Testing the SAF array2sh.h example (this may also serve as a tutorial on how
  * to use it) */
 void test__saf_example_array2sh(void);
+/**
+ * Testing that the coarse-to-fine scanning mode of the SAF powermap.h example
+ * finds the same peaks as the full scan */
+void test__saf_example_powermap(void);
 /**
  * Testing the SAF rotator.h example (this may also serve as a tutorial on how
  * to use it) */
@@ -386,6 +532,10 @@ void test__saf_example_rotator(void);
  * Testing the SAF spreader.h example (this may also serve as a tutorial on how
  * to use it) */
 void test__saf_example_spreader(void);
+/**
+ * Testing that the "_process"/"_analysis" functions of the SAF examples do
+ * not allocate memory on the heap (see md_rt_setCheckMode()) */
+void test__saf_example_rt_allocations(void);
 
 #endif /* SAF_ENABLE_EXAMPLES_TESTS */
 
@@ -50,6 +50,18 @@
  */
 
 #include "saf_test.h" 
+#if defined(_WIN32)
+# include <windows.h>
+# include <direct.h>
+# define saf_test_mkdir(path) _mkdir(path)
+# define saf_test_rmdir(path) _rmdir(path)
+#else
+# include <dirent.h>
+# include <sys/stat.h>
+# include <unistd.h>
+# define saf_test_mkdir(path) mkdir(path, 0700)
+# define saf_test_rmdir(path) rmdir(path)
+#endif
 
 static tick_t start;      /**< Start time for whole test program */
 static tick_t start_test; /**< Start time for the current unit test */
@@ -57,6 +69,87 @@ static tick_t start_test; /**< Start time for the current unit test */
 void setUp(void) { start_test = timer_current(); }
 /** Called after each unit test is executed */
 void tearDown(void) { }
+
+/* Helper functions */
+char* saf_test_createTempDir(void) {
+    static int counter = 0;
+    const char* tmpDir;
+    char* path;
+    size_t len;
+    unsigned long pid;
+
+#if defined(_WIN32)
+    tmpDir = getenv("TEMP");
+    if(tmpDir==NULL || tmpDir[0]=='\0')
+        tmpDir = ".";
+    pid = (unsigned long)GetCurrentProcessId();
+#else
+    tmpDir = getenv("TMPDIR");
+    if(tmpDir==NULL || tmpDir[0]=='\0')
+        tmpDir = "/tmp";
+    pid = (unsigned long)getpid();
+#endif
+    len = strlen(tmpDir) + 64;
+    path = malloc1d(len);
+    snprintf(path, len, "%s/saf_test_%lx_%d", tmpDir, pid, counter++);
+    if(saf_test_mkdir(path)!=0){
+        free(path);
+        return NULL;
+    }
+    return path;
+}
+
+int saf_test_removeTempDir(char** path) {
+    int nFiles;
+    char* filePath;
+    size_t len;
+
+    if((*path)==NULL)
+        return 0;
+    nFiles = 0;
+#if defined(_WIN32)
+    WIN32_FIND_DATAA findData;
+    HANDLE hFind;
+    len = strlen(*path) + 3;
+    filePath = malloc1d(len);
+    snprintf(filePath, len, "%s/*", *path);
+    hFind = FindFirstFileA(filePath, &findData);
+    free(filePath);
+    if(hFind!=INVALID_HANDLE_VALUE){
+        do{
+            if(findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+                continue;
+            len = strlen(*path) + strlen(findData.cFileName) + 2;
+            filePath = malloc1d(len);
+            snprintf(filePath, len, "%s/%s", *path, findData.cFileName);
+            nFiles += remove(filePath)==0;
+            free(filePath);
+        } while(FindNextFileA(hFind, &findData));
+        FindClose(hFind);
+    }
+#else
+    DIR* dir;
+    struct dirent* entry;
+    dir = opendir(*path);
+    if(dir!=NULL){
+        while((entry = readdir(dir))!=NULL){
+            if(strcmp(entry->d_name, ".")==0 || strcmp(entry->d_name, "..")==0)
+                continue;
+            len = strlen(*path) + strlen(entry->d_name) + 2;
+            filePath = malloc1d(len);
+            snprintf(filePath, len, "%s/%s", *path, entry->d_name);
+            nFiles += remove(filePath)==0;
+            free(filePath);
+        }
+        closedir(dir);
+    }
+#endif
+    saf_test_rmdir(*path);
+    free(*path);
+    (*path) = NULL;
+    return nFiles;
+}
+
 /** Displays the time taken to run the current unit test */
 static void timerResult(void) {
     printf("    (Time elapsed: %lfs) \n", (double)timer_elapsed(start_test));
@@ -98,6 +191,16 @@ int main_test(void) {
     RUN_TEST(test__saf_fft);
     RUN_TEST(test__qmf);
     RUN_TEST(test__smb_pitchShifter);
+    RUN_TEST(test__saf_resampler);
+    RUN_TEST(test__saf_gridSearch);
+    RUN_TEST(test__saf_cache);
+    RUN_TEST(test__veclib_simdDispatch);
+    RUN_TEST(test__veclib_cvvmul);
+    RUN_TEST(test__veclib_cvvmuladd);
+    RUN_TEST(test__saf_threadPool);
+    RUN_TEST(test__utility_cseig_batch);
+    RUN_TEST(test__utility_csvd_batch);
+    RUN_TEST(test__utility_ccovtrk);
     RUN_TEST(test__sortf);
     RUN_TEST(test__sortz);
     RUN_TEST(test__cmplxPairUp);
@@ -115,16 +218,21 @@ int main_test(void) {
     /* SAF cdf4sap module unit tests */
     RUN_TEST(test__formulate_M_and_Cr);
     RUN_TEST(test__formulate_M_and_Cr_cmplx);
+    RUN_TEST(test__formulate_M_and_Cr_cmplx_batch);
+    RUN_TEST(test__cdf4sap_decompositionMethods);
 
     /* SAF hoa module unit tests */
     RUN_TEST(test__getLoudspeakerDecoderMtx);
     RUN_TEST(test__truncationEQ);
+    RUN_TEST(test__getHOAConventionTransform);
 
     /* SAF sh module unit tests */
     RUN_TEST(test__getSHreal);
     RUN_TEST(test__getSHreal_recur);
+    RUN_TEST(test__shEvaluator);
     RUN_TEST(test__getSHcomplex);
     RUN_TEST(test__getSHrotMtxReal);
+    RUN_TEST(test__applySHrotMtxReal);
     RUN_TEST(test__real2complexSHMtx);
     RUN_TEST(test__complex2realSHMtx);
     RUN_TEST(test__computeSectorCoeffsEP);
@@ -132,17 +240,23 @@ int main_test(void) {
     RUN_TEST(test__calculateGridWeights);
     RUN_TEST(test__sphMUSIC);
     RUN_TEST(test__sphPWD);
+    RUN_TEST(test__generateMap);
     RUN_TEST(test__sphESPRIT);
     RUN_TEST(test__sphModalCoeffs);
 
     /* SAF hrir module unit tests */
     RUN_TEST(test__resampleHRIRs);
+    RUN_TEST(test__interpHRTFs_tri);
 
     /* SAF reverb modules unit tests */
     RUN_TEST(test__ims_shoebox_RIR);
     RUN_TEST(test__ims_shoebox_TD);
+    RUN_TEST(test__ims_shoebox_TD_arena);
 
     /* SAF vbap modules unit tests */
+    RUN_TEST(test__vbapRenderer);
+    RUN_TEST(test__vbapRenderer_tracked);
+    RUN_TEST(test__generateVBAPgainTable3D_threaded);
 
     /* SAF sofa reader module unit tests */
 #if defined(SAF_ENABLE_SOFA_READER_MODULE)
@@ -160,22 +274,36 @@ int main_test(void) {
 #if defined(SAF_ENABLE_HADES_MODULE) && defined(SAF_ENABLE_SOFA_READER_MODULE) /* unit tests rely also on SOFA reader */
     RUN_TEST(test__hades);
 #endif /* SAF_ENABLE_HADES_MODULE */
+#ifdef SAF_ENABLE_HADES_MODULE
+    RUN_TEST(test__hades_changeDetection);
+    RUN_TEST(test__hades_multiThreadedAnalysis);
+#endif /* SAF_ENABLE_HADES_MODULE */
 
     /* SAF resources unit tests */
     RUN_TEST(test__afSTFT);
+    RUN_TEST(test__afSTFT_filterbankCoeffsToFIR);
     RUN_TEST(test__realloc2d_r);
     RUN_TEST(test__malloc4d);
     RUN_TEST(test__malloc5d);
     RUN_TEST(test__malloc6d);
+    RUN_TEST(test__malloc_aligned);
+    RUN_TEST(test__md_arena);
+    RUN_TEST(test__md_rt_check);
 
     /* SAF examples unit tests */
 #ifdef SAF_ENABLE_EXAMPLES_TESTS
     RUN_TEST(test__saf_example_ambi_bin);
+    RUN_TEST(test__saf_example_ambi_bin_FIRdecoding);
+    RUN_TEST(test__saf_example_ambi_bin_decoderCache);
     RUN_TEST(test__saf_example_ambi_dec);
+    RUN_TEST(test__saf_example_ambi_dec_FIRdecoding);
+    RUN_TEST(test__saf_example_ambi_dec_decoderCache);
     RUN_TEST(test__saf_example_ambi_enc);
     RUN_TEST(test__saf_example_array2sh);
+    RUN_TEST(test__saf_example_powermap);
     RUN_TEST(test__saf_example_rotator);
     RUN_TEST(test__saf_example_spreader);
+    RUN_TEST(test__saf_example_rt_allocations);
 #endif /* SAF_ENABLE_EXAMPLES_TESTS */
 
     /* close */
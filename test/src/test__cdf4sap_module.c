@@ -343,3 +343,292 @@ void test__formulate_M_and_Cr_cmplx(void){
     }
 }
 
+
+void test__formulate_M_and_Cr_cmplx_batch(void){
+    int i, it, band, nCHin, nCHout, lenSig, nThreads, hermitianFLAG;
+    float tmp, maxAbs;
+    float_complex* x, *y, *Cx, *Cy, *Q, *M, *Cr, *M_ref, *Cr_ref;
+    void* hCdf, *hCdfBatch, *hPool;
+    const float_complex calpha = cmplxf(1.0f, 0.0f), cbeta = cmplxf(0.0f, 0.0f);
+
+    /* Config */
+    const float acceptedTolerance = 0.001f; /* relative to the largest element */
+    const int nBands = 24;
+    const int nIterations = 12;
+
+    /* Loop through iterations (alternating between the SVD/eigen decompositions, and single/multi-threaded) */
+    for(it=0; it<nIterations; it++){
+        rand_0_1(&tmp, 1);
+        nCHin = (int)(tmp*14.0f + 2.1f); /* random number between 2 and 16 */
+        rand_0_1(&tmp, 1);
+        nCHout = (int)(tmp*14.0f + 2.1f); /* random number between 2 and 16 */
+        lenSig = 64;
+        hermitianFLAG = it%2;
+        nThreads = (it/2)%2==0 ? 1 : 3;
+
+        /* Input/target covariance matrices and prototype matrices for each band */
+        x = malloc1d(nCHin*lenSig*sizeof(float_complex));
+        y = malloc1d(nCHout*lenSig*sizeof(float_complex));
+        Cx = malloc1d(nBands*nCHin*nCHin*sizeof(float_complex));
+        Cy = malloc1d(nBands*nCHout*nCHout*sizeof(float_complex));
+        Q = malloc1d(nBands*nCHout*nCHin*sizeof(float_complex));
+        for(band=0; band<nBands; band++){
+            rand_cmplx_m1_1(x, nCHin*lenSig);
+            rand_cmplx_m1_1(y, nCHout*lenSig);
+            cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, nCHin, nCHin, lenSig, &calpha,
+                        x, lenSig,
+                        x, lenSig, &cbeta,
+                        Cx + band*nCHin*nCHin, nCHin);
+            cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, nCHout, nCHout, lenSig, &calpha,
+                        y, lenSig,
+                        y, lenSig, &cbeta,
+                        Cy + band*nCHout*nCHout, nCHout);
+            rand_cmplx_m1_1(Q + band*nCHout*nCHin, nCHout*nCHin);
+        }
+
+        /* Reference: one band at a time */
+        M_ref = malloc1d(nBands*nCHout*nCHin*sizeof(float_complex));
+        Cr_ref = malloc1d(nBands*nCHout*nCHout*sizeof(float_complex));
+        cdf4sap_cmplx_create(&hCdf, nCHin, nCHout);
+        for(band=0; band<nBands; band++)
+            formulate_M_and_Cr_cmplx(hCdf, Cx + band*nCHin*nCHin, Cy + band*nCHout*nCHout, Q + band*nCHout*nCHin, 0, 0.2f,
+                                     M_ref + band*nCHout*nCHin, Cr_ref + band*nCHout*nCHout);
+
+        /* All bands at once */
+        M = malloc1d(nBands*nCHout*nCHin*sizeof(float_complex));
+        Cr = malloc1d(nBands*nCHout*nCHout*sizeof(float_complex));
+        hPool = NULL;
+        if(nThreads>1)
+            saf_threadPool_create(&hPool, nThreads);
+        cdf4sap_cmplx_batch_create(&hCdfBatch, nCHin, nCHout, nBands, hPool);
+        formulate_M_and_Cr_cmplx_batch(hCdfBatch, Cx, Cy, Q, nBands, 0, 0.2f, hermitianFLAG, M, Cr);
+
+        /* Assert that the mixing matrices and residuals are the same */
+        for(band=0; band<nBands; band++){
+            maxAbs = 0.0f;
+            for(i=0; i<nCHout*nCHin; i++)
+                maxAbs = SAF_MAX(maxAbs, cabsf(M_ref[band*nCHout*nCHin+i]));
+            for(i=0; i<nCHout*nCHin; i++){
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance*maxAbs, crealf(M_ref[band*nCHout*nCHin+i]), crealf(M[band*nCHout*nCHin+i]));
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance*maxAbs, cimagf(M_ref[band*nCHout*nCHin+i]), cimagf(M[band*nCHout*nCHin+i]));
+            }
+            maxAbs = 0.0f;
+            for(i=0; i<nCHout*nCHout; i++)
+                maxAbs = SAF_MAX(maxAbs, cabsf(Cy[band*nCHout*nCHout+i]));
+            for(i=0; i<nCHout*nCHout; i++)
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance*maxAbs, crealf(Cr_ref[band*nCHout*nCHout+i]), crealf(Cr[band*nCHout*nCHout+i]));
+        }
+
+        /* Clean-up */
+        cdf4sap_cmplx_destroy(&hCdf);
+        cdf4sap_cmplx_batch_destroy(&hCdfBatch);
+        saf_threadPool_destroy(&hPool);
+        free(x);
+        free(y);
+        free(Cx);
+        free(Cy);
+        free(Q);
+        free(M);
+        free(Cr);
+        free(M_ref);
+        free(Cr_ref);
+    }
+}
+
+void test__cdf4sap_decompositionMethods(void){
+    int i, it, nCHin, nCHout, lenSig;
+    float tmp, maxAbs;
+    float* x, *y, *Cx, *Cy, *Q, *M, *Cr, *M_ref, *Cr_ref, *M_Cx, *Cz, *Cz_ref;
+    float_complex* xc, *yc, *Cxc, *Cyc, *Qc, *Mc, *Crc, *Mc_ref, *Crc_ref, *Mc_Cx, *Czc, *Czc_ref;
+    void* hCdf, *hCdf_ref;
+    const float_complex calpha = cmplxf(1.0f, 0.0f), cbeta = cmplxf(0.0f, 0.0f);
+
+    /* Config */
+    const float acceptedTolerance = 0.001f; /* relative to the largest element */
+    const int nIterations = 100;
+
+    /* Loop through iterations. Note that, when Cx or Cy are rank deficient,
+     * then the solution is only defined up to the numerical noise of the
+     * decompositions (in their null-spaces). The mixing matrices, and even the
+     * resulting output covariance matrices, of the two methods may then differ
+     * by a few percent. Therefore, for these cases, it is instead asserted that
+     * both methods (with energy compensation) deliver the target energies */
+    for(it=0; it<nIterations; it++){
+        rand_0_1(&tmp, 1);
+        nCHin = (int)(tmp*14.0f + 2.1f); /* random number between 2 and 16 */
+        rand_0_1(&tmp, 1);
+        nCHout = (int)(tmp*14.0f + 2.1f); /* random number between 2 and 16 */
+        rand_0_1(&tmp, 1);
+        lenSig = (int)(tmp*62.0f + 2.1f); /* random number between 2 and 64 (so Cx and Cy may also be rank deficient) */
+
+        /* Real-valued input/target covariance matrices */
+        x = malloc1d(nCHin*lenSig*sizeof(float));
+        y = malloc1d(nCHout*lenSig*sizeof(float));
+        Cx = malloc1d(nCHin*nCHin*sizeof(float));
+        Cy = malloc1d(nCHout*nCHout*sizeof(float));
+        Q = malloc1d(nCHout*nCHin*sizeof(float));
+        rand_m1_1(x, nCHin*lenSig);
+        rand_m1_1(y, nCHout*lenSig);
+        rand_m1_1(Q, nCHout*nCHin);
+        cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasTrans, nCHin, nCHin, lenSig, 1.0f,
+                    x, lenSig,
+                    x, lenSig, 0.0f,
+                    Cx, nCHin);
+        cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasTrans, nCHout, nCHout, lenSig, 1.0f,
+                    y, lenSig,
+                    y, lenSig, 0.0f,
+                    Cy, nCHout);
+
+        /* Assert that the SVD and eigenvalue decomposition based solutions are the same */
+        M_ref = malloc1d(nCHout*nCHin*sizeof(float));
+        Cr_ref = malloc1d(nCHout*nCHout*sizeof(float));
+        M = malloc1d(nCHout*nCHin*sizeof(float));
+        Cr = malloc1d(nCHout*nCHout*sizeof(float));
+        M_Cx = malloc1d(nCHout*nCHin*sizeof(float));
+        Cz = malloc1d(nCHout*nCHout*sizeof(float));
+        Cz_ref = malloc1d(nCHout*nCHout*sizeof(float));
+        cdf4sap_create(&hCdf_ref, nCHin, nCHout);
+        cdf4sap_create(&hCdf, nCHin, nCHout);
+        cdf4sap_setDecompositionMethod(hCdf, CDF4SAP_DECOMPOSITION_EIG);
+        maxAbs = 0.0f;
+        for(i=0; i<nCHout*nCHout; i++)
+            maxAbs = SAF_MAX(maxAbs, fabsf(Cy[i]));
+        if(lenSig>=SAF_MAX(nCHin, nCHout)){
+            formulate_M_and_Cr(hCdf_ref, Cx, Cy, Q, 0, 0.2f, M_ref, Cr_ref);
+            formulate_M_and_Cr(hCdf, Cx, Cy, Q, 0, 0.2f, M, Cr);
+            for(i=0; i<nCHout*nCHout; i++)
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance*maxAbs, Cr_ref[i], Cr[i]);
+            maxAbs = 0.0f;
+            for(i=0; i<nCHout*nCHin; i++)
+                maxAbs = SAF_MAX(maxAbs, fabsf(M_ref[i]));
+            for(i=0; i<nCHout*nCHin; i++)
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance*maxAbs, M_ref[i], M[i]);
+        }
+        else{
+            /* Rank deficient: the output energies should still match the target energies */
+            formulate_M_and_Cr(hCdf_ref, Cx, Cy, Q, 1, 0.2f, M_ref, NULL);
+            formulate_M_and_Cr(hCdf, Cx, Cy, Q, 1, 0.2f, M, NULL);
+            cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nCHout, nCHin, nCHin, 1.0f,
+                        M_ref, nCHin,
+                        Cx, nCHin, 0.0f,
+                        M_Cx, nCHin);
+            cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasTrans, nCHout, nCHout, nCHin, 1.0f,
+                        M_Cx, nCHin,
+                        M_ref, nCHin, 0.0f,
+                        Cz_ref, nCHout);
+            cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nCHout, nCHin, nCHin, 1.0f,
+                        M, nCHin,
+                        Cx, nCHin, 0.0f,
+                        M_Cx, nCHin);
+            cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasTrans, nCHout, nCHout, nCHin, 1.0f,
+                        M_Cx, nCHin,
+                        M, nCHin, 0.0f,
+                        Cz, nCHout);
+            for(i=0; i<nCHout; i++){
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance*maxAbs, Cy[i*nCHout+i], Cz_ref[i*nCHout+i]);
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance*maxAbs, Cy[i*nCHout+i], Cz[i*nCHout+i]);
+            }
+        }
+
+        /* Complex-valued input/target covariance matrices */
+        xc = malloc1d(nCHin*lenSig*sizeof(float_complex));
+        yc = malloc1d(nCHout*lenSig*sizeof(float_complex));
+        Cxc = malloc1d(nCHin*nCHin*sizeof(float_complex));
+        Cyc = malloc1d(nCHout*nCHout*sizeof(float_complex));
+        Qc = malloc1d(nCHout*nCHin*sizeof(float_complex));
+        rand_cmplx_m1_1(xc, nCHin*lenSig);
+        rand_cmplx_m1_1(yc, nCHout*lenSig);
+        rand_cmplx_m1_1(Qc, nCHout*nCHin);
+        cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, nCHin, nCHin, lenSig, &calpha,
+                    xc, lenSig,
+                    xc, lenSig, &cbeta,
+                    Cxc, nCHin);
+        cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, nCHout, nCHout, lenSig, &calpha,
+                    yc, lenSig,
+                    yc, lenSig, &cbeta,
+                    Cyc, nCHout);
+
+        /* Assert that the SVD and eigenvalue decomposition based solutions are the same */
+        Mc_ref = malloc1d(nCHout*nCHin*sizeof(float_complex));
+        Crc_ref = malloc1d(nCHout*nCHout*sizeof(float_complex));
+        Mc = malloc1d(nCHout*nCHin*sizeof(float_complex));
+        Crc = malloc1d(nCHout*nCHout*sizeof(float_complex));
+        Mc_Cx = malloc1d(nCHout*nCHin*sizeof(float_complex));
+        Czc = malloc1d(nCHout*nCHout*sizeof(float_complex));
+        Czc_ref = malloc1d(nCHout*nCHout*sizeof(float_complex));
+        cdf4sap_destroy(&hCdf_ref);
+        cdf4sap_destroy(&hCdf);
+        cdf4sap_cmplx_create(&hCdf_ref, nCHin, nCHout);
+        cdf4sap_cmplx_create(&hCdf, nCHin, nCHout);
+        cdf4sap_cmplx_setDecompositionMethod(hCdf, CDF4SAP_DECOMPOSITION_EIG);
+        maxAbs = 0.0f;
+        for(i=0; i<nCHout*nCHout; i++)
+            maxAbs = SAF_MAX(maxAbs, cabsf(Cyc[i]));
+        if(lenSig>=SAF_MAX(nCHin, nCHout)){
+            formulate_M_and_Cr_cmplx(hCdf_ref, Cxc, Cyc, Qc, 0, 0.2f, Mc_ref, Crc_ref);
+            formulate_M_and_Cr_cmplx(hCdf, Cxc, Cyc, Qc, 0, 0.2f, Mc, Crc);
+            for(i=0; i<nCHout*nCHout; i++)
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance*maxAbs, crealf(Crc_ref[i]), crealf(Crc[i]));
+            maxAbs = 0.0f;
+            for(i=0; i<nCHout*nCHin; i++)
+                maxAbs = SAF_MAX(maxAbs, cabsf(Mc_ref[i]));
+            for(i=0; i<nCHout*nCHin; i++){
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance*maxAbs, crealf(Mc_ref[i]), crealf(Mc[i]));
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance*maxAbs, cimagf(Mc_ref[i]), cimagf(Mc[i]));
+            }
+        }
+        else{
+            /* Rank deficient: the output energies should still match the target energies */
+            formulate_M_and_Cr_cmplx(hCdf_ref, Cxc, Cyc, Qc, 1, 0.2f, Mc_ref, NULL);
+            formulate_M_and_Cr_cmplx(hCdf, Cxc, Cyc, Qc, 1, 0.2f, Mc, NULL);
+            cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nCHout, nCHin, nCHin, &calpha,
+                        Mc_ref, nCHin,
+                        Cxc, nCHin, &cbeta,
+                        Mc_Cx, nCHin);
+            cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, nCHout, nCHout, nCHin, &calpha,
+                        Mc_Cx, nCHin,
+                        Mc_ref, nCHin, &cbeta,
+                        Czc_ref, nCHout);
+            cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nCHout, nCHin, nCHin, &calpha,
+                        Mc, nCHin,
+                        Cxc, nCHin, &cbeta,
+                        Mc_Cx, nCHin);
+            cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, nCHout, nCHout, nCHin, &calpha,
+                        Mc_Cx, nCHin,
+                        Mc, nCHin, &cbeta,
+                        Czc, nCHout);
+            for(i=0; i<nCHout; i++){
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance*maxAbs, crealf(Cyc[i*nCHout+i]), crealf(Czc_ref[i*nCHout+i]));
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance*maxAbs, crealf(Cyc[i*nCHout+i]), crealf(Czc[i*nCHout+i]));
+            }
+        }
+
+        /* Clean-up */
+        cdf4sap_cmplx_destroy(&hCdf_ref);
+        cdf4sap_cmplx_destroy(&hCdf);
+        free(x);
+        free(y);
+        free(Cx);
+        free(Cy);
+        free(Q);
+        free(M);
+        free(Cr);
+        free(M_ref);
+        free(Cr_ref);
+        free(M_Cx);
+        free(Cz);
+        free(Cz_ref);
+        free(xc);
+        free(yc);
+        free(Cxc);
+        free(Cyc);
+        free(Qc);
+        free(Mc);
+        free(Crc);
+        free(Mc_ref);
+        free(Crc_ref);
+        free(Mc_Cx);
+        free(Czc);
+        free(Czc_ref);
+    }
+}
@@ -106,6 +106,140 @@ void test__saf_example_ambi_bin(void){
     free(binSig_frame);
 }
 
+void test__saf_example_ambi_bin_FIRdecoding(void){
+    int nSH, i, ch, framesize, delay, enableFIR;
+    void* hAmbi[2];
+    float direction_deg[2];
+    double errEnergy, refEnergy;
+    float* inSig, *y;
+    float** shSig, **binSig[2], **shSig_frame, **binSig_frame;
+
+    /* Config */
+    const int order = 3;
+    const int fs = 48000;
+    const int signalLength = fs;
+    const double acceptedNMSE = 0.001; /* -30dB */
+
+    /* Decode the same input in the time-frequency domain (0) and with the FIR filters (1) */
+    nSH = ORDER2NSH(order);
+    inSig = malloc1d(signalLength*sizeof(float));
+    shSig = (float**)malloc2d(nSH,signalLength,sizeof(float));
+    rand_m1_1(inSig, signalLength);
+    direction_deg[0] = 50.0f;
+    direction_deg[1] = 20.0f;
+    y = malloc1d(nSH*sizeof(float));
+    getRSH(order, (float*)direction_deg, 1, y);
+    cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nSH, signalLength, 1, 1.0f,
+                y, 1,
+                inSig, signalLength, 0.0f,
+                FLATTEN2D(shSig), signalLength);
+    framesize = ambi_bin_getFrameSize();
+    shSig_frame = (float**)malloc1d(nSH*sizeof(float*));
+    binSig_frame = (float**)malloc1d(NUM_EARS*sizeof(float*));
+    for(enableFIR=0; enableFIR<2; enableFIR++){
+        ambi_bin_create(&hAmbi[enableFIR]);
+        ambi_bin_init(hAmbi[enableFIR], fs);
+        ambi_bin_setNormType(hAmbi[enableFIR], NORM_N3D);
+        ambi_bin_setInputOrderPreset(hAmbi[enableFIR], (SH_ORDERS)order);
+        ambi_bin_setEnableRotation(hAmbi[enableFIR], 1);
+        ambi_bin_setYaw(hAmbi[enableFIR], 90.0f);
+        ambi_bin_setEnableFIRdecoding(hAmbi[enableFIR], enableFIR);
+        ambi_bin_initCodec(hAmbi[enableFIR]);
+        TEST_ASSERT_TRUE(ambi_bin_getEnableFIRdecoding(hAmbi[enableFIR])==enableFIR);
+
+        binSig[enableFIR] = (float**)calloc2d(NUM_EARS,signalLength,sizeof(float));
+        for(i=0; i<(int)((float)signalLength/(float)framesize); i++){
+            for(ch=0; ch<nSH; ch++)
+                shSig_frame[ch] = &shSig[ch][i*framesize];
+            for(ch=0; ch<NUM_EARS; ch++)
+                binSig_frame[ch] = &binSig[enableFIR][ch][i*framesize];
+            ambi_bin_process(hAmbi[enableFIR], (const float* const*)shSig_frame, binSig_frame, nSH, NUM_EARS, framesize);
+        }
+    }
+
+    /* The FIR decoding should have a much lower latency, but otherwise give a similar output */
+    delay = ambi_bin_getProcessingDelayEx(hAmbi[0]) - ambi_bin_getProcessingDelayEx(hAmbi[1]);
+    TEST_ASSERT_TRUE(delay>0);
+    for(ch=0; ch<NUM_EARS; ch++){
+        errEnergy = refEnergy = 0.0;
+        for(i=delay+fs/10; i<signalLength; i++){
+            errEnergy += pow((double)binSig[0][ch][i] - (double)binSig[1][ch][i-delay], 2.0);
+            refEnergy += pow((double)binSig[0][ch][i], 2.0);
+        }
+        TEST_ASSERT_TRUE(errEnergy/refEnergy < acceptedNMSE);
+    }
+
+    /* Clean-up */
+    for(enableFIR=0; enableFIR<2; enableFIR++){
+        ambi_bin_destroy(&hAmbi[enableFIR]);
+        free(binSig[enableFIR]);
+    }
+    free(inSig);
+    free(shSig);
+    free(y);
+    free(shSig_frame);
+    free(binSig_frame);
+}
+
+void test__saf_example_ambi_bin_decoderCache(void){
+    int nSH, i, k, ch, framesize;
+    void* hAmbi;
+    char* cacheDir;
+    float** shSig, **binSig[2], **shSig_frame, **binSig_frame;
+
+    /* Config */
+    const float acceptedTolerance = 0.000001f;
+    const int order = 4;
+    const int fs = 48000;
+    const int signalLength = fs/2;
+
+    /* Input spherical harmonic (Ambisonic) signals */
+    nSH = ORDER2NSH(order);
+    shSig = (float**)malloc2d(nSH,signalLength,sizeof(float));
+    rand_m1_1(FLATTEN2D(shSig), nSH*signalLength);
+
+    /* Decode to binaural: (0) computing the decoder and storing it in the cache, and (1) loading the decoder from the
+     * cache. Note that the decoder is compared with the one that was stored, since decoders that are computed afresh
+     * differ very slightly (the HRIR directions are triangulated with a small random jitter) */
+    cacheDir = saf_test_createTempDir();
+    TEST_ASSERT_NOT_NULL(cacheDir);
+    framesize = ambi_bin_getFrameSize();
+    shSig_frame = (float**)malloc1d(nSH*sizeof(float*));
+    binSig_frame = (float**)malloc1d(NUM_EARS*sizeof(float*));
+    for(k=0; k<2; k++){
+        ambi_bin_create(&hAmbi);
+        ambi_bin_setNormType(hAmbi, NORM_N3D);
+        ambi_bin_setInputOrderPreset(hAmbi, (SH_ORDERS)order);
+        ambi_bin_setDecoderCacheDir(hAmbi, cacheDir);
+        ambi_bin_init(hAmbi, fs);
+        ambi_bin_initCodec(hAmbi);
+
+        binSig[k] = (float**)calloc2d(NUM_EARS,signalLength,sizeof(float));
+        for(i=0; i<(int)((float)signalLength/(float)framesize); i++){
+            for(ch=0; ch<nSH; ch++)
+                shSig_frame[ch] = &shSig[ch][i*framesize];
+            for(ch=0; ch<NUM_EARS; ch++)
+                binSig_frame[ch] = &binSig[k][ch][i*framesize];
+
+            ambi_bin_process(hAmbi, (const float* const*)shSig_frame, binSig_frame, nSH, NUM_EARS, framesize);
+        }
+        ambi_bin_destroy(&hAmbi);
+    }
+
+    /* Assert that the outputs are the same, and that the cache was indeed populated */
+    for(ch=0; ch<NUM_EARS; ch++)
+        for(i=0; i<signalLength; i++)
+            TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, binSig[0][ch][i], binSig[1][ch][i]);
+    TEST_ASSERT_TRUE(saf_test_removeTempDir(&cacheDir)>0);
+
+    /* Clean-up */
+    free(shSig);
+    for(k=0; k<2; k++)
+        free(binSig[k]);
+    free(shSig_frame);
+    free(binSig_frame);
+}
+
 void test__saf_example_ambi_dec(void){
     int nSH, i, j, ch, max_ind, framesize;
     void* hAmbi;
@@ -189,6 +323,170 @@ void test__saf_example_ambi_dec(void){
     free(lsSig_frame);
 }
 
+void test__saf_example_ambi_dec_FIRdecoding(void){
+    int nSH, nOutputs, i, ch, framesize, delay, enableFIR, binauralise;
+    void* hAmbi[2];
+    float direction_deg[2];
+    double errEnergy, refEnergy;
+    float* inSig, *y;
+    float** shSig, **outSig[2], **shSig_frame, **outSig_frame;
+
+    /* Config */
+    const int order = 3;
+    const int fs = 48000;
+    const int signalLength = fs;
+    /* Note that the interaural phase differences of the interpolated HRTFs are only applied below 1.5kHz (and are
+     * wrapped), so they change abruptly between some bands. The filterbank does not apply such abrupt changes as a
+     * linear time-invariant filter, which no FIR can therefore match; this limits the binaural case to about -21dB,
+     * whereas it would be about -41dB without them */
+    const double acceptedNMSE[2] = { 0.000003 /* -55dB, loudspeakers */, 0.01 /* -20dB, binaural */ };
+
+    /* Define the input */
+    nSH = ORDER2NSH(order);
+    inSig = malloc1d(signalLength*sizeof(float));
+    shSig = (float**)malloc2d(nSH,signalLength,sizeof(float));
+    rand_m1_1(inSig, signalLength);
+    direction_deg[0] = 50.0f;
+    direction_deg[1] = 20.0f;
+    y = malloc1d(nSH*sizeof(float));
+    getRSH(order, (float*)direction_deg, 1, y);
+    cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nSH, signalLength, 1, 1.0f,
+                y, 1,
+                inSig, signalLength, 0.0f,
+                FLATTEN2D(shSig), signalLength);
+    framesize = ambi_dec_getFrameSize();
+    shSig_frame = (float**)malloc1d(nSH*sizeof(float*));
+    outSig_frame = (float**)malloc1d(22*sizeof(float*));
+
+    /* Decode to a 22.x loudspeaker layout (0), and binauralise the loudspeakers (1) */
+    for(binauralise=0; binauralise<2; binauralise++){
+        nOutputs = binauralise ? NUM_EARS : 22;
+
+        /* Decode the same input in the time-frequency domain (0) and with the FIR filters (1) */
+        for(enableFIR=0; enableFIR<2; enableFIR++){
+            ambi_dec_create(&hAmbi[enableFIR]);
+            ambi_dec_setNormType(hAmbi[enableFIR], NORM_N3D);
+            ambi_dec_setMasterDecOrder(hAmbi[enableFIR], (SH_ORDERS)order);
+            ambi_dec_setOutputConfigPreset(hAmbi[enableFIR], LOUDSPEAKER_ARRAY_PRESET_22PX);
+            ambi_dec_setBinauraliseLSflag(hAmbi[enableFIR], binauralise);
+            /* (AllRAD triangulates the loudspeakers with a small random jitter, so two instances would not employ quite
+             * the same decoding matrix; hence a deterministic decoder is used here) */
+            ambi_dec_setDecMethod(hAmbi[enableFIR], 0/* low-freq decoder */, DECODING_METHOD_SAD);
+            ambi_dec_setDecMethod(hAmbi[enableFIR], 1/* high-freq decoder */, DECODING_METHOD_SAD);
+            ambi_dec_setEnableFIRdecoding(hAmbi[enableFIR], enableFIR);
+            ambi_dec_initCodec(hAmbi[enableFIR]);
+            ambi_dec_init(hAmbi[enableFIR], fs);
+            TEST_ASSERT_TRUE(ambi_dec_getEnableFIRdecoding(hAmbi[enableFIR])==enableFIR);
+
+            outSig[enableFIR] = (float**)calloc2d(nOutputs,signalLength,sizeof(float));
+            for(i=0; i<(int)((float)signalLength/(float)framesize); i++){
+                for(ch=0; ch<nSH; ch++)
+                    shSig_frame[ch] = &shSig[ch][i*framesize];
+                for(ch=0; ch<nOutputs; ch++)
+                    outSig_frame[ch] = &outSig[enableFIR][ch][i*framesize];
+                ambi_dec_process(hAmbi[enableFIR], (const float* const*)shSig_frame, outSig_frame, nSH, nOutputs, framesize);
+            }
+        }
+
+        /* The FIR decoding should have a much lower latency, but otherwise give a similar output (over all channels, since
+         * the loudspeakers far away from the source are barely active) */
+        delay = ambi_dec_getProcessingDelayEx(hAmbi[0]) - ambi_dec_getProcessingDelayEx(hAmbi[1]);
+        TEST_ASSERT_TRUE(delay>0);
+        errEnergy = refEnergy = 0.0;
+        for(ch=0; ch<nOutputs; ch++){
+            for(i=delay+fs/10; i<signalLength; i++){
+                errEnergy += pow((double)outSig[0][ch][i] - (double)outSig[1][ch][i-delay], 2.0);
+                refEnergy += pow((double)outSig[0][ch][i], 2.0);
+            }
+        }
+        TEST_ASSERT_TRUE(errEnergy/refEnergy < acceptedNMSE[binauralise]);
+
+        /* Clean-up */
+        for(enableFIR=0; enableFIR<2; enableFIR++){
+            ambi_dec_destroy(&hAmbi[enableFIR]);
+            free(outSig[enableFIR]);
+        }
+    }
+
+    /* Clean-up */
+    free(inSig);
+    free(shSig);
+    free(y);
+    free(shSig_frame);
+    free(outSig_frame);
+}
+
+void test__saf_example_ambi_dec_decoderCache(void){
+    int nSH, i, k, ch, framesize;
+    void* hAmbi;
+    char* cacheDir;
+    float peak;
+    float** shSig, **binSig[2], **shSig_frame, **binSig_frame;
+
+    /* Config */
+    const float acceptedTolerance = 0.00001f; /* relative to the peak output */
+    const int order = 4;
+    const int fs = 48000;
+    const int signalLength = fs/2;
+
+    /* Input spherical harmonic (Ambisonic) signals */
+    nSH = ORDER2NSH(order);
+    shSig = (float**)malloc2d(nSH,signalLength,sizeof(float));
+    rand_m1_1(FLATTEN2D(shSig), nSH*signalLength);
+
+    /* Decode to a 22.x loudspeaker layout with AllRAD, and binauralise the loudspeakers (so that both the decoding
+     * matrices and the pre-processed HRTFs are cached): (0) computing everything and storing it in the cache, and (1)
+     * loading everything from the cache. Note that the outputs are compared with the one that used the stored data,
+     * since data computed afresh differs (the triangulations are computed with a small random jitter) */
+    cacheDir = saf_test_createTempDir();
+    TEST_ASSERT_NOT_NULL(cacheDir);
+    framesize = ambi_dec_getFrameSize();
+    shSig_frame = (float**)malloc1d(nSH*sizeof(float*));
+    binSig_frame = (float**)malloc1d(NUM_EARS*sizeof(float*));
+    for(k=0; k<2; k++){
+        ambi_dec_create(&hAmbi);
+        ambi_dec_setNormType(hAmbi, NORM_N3D);
+        ambi_dec_setMasterDecOrder(hAmbi, (SH_ORDERS)order);
+        ambi_dec_setOutputConfigPreset(hAmbi, LOUDSPEAKER_ARRAY_PRESET_22PX);
+        ambi_dec_setDecMethod(hAmbi, 0/* low-freq decoder */, DECODING_METHOD_ALLRAD);
+        ambi_dec_setDecMethod(hAmbi, 1/* high-freq decoder */, DECODING_METHOD_ALLRAD);
+        ambi_dec_setBinauraliseLSflag(hAmbi, 1);
+        ambi_dec_setDecoderCacheDir(hAmbi, cacheDir);
+        ambi_dec_initCodec(hAmbi);
+        ambi_dec_init(hAmbi, fs);
+
+        binSig[k] = (float**)calloc2d(NUM_EARS,signalLength,sizeof(float));
+        for(i=0; i<(int)((float)signalLength/(float)framesize); i++){
+            for(ch=0; ch<nSH; ch++)
+                shSig_frame[ch] = &shSig[ch][i*framesize];
+            for(ch=0; ch<NUM_EARS; ch++)
+                binSig_frame[ch] = &binSig[k][ch][i*framesize];
+
+            ambi_dec_process(hAmbi, (const float* const*)shSig_frame, binSig_frame, nSH, NUM_EARS, framesize);
+        }
+        ambi_dec_destroy(&hAmbi);
+    }
+
+    /* Assert that the outputs are the same (up to floating-point rounding, which is around 1e-6 of the peak; whereas
+     * recomputing the decoders afresh would change the output by around 1e-2 of the peak), and that the cache was
+     * indeed populated */
+    peak = 0.0f;
+    for(ch=0; ch<NUM_EARS; ch++)
+        for(i=0; i<signalLength; i++)
+            peak = SAF_MAX(peak, fabsf(binSig[0][ch][i]));
+    for(ch=0; ch<NUM_EARS; ch++)
+        for(i=0; i<signalLength; i++)
+            TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance*peak, binSig[0][ch][i], binSig[1][ch][i]);
+    TEST_ASSERT_TRUE(saf_test_removeTempDir(&cacheDir)>0);
+
+    /* Clean-up */
+    free(shSig);
+    for(k=0; k<2; k++)
+        free(binSig[k]);
+    free(shSig_frame);
+    free(binSig_frame);
+}
+
 void test__saf_example_ambi_enc(void){
     int nSH, i, ch, framesize, j, delay;
     void* hAmbi;
@@ -354,10 +652,101 @@ void test__saf_example_array2sh(void){
     free(shSig_frame);
 }
 
+/** Returns the angle between two directions, given in degrees [azi elev] */
+static float test__angleBetween_deg(float* dir1_deg, float* dir2_deg){
+    float xyz1[3], xyz2[3];
+    unitSph2cart(dir1_deg, 1, 1, xyz1);
+    unitSph2cart(dir2_deg, 1, 1, xyz2);
+    return acosf(SAF_CLAMP(xyz1[0]*xyz2[0] + xyz1[1]*xyz2[1] + xyz1[2]*xyz2[2], -1.0f, 1.0f))*180.0f/SAF_PI;
+}
+
+void test__saf_example_powermap(void){
+    int i, j, ch, nSH, mode, scanMode, framesize, nDirs, pmapWidth, hfov, aspectRatio;
+    int peak_inds[2][2], *pk;
+    void* hPm;
+    float src_dirs_deg[2][2], src_gains[2];
+    float** srcSigs, **shSig, **Y, *shSig_frame[MAX_NUM_SH_SIGNALS];
+    float* grid_dirs, *pmap;
+
+    /* Config */
+    const int order = 3;
+    const int fs = 48000;
+    const int signalLength = fs;
+    const float maskRadius_deg = 90.0f;
+    src_dirs_deg[0][0] = 60.0f;    src_dirs_deg[0][1] = 10.0f;
+    src_dirs_deg[1][0] = -100.0f;  src_dirs_deg[1][1] = -20.0f;
+    src_gains[0] = 1.0f;
+    src_gains[1] = 0.8f;
+
+    /* Two uncorrelated white-noise sources encoded into the SH domain, plus some sensor noise */
+    nSH = ORDER2NSH(order);
+    srcSigs = (float**)malloc2d(2, signalLength, sizeof(float));
+    rand_m1_1(FLATTEN2D(srcSigs), 2*signalLength);
+    for(i=0; i<2; i++)
+        cblas_sscal(signalLength, src_gains[i], srcSigs[i], 1);
+    Y = (float**)malloc2d(nSH, 2, sizeof(float));
+    getRSH(order, FLATTEN2D(src_dirs_deg), 2, FLATTEN2D(Y));
+    shSig = (float**)malloc2d(nSH, signalLength, sizeof(float));
+    rand_m1_1(FLATTEN2D(shSig), nSH*signalLength);
+    cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nSH, signalLength, 2, 1.0f,
+                FLATTEN2D(Y), 2,
+                FLATTEN2D(srcSigs), signalLength, 0.01f,
+                FLATTEN2D(shSig), signalLength);
+
+    /* The coarse-to-fine scan should find the same two peaks as the full scan, for all of the activity-maps */
+    framesize = powermap_getFrameSize();
+    for(mode=PM_MODE_PWD; mode<=PM_MODE_MINNORM_LOG; mode++){
+        for(scanMode=POWERMAP_SCAN_FULL; scanMode<=POWERMAP_SCAN_COARSE_TO_FINE; scanMode++){
+            powermap_create(&hPm);
+            powermap_init(hPm, fs);
+            powermap_setMasterOrder(hPm, order);
+            powermap_setAnaOrderAllBands(hPm, order);
+            powermap_setNormType(hPm, NORM_N3D);
+            powermap_setNumSources(hPm, 2);
+            powermap_setPowermapMode(hPm, mode);
+            powermap_setScanMode(hPm, scanMode);
+            powermap_initCodec(hPm);
+            for(i=0; i<signalLength/framesize; i++){
+                for(ch=0; ch<nSH; ch++)
+                    shSig_frame[ch] = &shSig[ch][i*framesize];
+                powermap_requestPmapUpdate(hPm);
+                powermap_analysis(hPm, (const float* const*)shSig_frame, nSH, framesize, 1);
+            }
+            TEST_ASSERT_TRUE(powermap_getPmap(hPm, &grid_dirs, &pmap, &nDirs, &pmapWidth, &hfov, &aspectRatio));
+
+            /* The highest peak, and then the highest peak outside of its vicinity */
+            pk = peak_inds[scanMode-POWERMAP_SCAN_FULL];
+            pk[0] = 0;
+            for(j=1; j<nDirs; j++)
+                if(pmap[j] > pmap[pk[0]])
+                    pk[0] = j;
+            pk[1] = -1;
+            for(j=0; j<nDirs; j++)
+                if(test__angleBetween_deg(&grid_dirs[j*2], &grid_dirs[pk[0]*2]) > maskRadius_deg && (pk[1]==-1 || pmap[j] > pmap[pk[1]]))
+                    pk[1] = j;
+            TEST_ASSERT_TRUE(pk[1]!=-1);
+
+            /* The two peaks should correspond to the two sources (loosely, since MinNorm is biased with two sources at
+             * this order, and the display grid is only ~2.5 degrees apart) */
+            for(j=0; j<2; j++)
+                TEST_ASSERT_TRUE(SAF_MIN(test__angleBetween_deg(&grid_dirs[pk[j]*2], src_dirs_deg[0]),
+                                         test__angleBetween_deg(&grid_dirs[pk[j]*2], src_dirs_deg[1])) < 20.0f);
+            powermap_destroy(&hPm);
+        }
+        TEST_ASSERT_EQUAL_INT(peak_inds[0][0], peak_inds[1][0]);
+        TEST_ASSERT_EQUAL_INT(peak_inds[0][1], peak_inds[1][1]);
+    }
+
+    /* Clean-up */
+    free(srcSigs);
+    free(Y);
+    free(shSig);
+}
+
 void test__saf_example_rotator(void){
-    int ch, nSH, i, j, delay, framesize;
+    int ch, nSH, i, j, delay, framesize, nFrames;
     void* hRot;
-    float direction_deg[2], ypr[3], Rzyx[3][3];
+    float direction_deg[2], ypr[3], Rzyx[3][3], energy_in, energy_rot;
     float** inSig, *y, **shSig_frame, **shSig_rot_frame;
     float** shSig, **shSig_rot, **shSig_rot_ref, **Mrot;
 
@@ -428,6 +817,37 @@ void test__saf_example_rotator(void){
         for(j=0; j<signalLength-delay; j++)
             TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, shSig_rot_ref[i][j], shSig_rot[i][j+delay]);
 
+    /* Repeat with slerp interpolation, and change the orientation half-way through */
+    rotator_init(hRot, fs);
+    rotator_setInterpMode(hRot, ROTATOR_INTERP_SLERP);
+    rotator_setYaw(hRot, ypr[0]*180.0f/SAF_PI);
+    nFrames = (int)((float)signalLength/(float)framesize);
+    for(i=0; i<nFrames; i++){
+        for(ch=0; ch<nSH; ch++)
+            shSig_frame[ch] = &shSig[ch][i*framesize];
+        for(ch=0; ch<nSH; ch++)
+            shSig_rot_frame[ch] = &shSig_rot[ch][i*framesize];
+        if(i==nFrames/2)
+            rotator_setYaw(hRot, 150.0f);
+        rotator_process(hRot, (const float* const*)shSig_frame, shSig_rot_frame, nSH, nSH, framesize);
+    }
+
+    /* Should be equivalent to the reference, prior to the change in orientation */
+    for(i=0; i<nSH; i++)
+        for(j=0; j<(nFrames/2)*framesize-delay; j++)
+            TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, shSig_rot_ref[i][j], shSig_rot[i][j+delay]);
+
+    /* Since every sub-frame is rotated by a valid rotation matrix, the energy of the (N3D) SH signals should be
+     * preserved throughout; including during the transition (unlike with a cross-fade) */
+    for(j=0; j<nFrames*framesize-delay; j++){
+        energy_in = energy_rot = 0.0f;
+        for(i=0; i<nSH; i++){
+            energy_in += shSig[i][j]*shSig[i][j];
+            energy_rot += shSig_rot[i][j+delay]*shSig_rot[i][j+delay];
+        }
+        TEST_ASSERT_FLOAT_WITHIN(0.0001f*energy_in, energy_in, energy_rot);
+    }
+
     /* Clean-up */
     rotator_destroy(&hRot);
     free(inSig);
@@ -487,4 +907,244 @@ void test__saf_example_spreader(void){
     free(outSig_frame);
 }
 
+/** Signature shared by the "_process" functions of the SAF examples */
+typedef void (*example_processFn)(void* const, const float *const *, float** const, int, int, int);
+
+/** Signature shared by the "_analysis" functions of the SAF examples */
+typedef void (*example_analysisFn)(void* const, const float *const *, int, int, int);
+
+/** Wraps ambi_drc_process(), which takes a single number of channels */
+static void ambi_drc_processWrapper
+(
+    void* const hAmbi,
+    const float *const * inputs,
+    float** const outputs,
+    int nInputs,
+    int nOutputs,
+    int nSamples
+)
+{
+    ambi_drc_process(hAmbi, inputs, outputs, SAF_MIN(nInputs, nOutputs), nSamples);
+}
+
+/** Wraps tvconv_process(), which takes non-const input signals */
+static void tvconv_processWrapper
+(
+    void* const hTVCnv,
+    const float *const * inputs,
+    float** const outputs,
+    int nInputs,
+    int nOutputs,
+    int nSamples
+)
+{
+    tvconv_process(hTVCnv, (float** const)inputs, outputs, nInputs, nOutputs, nSamples);
+}
+
+/**
+ * Calls a "_process" (or "_analysis") function for a number of blocks of
+ * white-noise, and returns the number of heap allocations that were made
+ * inside its real-time region */
+static unsigned long example_countAllocations
+(
+    void* hEx,
+    example_processFn process,
+    example_analysisFn analysis,
+    int nBlocks,
+    int blockSize
+)
+{
+    int i, ch;
+    float** inSigs, **outSigs;
+    float* inSig_ptrs[MAX_NUM_CHANNELS], *outSig_ptrs[MAX_NUM_CHANNELS];
+    unsigned long nAllocations;
+
+    /* (allocated before enabling the check) */
+    inSigs = (float**)malloc2d(MAX_NUM_CHANNELS, blockSize, sizeof(float));
+    outSigs = (float**)malloc2d(MAX_NUM_CHANNELS, blockSize, sizeof(float));
+    for(ch=0; ch<MAX_NUM_CHANNELS; ch++){
+        inSig_ptrs[ch] = inSigs[ch];
+        outSig_ptrs[ch] = outSigs[ch];
+    }
+
+    md_rt_resetNumAllocations();
+    md_rt_setCheckMode(MD_RT_CHECK_COUNT);
+    for(i=0; i<nBlocks; i++){
+        rand_m1_1(FLATTEN2D(inSigs), MAX_NUM_CHANNELS*blockSize);
+        if(process!=NULL)
+            process(hEx, (const float* const*)inSig_ptrs, outSig_ptrs, MAX_NUM_CHANNELS, MAX_NUM_CHANNELS, blockSize);
+        else
+            analysis(hEx, (const float* const*)inSig_ptrs, MAX_NUM_CHANNELS, blockSize, 1);
+    }
+    md_rt_setCheckMode(MD_RT_CHECK_DISABLED);
+    nAllocations = md_rt_getNumAllocations();
+
+    free(inSigs);
+    free(outSigs);
+    return nAllocations;
+}
+
+void test__saf_example_rt_allocations(void){
+    void* hEx;
+    int mode, i;
+
+    /* Config */
+    const int fs = 48000;
+    const int nBlocks = 16;
+    const int hostBlockSize = 512;
+
+    /* ambi_bin (with rotation enabled) */
+    ambi_bin_create(&hEx);
+    ambi_bin_init(hEx, fs);
+    ambi_bin_setInputOrderPreset(hEx, SH_ORDER_FOURTH);
+    ambi_bin_setEnableRotation(hEx, 1);
+    ambi_bin_setYaw(hEx, 90.0f);
+    ambi_bin_initCodec(hEx);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, ambi_bin_process, NULL, nBlocks, ambi_bin_getFrameSize())==0);
+    ambi_bin_setEnableFIRdecoding(hEx, 1);
+    ambi_bin_initCodec(hEx);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, ambi_bin_process, NULL, nBlocks, ambi_bin_getFrameSize())==0);
+    ambi_bin_destroy(&hEx);
+
+    /* ambi_dec (with the loudspeaker signals also binauralised) */
+    ambi_dec_create(&hEx);
+    ambi_dec_init(hEx, fs);
+    ambi_dec_setBinauraliseLSflag(hEx, 1);
+    ambi_dec_initCodec(hEx);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, ambi_dec_process, NULL, nBlocks, ambi_dec_getFrameSize())==0);
+    ambi_dec_setEnableFIRdecoding(hEx, 1);
+    ambi_dec_initCodec(hEx);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, ambi_dec_process, NULL, nBlocks, ambi_dec_getFrameSize())==0);
+    ambi_dec_destroy(&hEx);
+
+    /* ambi_drc */
+    ambi_drc_create(&hEx);
+    ambi_drc_init(hEx, fs);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, ambi_drc_processWrapper, NULL, nBlocks, ambi_drc_getFrameSize())==0);
+    ambi_drc_destroy(&hEx);
+
+    /* ambi_enc */
+    ambi_enc_create(&hEx);
+    ambi_enc_init(hEx, fs);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, ambi_enc_process, NULL, nBlocks, ambi_enc_getFrameSize())==0);
+    ambi_enc_destroy(&hEx);
+
+    /* ambi_roomsim */
+    ambi_roomsim_create(&hEx);
+    ambi_roomsim_init(hEx, fs);
+    /* (ims_shoebox resizes its echograms whenever the number of image sources changes. Therefore, the first two blocks,
+     * over which the current and previous echograms are sized, are excluded. The scene is static from then on) */
+    example_countAllocations(hEx, ambi_roomsim_process, NULL, 2, ambi_roomsim_getFrameSize());
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, ambi_roomsim_process, NULL, nBlocks, ambi_roomsim_getFrameSize())==0);
+    ambi_roomsim_destroy(&hEx);
+
+    /* array2sh */
+    array2sh_create(&hEx);
+    array2sh_init(hEx, fs);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, array2sh_process, NULL, nBlocks, array2sh_getFrameSize())==0);
+    array2sh_destroy(&hEx);
+
+    /* beamformer */
+    beamformer_create(&hEx);
+    beamformer_init(hEx, fs);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, beamformer_process, NULL, nBlocks, beamformer_getFrameSize())==0);
+    beamformer_destroy(&hEx);
+
+    /* binauraliser (with rotation enabled) */
+    binauraliser_create(&hEx);
+    binauraliser_init(hEx, fs);
+    binauraliser_setEnableRotation(hEx, 1);
+    binauraliser_setYaw(hEx, 90.0f);
+    binauraliser_initCodec(hEx);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, binauraliser_process, NULL, nBlocks, binauraliser_getFrameSize())==0);
+    binauraliser_destroy(&hEx);
+
+    /* binauraliser_nf */
+    binauraliserNF_create(&hEx);
+    binauraliserNF_init(hEx, fs);
+    binauraliserNF_initCodec(hEx);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, binauraliserNF_process, NULL, nBlocks, binauraliser_getFrameSize())==0);
+    binauraliserNF_destroy(&hEx);
+
+    /* decorrelator */
+    decorrelator_create(&hEx);
+    decorrelator_init(hEx, fs);
+    decorrelator_initCodec(hEx);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, decorrelator_process, NULL, nBlocks, decorrelator_getFrameSize())==0);
+    decorrelator_destroy(&hEx);
+
+    /* dirass */
+    dirass_create(&hEx);
+    dirass_init(hEx, fs);
+    dirass_initCodec(hEx);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, NULL, dirass_analysis, nBlocks, dirass_getFrameSize())==0);
+    dirass_destroy(&hEx);
+
+    /* matrixconv (no filters loaded) */
+    matrixconv_create(&hEx);
+    matrixconv_init(hEx, fs, hostBlockSize);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, matrixconv_process, NULL, nBlocks, hostBlockSize)==0);
+    matrixconv_destroy(&hEx);
+
+    /* multiconv (no filters loaded) */
+    multiconv_create(&hEx);
+    multiconv_init(hEx, fs, hostBlockSize);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, multiconv_process, NULL, nBlocks, hostBlockSize)==0);
+    multiconv_destroy(&hEx);
+
+    /* panner */
+    panner_create(&hEx);
+    panner_init(hEx, fs);
+    panner_initCodec(hEx);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, panner_process, NULL, nBlocks, panner_getFrameSize())==0);
+    panner_destroy(&hEx);
+
+    /* pitch_shifter */
+    pitch_shifter_create(&hEx);
+    pitch_shifter_init(hEx, fs);
+    pitch_shifter_initCodec(hEx);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, pitch_shifter_process, NULL, nBlocks, pitch_shifter_getFrameSize())==0);
+    pitch_shifter_destroy(&hEx);
+
+    /* powermap (for all of its activity-map and scanning modes) */
+    for(mode=PM_MODE_PWD; mode<=PM_MODE_MINNORM_LOG; mode++){
+        for(i=POWERMAP_SCAN_FULL; i<=POWERMAP_SCAN_COARSE_TO_FINE; i++){
+            powermap_create(&hEx);
+            powermap_init(hEx, fs);
+            powermap_setPowermapMode(hEx, mode);
+            powermap_setScanMode(hEx, i);
+            powermap_initCodec(hEx);
+            TEST_ASSERT_TRUE(example_countAllocations(hEx, NULL, powermap_analysis, nBlocks, powermap_getFrameSize())==0);
+            powermap_destroy(&hEx);
+        }
+    }
+
+    /* rotator */
+    rotator_create(&hEx);
+    rotator_init(hEx, fs);
+    rotator_setYaw(hEx, 90.0f);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, rotator_process, NULL, nBlocks, rotator_getFrameSize())==0);
+    rotator_destroy(&hEx);
+
+    /* sldoa */
+    sldoa_create(&hEx);
+    sldoa_init(hEx, fs);
+    sldoa_initCodec(hEx);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, NULL, sldoa_analysis, nBlocks, sldoa_getFrameSize())==0);
+    sldoa_destroy(&hEx);
+
+    /* spreader */
+    spreader_create(&hEx);
+    spreader_init(hEx, fs);
+    spreader_initCodec(hEx);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, spreader_process, NULL, nBlocks, spreader_getFrameSize())==0);
+    spreader_destroy(&hEx);
+
+    /* tvconv (no filters loaded) */
+    tvconv_create(&hEx);
+    tvconv_init(hEx, fs, hostBlockSize);
+    TEST_ASSERT_TRUE(example_countAllocations(hEx, tvconv_processWrapper, NULL, nBlocks, hostBlockSize)==0);
+    tvconv_destroy(&hEx);
+}
+
 #endif /* SAF_ENABLE_EXAMPLES_TESTS */
@@ -46,6 +46,7 @@ void test__hades(void){
     const int hopsize = 64;
     const int blocksize = 256;
     const int hybridmode = 0;
+    const int nThreads = 2;
 
     /* Analysis */
     error = saf_sofa_open(&sofa, "/Users/mccorml1/Documents/git/matlab/h_array/h_array_horiz1deg_357.sofa", SAF_SOFA_READER_OPTION_DEFAULT);
@@ -58,7 +59,8 @@ void test__hades(void){
     cblas_scopy(nDirs, &sofa.SourcePosition[1], 3, &grid_dirs_deg[1], 2); /* elev */
     hades_analysis_create(&hAna, (float)fs, HADES_USE_AFSTFT_LD, hopsize, blocksize, hybridmode, /* for time-frequency transform */
                           sofa.DataIR, grid_dirs_deg, nDirs, nMics, sofa.DataLengthIR,    /* for the array measurements */
-                          HADES_USE_COMEDIE, HADES_USE_MUSIC);                            /* for parameter analysis */
+                          HADES_USE_COMEDIE, HADES_USE_MUSIC,                             /* for parameter analysis */
+                          nThreads);
     saf_sofa_close(&sofa);
 
     /* Parameter/signal containers */
@@ -100,10 +102,10 @@ void test__hades(void){
     }
 
     /* Clean-up */
-    hades_analysis_destroy(&hAna);
+    hades_synthesis_destroy(&hSyn);
     hades_param_container_destroy(&hPCon);
     hades_signal_container_destroy(&hSCon);
-    hades_synthesis_destroy(&hSyn);
+    hades_analysis_destroy(&hAna);
     free(grid_dirs_deg);
     free(inSigMIC);
     free(inSigMIC_block);
@@ -111,5 +113,212 @@ void test__hades(void){
     free(outSigBIN);
 }
 
+#endif /* SAF_ENABLE_HADES_MODULE && SAF_ENABLE_SOFA_READER_MODULE */
+
+#ifdef SAF_ENABLE_HADES_MODULE
+
+void test__hades_changeDetection(void){
+    hades_analysis_handle hAna = NULL;          /* Analysis handle */
+    hades_synthesis_handle hSyn = NULL;         /* Synthesis handle (recompute every band, every frame) */
+    hades_synthesis_handle hSyn_cd = NULL;      /* Synthesis handle (with change detection enabled) */
+    hades_param_container_handle hPCon = NULL;  /* Parameter container handle */
+    hades_signal_container_handle hSCon = NULL; /* Signal container handle */
+    hades_binaural_config binConfig;
+    int i, j, ch, srcIdx, nBlocks, nMics, h_len;
+    int refIndices[2];
+    float errorEnergy, refEnergy;
+    float* h_array;
+
+    /* Config */
+    const int fs = __default_hrir_fs;
+    const int sigLen = fs*2;
+    const int hopsize = 64;
+    const int blocksize = 256;
+    const int hybridmode = 0;
+    const int nThreads = 2; /* (the synthesisers then share the thread pool of the analysis) */
+    const float srcDir_deg[2] = {40.0f, 0.0f};
+
+    /* The default HRIRs serve as the (2 microphone) array measurements, so that this test does not depend on a SOFA file */
+    nMics = NUM_EARS;
+    h_len = __default_hrir_len;
+    h_array = malloc1d(__default_N_hrir_dirs*nMics*h_len*sizeof(float));
+    memcpy(h_array, (float*)__default_hrirs, __default_N_hrir_dirs*nMics*h_len*sizeof(float));
+    hades_analysis_create(&hAna, (float)fs, HADES_USE_AFSTFT_LD, hopsize, blocksize, hybridmode,
+                          h_array, (float*)__default_hrir_dirs_deg, __default_N_hrir_dirs, nMics, h_len,
+                          HADES_USE_COMEDIE, HADES_USE_MUSIC, nThreads);
+    hades_param_container_create(&hPCon, hAna);
+    hades_signal_container_create(&hSCon, hAna);
+
+    /* Two synthesisers, which differ only in whether change detection is enabled */
+    binConfig.hrir_fs = __default_hrir_fs;
+    binConfig.lHRIR = __default_hrir_len;
+    binConfig.nHRIR = __default_N_hrir_dirs;
+    binConfig.hrirs = (float*)__default_hrirs;
+    binConfig.hrir_dirs_deg = (float*)__default_hrir_dirs_deg;
+    refIndices[0] = 0;
+    refIndices[1] = 1;
+    hades_synthesis_create(&hSyn, hAna, HADES_BEAMFORMER_BMVDR, SAF_TRUE, refIndices, &binConfig, HADES_HRTF_INTERP_NEAREST);
+    hades_synthesis_create(&hSyn_cd, hAna, HADES_BEAMFORMER_BMVDR, SAF_TRUE, refIndices, &binConfig, HADES_HRTF_INTERP_NEAREST);
+    hades_synthesis_setChangeDetection(hSyn_cd, 1, 5.0f, 0.05f);
+
+    /* Define input audio: a static source (noise convolved with the array response for its direction), plus weak uncorrelated noise */
+    float** inSigMIC, *srcSig, *noiseSig;
+    inSigMIC = (float**)calloc2d(nMics, sigLen, sizeof(float));
+    srcSig = malloc1d(sigLen*sizeof(float));
+    noiseSig = malloc1d(sigLen*sizeof(float));
+    findClosestGridPoints((float*)__default_hrir_dirs_deg, __default_N_hrir_dirs, (float*)srcDir_deg, 1, 1, &srcIdx, NULL, NULL);
+    rand_m1_1(srcSig, sigLen);
+    for(ch=0; ch<nMics; ch++){
+        for(i=0; i<sigLen; i++)
+            for(j=0; j<SAF_MIN(h_len, i+1); j++)
+                inSigMIC[ch][i] += h_array[srcIdx*nMics*h_len + ch*h_len + j] * srcSig[i-j];
+        rand_m1_1(noiseSig, sigLen);
+        cblas_saxpy(sigLen, 0.01f, noiseSig, 1, inSigMIC[ch], 1);
+    }
+
+    /* Main loop */
+    float **inSigMIC_block, **outSigBIN_block, **outSigBIN, **outSigBIN_cd;
+    inSigMIC_block = (float**)malloc2d(nMics, blocksize, sizeof(float));
+    outSigBIN_block = (float**)malloc2d(NUM_EARS, blocksize, sizeof(float));
+    outSigBIN = (float**)calloc2d(NUM_EARS, sigLen, sizeof(float));
+    outSigBIN_cd = (float**)calloc2d(NUM_EARS, sigLen, sizeof(float));
+    nBlocks = (int)((float)sigLen/(float)blocksize);
+    for(i=0; i < nBlocks; i++){
+        for(ch=0; ch<nMics; ch++)
+            memcpy(inSigMIC_block[ch], &inSigMIC[ch][i*blocksize], blocksize*sizeof(float));
+
+        /* Both synthesisers render from the same parameters and signals */
+        hades_analysis_apply(hAna, inSigMIC_block, nMics, blocksize, hPCon, hSCon);
+        hades_synthesis_apply(hSyn, hPCon, hSCon, NUM_EARS, blocksize, outSigBIN_block);
+        for(ch=0; ch<NUM_EARS; ch++)
+            memcpy(&outSigBIN[ch][i*blocksize], outSigBIN_block[ch], blocksize*sizeof(float));
+        hades_synthesis_apply(hSyn_cd, hPCon, hSCon, NUM_EARS, blocksize, outSigBIN_block);
+        for(ch=0; ch<NUM_EARS; ch++)
+            memcpy(&outSigBIN_cd[ch][i*blocksize], outSigBIN_block[ch], blocksize*sizeof(float));
+    }
+
+    /* Holding the mixing matrices of unchanged bands should barely alter the output for a static scene */
+    errorEnergy = refEnergy = 0.0f;
+    for(ch=0; ch<NUM_EARS; ch++){
+        for(i=0; i<nBlocks*blocksize; i++){
+            refEnergy += outSigBIN[ch][i]*outSigBIN[ch][i];
+            errorEnergy += (outSigBIN_cd[ch][i]-outSigBIN[ch][i])*(outSigBIN_cd[ch][i]-outSigBIN[ch][i]);
+        }
+    }
+    TEST_ASSERT_TRUE(refEnergy > 0.0f);
+    TEST_ASSERT_TRUE(errorEnergy > 0.0f); /* i.e., some mixing matrices were actually held */
+    TEST_ASSERT_TRUE(10.0f*log10f(errorEnergy/refEnergy) < -30.0f);
+
+    /* Clean-up (the synthesisers hold their own reference to the thread pool of the analysis, so the analysis may
+     * go first) */
+    hades_analysis_destroy(&hAna);
+    hades_synthesis_destroy(&hSyn);
+    hades_synthesis_destroy(&hSyn_cd);
+    hades_param_container_destroy(&hPCon);
+    hades_signal_container_destroy(&hSCon);
+    free(h_array);
+    free(inSigMIC);
+    free(srcSig);
+    free(noiseSig);
+    free(inSigMIC_block);
+    free(outSigBIN_block);
+    free(outSigBIN);
+    free(outSigBIN_cd);
+}
+
+void test__hades_multiThreadedAnalysis(void){
+    hades_analysis_handle hAna[2] = {NULL, NULL};
+    hades_param_container_handle hPCon[2] = {NULL, NULL};
+    hades_signal_container_handle hSCon[2] = {NULL, NULL};
+    int i, j, k, t, ch, src, nBlocks, nBands, rotIdx, nMics, h_len;
+    int srcIdx[2];
+    float rotDir_deg[2];
+    float* h_array, *srcSig, *noiseSig;
+    float** inSigMIC, **inSigMIC_block;
+    const float_complex* Cx[2];
+
+    /* Config */
+    const int fs = __default_hrir_fs;
+    const int sigLen = fs/2;
+    const int hopsize = 64;
+    const int blocksize = 256;
+    const int nThreads[2] = {1, 4};
+    const float srcDirs_deg[2][2] = { {40.0f, 0.0f}, {-110.0f, 20.0f} };
+
+    /* A 4 microphone array: the default HRIRs, plus those of the same head turned by 90 degrees (so that this test does
+     * not depend on a SOFA file) */
+    nMics = 2*NUM_EARS;
+    h_len = __default_hrir_len;
+    h_array = malloc1d(__default_N_hrir_dirs*nMics*h_len*sizeof(float));
+    for(i=0; i<__default_N_hrir_dirs; i++){
+        rotDir_deg[0] = __default_hrir_dirs_deg[i][0] + 90.0f;
+        rotDir_deg[1] = __default_hrir_dirs_deg[i][1];
+        findClosestGridPoints((float*)__default_hrir_dirs_deg, __default_N_hrir_dirs, (float*)rotDir_deg, 1, 1, &rotIdx, NULL, NULL);
+        for(ch=0; ch<NUM_EARS; ch++){
+            memcpy(&h_array[i*nMics*h_len + ch*h_len], __default_hrirs[i][ch], h_len*sizeof(float));
+            memcpy(&h_array[i*nMics*h_len + (NUM_EARS+ch)*h_len], __default_hrirs[rotIdx][ch], h_len*sizeof(float));
+        }
+    }
+
+    /* Single-threaded (0) and multi-threaded (1) analysis */
+    for(t=0; t<2; t++){
+        srand(1); /* (the convex hull used for the integration weights adds a little random noise to the grid) */
+        hades_analysis_create(&hAna[t], (float)fs, HADES_USE_AFSTFT_LD, hopsize, blocksize, 0,
+                              h_array, (float*)__default_hrir_dirs_deg, __default_N_hrir_dirs, nMics, h_len,
+                              HADES_USE_COMEDIE, HADES_USE_MUSIC, nThreads[t]);
+        hades_param_container_create(&hPCon[t], hAna[t]);
+        hades_signal_container_create(&hSCon[t], hAna[t]);
+    }
+    nBands = hades_analysis_getNbands(hAna[0]);
+
+    /* Define input audio: two sources (noise convolved with the array responses for their directions), plus noise */
+    inSigMIC = (float**)calloc2d(nMics, sigLen, sizeof(float));
+    srcSig = malloc1d(sigLen*sizeof(float));
+    noiseSig = malloc1d(sigLen*sizeof(float));
+    findClosestGridPoints((float*)__default_hrir_dirs_deg, __default_N_hrir_dirs, (float*)srcDirs_deg, 2, 1, srcIdx, NULL, NULL);
+    for(src=0; src<2; src++){
+        rand_m1_1(srcSig, sigLen);
+        for(ch=0; ch<nMics; ch++)
+            for(i=0; i<sigLen; i++)
+                for(j=0; j<SAF_MIN(h_len, i+1); j++)
+                    inSigMIC[ch][i] += h_array[srcIdx[src]*nMics*h_len + ch*h_len + j] * srcSig[i-j];
+    }
+    for(ch=0; ch<nMics; ch++){
+        rand_m1_1(noiseSig, sigLen);
+        cblas_saxpy(sigLen, 0.05f, noiseSig, 1, inSigMIC[ch], 1);
+    }
+
+    /* Analyse the same input with both, and compare the estimated parameters after every block */
+    inSigMIC_block = (float**)malloc2d(nMics, blocksize, sizeof(float));
+    nBlocks = (int)((float)sigLen/(float)blocksize);
+    for(i=0; i < nBlocks; i++){
+        for(ch=0; ch<nMics; ch++)
+            memcpy(inSigMIC_block[ch], &inSigMIC[ch][i*blocksize], blocksize*sizeof(float));
+        for(t=0; t<2; t++)
+            hades_analysis_apply(hAna[t], inSigMIC_block, nMics, blocksize, hPCon[t], hSCon[t]);
+
+        for(k=0; k<nBands; k++){
+            /* Splitting the bands over the threads should not change the results at all */
+            TEST_ASSERT_TRUE(hades_param_container_getDoAindicesPtr(hPCon[0])[k] == hades_param_container_getDoAindicesPtr(hPCon[1])[k]);
+            TEST_ASSERT_TRUE(hades_param_container_getDiffusenessPtr(hPCon[0])[k] == hades_param_container_getDiffusenessPtr(hPCon[1])[k]);
+            Cx[0] = hades_signal_container_getCovarianceMatrixPtr(hSCon[0], k);
+            Cx[1] = hades_signal_container_getCovarianceMatrixPtr(hSCon[1], k);
+            TEST_ASSERT_TRUE(memcmp(Cx[0], Cx[1], nMics*nMics*sizeof(float_complex)) == 0);
+        }
+    }
+
+    /* Clean-up */
+    for(t=0; t<2; t++){
+        hades_param_container_destroy(&hPCon[t]);
+        hades_signal_container_destroy(&hSCon[t]);
+        hades_analysis_destroy(&hAna[t]);
+    }
+    free(h_array);
+    free(inSigMIC);
+    free(inSigMIC_block);
+    free(srcSig);
+    free(noiseSig);
+}
+
 
 #endif /* SAF_ENABLE_HADES_MODULE */
@@ -167,3 +167,55 @@ void test__truncationEQ(void)
     free(gain);
     free(gainDB);
 }
+
+void test__getHOAConventionTransform(void){
+    int i, j, order, nSH, inCh, outCh, inNorm, outNorm, nInputs;
+    int perm[16];
+    float gains[16];
+    float** insig, **outsig, **ref;
+    const int maxOrder = 3;
+    const int signalLength = 64;
+
+    /* Config */
+    insig = (float**)malloc2d(ORDER2NSH(maxOrder), signalLength, sizeof(float));
+    outsig = (float**)malloc2d(ORDER2NSH(maxOrder), signalLength, sizeof(float));
+    ref = (float**)malloc2d(ORDER2NSH(maxOrder), signalLength, sizeof(float));
+    rand_m1_1(FLATTEN2D(insig), ORDER2NSH(maxOrder)*signalLength);
+
+    /* The single-pass transform should give exactly the same result as converting the channel order and then the
+     * normalisation, for all orders, conventions, and (fewer) numbers of input channels */
+    for(order=0; order<=maxOrder; order++){
+        nSH = ORDER2NSH(order);
+        for(inCh=HOA_CH_ORDER_ACN; inCh<=HOA_CH_ORDER_FUMA; inCh++){
+            for(outCh=HOA_CH_ORDER_ACN; outCh<=HOA_CH_ORDER_FUMA; outCh++){
+                for(inNorm=HOA_NORM_N3D; inNorm<=HOA_NORM_FUMA; inNorm++){
+                    for(outNorm=HOA_NORM_N3D; outNorm<=HOA_NORM_FUMA; outNorm++){
+                        for(nInputs=SAF_MAX(nSH-2, 1); nInputs<=nSH; nInputs++){
+                            /* Reference (missing channels are zeros) */
+                            for(i=0; i<nSH; i++){
+                                if(i<nInputs)
+                                    memcpy(ref[i], insig[i], signalLength*sizeof(float));
+                                else
+                                    memset(ref[i], 0, signalLength*sizeof(float));
+                            }
+                            convertHOAChannelConvention(FLATTEN2D(ref), order, signalLength, (HOA_CH_ORDER)inCh, (HOA_CH_ORDER)outCh);
+                            convertHOANormConvention(FLATTEN2D(ref), order, signalLength, (HOA_NORM)inNorm, (HOA_NORM)outNorm);
+
+                            /* Single pass */
+                            getHOAConventionTransform(order, (HOA_CH_ORDER)inCh, (HOA_NORM)inNorm, (HOA_CH_ORDER)outCh, (HOA_NORM)outNorm, perm, gains);
+                            applyHOAConventionTransform((const float* const*)insig, nInputs, perm, gains, nSH, signalLength, outsig);
+                            for(i=0; i<nSH; i++)
+                                for(j=0; j<signalLength; j++)
+                                    TEST_ASSERT_TRUE(outsig[i][j]==ref[i][j]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /* clean-up */
+    free(insig);
+    free(outsig);
+    free(ref);
+}
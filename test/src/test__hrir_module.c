@@ -28,9 +28,8 @@ void test__resampleHRIRs(void){
     float* hrirs_out, *hrirs_tmp;
     int i, j, target_fs, hrirs_out_len, hrirs_tmp_len, max_ind;
 
-    /* The Speex resampler has generally quite a good compromise between quality and speed.
-     * This tolerance is quite high, but ultimately, it's how it sounds that matters.
-     * If SAF_USE_INTEL_IPP is defined, then the Intel IPP resampler is employed instead */
+    /* The resampler low-pass filters the HRIRs slightly below Nyquist, which is where the error comes from.
+     * This tolerance is quite high, but ultimately, it's how it sounds that matters. */
     const float acceptedTolerance = 0.08f;
 
     /* Test 1 - passing a unit impulse through, and :qasserting the peak is where it should be */
@@ -88,3 +87,66 @@ void test__resampleHRIRs(void){
     free(hrirs_tmp);
     free(hrirs_out);
 }
+
+void test__interpHRTFs_tri(void){
+    int i, nBands, nTargetDirs, nTable, nTri, mode;
+    int* idx;
+    float* freqVector, *itds, *interpTable, *interpWeights;
+    float_complex* hrtfs, *hrtfs_dm, *hrtfs_interp, *hrtfs_interp_ref;
+
+    /* Config */
+    const float acceptedTolerance = 0.0001f;
+    const int hopsize = 128;
+    nBands = hopsize + 5; /* hybrid-mode */
+    nTargetDirs = 240;
+
+    /* Pass the default HRIRs through the filterbank, and get their direction-major counterparts */
+    hrtfs = malloc1d(nBands*NUM_EARS*__default_N_hrir_dirs*sizeof(float_complex));
+    HRIRs2HRTFs_afSTFT((float*)__default_hrirs, __default_N_hrir_dirs, __default_hrir_len, hopsize, 0, 1, hrtfs);
+    hrtfs_dm = malloc1d(__default_N_hrir_dirs*nBands*NUM_EARS*sizeof(float_complex));
+    reorderHRTFs2dirMajor(hrtfs, __default_N_hrir_dirs, nBands, hrtfs_dm);
+    TEST_ASSERT_TRUE(memcmp(&hrtfs[(10*NUM_EARS+1)*__default_N_hrir_dirs+500], &hrtfs_dm[(500*nBands+10)*NUM_EARS+1], sizeof(float_complex))==0);
+    itds = malloc1d(__default_N_hrir_dirs*sizeof(float));
+    estimateITDs((float*)__default_hrirs, __default_N_hrir_dirs, __default_hrir_len, __default_hrir_fs, itds);
+    freqVector = malloc1d(nBands*sizeof(float));
+    for(i=0; i<nBands; i++)
+        freqVector[i] = (float)i*(float)__default_hrir_fs/(2.0f*(float)(nBands-1));
+
+    /* Interpolation table, in both the full and compressed forms */
+    interpTable = NULL;
+    generateVBAPgainTable3D_srcs((float*)__Tdesign_degree_21_dirs_deg, nTargetDirs, (float*)__default_hrir_dirs_deg,
+                                 __default_N_hrir_dirs, 0, 0, 0.0f, &interpTable, &nTable, &nTri);
+    idx = malloc1d(nTargetDirs*3*sizeof(int));
+    interpWeights = malloc1d(nTargetDirs*3*sizeof(float));
+    compressVBAPgainTable3D(interpTable, nTargetDirs, __default_N_hrir_dirs, interpWeights, idx);
+    VBAPgainTable2InterpTable(interpTable, nTargetDirs, __default_N_hrir_dirs);
+
+    /* Should match interpHRTFs(), both with (mode 0) and without (mode 1) phase simplification */
+    hrtfs_interp = malloc1d(nBands*NUM_EARS*nTargetDirs*sizeof(float_complex));
+    hrtfs_interp_ref = malloc1d(nBands*NUM_EARS*nTargetDirs*sizeof(float_complex));
+    for(mode=0; mode<2; mode++){
+        interpHRTFs(hrtfs, mode==0 ? itds : NULL, mode==0 ? freqVector : NULL, interpTable, __default_N_hrir_dirs,
+                    nBands, nTargetDirs, hrtfs_interp_ref);
+        interpHRTFs_tri(hrtfs_dm, mode==0 ? itds : NULL, mode==0 ? freqVector : NULL, idx, interpWeights,
+                        nBands, nTargetDirs, hrtfs_interp);
+        for(i=0; i<nBands*NUM_EARS*nTargetDirs; i++){
+            TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, cabsf(hrtfs_interp_ref[i]), cabsf(hrtfs_interp[i]));
+            /* (the ITDs are summed in a different order, so an IPD lying right on the +/-pi wrap may flip sign) */
+            if(mode==1 || fabsf(crealf(hrtfs_interp_ref[i]))>acceptedTolerance){
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, crealf(hrtfs_interp_ref[i]), crealf(hrtfs_interp[i]));
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, cimagf(hrtfs_interp_ref[i]), cimagf(hrtfs_interp[i]));
+            }
+        }
+    }
+
+    /* Clean-up */
+    free(hrtfs);
+    free(hrtfs_dm);
+    free(itds);
+    free(freqVector);
+    free(interpTable);
+    free(idx);
+    free(interpWeights);
+    free(hrtfs_interp);
+    free(hrtfs_interp_ref);
+}
@@ -99,6 +99,56 @@ void test__afSTFT(void){
     free(freqVector);
 }
 
+void test__afSTFT_filterbankCoeffsToFIR(void){
+    int i, d, ch, band, nBands, nDirs;
+    double errEnergy, refEnergy;
+    float* hrirs, *firs;
+    float_complex* hFB, *hFB_firs;
+
+    /* Config */
+    const double acceptedNMSE = 0.001; /* -30dB */
+    const int hopsize = 128;
+    const int hybridmode = 1;
+    const int fir_len = 2*hopsize;
+    const int delay = hopsize/2;
+    const int dirStep = 20; /* (a subset of the default HRIRs is enough) */
+
+    /* Filterbank coefficients of the default HRIRs */
+    nDirs = (__default_N_hrir_dirs+dirStep-1)/dirStep;
+    nBands = hopsize + (hybridmode ? 5 : 1);
+    hrirs = malloc1d(nDirs*NUM_EARS*__default_hrir_len*sizeof(float));
+    for(d=0; d<nDirs; d++)
+        for(ch=0; ch<NUM_EARS; ch++)
+            memcpy(&hrirs[(d*NUM_EARS+ch)*__default_hrir_len], __default_hrirs[d*dirStep][ch], __default_hrir_len*sizeof(float));
+    hFB = malloc1d(nBands*NUM_EARS*nDirs*sizeof(float_complex));
+    afSTFT_FIRtoFilterbankCoeffs(hrirs, nDirs, NUM_EARS, __default_hrir_len, hopsize, 1, hybridmode, hFB);
+
+    /* Design FIRs from these coefficients, and pass them back through the filterbank */
+    firs = malloc1d(nDirs*NUM_EARS*fir_len*sizeof(float));
+    afSTFT_filterbankCoeffsToFIR(hFB, nDirs, NUM_EARS, hopsize, hybridmode, fir_len, delay, firs);
+    hFB_firs = malloc1d(nBands*NUM_EARS*nDirs*sizeof(float_complex));
+    afSTFT_FIRtoFilterbankCoeffs(firs, nDirs, NUM_EARS, fir_len, hopsize, 1, hybridmode, hFB_firs);
+
+    /* The designed FIRs should give (approximately) the same filterbank coefficients as the HRIRs they came from */
+    for(d=0; d<nDirs; d++){
+        errEnergy = refEnergy = 0.0;
+        for(band=0; band<nBands; band++){
+            for(ch=0; ch<NUM_EARS; ch++){
+                i = band*NUM_EARS*nDirs + ch*nDirs + d;
+                errEnergy += pow((double)cabsf(ccsubf(hFB[i], hFB_firs[i])), 2.0);
+                refEnergy += pow((double)cabsf(hFB[i]), 2.0);
+            }
+        }
+        TEST_ASSERT_TRUE(errEnergy/refEnergy < acceptedNMSE);
+    }
+
+    /* Clean-up */
+    free(hrirs);
+    free(firs);
+    free(hFB);
+    free(hFB_firs);
+}
+
 void test__realloc2d_r(void){
     int s, r, i, j, k;
     typedef struct _test_data{
@@ -260,3 +310,202 @@ void test__malloc6d(void){
     /* Clean-up */
     free(test_malloc_6d);
 }
+
+void test__malloc_aligned(void){
+    int i, j, k, dim;
+    float* test_1d;
+    float_complex** test_2d;
+    double*** test_3d;
+
+    /* Check the padded row lengths */
+    TEST_ASSERT_TRUE(aligned_dim(16, sizeof(float)) == 16);
+    TEST_ASSERT_TRUE(aligned_dim(17, sizeof(float)) == 32);
+    TEST_ASSERT_TRUE(aligned_dim(129, sizeof(float_complex)) == 136);
+    TEST_ASSERT_TRUE(aligned_dim(5, 12)*12 % MD_MALLOC_ALIGNMENT == 0);
+
+    /* 1-D (odd sizes, to make sure that the pointer is not aligned by chance) */
+    for(dim=1; dim<40; dim+=7){
+        test_1d = calloc1d_aligned(dim, sizeof(float));
+        TEST_ASSERT_TRUE(((size_t)test_1d % MD_MALLOC_ALIGNMENT) == 0);
+        for(i=0; i<dim; i++)
+            TEST_ASSERT_TRUE(test_1d[i] == 0.0f);
+        free_aligned(test_1d);
+    }
+
+    /* 2-D: every row should be aligned and zeroed, and the rows should not overlap */
+    test_2d = (float_complex**)calloc2d_aligned(7, 129, sizeof(float_complex));
+    for(i=0; i<7; i++){
+        TEST_ASSERT_TRUE(((size_t)test_2d[i] % MD_MALLOC_ALIGNMENT) == 0);
+        for(j=0; j<129; j++){
+            TEST_ASSERT_TRUE(crealf(test_2d[i][j]) == 0.0f && cimagf(test_2d[i][j]) == 0.0f);
+            test_2d[i][j] = cmplxf((float)(i*129+j), -(float)(i*129+j));
+        }
+    }
+    for(i=0; i<7; i++)
+        for(j=0; j<129; j++)
+            TEST_ASSERT_TRUE(crealf(test_2d[i][j]) == (float)(i*129+j) && cimagf(test_2d[i][j]) == -(float)(i*129+j));
+    free_aligned(test_2d);
+
+    /* 3-D */
+    test_3d = (double***)calloc3d_aligned(3, 5, 11, sizeof(double));
+    for(i=0; i<3; i++){
+        for(j=0; j<5; j++){
+            TEST_ASSERT_TRUE(((size_t)test_3d[i][j] % MD_MALLOC_ALIGNMENT) == 0);
+            for(k=0; k<11; k++){
+                TEST_ASSERT_TRUE(test_3d[i][j][k] == 0.0);
+                test_3d[i][j][k] = (double)(i*5*11 + j*11 + k);
+            }
+        }
+    }
+    for(i=0; i<3; i++)
+        for(j=0; j<5; j++)
+            for(k=0; k<11; k++)
+                TEST_ASSERT_TRUE(test_3d[i][j][k] == (double)(i*5*11 + j*11 + k));
+    free_aligned(test_3d);
+}
+
+void test__md_arena(void){
+    void* hArena;
+    int i, j, k;
+    size_t used;
+    float* test_1d;
+    float** test_2d;
+    double*** test_3d;
+
+    md_arena_create(&hArena, 64*1024);
+    TEST_ASSERT_TRUE(md_arena_getCapacity(hArena) >= 64*1024);
+    TEST_ASSERT_TRUE(md_arena_getUsed(hArena) == 0);
+
+    /* 1-D: aligned and zeroed, and consecutive chunks should not overlap */
+    test_1d = (float*)calloc1d_arena(hArena, 33, sizeof(float));
+    TEST_ASSERT_TRUE(((size_t)test_1d % MD_MALLOC_ALIGNMENT) == 0);
+    for(i=0; i<33; i++){
+        TEST_ASSERT_TRUE(test_1d[i] == 0.0f);
+        test_1d[i] = (float)i;
+    }
+    used = md_arena_getUsed(hArena);
+    TEST_ASSERT_TRUE(used >= 33*sizeof(float) && (used % MD_MALLOC_ALIGNMENT) == 0);
+    TEST_ASSERT_TRUE(used == md_arena_size1d(33*sizeof(float)));
+
+    /* 2-D: same layout as calloc2d() */
+    test_2d = (float**)calloc2d_arena(hArena, 7, 129, sizeof(float));
+    TEST_ASSERT_TRUE(md_arena_getUsed(hArena) == used + md_arena_size2d(7, 129, sizeof(float)));
+    used = md_arena_getUsed(hArena);
+    TEST_ASSERT_TRUE(((size_t)FLATTEN2D(test_2d) % MD_MALLOC_ALIGNMENT) == 0);
+    for(i=0; i<7; i++){
+        for(j=0; j<129; j++){
+            TEST_ASSERT_TRUE(test_2d[i][j] == 0.0f);
+            test_2d[i][j] = (float)(i*129+j);
+        }
+    }
+    for(i=0; i<7*129; i++)
+        TEST_ASSERT_TRUE(FLATTEN2D(test_2d)[i] == (float)i);
+    for(i=0; i<33; i++)
+        TEST_ASSERT_TRUE(test_1d[i] == (float)i);
+
+    /* 3-D: same layout as calloc3d() */
+    test_3d = (double***)calloc3d_arena(hArena, 3, 5, 11, sizeof(double));
+    TEST_ASSERT_TRUE(md_arena_getUsed(hArena) == used + md_arena_size3d(3, 5, 11, sizeof(double)));
+    TEST_ASSERT_TRUE(((size_t)FLATTEN3D(test_3d) % MD_MALLOC_ALIGNMENT) == 0);
+    for(i=0; i<3; i++)
+        for(j=0; j<5; j++)
+            for(k=0; k<11; k++)
+                test_3d[i][j][k] = (double)(i*5*11 + j*11 + k);
+    for(i=0; i<3*5*11; i++)
+        TEST_ASSERT_TRUE(FLATTEN3D(test_3d)[i] == (double)i);
+    TEST_ASSERT_TRUE(md_arena_getUsed(hArena) <= md_arena_getCapacity(hArena));
+
+    /* Requests that do not fit should fail, and leave the arena untouched */
+    used = md_arena_getUsed(hArena);
+    TEST_ASSERT_TRUE(malloc1d_arena(hArena, md_arena_getCapacity(hArena)) == NULL);
+    TEST_ASSERT_TRUE(md_arena_getUsed(hArena) == used);
+
+    /* Memory taken from the heap instead (e.g. since the arena was full) should still be freed */
+    test_2d = (float**)calloc2d(4, 8, sizeof(float));
+    free_arena(hArena, test_2d);
+
+    /* After a reset, the arena should hand out the same memory again */
+    md_arena_reset(hArena);
+    TEST_ASSERT_TRUE(md_arena_getUsed(hArena) == 0);
+    TEST_ASSERT_TRUE(malloc1d_arena(hArena, sizeof(float)) == (void*)test_1d);
+    free_arena(hArena, test_1d); /* (does nothing) */
+    md_arena_destroy(&hArena);
+    TEST_ASSERT_TRUE(hArena == NULL);
+
+    /* Without an arena, the heap should be used instead */
+    test_2d = (float**)calloc2d_arena(NULL, 4, 8, sizeof(float));
+    for(i=0; i<4*8; i++)
+        TEST_ASSERT_TRUE(FLATTEN2D(test_2d)[i] == 0.0f);
+    free_arena(NULL, test_2d);
+}
+
+/** Job used by test__md_rt_check(): allocates memory on the worker thread, and counts its jobs */
+static void test__md_rt_check_job(void* userData, int jobIdx, int threadIdx){
+    int i;
+    float* test_1d;
+    (void)jobIdx;
+    for(i=0; i<100; i++){ /* (the same work on every thread, so that the worker also gets to carry out some of the jobs) */
+        test_1d = threadIdx>0 ? malloc1d(10*sizeof(float)) : NULL;
+        free(test_1d);
+    }
+    if(threadIdx>0)
+        (*(int*)userData)++; /* (only one worker, so no lock is needed) */
+}
+
+void test__md_rt_check(void){
+    void* hPool;
+    int i, nWorkerJobs;
+    float* test_1d;
+    float** test_2d;
+    void* hArena;
+
+    md_arena_create(&hArena, 1024);
+    md_rt_resetNumAllocations();
+
+    /* Allocations made outside of real-time regions should not be counted */
+    md_rt_setCheckMode(MD_RT_CHECK_COUNT);
+    test_1d = malloc1d(10*sizeof(float));
+    free(test_1d);
+    TEST_ASSERT_TRUE(md_rt_getNumAllocations() == 0);
+
+    /* Whereas those made inside one (including nested ones) should be */
+    md_rt_enterRegion();
+    test_1d = malloc1d(10*sizeof(float));
+    test_1d = realloc1d(test_1d, 20*sizeof(float));
+    md_rt_enterRegion();
+    test_2d = (float**)calloc2d(3, 4, sizeof(float));
+    md_rt_exitRegion();
+    free(test_2d);
+    test_2d = (float**)calloc2d_aligned(3, 4, sizeof(float));
+    free_aligned(test_2d);
+    TEST_ASSERT_TRUE(md_rt_getNumAllocations() == 4);
+
+    /* Taking memory from an arena is permitted */
+    test_2d = (float**)malloc2d_arena(hArena, 3, 4, sizeof(float));
+    TEST_ASSERT_TRUE(test_2d != NULL);
+    TEST_ASSERT_TRUE(md_rt_getNumAllocations() == 4);
+    md_rt_exitRegion();
+    free(test_1d);
+
+    /* Regions are per-thread, so allocations made by other threads in the meantime should not be counted */
+    saf_threadPool_create(&hPool, 2);
+    md_rt_resetNumAllocations();
+    nWorkerJobs = 0;
+    md_rt_enterRegion();
+    for(i=0; i<100 && nWorkerJobs==0; i++)
+        saf_threadPool_run(hPool, 64, test__md_rt_check_job, (void*)&nWorkerJobs);
+    md_rt_exitRegion();
+    TEST_ASSERT_TRUE(nWorkerJobs > 0);
+    TEST_ASSERT_TRUE(md_rt_getNumAllocations() == 0);
+    saf_threadPool_destroy(&hPool);
+
+    /* Nothing should be counted once disabled */
+    md_rt_setCheckMode(MD_RT_CHECK_DISABLED);
+    md_rt_resetNumAllocations();
+    md_rt_enterRegion();
+    test_1d = malloc1d(10*sizeof(float));
+    md_rt_exitRegion();
+    free(test_1d);
+    TEST_ASSERT_TRUE(md_rt_getNumAllocations() == 0);
+    md_arena_destroy(&hArena);
+}
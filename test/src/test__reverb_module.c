@@ -25,7 +25,7 @@
 #include "saf_test.h"
 
 void test__ims_shoebox_RIR(void){
-    void* hIms;
+    void* hIms, *hArena;
     float maxTime_s;
     float mov_src_pos[3], mov_rec_pos[3];
     int sourceID_1, sourceID_2, sourceID_3, sourceID_4, sourceID_5, receiverID;
@@ -50,8 +50,10 @@ void test__ims_shoebox_RIR(void){
     const float rec_pos[3] = {8.8f, 5.5f, 0.9f};
     const float roomdims[3] = {10.0f, 7.0f, 3.0f};
 
-    /* Set-up the shoebox room simulator, with two sources and one spherical harmonic receiver */
-    ims_shoebox_create(&hIms, (float*)roomdims, (float*)abs_wall, 125.0f, nBands, 343.0f, 48e3f);
+    /* Set-up the shoebox room simulator, with two sources and one spherical harmonic receiver. The simulator's
+     * own memory is taken from an arena (i.e. one contiguous, prefaulted block) */
+    md_arena_create(&hArena, 1024*1024);
+    ims_shoebox_create(&hIms, (float*)roomdims, (float*)abs_wall, 125.0f, nBands, 343.0f, 48e3f, hArena);
     sourceID_1 = ims_shoebox_addSource(hIms, (float*)src_pos, NULL);
     sourceID_2 = ims_shoebox_addSource(hIms, (float*)src2_pos, NULL);
     receiverID = ims_shoebox_addReceiverSH(hIms, sh_order, (float*)rec_pos, NULL);
@@ -91,8 +93,13 @@ void test__ims_shoebox_RIR(void){
         ims_shoebox_renderRIRs(hIms, 0);
     }
 
+    /* The arena should have been used, without exceeding its capacity */
+    TEST_ASSERT_TRUE(md_arena_getUsed(hArena)>0);
+    TEST_ASSERT_TRUE(md_arena_getUsed(hArena)<=md_arena_getCapacity(hArena));
+
     /* clean-up */
     ims_shoebox_destroy(&hIms);
+    md_arena_destroy(&hArena);
 }
 
 void test__ims_shoebox_TD(void){
@@ -126,7 +133,7 @@ void test__ims_shoebox_TD(void){
     rand_m1_1(FLATTEN2D(src_sigs), 4*signalLength);
 
     /* Set-up the shoebox room simulator for these four sources and SH receiver */
-    ims_shoebox_create(&hIms, (float*)roomdims, (float*)abs_wall, 250.0f, nBands, 343.0f, 48e3f);
+    ims_shoebox_create(&hIms, (float*)roomdims, (float*)abs_wall, 250.0f, nBands, 343.0f, 48e3f, NULL);
     sourceIDs[0] = ims_shoebox_addSource(hIms, (float*)src_pos, &src_sigs[0]);
     sourceIDs[1] = ims_shoebox_addSource(hIms, (float*)src2_pos, &src_sigs[1]);
     sourceIDs[2] = ims_shoebox_addSource(hIms, (float*)src3_pos, &src_sigs[2]);
@@ -151,3 +158,79 @@ void test__ims_shoebox_TD(void){
     free(rec_sh_outsigs);
     ims_shoebox_destroy(&hIms);
 }
+
+void test__ims_shoebox_TD_arena(void){
+    void* hIms, *hArena;
+    float mov_src_pos[3];
+    float** src_sigs, ***rec_sh_outsigs, **src_frame, **rec_frame;
+    int sourceIDs[2], receiverIDs[1];
+    int i, j, ch, useArena;
+    size_t arenaSize;
+
+    /* Config */
+    const int signalLength = 4*1024;
+    const int framesize = 1024;
+    const int sh_order = 1;
+    const int nBands = 3;
+    const float abs_wall[3][6] =  /* Absorption Coefficients per Octave band, and per wall */
+      { {0.180791250f, 0.207307300f, 0.134990800f, 0.229002250f, 0.212128400f, 0.241055000f},
+        {0.225971250f, 0.259113700f, 0.168725200f, 0.286230250f, 0.265139600f, 0.301295000f},
+        {0.258251250f, 0.296128100f, 0.192827600f, 0.327118250f, 0.303014800f, 0.344335000f} };
+    const float src_pos[3]  = {5.1f, 6.0f, 1.1f};
+    const float src2_pos[3] = {2.1f, 1.0f, 1.3f};
+    const float rec_pos[3]  = {8.8f, 5.5f, 0.9f};
+    const float roomdims[3] = {10.0f, 7.0f, 3.0f};
+
+    /* Two sources and one spherical harmonic receiver */
+    rec_sh_outsigs = (float***)calloc3d(3, ORDER2NSH(sh_order), signalLength, sizeof(float));
+    src_sigs = (float**)malloc2d(2, signalLength, sizeof(float));
+    rand_m1_1(FLATTEN2D(src_sigs), 2*signalLength);
+    src_frame = (float**)malloc2d(2, framesize, sizeof(float));
+    rec_frame = (float**)malloc2d(ORDER2NSH(sh_order), framesize, sizeof(float));
+    arenaSize = ims_shoebox_getRequiredArenaSize(nBands, 2, 1, ORDER2NSH(sh_order));
+
+    /* Render the same scene using the heap (0), an arena of the required size (1), and an arena which is too small (2) */
+    for(useArena=0; useArena<3; useArena++){
+        hArena = NULL;
+        if(useArena)
+            md_arena_create(&hArena, useArena==1 ? arenaSize : arenaSize/2);
+        ims_shoebox_create(&hIms, (float*)roomdims, (float*)abs_wall, 250.0f, nBands, 343.0f, 48e3f, hArena);
+        sourceIDs[0] = ims_shoebox_addSource(hIms, (float*)src_pos, &src_frame[0]);
+        sourceIDs[1] = ims_shoebox_addSource(hIms, (float*)src2_pos, &src_frame[1]);
+        receiverIDs[0] = ims_shoebox_addReceiverSH(hIms, sh_order, (float*)rec_pos, &rec_frame);
+
+        /* Move source No.1 between frames (so that the cross-fading buffers are also used) */
+        memcpy(mov_src_pos, src_pos, 3*sizeof(float));
+        for(i=0; i<signalLength/framesize; i++){
+            mov_src_pos[1] = 2.0f + (float)i/10.0f;
+            ims_shoebox_updateSource(hIms, sourceIDs[0], mov_src_pos);
+            ims_shoebox_computeEchograms(hIms, -1, 0.025f);
+            for(j=0; j<2; j++)
+                memcpy(src_frame[j], &src_sigs[j][i*framesize], framesize*sizeof(float));
+            ims_shoebox_applyEchogramTD(hIms, receiverIDs[0], framesize, 0);
+            for(ch=0; ch<ORDER2NSH(sh_order); ch++)
+                memcpy(&rec_sh_outsigs[useArena][ch][i*framesize], rec_frame[ch], framesize*sizeof(float));
+        }
+
+        /* (also render the RIRs, so that all of the buffers of the object have been allocated) */
+        ims_shoebox_renderRIRs(hIms, 0);
+
+        /* All of the allocations should have been taken from the arena (or, the remainder from the heap) */
+        if(useArena==1)
+            TEST_ASSERT_TRUE(md_arena_getUsed(hArena) == arenaSize);
+        ims_shoebox_destroy(&hIms);
+        md_arena_destroy(&hArena);
+    }
+
+    /* The output should be the same in all cases */
+    for(i=0; i<ORDER2NSH(sh_order)*signalLength; i++){
+        TEST_ASSERT_TRUE(FLATTEN3D(rec_sh_outsigs)[i] == FLATTEN3D(rec_sh_outsigs)[ORDER2NSH(sh_order)*signalLength+i]);
+        TEST_ASSERT_TRUE(FLATTEN3D(rec_sh_outsigs)[i] == FLATTEN3D(rec_sh_outsigs)[2*ORDER2NSH(sh_order)*signalLength+i]);
+    }
+
+    /* clean-up */
+    free(src_sigs);
+    free(rec_sh_outsigs);
+    free(src_frame);
+    free(rec_frame);
+}
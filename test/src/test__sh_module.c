@@ -81,31 +81,139 @@ void test__getSHreal(void){
     }
 }
 
+/* Independent reference for the real SH (i.e. the original getSHreal() implementation, which is based on the
+ * unnormalised Legendre functions, the factorials, and an explicit cancellation of the Condon-Shortley phase);
+ * FLAT: (order+1)^2 x nDirs */
+static void test__getSHreal_ref(int order, float* dirs_rad, int nDirs, float* Y){
+    int dir, n, m;
+    double norm, azi;
+    double* cos_incl, *p_nm;
+
+    cos_incl = malloc1d(nDirs*sizeof(double));
+    p_nm = malloc1d((order+1)*nDirs*sizeof(double));
+    for(dir=0; dir<nDirs; dir++)
+        cos_incl[dir] = cos((double)dirs_rad[dir*2+1]);
+    for(n=0; n<=order; n++){
+        unnorm_legendreP(n, cos_incl, nDirs, p_nm); /* includes Condon-Shortley phase term */
+        for(m=0; m<=n; m++){
+            norm = sqrt((2.0*(double)n+1.0)*(double)factorial(n-m)/(4.0*SAF_PId*(double)factorial(n+m))) * pow(-1.0, (double)m);
+            for(dir=0; dir<nDirs; dir++){
+                azi = (double)dirs_rad[dir*2];
+                if(m==0)
+                    Y[(n*n+n)*nDirs+dir] = (float)(norm*p_nm[dir]);
+                else{
+                    Y[(n*n+n-m)*nDirs+dir] = (float)(norm*p_nm[m*nDirs+dir]*sqrt(2.0)*sin((double)m*azi));
+                    Y[(n*n+n+m)*nDirs+dir] = (float)(norm*p_nm[m*nDirs+dir]*sqrt(2.0)*cos((double)m*azi));
+                }
+            }
+        }
+    }
+    free(cos_incl);
+    free(p_nm);
+}
+
 void test__getSHreal_recur(void){
-    int i, j;
+    int i, j, k, order, nDirs, nSH;
+    float* dirs_rad, *Yr, *Y;
 
     /* Config */
-    /* In general, the values from this recusive alternative are well below this
-     * tolerance value. However, the error does get larger for higher-orders and
-     * when dir[1] is near 0. */
-    float acceptedTolerance = 0.005f;
-    const int order = 15;
-    const int nSH = ORDER2NSH(order);
-    float dir[2];
+    const float acceptedTolerance = 0.0001f; /* (the largest error is ~7e-6, at 15th order) */
+    const int maxOrder = 15;
+    const int nTestDirs = 3;
+    const int testDirs[3] = {1, 5, 37}; /* (one direction; fewer directions than a block; blocks plus a remainder) */
+    const float Y_2[9] = { 0.2820948f, 0.2115711f, 0.2443013f, 0.3664519f, 0.3548155f, /* closed-form values */
+                           0.2365437f, -0.0788479f, 0.4097057f, 0.2048528f };
+
+    /* Check that the output of getSHreal_recur matches the independent reference, for random directions */
+    dirs_rad = malloc1d(37*2*sizeof(float));
+    Yr = malloc1d(ORDER2NSH(maxOrder)*37*sizeof(float));
+    Y = malloc1d(ORDER2NSH(maxOrder)*37*sizeof(float));
+    for(i=0; i<100; i++){
+        for(k=0; k<nTestDirs; k++){
+            nDirs = testDirs[k];
+            order = (i+k)%(maxOrder+1);
+            nSH = ORDER2NSH(order);
+            rand_m1_1(dirs_rad, nDirs*2);
+            for(j=0; j<nDirs; j++){
+                dirs_rad[j*2]   *= SAF_PI;
+                dirs_rad[j*2+1] = (dirs_rad[j*2+1]+1.0f)*SAF_PI/2.0f;
+            }
+            getSHreal_recur(order, dirs_rad, nDirs, Yr);
+            test__getSHreal_ref(order, dirs_rad, nDirs, Y);
+            for(j=0; j<nSH*nDirs; j++)
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, Y[j], Yr[j]);
+        }
+    }
 
-    /* Check that the output of getSHreal_recur matches that of getSH_recur */
-    float Yr[ORDER2NSH(15)];
-    float Y[ORDER2NSH(15)];
-    for(i=0; i<1e3; i++){
-        rand_m1_1(&dir[0] , 1);
-        rand_m1_1(&dir[1] , 1);
-        dir[0] *= SAF_PI;
-        dir[1] *= SAF_PI/2.0f;
-        getSHreal_recur(order, (float*)dir, 1, (float*)Yr);
-        getSHreal(order, (float*)dir, 1, (float*)Y);
-        for(j=0; j<nSH; j++)
-            TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, Yr[j], Y[j]);
+    /* Also check against hard-coded values (order 2, azi = 30 deg, incl = 60 deg) */
+    dirs_rad[0] = SAF_PI/6.0f;
+    dirs_rad[1] = SAF_PI/3.0f;
+    getSHreal_recur(2, dirs_rad, 1, Yr);
+    for(j=0; j<9; j++)
+        TEST_ASSERT_FLOAT_WITHIN(0.00001f, Y_2[j], Yr[j]);
+
+    /* clean-up */
+    free(dirs_rad);
+    free(Yr);
+    free(Y);
+}
+
+void test__shEvaluator(void){
+    int i, j, order, nDirs, nSH;
+    float* dirs_rad, *Y_ref, *Y;
+    double* dirs_rad_d, *Y_d;
+    void* hSHE;
+
+    /* Config */
+    const float acceptedTolerance = 0.0001f;
+    const int maxOrder = 20;
+
+    /* Random directions (including the poles) */
+    nDirs = 1000;
+    dirs_rad = malloc1d(nDirs*2*sizeof(float));
+    dirs_rad_d = malloc1d(nDirs*2*sizeof(double));
+    rand_0_1(dirs_rad, nDirs*2);
+    for(i=0; i<nDirs; i++){
+        dirs_rad[i*2] = (dirs_rad[i*2]*2.0f - 1.0f) * SAF_PI;
+        dirs_rad[i*2+1] *= SAF_PI;
     }
+    dirs_rad[1] = 0.0f;
+    dirs_rad[3] = SAF_PI;
+    for(i=0; i<nDirs*2; i++)
+        dirs_rad_d[i] = (double)dirs_rad[i];
+
+    /* Check that the evaluator (single and double precision) matches the independent reference, for all orders */
+    shEvaluator_create(&hSHE, maxOrder);
+    Y_ref = malloc1d(ORDER2NSH(maxOrder)*nDirs*sizeof(float));
+    Y = malloc1d(ORDER2NSH(maxOrder)*nDirs*sizeof(float));
+    Y_d = malloc1d(ORDER2NSH(maxOrder)*nDirs*sizeof(double));
+    for(order=0; order<=maxOrder; order++){
+        nSH = ORDER2NSH(order);
+        test__getSHreal_ref(order, dirs_rad, nDirs, Y_ref);
+
+        /* (evaluated inside a real-time region, to also check that no memory is allocated) */
+        md_rt_resetNumAllocations();
+        md_rt_setCheckMode(MD_RT_CHECK_COUNT);
+        md_rt_enterRegion();
+        shEvaluator_getSHreal(hSHE, order, dirs_rad, nDirs, Y);
+        shEvaluator_getSHreal_d(hSHE, order, dirs_rad_d, nDirs, Y_d);
+        md_rt_exitRegion();
+        md_rt_setCheckMode(MD_RT_CHECK_DISABLED);
+        TEST_ASSERT_TRUE(md_rt_getNumAllocations()==0);
+
+        for(j=0; j<nSH*nDirs; j++){
+            TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, Y_ref[j], Y[j]);
+            TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, Y_ref[j], (float)Y_d[j]);
+        }
+    }
+
+    /* clean-up */
+    shEvaluator_destroy(&hSHE);
+    free(dirs_rad);
+    free(dirs_rad_d);
+    free(Y_ref);
+    free(Y);
+    free(Y_d);
 }
 
 void test__getSHcomplex(void){
@@ -228,6 +336,77 @@ void test__getSHrotMtxReal(void){
     free(Mrot);
 }
 
+void test__applySHrotMtxReal(void){
+    int i, j, n, order, nSH, nSamples, nRows;
+    float Rzyx[3][3];
+    float* Mrot, *inSig, *outSig, *outSig_ref;
+    float_complex* decMtx, *decMtx_rot, *decMtx_rot_ref, *Mrot_c;
+    const float_complex calpha = cmplxf(1.0f, 0.0f), cbeta = cmplxf(0.0f, 0.0f);
+
+    /* Config */
+    const float acceptedTolerance = 0.0001f;
+    order = 7;
+    nSamples = 256;
+    nRows = 2;
+
+    /* Rotation matrix */
+    nSH = ORDER2NSH(order);
+    Mrot = malloc1d(nSH*nSH*sizeof(float));
+    yawPitchRoll2Rzyx(0.3f, -0.84f, 1.2f, 0, Rzyx);
+    getSHrotMtxReal(Rzyx, Mrot, order);
+
+    /* Rotate random SH signals, and compare with the dense matrix multiplication */
+    inSig = malloc1d(nSH*nSamples*sizeof(float));
+    outSig = malloc1d(nSH*nSamples*sizeof(float));
+    outSig_ref = malloc1d(nSH*nSamples*sizeof(float));
+    rand_m1_1(inSig, nSH*nSamples);
+    cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nSH, nSamples, nSH, 1.0f,
+                Mrot, nSH,
+                inSig, nSamples, 0.0f,
+                outSig_ref, nSamples);
+    applySHrotMtxReal(order, Mrot, nSH, inSig, nSamples, nSamples, nSamples, outSig);
+    for(i=0; i<nSH*nSamples; i++)
+        TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, outSig_ref[i], outSig[i]);
+
+    /* Bake the rotation into a random complex decoding matrix, and compare with the dense matrix multiplication */
+    decMtx = malloc1d(nRows*nSH*sizeof(float_complex));
+    decMtx_rot = malloc1d(nRows*nSH*sizeof(float_complex));
+    decMtx_rot_ref = malloc1d(nRows*nSH*sizeof(float_complex));
+    Mrot_c = malloc1d(nSH*nSH*sizeof(float_complex));
+    rand_m1_1((float*)decMtx, 2*nRows*nSH);
+    for(i=0; i<nSH*nSH; i++)
+        Mrot_c[i] = cmplxf(Mrot[i], 0.0f);
+    cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, nRows, nSH, nSH, &calpha,
+                decMtx, nSH,
+                Mrot_c, nSH, &cbeta,
+                decMtx_rot_ref, nSH);
+    applySHrotMtxRealToDecoder(order, Mrot, nSH, decMtx, nSH, nRows, nSH, decMtx_rot);
+    for(i=0; i<nRows*nSH; i++){
+        TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, crealf(decMtx_rot_ref[i]), crealf(decMtx_rot[i]));
+        TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, cimagf(decMtx_rot_ref[i]), cimagf(decMtx_rot[i]));
+    }
+
+    /* Values outside of the diagonal blocks should be ignored */
+    for(i=0; i<nSH; i++)
+        for(j=0; j<nSH; j++)
+            for(n=0; n<=order; n++)
+                if((i>=n*n && i<(n+1)*(n+1)) != (j>=n*n && j<(n+1)*(n+1)))
+                    Mrot[i*nSH+j] = 1.0f;
+    applySHrotMtxReal(order, Mrot, nSH, inSig, nSamples, nSamples, nSamples, outSig);
+    for(i=0; i<nSH*nSamples; i++)
+        TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, outSig_ref[i], outSig[i]);
+
+    /* Clean-up */
+    free(Mrot);
+    free(inSig);
+    free(outSig);
+    free(outSig_ref);
+    free(decMtx);
+    free(decMtx_rot);
+    free(decMtx_rot_ref);
+    free(Mrot_c);
+}
+
 void test__real2complexSHMtx(void){
     int o, it, j, nSH, order;
     float* Y_real_ref;
@@ -588,6 +767,219 @@ void test__sphPWD(void){
     free(Cx_cmplx);
 }
 
+/* Independent (double precision, direction-by-direction) implementation of the baseline activity-map formulas, for a
+ * real-valued Cx and Y_grid, and a single source: 0 PWD, 1 MVDR, 2 CroPaC-LCMV, 3 MUSIC, 4 MinNorm */
+static void test__generateMap_ref(int mode, int nSH, float* Cx, float* Y_grid, int nGrid, float regPar, float* pmap){
+    int i, j, k, n, c, piv;
+    double trace, tmp, denom, S, G, mvdr, M[2][2], det, u[2], xspec;
+    double Cd[64][64], Z[64][2], A[64][2], v[64], v_new[64], P[64][64], Un[64];
+
+    saf_assert(nSH<=64, "reference is for low orders only");
+    if(mode<3){
+        /* A = [y, diag(Cx).*y]; Z = (Cx + regPar*trace(Cx)/nSH*I)^-1 * A (Gaussian elimination with partial pivoting) */
+        for(i=0, trace=0.0; i<nSH; i++)
+            trace += Cx[i*nSH+i];
+        for(n=0; n<nGrid; n++){
+            for(i=0; i<nSH; i++){
+                for(j=0; j<nSH; j++)
+                    Cd[i][j] = (double)Cx[i*nSH+j] + (i==j ? regPar*trace/(double)nSH : 0.0);
+                A[i][0] = Z[i][0] = (double)Y_grid[i*nGrid+n];
+                A[i][1] = Z[i][1] = (double)Cx[i*nSH+i]*A[i][0];
+            }
+            for(k=0; k<nSH; k++){
+                for(i=k+1, piv=k; i<nSH; i++)
+                    if(fabs(Cd[i][k])>fabs(Cd[piv][k]))
+                        piv = i;
+                for(j=0; j<nSH; j++){ tmp = Cd[k][j]; Cd[k][j] = Cd[piv][j]; Cd[piv][j] = tmp; }
+                for(c=0; c<2; c++){ tmp = Z[k][c]; Z[k][c] = Z[piv][c]; Z[piv][c] = tmp; }
+                for(i=k+1; i<nSH; i++){
+                    tmp = Cd[i][k]/Cd[k][k];
+                    for(j=k; j<nSH; j++)
+                        Cd[i][j] -= tmp*Cd[k][j];
+                    for(c=0; c<2; c++)
+                        Z[i][c] -= tmp*Z[k][c];
+                }
+            }
+            for(k=nSH-1; k>=0; k--){
+                for(c=0; c<2; c++){
+                    for(j=k+1; j<nSH; j++)
+                        Z[k][c] -= Cd[k][j]*Z[j][c];
+                    Z[k][c] /= Cd[k][k];
+                }
+            }
+
+            /* PWD: y^T*Cx*y; MVDR: w^T*Cx*w, with w = Z(:,1)/(y^T*Z(:,1)) */
+            for(i=0, denom=0.0; i<nSH; i++)
+                denom += A[i][0]*Z[i][0];
+            for(i=0, tmp=mvdr=0.0; i<nSH; i++){
+                for(j=0; j<nSH; j++){
+                    tmp  += A[i][0]*(double)Cx[i*nSH+j]*A[j][0];
+                    mvdr += Z[i][0]*(double)Cx[i*nSH+j]*Z[j][0];
+                }
+            }
+            mvdr /= denom*denom;
+            if(mode==0){
+                pmap[n] = (float)tmp;
+                continue;
+            }
+            else if(mode==1){
+                pmap[n] = (float)mvdr;
+                continue;
+            }
+
+            /* CroPaC-LCMV: wo = Z*(A^T*Z)^-T*[1 0]^T; the MVDR map is scaled by G^2, G = sqrt(min(|wo^T*Cx*y|, mvdr)/mvdr) */
+            for(j=0; j<2; j++)
+                for(c=0; c<2; c++)
+                    for(i=0, M[j][c]=0.0; i<nSH; i++)
+                        M[j][c] += A[i][j]*Z[i][c];
+            det = M[0][0]*M[1][1] - M[0][1]*M[1][0];
+            u[0] =  M[1][1]/det;
+            u[1] = -M[0][1]/det;
+            for(i=0, xspec=0.0; i<nSH; i++)
+                for(j=0; j<nSH; j++)
+                    xspec += (Z[i][0]*u[0] + Z[i][1]*u[1])*(double)Cx[i*nSH+j]*A[j][0];
+            S = SAF_MIN(fabs(xspec), mvdr);
+            G = sqrt(S/(mvdr+2.23e-10));
+            pmap[n] = (float)(G*G*mvdr);
+        }
+    }
+    else{
+        /* Signal sub-space (dominant eigenvector) via power iteration, and the noise sub-space projector P = I - v*v^T */
+        for(i=0; i<nSH; i++)
+            v[i] = 1.0;
+        for(k=0; k<200; k++){
+            for(i=0, tmp=0.0; i<nSH; i++){
+                for(j=0, v_new[i]=0.0; j<nSH; j++)
+                    v_new[i] += (double)Cx[i*nSH+j]*v[j];
+                tmp += v_new[i]*v_new[i];
+            }
+            for(i=0; i<nSH; i++)
+                v[i] = v_new[i]/sqrt(tmp);
+        }
+        for(i=0; i<nSH; i++)
+            for(j=0; j<nSH; j++)
+                P[i][j] = (i==j ? 1.0 : 0.0) - v[i]*v[j];
+
+        /* MUSIC: 1/(y^T*P*y); MinNorm: 1/|u^T*y|^2, with u = P*e1/(e1^T*P*e1) */
+        for(i=0; i<nSH; i++)
+            Un[i] = P[i][0]/(P[0][0]+2.23e-9);
+        for(n=0; n<nGrid; n++){
+            for(i=0, tmp=0.0; i<nSH; i++){
+                if(mode==3)
+                    for(j=0; j<nSH; j++)
+                        tmp += (double)Y_grid[i*nGrid+n]*P[i][j]*(double)Y_grid[j*nGrid+n];
+                else
+                    tmp += Un[i]*(double)Y_grid[i*nGrid+n];
+            }
+            pmap[n] = mode==3 ? (float)(1.0/(tmp+2.23e-10)) : (float)(1.0/(tmp*tmp+2.23e-9));
+        }
+    }
+}
+
+void test__generateMap(void){
+    int i, j, nGrid, nSH, srcInd, peakInd, mode;
+    float test_dir_deg[2];
+    float* grid_dirs_deg, *Y_src, *src_sig, *pmap, *pmap_ref;
+    float** Y_grid, **src_sigs_sh, **Cx;
+    float_complex** Y_grid_cmplx, **Cx_cmplx, *Y_sub;
+    void* hMap;
+
+    /* config */
+    const int order = 3;
+    const int lsig = 48000;
+    const float acceptedTolerance = 0.01f; /* relative, per direction (the MUSIC/MinNorm peaks are ill-conditioned) */
+
+    /* define scanning grid directions */
+    nGrid = 240;
+    grid_dirs_deg = (float*)__Tdesign_degree_21_dirs_deg;
+    nSH = ORDER2NSH(order);
+    Y_grid = (float**)malloc2d(nSH, nGrid, sizeof(float));
+    getRSH(order, grid_dirs_deg, nGrid, FLATTEN2D(Y_grid));
+    Y_grid_cmplx = (float_complex**)calloc2d(nSH, nGrid, sizeof(float_complex));
+    cblas_scopy(nSH*nGrid, FLATTEN2D(Y_grid), 1, (float*)FLATTEN2D(Y_grid_cmplx), 2);
+
+    /* test scenario: one noise source, plus some uncorrelated sensor noise */
+    srcInd = 139;
+    test_dir_deg[0] = grid_dirs_deg[srcInd*2];
+    test_dir_deg[1] = grid_dirs_deg[srcInd*2+1];
+    Y_src = malloc1d(nSH*sizeof(float));
+    getRSH(order, test_dir_deg, 1, Y_src);
+    src_sig = malloc1d(lsig*sizeof(float));
+    rand_m1_1(src_sig, lsig);
+    src_sigs_sh = (float**)malloc2d(nSH, lsig, sizeof(float));
+    rand_m1_1(FLATTEN2D(src_sigs_sh), nSH*lsig);
+    cblas_sscal(nSH*lsig, 0.01f, FLATTEN2D(src_sigs_sh), 1);
+    for(i=0; i<nSH; i++)
+        for(j=0; j<lsig; j++)
+            src_sigs_sh[i][j] += Y_src[i]*src_sig[j];
+    Cx = (float**)malloc2d(nSH, nSH, sizeof(float));
+    cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasTrans, nSH, nSH, lsig, 1.0f,
+                FLATTEN2D(src_sigs_sh), lsig,
+                FLATTEN2D(src_sigs_sh), lsig, 0.0f,
+                FLATTEN2D(Cx), nSH);
+    Cx_cmplx = (float_complex**)calloc2d(nSH, nSH, sizeof(float_complex));
+    cblas_scopy(nSH*nSH, FLATTEN2D(Cx), 1, (float*)FLATTEN2D(Cx_cmplx), 2);
+
+    /* The handle is deliberately created for a higher order and more grid directions than are used */
+    pmap = malloc1d(nGrid*sizeof(float));
+    pmap_ref = malloc1d(nGrid*sizeof(float));
+    Y_sub = malloc1d(nSH*(nGrid/3)*sizeof(float_complex));
+    generateMap_create(&hMap, order+1, nGrid+10);
+    for(mode=0; mode<5; mode++){
+        /* Compute the map (inside a real-time region, to also check that no memory is allocated) */
+        md_rt_resetNumAllocations();
+        md_rt_setCheckMode(MD_RT_CHECK_COUNT);
+        md_rt_enterRegion();
+        switch(mode){
+            case 0: generatePWDmap_compute(hMap, order, FLATTEN2D(Cx_cmplx), FLATTEN2D(Y_grid_cmplx), nGrid, pmap); break;
+            case 1: generateMVDRmap_compute(hMap, order, FLATTEN2D(Cx_cmplx), FLATTEN2D(Y_grid_cmplx), nGrid, 8.0f, pmap, NULL); break;
+            case 2: generateCroPaCLCMVmap_compute(hMap, order, FLATTEN2D(Cx_cmplx), FLATTEN2D(Y_grid_cmplx), nGrid, 8.0f, 0.0f, pmap); break;
+            case 3: generateMUSICmap_compute(hMap, order, FLATTEN2D(Cx_cmplx), FLATTEN2D(Y_grid_cmplx), 1, nGrid, 0, pmap); break;
+            case 4: generateMinNormMap_compute(hMap, order, FLATTEN2D(Cx_cmplx), FLATTEN2D(Y_grid_cmplx), 1, nGrid, 0, pmap); break;
+        }
+        md_rt_exitRegion();
+        md_rt_setCheckMode(MD_RT_CHECK_DISABLED);
+        TEST_ASSERT_TRUE(md_rt_getNumAllocations()==0);
+
+        /* Assert that the true source index was found */
+        utility_simaxv(pmap, nGrid, &peakInd);
+        TEST_ASSERT_TRUE(peakInd == srcInd);
+
+        /* Assert that the map matches an independent (double precision, per-direction) implementation */
+        test__generateMap_ref(mode, nSH, FLATTEN2D(Cx), FLATTEN2D(Y_grid), nGrid, 8.0f, pmap_ref);
+        for(i=0; i<nGrid; i++)
+            TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, logf(pmap_ref[i]), logf(pmap[i]));
+
+        /* Passing Cx=NULL reuses the decomposition of the previous call; so evaluating every 3rd direction this way
+         * should give the same values as the whole grid */
+        for(i=0; i<nSH; i++)
+            for(j=0; j<nGrid/3; j++)
+                Y_sub[i*(nGrid/3)+j] = Y_grid_cmplx[i][j*3];
+        switch(mode){
+            case 0: generatePWDmap_compute(hMap, order, NULL, Y_sub, nGrid/3, pmap_ref); break;
+            case 1: generateMVDRmap_compute(hMap, order, NULL, Y_sub, nGrid/3, 8.0f, pmap_ref, NULL); break;
+            case 2: generateCroPaCLCMVmap_compute(hMap, order, NULL, Y_sub, nGrid/3, 8.0f, 0.0f, pmap_ref); break;
+            case 3: generateMUSICmap_compute(hMap, order, NULL, Y_sub, 1, nGrid/3, 0, pmap_ref); break;
+            case 4: generateMinNormMap_compute(hMap, order, NULL, Y_sub, 1, nGrid/3, 0, pmap_ref); break;
+        }
+        for(j=0; j<nGrid/3; j++)
+            TEST_ASSERT_FLOAT_WITHIN(0.0001f*pmap[j*3], pmap[j*3], pmap_ref[j]);
+    }
+
+    /* clean-up */
+    generateMap_destroy(&hMap);
+    free(Y_grid);
+    free(Y_grid_cmplx);
+    free(Y_src);
+    free(src_sig);
+    free(src_sigs_sh);
+    free(Cx);
+    free(Cx_cmplx);
+    free(pmap);
+    free(pmap_ref);
+    free(Y_sub);
+}
+
 void test__sphESPRIT(void){
     int i,j,nSH, nSrcs;
     void* hESPRIT;
@@ -201,6 +201,25 @@ void test__quaternion(void){
         quaternion2euler(&Q2, 1, EULER_ROTATION_YAW_PITCH_ROLL, &test_ypr[0], &test_ypr[1], &test_ypr[2]);
         for(j=0; j<3; j++)
             TEST_ASSERT_TRUE(fabsf(test_ypr[j]-ypr[j])<1e-2f);
+
+        /* Testing that quaternionSlerp() returns the end points, and a valid rotation in between */
+        rand_m1_1(Q2.Q, 4);
+        norm = L2_norm(Q2.Q, 4);
+        for(j=0; j<4; j++)
+            Q2.Q[j] /= norm;
+        quaternionSlerp(&Q, &Q2, 0.0f, &Q1);
+        quaternion2rotationMatrix(&Q1, rot2);
+        utility_svvsub((float*)rot, (float*)rot2, 9, residual);
+        for(j=0; j<9; j++)
+            TEST_ASSERT_TRUE(fabsf(residual[j])<1e-3f);
+        quaternionSlerp(&Q, &Q2, 1.0f, &Q1);
+        quaternion2rotationMatrix(&Q1, rot);
+        quaternion2rotationMatrix(&Q2, rot2);
+        utility_svvsub((float*)rot, (float*)rot2, 9, residual);
+        for(j=0; j<9; j++)
+            TEST_ASSERT_TRUE(fabsf(residual[j])<1e-3f);
+        quaternionSlerp(&Q, &Q2, 0.3f, &Q1);
+        TEST_ASSERT_TRUE(fabsf(L2_norm(Q1.Q, 4)-1.0f)<1e-4f);
     }
 }
 
@@ -328,9 +347,10 @@ void test__saf_stft_LTI(void){
 }
 
 void test__saf_matrixConv(void){
-    int i, frame;
+    int i, j, k, o, frame, usePart;
     float** inputTD, **outputTD, **inputFrameTD, **outputFrameTD;
     float*** filters;
+    double ref;
     void* hMatrixConv;
 
     /* config */
@@ -339,6 +359,8 @@ void test__saf_matrixConv(void){
     const int filterLength = 512;
     const int nInputs = 32;
     const int nOutputs = 40;
+    const int nSamplesToCheck = 2500; /* (against direct convolution) */
+    const float acceptedTolerance = 0.001f;
 
     /* prep */
     inputTD = (float**)malloc2d(nInputs, signalLength, sizeof(float));
@@ -348,18 +370,32 @@ void test__saf_matrixConv(void){
     filters = (float***)malloc3d(nOutputs, nInputs, filterLength, sizeof(float));
     rand_m1_1(FLATTEN3D(filters), nOutputs*nInputs*filterLength);
     rand_m1_1(FLATTEN2D(inputTD), nInputs*signalLength);
-    saf_matrixConv_create(&hMatrixConv, hostBlockSize, FLATTEN3D(filters), filterLength,
-                          nInputs, nOutputs, SAF_TRUE);
+    for(usePart=0; usePart<2; usePart++){
+        saf_matrixConv_create(&hMatrixConv, hostBlockSize, FLATTEN3D(filters), filterLength,
+                              nInputs, nOutputs, usePart);
 
-    /* Apply */
-    for(frame = 0; frame<(int)signalLength/hostBlockSize; frame++){
-        for(i = 0; i<nInputs; i++)
-            memcpy(inputFrameTD[i], &inputTD[i][frame*hostBlockSize], hostBlockSize*sizeof(float));
+        /* Apply */
+        for(frame = 0; frame<(int)signalLength/hostBlockSize; frame++){
+            for(i = 0; i<nInputs; i++)
+                memcpy(inputFrameTD[i], &inputTD[i][frame*hostBlockSize], hostBlockSize*sizeof(float));
 
-        saf_matrixConv_apply(hMatrixConv, FLATTEN2D(inputFrameTD), FLATTEN2D(outputFrameTD));
+            saf_matrixConv_apply(hMatrixConv, FLATTEN2D(inputFrameTD), FLATTEN2D(outputFrameTD));
 
-        for(i = 0; i<nOutputs; i++)
-            memcpy(&outputTD[i][frame*hostBlockSize], outputFrameTD[i], hostBlockSize*sizeof(float));
+            for(i = 0; i<nOutputs; i++)
+                memcpy(&outputTD[i][frame*hostBlockSize], outputFrameTD[i], hostBlockSize*sizeof(float));
+        }
+
+        /* Compare the first and last outputs with direct convolution (scaled by the filter energy) */
+        for(o = 0; o<nOutputs; o+=nOutputs-1){
+            for(j = 0; j<nSamplesToCheck; j++){
+                ref = 0.0;
+                for(i = 0; i<nInputs; i++)
+                    for(k = 0; k<SAF_MIN(j+1, filterLength); k++)
+                        ref += (double)filters[o][i][k] * (double)inputTD[i][j-k];
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance*sqrtf((float)(nInputs*filterLength)), (float)ref, outputTD[o][j]);
+            }
+        }
+        saf_matrixConv_destroy(&hMatrixConv);
     }
 
     /* Clean-up */
@@ -368,7 +404,6 @@ void test__saf_matrixConv(void){
     free(inputFrameTD);
     free(outputFrameTD);
     free(filters);
-    saf_matrixConv_destroy(&hMatrixConv);
 }
 
 void test__saf_rfft(void){
@@ -557,6 +592,676 @@ void test__smb_pitchShifter(void){
     free(out_fft);
 }
 
+void test__saf_resampler(void){
+    int i, ch, t, nOut, totalOut, maxNout, latency, fs_in, fs_out, nFrames;
+    float** inFrame, **outFrame, **outSigs;
+    float f[3];
+    void* hRes;
+
+    /* Config */
+    const float acceptedTolerance = 0.0001f;
+    const int nCH = 3;
+    const int blockSize = 512;
+    const int nTests = 2;
+    const int fs_in_list[2]  = {44100, 48000};
+    const int fs_out_list[2] = {48000, 32000};
+
+    f[0] = 250.0f; f[1] = 1000.0f; f[2] = 8000.0f; /* test tones (below 0.9*Nyquist of all sampling rates) */
+    for(t=0; t<nTests; t++){
+        fs_in = fs_in_list[t];
+        fs_out = fs_out_list[t];
+        nFrames = 40;
+
+        /* Resample test tones block-wise */
+        saf_resampler_create(&hRes, nCH, fs_in, fs_out, blockSize);
+        maxNout = saf_resampler_getMaxNsamplesOut(hRes);
+        latency = saf_resampler_getLatency(hRes);
+        inFrame = (float**)malloc2d(nCH, blockSize, sizeof(float));
+        outFrame = (float**)malloc2d(nCH, maxNout, sizeof(float));
+        outSigs = (float**)calloc2d(nCH, nFrames*maxNout, sizeof(float));
+        totalOut = 0;
+        for(i=0; i<nFrames; i++){
+            for(ch=0; ch<nCH; ch++)
+                for(int j=0; j<blockSize; j++)
+                    inFrame[ch][j] = (float)sin(2.0*SAF_PId*(double)f[ch]*(double)(i*blockSize+j)/(double)fs_in);
+            nOut = saf_resampler_apply(hRes, inFrame, blockSize, outFrame);
+            TEST_ASSERT_TRUE(nOut<=maxNout);
+            for(ch=0; ch<nCH; ch++)
+                memcpy(&outSigs[ch][totalOut], outFrame[ch], nOut*sizeof(float));
+            totalOut += nOut;
+        }
+
+        /* The output should be time-aligned with the input, delayed only by the latency of the resampler */
+        TEST_ASSERT_TRUE(abs(totalOut - (int)((float)(nFrames*blockSize-latency)*(float)fs_out/(float)fs_in)) <= 1);
+        for(ch=0; ch<nCH; ch++)
+            for(i=2*latency; i<totalOut; i++) /* (skipping the onset) */
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, (float)sin(2.0*SAF_PId*(double)f[ch]*(double)i/(double)fs_out), outSigs[ch][i]);
+
+        /* clean-up */
+        saf_resampler_destroy(&hRes);
+        free(inFrame);
+        free(outFrame);
+        free(outSigs);
+    }
+}
+
+/** Returns the (precomputed) map values of the requested directions, for test__saf_gridSearch() */
+static void test__saf_gridSearch_eval(void* userData, const int* inds, int nInds, float* vals){
+    float* map = (float*)userData;
+    int i;
+    for(i=0; i<nInds; i++)
+        vals[i] = map[inds[i]];
+}
+
+void test__saf_gridSearch(void){
+    int i, j, nDirs, nFound, peak_inds[4], src_inds[2];
+    float src_gains[2], xyz_i[3], xyz_s[3], errSum;
+    float* grid_dirs_deg, *map_ref, *map;
+    void* hGS;
+
+    /* Config */
+    const float kappa = 40.0f;
+    nDirs = __geosphere_ico_16_0_nPoints;
+    grid_dirs_deg = (float*)__geosphere_ico_16_0_dirs_deg;
+    src_inds[0] = 1000;
+    src_inds[1] = 100;
+    src_gains[0] = 1.0f;
+    src_gains[1] = 0.6f;
+
+    /* Reference map, containing two peaks */
+    map_ref = calloc1d(nDirs, sizeof(float));
+    map = malloc1d(nDirs*sizeof(float));
+    for(i=0; i<nDirs; i++){
+        unitSph2cart(&grid_dirs_deg[i*2], 1, 1, xyz_i);
+        for(j=0; j<2; j++){
+            unitSph2cart(&grid_dirs_deg[src_inds[j]*2], 1, 1, xyz_s);
+            map_ref[i] += src_gains[j] * expf(kappa*(xyz_i[0]*xyz_s[0] + xyz_i[1]*xyz_s[1] + xyz_i[2]*xyz_s[2] - 1.0f));
+        }
+    }
+
+    /* The two peaks should be found (highest first), while evaluating only a fraction of the grid */
+    saf_gridSearch_create(&hGS, grid_dirs_deg, nDirs, nDirs/16);
+    nFound = saf_gridSearch_apply(hGS, test__saf_gridSearch_eval, (void*)map_ref, 2, map, (int*)peak_inds);
+    TEST_ASSERT_EQUAL_INT(2, nFound);
+    TEST_ASSERT_EQUAL_INT(src_inds[0], peak_inds[0]);
+    TEST_ASSERT_EQUAL_INT(src_inds[1], peak_inds[1]);
+    TEST_ASSERT_TRUE(saf_gridSearch_getNumEvaluations(hGS) < nDirs/4);
+
+    /* The map should be exact around the peaks, and interpolated reasonably elsewhere */
+    TEST_ASSERT_EQUAL_FLOAT(map_ref[src_inds[0]], map[src_inds[0]]);
+    TEST_ASSERT_EQUAL_FLOAT(map_ref[src_inds[1]], map[src_inds[1]]);
+    errSum = 0.0f;
+    for(i=0; i<nDirs; i++)
+        errSum += fabsf(map[i]-map_ref[i]);
+    TEST_ASSERT_TRUE(errSum/(float)nDirs < 0.01f);
+
+    /* Peak-only output, and asking for more peaks than there are */
+    nFound = saf_gridSearch_apply(hGS, test__saf_gridSearch_eval, (void*)map_ref, 4, NULL, (int*)peak_inds);
+    TEST_ASSERT_TRUE(nFound>=2 && nFound<=4);
+    TEST_ASSERT_EQUAL_INT(src_inds[0], peak_inds[0]);
+    TEST_ASSERT_EQUAL_INT(src_inds[1], peak_inds[1]);
+    for(i=0; i<4; i++){ /* (any remaining peaks must still be distinct grid directions) */
+        TEST_ASSERT_TRUE(peak_inds[i]>=0 && peak_inds[i]<nDirs);
+        for(j=0; j<i; j++)
+            TEST_ASSERT_TRUE(peak_inds[i]!=peak_inds[j]);
+    }
+
+    /* With only one peak in the map, the remaining peaks should be the next-highest values not already picked */
+    unitSph2cart(&grid_dirs_deg[src_inds[0]*2], 1, 1, xyz_s);
+    for(i=0; i<nDirs; i++){
+        unitSph2cart(&grid_dirs_deg[i*2], 1, 1, xyz_i);
+        map_ref[i] = expf(kappa*(xyz_i[0]*xyz_s[0] + xyz_i[1]*xyz_s[1] + xyz_i[2]*xyz_s[2] - 1.0f));
+    }
+    nFound = saf_gridSearch_apply(hGS, test__saf_gridSearch_eval, (void*)map_ref, 3, NULL, (int*)peak_inds);
+    TEST_ASSERT_EQUAL_INT(1, nFound);
+    TEST_ASSERT_EQUAL_INT(src_inds[0], peak_inds[0]);
+    memcpy(map, map_ref, nDirs*sizeof(float));
+    for(i=0; i<3; i++){
+        utility_simaxv(map, nDirs, &j);
+        TEST_ASSERT_EQUAL_FLOAT(map_ref[j], map_ref[peak_inds[i]]);
+        map[peak_inds[i]] = 0.0f; /* (the one picked, rather than j, in case of ties) */
+    }
+    TEST_ASSERT_TRUE(peak_inds[1]!=peak_inds[2]);
+
+    /* Clean-up */
+    saf_gridSearch_destroy(&hGS);
+    free(map_ref);
+    free(map);
+}
+
+void test__saf_cache(void){
+    int i;
+    unsigned long long key, key2;
+    float dirs_deg[8], data[256], loaded[256];
+    char* cacheDir;
+
+    /* Config */
+    const char* name = "test__saf_cache";
+
+    /* Use a fresh temporary directory for the cache */
+    cacheDir = saf_test_createTempDir();
+    TEST_ASSERT_NOT_NULL(cacheDir);
+
+    /* Key computed from the inputs, and the "expensive" data to cache */
+    rand_m1_1(dirs_deg, 8);
+    rand_m1_1(data, 256);
+    key = saf_cache_initKey();
+    saf_cache_hashInt(&key, 4);
+    saf_cache_hashData(&key, dirs_deg, 8*sizeof(float));
+
+    /* Cache miss, store, then cache hit */
+    TEST_ASSERT_FALSE(saf_cache_load(cacheDir, name, key, 256*sizeof(float), loaded));
+    TEST_ASSERT_TRUE(saf_cache_store(cacheDir, name, key, data, 256*sizeof(float)));
+    memset(loaded, 0, 256*sizeof(float));
+    TEST_ASSERT_TRUE(saf_cache_load(cacheDir, name, key, 256*sizeof(float), loaded));
+    for(i=0; i<256; i++)
+        TEST_ASSERT_EQUAL_FLOAT(data[i], loaded[i]);
+
+    /* Any change to the inputs must result in a different key (and therefore a cache miss) */
+    key2 = saf_cache_initKey();
+    saf_cache_hashInt(&key2, 4);
+    dirs_deg[7] += 1e-6f;
+    saf_cache_hashData(&key2, dirs_deg, 8*sizeof(float));
+    TEST_ASSERT_TRUE(key!=key2);
+    TEST_ASSERT_FALSE(saf_cache_load(cacheDir, name, key2, 256*sizeof(float), loaded));
+
+    /* Entries of an unexpected size are rejected */
+    TEST_ASSERT_FALSE(saf_cache_load(cacheDir, name, key, 128*sizeof(float), loaded));
+
+    /* Overwrite, and remove */
+    data[0] = 2.0f;
+    TEST_ASSERT_TRUE(saf_cache_store(cacheDir, name, key, data, 256*sizeof(float)));
+    TEST_ASSERT_TRUE(saf_cache_load(cacheDir, name, key, 256*sizeof(float), loaded));
+    TEST_ASSERT_EQUAL_FLOAT(2.0f, loaded[0]);
+    TEST_ASSERT_TRUE(saf_cache_remove(cacheDir, name, key));
+    TEST_ASSERT_FALSE(saf_cache_load(cacheDir, name, key, 256*sizeof(float), loaded));
+
+    /* The cache is disabled if no directory is given */
+    TEST_ASSERT_FALSE(saf_cache_store(NULL, name, key, data, 256*sizeof(float)));
+    TEST_ASSERT_FALSE(saf_cache_load(NULL, name, key, 256*sizeof(float), loaded));
+
+    /* Nothing should be left behind (including any temporary files) */
+    TEST_ASSERT_EQUAL_INT(0, saf_test_removeTempDir(&cacheDir));
+}
+
+void test__veclib_simdDispatch(void){
+    float *a, *b, *c, *ref;
+    float s;
+    int i, isa;
+    SAF_SIMD_INSTRUCTION_SET defaultISA;
+
+    /* Config */
+    const float acceptedTolerance = 0.00001f;
+    const int len = 1003; /* (odd, to also exercise the residual loops) */
+
+    /* Prep */
+    a = malloc1d(2*len*sizeof(float));
+    b = malloc1d(2*len*sizeof(float));
+    c = malloc1d(2*len*sizeof(float));
+    ref = malloc1d(2*len*sizeof(float));
+    rand_m1_1(a, 2*len);
+    rand_m1_1(b, 2*len);
+    for(i=0; i<2*len; i++)
+        a[i] += a[i]>=0.0f ? 0.5f : -0.5f; /* (keep away from zero for the reciprocal) */
+    s = 0.3f;
+    defaultISA = utility_getSIMDinstructionSet();
+    TEST_ASSERT_TRUE(defaultISA <= utility_getSIMDsupport());
+
+    /* Compare each supported instruction set against reference implementations */
+    for(isa=(int)SAF_SIMD_NONE; isa<=(int)utility_getSIMDsupport(); isa++){
+        utility_setSIMDinstructionSet((SAF_SIMD_INSTRUCTION_SET)isa);
+#ifdef SAF_ENABLE_SIMD_RUNTIME_DISPATCH
+        TEST_ASSERT_TRUE(utility_getSIMDinstructionSet() == (SAF_SIMD_INSTRUCTION_SET)isa);
+#endif
+        utility_svvadd(a, b, len, c);
+        for(i=0; i<len; i++)
+            TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, a[i] + b[i], c[i]);
+        utility_svvsub(a, b, len, c);
+        for(i=0; i<len; i++)
+            TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, a[i] - b[i], c[i]);
+        utility_svvmul(a, b, len, c);
+        for(i=0; i<len; i++)
+            TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, a[i] * b[i], c[i]);
+        utility_svsadd(a, &s, len, c);
+        for(i=0; i<len; i++)
+            TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, a[i] + s, c[i]);
+        utility_svssub(a, &s, len, c);
+        for(i=0; i<len; i++)
+            TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, a[i] - s, c[i]);
+        utility_svrecip(a, len, c);
+        for(i=0; i<len; i++) /* (approximate reciprocal instructions, so relative tolerance) */
+            TEST_ASSERT_FLOAT_WITHIN(0.001f*fabsf(1.0f/a[i]), 1.0f/a[i], c[i]);
+        utility_cvvadd((float_complex*)a, (float_complex*)b, len, (float_complex*)c);
+        for(i=0; i<2*len; i++)
+            TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, a[i] + b[i], c[i]);
+        utility_cvvsub((float_complex*)a, (float_complex*)b, len, (float_complex*)c);
+        for(i=0; i<2*len; i++)
+            TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, a[i] - b[i], c[i]);
+        utility_cvvmul((float_complex*)a, (float_complex*)b, len, (float_complex*)c);
+        for(i=0; i<len; i++){
+            ref[2*i]   = a[2*i] * b[2*i]   - a[2*i+1] * b[2*i+1];
+            ref[2*i+1] = a[2*i] * b[2*i+1] + a[2*i+1] * b[2*i];
+        }
+        for(i=0; i<2*len; i++)
+            TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, ref[i], c[i]);
+    }
+
+    /* clean-up */
+    utility_setSIMDinstructionSet(defaultISA);
+    free(a);
+    free(b);
+    free(c);
+    free(ref);
+}
+
+void test__veclib_cvvmul(void){
+    float *a, *b, *c, *ref, *a_re, *a_im, *b_re, *b_im, *c_re, *c_im;
+    int i, isa, trial;
+    SAF_SIMD_INSTRUCTION_SET defaultISA;
+
+    /* Config */
+    const float acceptedTolerance = 0.00001f;
+    const int lens[4] = {1, 7, 129, 1031}; /* (to also exercise the residual loops) */
+
+    defaultISA = utility_getSIMDinstructionSet();
+    for(trial=0; trial<4; trial++){
+        /* Prep */
+        a = malloc1d(2*lens[trial]*sizeof(float));
+        b = malloc1d(2*lens[trial]*sizeof(float));
+        c = malloc1d(2*lens[trial]*sizeof(float));
+        ref = malloc1d(2*lens[trial]*sizeof(float));
+        a_re = malloc1d(lens[trial]*sizeof(float));
+        a_im = malloc1d(lens[trial]*sizeof(float));
+        b_re = malloc1d(lens[trial]*sizeof(float));
+        b_im = malloc1d(lens[trial]*sizeof(float));
+        c_re = malloc1d(lens[trial]*sizeof(float));
+        c_im = malloc1d(lens[trial]*sizeof(float));
+        rand_m1_1(a, 2*lens[trial]);
+        rand_m1_1(b, 2*lens[trial]);
+        cblas_scopy(lens[trial], a,   2, a_re, 1);
+        cblas_scopy(lens[trial], a+1, 2, a_im, 1);
+        cblas_scopy(lens[trial], b,   2, b_re, 1);
+        cblas_scopy(lens[trial], b+1, 2, b_im, 1);
+        for(i=0; i<lens[trial]; i++){
+            ref[2*i]   = a[2*i] * b[2*i]   - a[2*i+1] * b[2*i+1];
+            ref[2*i+1] = a[2*i] * b[2*i+1] + a[2*i+1] * b[2*i];
+        }
+
+        /* Compare each supported instruction set against the reference */
+        for(isa=(int)SAF_SIMD_NONE; isa<=(int)utility_getSIMDsupport(); isa++){
+            utility_setSIMDinstructionSet((SAF_SIMD_INSTRUCTION_SET)isa);
+
+            /* Interleaved */
+            utility_cvvmul((float_complex*)a, (float_complex*)b, lens[trial], (float_complex*)c);
+            for(i=0; i<2*lens[trial]; i++)
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, ref[i], c[i]);
+
+            /* Split */
+            utility_cvvmul_split(a_re, a_im, b_re, b_im, lens[trial], c_re, c_im);
+            for(i=0; i<lens[trial]; i++){
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, ref[2*i], c_re[i]);
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, ref[2*i+1], c_im[i]);
+            }
+
+            /* Split multiply-accumulate (c = a.*b + a.*b) */
+            utility_cvvmuladd_split(a_re, a_im, b_re, b_im, lens[trial], c_re, c_im);
+            for(i=0; i<lens[trial]; i++){
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, 2.0f*ref[2*i], c_re[i]);
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, 2.0f*ref[2*i+1], c_im[i]);
+            }
+        }
+
+        /* clean-up */
+        free(a);
+        free(b);
+        free(c);
+        free(ref);
+        free(a_re);
+        free(a_im);
+        free(b_re);
+        free(b_im);
+        free(c_re);
+        free(c_im);
+    }
+    utility_setSIMDinstructionSet(defaultISA);
+}
+
+void test__veclib_cvvmuladd(void){
+    float_complex *a, *b, *c, *ref;
+    int i, n, isa, trial;
+    SAF_SIMD_INSTRUCTION_SET defaultISA;
+
+    /* Config */
+    const float acceptedTolerance = 0.0001f;
+    const int nBatch = 6;
+    const int lens[3] = {1, 7, 257}; /* (to also exercise the residual loops) */
+
+    defaultISA = utility_getSIMDinstructionSet();
+    for(trial=0; trial<3; trial++){
+        /* Prep (the vectors are spaced further apart than their length, to test the strides) */
+        a = malloc1d(nBatch*(lens[trial]+3)*sizeof(float_complex));
+        b = malloc1d(nBatch*(lens[trial]+5)*sizeof(float_complex));
+        c = malloc1d(lens[trial]*sizeof(float_complex));
+        ref = malloc1d(lens[trial]*sizeof(float_complex));
+        rand_m1_1((float*)a, 2*nBatch*(lens[trial]+3));
+        rand_m1_1((float*)b, 2*nBatch*(lens[trial]+5));
+        rand_m1_1((float*)ref, 2*lens[trial]);
+
+        for(isa=(int)SAF_SIMD_NONE; isa<=(int)utility_getSIMDsupport(); isa++){
+            utility_setSIMDinstructionSet((SAF_SIMD_INSTRUCTION_SET)isa);
+
+            /* Single */
+            cblas_ccopy(lens[trial], ref, 1, c, 1);
+            utility_cvvmuladd(a, b, lens[trial], c);
+            for(i=0; i<lens[trial]; i++){
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, crealf(ref[i]) + crealf(a[i])*crealf(b[i]) - cimagf(a[i])*cimagf(b[i]), crealf(c[i]));
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, cimagf(ref[i]) + crealf(a[i])*cimagf(b[i]) + cimagf(a[i])*crealf(b[i]), cimagf(c[i]));
+            }
+
+            /* Batched (strided) */
+            cblas_ccopy(lens[trial], ref, 1, c, 1);
+            utility_cvvmuladd_batch(a, lens[trial]+3, b, lens[trial]+5, lens[trial], nBatch, c);
+            for(i=0; i<lens[trial]; i++){
+                float re, im;
+                re = crealf(ref[i]);
+                im = cimagf(ref[i]);
+                for(n=0; n<nBatch; n++){
+                    float_complex an = a[n*(lens[trial]+3)+i], bn = b[n*(lens[trial]+5)+i];
+                    re += crealf(an)*crealf(bn) - cimagf(an)*cimagf(bn);
+                    im += crealf(an)*cimagf(bn) + cimagf(an)*crealf(bn);
+                }
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, re, crealf(c[i]));
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, im, cimagf(c[i]));
+            }
+        }
+
+        /* clean-up */
+        free(a);
+        free(b);
+        free(c);
+        free(ref);
+    }
+    utility_setSIMDinstructionSet(defaultISA);
+}
+
+/** Job used by test__saf_threadPool(): counts the number of times each job was carried out */
+static void test__saf_threadPool_job(void* userData, int jobIdx, int threadIdx){
+    int* counts = (int*)userData;
+    saf_assert(threadIdx>=0 && threadIdx<4, "Unexpected thread index");
+    counts[jobIdx]++; /* (each job is carried out by one thread only, so no lock is needed) */
+}
+
+void test__saf_threadPool(void){
+    void* hPool, *hPoolShared;
+    int i, run, nThreads;
+    int* counts;
+
+    /* Config */
+    const int nJobs = 1000;
+    const int nRuns = 50;
+
+    counts = calloc1d(nJobs, sizeof(int));
+    for(nThreads=1; nThreads<=4; nThreads+=3){
+        saf_threadPool_create(&hPool, nThreads);
+        TEST_ASSERT_TRUE(saf_threadPool_getNumThreads(hPool)==nThreads);
+        for(run=0; run<nRuns; run++)
+            saf_threadPool_run(hPool, run==0 ? 1 : nJobs, test__saf_threadPool_job, (void*)counts);
+        saf_threadPool_destroy(&hPool);
+        TEST_ASSERT_TRUE(hPool==NULL);
+        TEST_ASSERT_TRUE(counts[0]==nRuns);
+        for(i=1; i<nJobs; i++)
+            TEST_ASSERT_TRUE(counts[i]==nRuns-1);
+        memset(counts, 0, nJobs*sizeof(int));
+    }
+
+    /* A shared pool should remain usable until every reference has been released */
+    saf_threadPool_create(&hPool, 4);
+    hPoolShared = hPool;
+    saf_threadPool_retain(hPoolShared);
+    saf_threadPool_destroy(&hPool);
+    TEST_ASSERT_TRUE(hPool==NULL);
+    TEST_ASSERT_TRUE(saf_threadPool_getNumThreads(hPoolShared)==4);
+    saf_threadPool_run(hPoolShared, nJobs, test__saf_threadPool_job, (void*)counts);
+    saf_threadPool_destroy(&hPoolShared);
+    TEST_ASSERT_TRUE(hPoolShared==NULL);
+    for(i=0; i<nJobs; i++)
+        TEST_ASSERT_TRUE(counts[i]==1);
+    memset(counts, 0, nJobs*sizeof(int));
+
+    /* No pool; jobs are carried out by the calling thread */
+    saf_threadPool_run(NULL, nJobs, test__saf_threadPool_job, (void*)counts);
+    for(i=0; i<nJobs; i++)
+        TEST_ASSERT_TRUE(counts[i]==1);
+    free(counts);
+}
+
+void test__utility_cseig_batch(void){
+    void* hPool, *hWork;
+    int i, j, b, trial, dim, useThreads;
+    float_complex* X, *A, *V, *D, *V_ref, *AV, *VD;
+    float* eig, *eig_ref;
+    const float_complex calpha = cmplxf(1.0f, 0.0f), cbeta = cmplxf(0.0f, 0.0f);
+
+    /* Config */
+    const float acceptedTolerance = 0.0005f;
+    const int nBatch = 37; /* (not a multiple of the Jacobi group size) */
+    const int dims[3] = {4, 9, 30}; /* (the last is passed on to LAPACK) */
+
+    saf_threadPool_create(&hPool, 3);
+    for(trial=0; trial<3; trial++){
+        dim = dims[trial];
+        X = malloc1d(nBatch*dim*dim*sizeof(float_complex));
+        A = malloc1d(nBatch*dim*dim*sizeof(float_complex));
+        V = malloc1d(nBatch*dim*dim*sizeof(float_complex));
+        D = malloc1d(nBatch*dim*dim*sizeof(float_complex));
+        V_ref = malloc1d(dim*dim*sizeof(float_complex));
+        AV = malloc1d(dim*dim*sizeof(float_complex));
+        VD = malloc1d(dim*dim*sizeof(float_complex));
+        eig = malloc1d(nBatch*dim*sizeof(float));
+        eig_ref = malloc1d(dim*sizeof(float));
+
+        /* Random Hermitian (covariance-like) matrices, normalised by dim */
+        rand_m1_1((float*)X, 2*nBatch*dim*dim);
+        for(b=0; b<nBatch; b++){
+            cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, dim, dim, dim, &calpha,
+                        &X[b*dim*dim], dim, &X[b*dim*dim], dim, &cbeta, &A[b*dim*dim], dim);
+            cblas_sscal(2*dim*dim, 1.0f/(float)dim, (float*)&A[b*dim*dim], 1);
+        }
+
+        for(useThreads=0; useThreads<2; useThreads++){
+            if(useThreads){
+                utility_cseig_batch_create(&hWork, dim, hPool);
+                utility_cseig_batch(hWork, A, dim, nBatch, 1, V, D, eig);
+                utility_cseig_batch_destroy(&hWork);
+            }
+            else
+                utility_cseig_batch(NULL, A, dim, nBatch, 1, V, D, eig);
+
+            for(b=0; b<nBatch; b++){
+                /* Eigenvalues should match those of LAPACK */
+                utility_cseig(NULL, &A[b*dim*dim], dim, 1, V_ref, NULL, eig_ref);
+                for(i=0; i<dim; i++){
+                    TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, eig_ref[i], eig[b*dim+i]);
+                    TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, eig_ref[i], crealf(D[b*dim*dim+i*dim+i]));
+                }
+
+                /* A*V = V*D */
+                cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, dim, dim, dim, &calpha,
+                            &A[b*dim*dim], dim, &V[b*dim*dim], dim, &cbeta, AV, dim);
+                cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, dim, dim, dim, &calpha,
+                            &V[b*dim*dim], dim, &D[b*dim*dim], dim, &cbeta, VD, dim);
+                for(i=0; i<dim*dim; i++){
+                    TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, crealf(AV[i]), crealf(VD[i]));
+                    TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, cimagf(AV[i]), cimagf(VD[i]));
+                }
+
+                /* V^H*V = I */
+                cblas_cgemm(CblasRowMajor, CblasConjTrans, CblasNoTrans, dim, dim, dim, &calpha,
+                            &V[b*dim*dim], dim, &V[b*dim*dim], dim, &cbeta, AV, dim);
+                for(i=0; i<dim; i++){
+                    for(j=0; j<dim; j++){
+                        TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, i==j ? 1.0f : 0.0f, crealf(AV[i*dim+j]));
+                        TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, 0.0f, cimagf(AV[i*dim+j]));
+                    }
+                }
+            }
+        }
+
+        /* clean-up */
+        free(X);
+        free(A);
+        free(V);
+        free(D);
+        free(V_ref);
+        free(AV);
+        free(VD);
+        free(eig);
+        free(eig_ref);
+    }
+    saf_threadPool_destroy(&hPool);
+}
+
+void test__utility_csvd_batch(void){
+    void* hPool, *hWork;
+    int i, j, b, trial, dim1, dim2, useThreads;
+    float_complex* A, *U, *S, *V, *US, *USVH;
+    float* sing, *sing_ref;
+    const float_complex calpha = cmplxf(1.0f, 0.0f), cbeta = cmplxf(0.0f, 0.0f);
+
+    /* Config */
+    const float acceptedTolerance = 0.0005f;
+    const int nBatch = 21;
+    const int dims1[4] = {4, 6, 3, 30};
+    const int dims2[4] = {4, 3, 7, 5}; /* (square, tall, wide, and one passed on to LAPACK) */
+
+    saf_threadPool_create(&hPool, 2);
+    for(trial=0; trial<4; trial++){
+        dim1 = dims1[trial];
+        dim2 = dims2[trial];
+        A = malloc1d(nBatch*dim1*dim2*sizeof(float_complex));
+        U = malloc1d(nBatch*dim1*dim1*sizeof(float_complex));
+        S = malloc1d(nBatch*dim1*dim2*sizeof(float_complex));
+        V = malloc1d(nBatch*dim2*dim2*sizeof(float_complex));
+        US = malloc1d(dim1*dim2*sizeof(float_complex));
+        USVH = malloc1d(SAF_MAX(dim1,dim2)*SAF_MAX(dim1,dim2)*sizeof(float_complex));
+        sing = malloc1d(nBatch*SAF_MIN(dim1, dim2)*sizeof(float));
+        sing_ref = malloc1d(SAF_MIN(dim1, dim2)*sizeof(float));
+        rand_m1_1((float*)A, 2*nBatch*dim1*dim2);
+        /* (also include a rank-deficient matrix) */
+        memset(&A[0], 0, dim1*dim2*sizeof(float_complex));
+        A[0] = cmplxf(0.5f, -0.5f);
+
+        for(useThreads=0; useThreads<2; useThreads++){
+            if(useThreads){
+                utility_csvd_batch_create(&hWork, dim1, dim2, hPool);
+                utility_csvd_batch(hWork, A, dim1, dim2, nBatch, U, S, V, sing);
+                utility_csvd_batch_destroy(&hWork);
+            }
+            else
+                utility_csvd_batch(NULL, A, dim1, dim2, nBatch, U, S, V, sing);
+
+            for(b=0; b<nBatch; b++){
+                /* Singular values should match those of LAPACK */
+                utility_csvd(NULL, &A[b*dim1*dim2], dim1, dim2, NULL, NULL, NULL, sing_ref);
+                for(i=0; i<SAF_MIN(dim1, dim2); i++)
+                    TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, sing_ref[i], sing[b*SAF_MIN(dim1, dim2)+i]);
+
+                /* A = U*S*V^H */
+                cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, dim1, dim2, dim1, &calpha,
+                            &U[b*dim1*dim1], dim1, &S[b*dim1*dim2], dim2, &cbeta, US, dim2);
+                cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, dim1, dim2, dim2, &calpha,
+                            US, dim2, &V[b*dim2*dim2], dim2, &cbeta, USVH, dim2);
+                for(i=0; i<dim1*dim2; i++){
+                    TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, crealf(A[b*dim1*dim2+i]), crealf(USVH[i]));
+                    TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, cimagf(A[b*dim1*dim2+i]), cimagf(USVH[i]));
+                }
+
+                /* U and V should be unitary */
+                cblas_cgemm(CblasRowMajor, CblasConjTrans, CblasNoTrans, dim1, dim1, dim1, &calpha,
+                            &U[b*dim1*dim1], dim1, &U[b*dim1*dim1], dim1, &cbeta, USVH, dim1);
+                for(i=0; i<dim1; i++)
+                    for(j=0; j<dim1; j++)
+                        TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, i==j ? 1.0f : 0.0f, cabsf(USVH[i*dim1+j]));
+                cblas_cgemm(CblasRowMajor, CblasConjTrans, CblasNoTrans, dim2, dim2, dim2, &calpha,
+                            &V[b*dim2*dim2], dim2, &V[b*dim2*dim2], dim2, &cbeta, USVH, dim2);
+                for(i=0; i<dim2; i++)
+                    for(j=0; j<dim2; j++)
+                        TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, i==j ? 1.0f : 0.0f, cabsf(USVH[i*dim2+j]));
+            }
+        }
+
+        /* clean-up */
+        free(A);
+        free(U);
+        free(S);
+        free(V);
+        free(US);
+        free(USVH);
+        free(sing);
+        free(sing_ref);
+    }
+    saf_threadPool_destroy(&hPool);
+}
+
+void test__utility_ccovtrk(void){
+    void* hCov;
+    int i, band, frame, dim;
+    float_complex* X, *C_new, *C_new_ref, *C, *C_ref;
+    const float_complex calpha = cmplxf(1.0f, 0.0f), cbeta = cmplxf(0.0f, 0.0f);
+
+    /* Config */
+    const float acceptedTolerance = 0.00001f;
+    const int maxDim = 16;
+    const int nBands = 5;
+    const int nSamples = 8;
+    const int nFrames = 6;
+    const float avgCoeff = 0.7f;
+
+    X = malloc1d(maxDim*nSamples*sizeof(float_complex));
+    C_new = malloc1d(maxDim*maxDim*sizeof(float_complex));
+    C_new_ref = malloc1d(maxDim*maxDim*sizeof(float_complex));
+    C = malloc1d(maxDim*maxDim*sizeof(float_complex));
+    C_ref = calloc1d(nBands*maxDim*maxDim, sizeof(float_complex));
+    utility_ccovtrk_create(&hCov, maxDim, nBands);
+
+    /* Compare with the full cgemm, sscal, saxpy version. Note that the dimension also changes part way through */
+    for(frame=0; frame<nFrames; frame++){
+        dim = frame<nFrames/2 ? maxDim : 9;
+        if(frame==nFrames/2)
+            memset(C_ref, 0, nBands*maxDim*maxDim*sizeof(float_complex));
+        for(band=0; band<nBands; band++){
+            rand_m1_1((float*)X, 2*dim*nSamples);
+            utility_ccovtrk_update(hCov, band, X, dim, nSamples, avgCoeff, C_new);
+            cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasConjTrans, dim, dim, nSamples, &calpha,
+                        X, nSamples, X, nSamples, &cbeta, C_new_ref, dim);
+            cblas_sscal(/*re+im*/2*dim*dim, avgCoeff, (float*)&C_ref[band*maxDim*maxDim], 1);
+            cblas_saxpy(/*re+im*/2*dim*dim, 1.0f-avgCoeff, (float*)C_new_ref, 1, (float*)&C_ref[band*maxDim*maxDim], 1);
+
+            utility_ccovtrk_get(hCov, band, dim, C);
+            for(i=0; i<dim*dim; i++){
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, crealf(C_new_ref[i]), crealf(C_new[i]));
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, cimagf(C_new_ref[i]), cimagf(C_new[i]));
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, crealf(C_ref[band*maxDim*maxDim+i]), crealf(C[i]));
+                TEST_ASSERT_FLOAT_WITHIN(acceptedTolerance, cimagf(C_ref[band*maxDim*maxDim+i]), cimagf(C[i]));
+            }
+        }
+    }
+
+    /* Should be zeros after a reset */
+    utility_ccovtrk_reset(hCov);
+    utility_ccovtrk_get(hCov, 0, maxDim, C);
+    for(i=0; i<maxDim*maxDim; i++)
+        TEST_ASSERT_TRUE(crealf(C[i])==0.0f && cimagf(C[i])==0.0f);
+
+    /* clean-up */
+    utility_ccovtrk_destroy(&hCov);
+    free(X);
+    free(C_new);
+    free(C_new_ref);
+    free(C);
+    free(C_ref);
+}
+
 void test__sortf(void){
     float* values;
     int* sortedIdx;
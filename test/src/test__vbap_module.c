@@ -23,3 +23,143 @@
  */
 
 #include "saf_test.h"
+
+void test__vbapRenderer(void){
+    int i, j, k, L, nPoints, nTriangles, nTable, nRepeat;
+    float spread;
+    float* src_dirs_deg, *gtable, *gains, *gains_cached;
+    void* hVbap;
+    const int nSrcs = 2000;
+    const float spreads[2] = {0.0f, 30.0f};
+
+    /* Config */
+    L = 22;
+    src_dirs_deg = malloc1d(nSrcs*2*sizeof(float));
+    rand_m1_1(src_dirs_deg, nSrcs*2);
+    for(i=0; i<nSrcs; i++){
+        src_dirs_deg[i*2+0] *= 180.0f;
+        src_dirs_deg[i*2+1] *= 90.0f;
+    }
+    /* include some directions on the look-up grid cell boundaries and at the poles */
+    src_dirs_deg[0] = 0.0f;    src_dirs_deg[1] = 90.0f;
+    src_dirs_deg[2] = 180.0f;  src_dirs_deg[3] = -90.0f;
+    src_dirs_deg[4] = -180.0f; src_dirs_deg[5] = 0.0f;
+    src_dirs_deg[6] = 30.0f;   src_dirs_deg[7] = 40.0f;
+    gains = malloc1d(L*sizeof(float));
+    gains_cached = malloc1d(L*sizeof(float));
+
+    /* The gains should be the same as those computed (for all directions at once) by the gain table function */
+    for(k=0; k<2; k++){
+        spread = spreads[k];
+        /* (the convex hull adds a little random noise to the loudspeaker directions, so seed it the same for both) */
+        gtable = NULL;
+        srand(1);
+        generateVBAPgainTable3D_srcs(src_dirs_deg, nSrcs, (float*)__22pX_dirs_deg, L, 0, 1, spread, &gtable, &nTable, &nTriangles);
+        srand(1);
+        vbapRenderer_create(&hVbap, (float*)__22pX_dirs_deg, L, 0, 1, spread, 16);
+        TEST_ASSERT_TRUE(vbapRenderer_getNumTriangles(hVbap)==nTriangles);
+        nPoints = nTable;
+        for(i=0; i<nPoints; i++){
+            vbapRenderer_getGains(hVbap, src_dirs_deg[i*2+0], src_dirs_deg[i*2+1], gains);
+            for(j=0; j<L; j++)
+                TEST_ASSERT_FLOAT_WITHIN(1e-6f, gtable[i*L+j], gains[j]);
+
+            /* Querying the last few directions again should give the same gains (from the cache) */
+            for(nRepeat=0; nRepeat<3 && nRepeat<=i; nRepeat++){
+                vbapRenderer_getGains(hVbap, src_dirs_deg[(i-nRepeat)*2+0], src_dirs_deg[(i-nRepeat)*2+1], gains_cached);
+                for(j=0; j<L; j++)
+                    TEST_ASSERT_TRUE(gains_cached[j]==gtable[(i-nRepeat)*L+j]);
+            }
+        }
+        vbapRenderer_destroy(&hVbap);
+        free(gtable);
+    }
+
+    /* clean-up */
+    free(src_dirs_deg);
+    free(gains);
+    free(gains_cached);
+}
+
+void test__vbapRenderer_tracked(void){
+    int i, j, n, L, tri;
+    float azi, elev, energy;
+    float* gains, *gains_ref, *rand_dirs;
+    void* hVbap;
+    const int nSteps = 5000;
+
+    /* Config */
+    L = 64;
+    gains = malloc1d(L*sizeof(float));
+    gains_ref = malloc1d(L*sizeof(float));
+    rand_dirs = malloc1d(100*2*sizeof(float));
+    rand_m1_1(rand_dirs, 100*2);
+    vbapRenderer_create(&hVbap, (float*)__DTU_AVIL_dirs_deg, L, 1, 1, 0.0f, 0);
+
+    /* A source moving slowly over the whole sphere, with occasional jumps to random directions */
+    tri = -1;
+    for(n=0; n<nSteps; n++){
+        if(n%50==0){
+            azi = rand_dirs[(n/50)*2+0]*180.0f;
+            elev = rand_dirs[(n/50)*2+1]*90.0f;
+        }
+        else{
+            azi = -180.0f + 7.0f*360.0f*(float)n/(float)nSteps;
+            elev = 85.0f*sinf(2.0f*SAF_PI*3.0f*(float)n/(float)nSteps);
+        }
+        vbapRenderer_getGainsTracked(hVbap, azi, elev, &tri, gains);
+        vbapRenderer_getGains(hVbap, azi, elev, gains_ref);
+
+        /* The enclosing triangle may only differ if the direction is (within tolerance) on a shared edge, where
+         * the gains are (almost) the same */
+        TEST_ASSERT_TRUE(tri>=0);
+        energy = 0.0f;
+        for(j=0; j<L; j++){
+            TEST_ASSERT_FLOAT_WITHIN(2e-3f, gains_ref[j], gains[j]);
+            energy += gains[j]*gains[j];
+        }
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, 1.0f, energy);
+    }
+
+    /* Any starting triangle should do */
+    for(i=0; i<vbapRenderer_getNumTriangles(hVbap); i++){
+        tri = i;
+        vbapRenderer_getGainsTracked(hVbap, 10.0f, -20.0f, &tri, gains);
+        vbapRenderer_getGains(hVbap, 10.0f, -20.0f, gains_ref);
+        for(j=0; j<L; j++)
+            TEST_ASSERT_FLOAT_WITHIN(2e-3f, gains_ref[j], gains[j]);
+    }
+
+    /* clean-up */
+    vbapRenderer_destroy(&hVbap);
+    free(gains);
+    free(gains_ref);
+    free(rand_dirs);
+}
+
+void test__generateVBAPgainTable3D_threaded(void){
+    int i, k, nTable, nTable_ref, nTriangles, nTriangles_ref;
+    float spread;
+    float* gtable, *gtable_ref;
+    void* hPool;
+    const float spreads[2] = {0.0f, 20.0f};
+
+    /* The gains should not depend on the number of threads */
+    saf_threadPool_create(&hPool, 4);
+    for(k=0; k<2; k++){
+        spread = spreads[k];
+        gtable = gtable_ref = NULL;
+        srand(1); /* (the convex hull adds a little random noise to the loudspeaker directions) */
+        generateVBAPgainTable3D((float*)__9_10_3p2_dirs_deg, 24, 4, 4, 1, 1, spread, &gtable_ref, &nTable_ref, &nTriangles_ref);
+        srand(1);
+        generateVBAPgainTable3D_threaded((float*)__9_10_3p2_dirs_deg, 24, 4, 4, 1, 1, spread, hPool, &gtable, &nTable, &nTriangles);
+        TEST_ASSERT_TRUE(nTable==nTable_ref && nTriangles==nTriangles_ref);
+        for(i=0; i<nTable*24; i++)
+            TEST_ASSERT_TRUE(gtable[i]==gtable_ref[i]);
+        free(gtable);
+        free(gtable_ref);
+    }
+
+    /* clean-up */
+    saf_threadPool_destroy(&hPool);
+}